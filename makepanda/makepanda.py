@@ -4222,6 +4222,8 @@ if (not RUNTIME and (GetTarget() in ('windows', 'darwin') or PkgSkip("X11")==0)
   TargetAdd('p3tinydisplay_ztriangle_2.obj', opts=OPTS, input='ztriangle_2.cxx')
   TargetAdd('p3tinydisplay_ztriangle_3.obj', opts=OPTS, input='ztriangle_3.cxx')
   TargetAdd('p3tinydisplay_ztriangle_4.obj', opts=OPTS, input='ztriangle_4.cxx')
+  TargetAdd('p3tinydisplay_ztriangle_sse2.obj', opts=OPTS, input='ztriangle_sse2.cxx')
+  TargetAdd('p3tinydisplay_ztriangle_avx2.obj', opts=OPTS, input='ztriangle_avx2.cxx')
   TargetAdd('p3tinydisplay_ztriangle_table.obj', opts=OPTS, input='ztriangle_table.cxx')
   if GetTarget() == 'darwin':
     TargetAdd('p3tinydisplay_tinyOsxGraphicsWindow.obj', opts=OPTS, input='tinyOsxGraphicsWindow.mm')
@@ -4239,6 +4241,8 @@ if (not RUNTIME and (GetTarget() in ('windows', 'darwin') or PkgSkip("X11")==0)
   TargetAdd('libp3tinydisplay.dll', input='p3tinydisplay_ztriangle_2.obj')
   TargetAdd('libp3tinydisplay.dll', input='p3tinydisplay_ztriangle_3.obj')
   TargetAdd('libp3tinydisplay.dll', input='p3tinydisplay_ztriangle_4.obj')
+  TargetAdd('libp3tinydisplay.dll', input='p3tinydisplay_ztriangle_sse2.obj')
+  TargetAdd('libp3tinydisplay.dll', input='p3tinydisplay_ztriangle_avx2.obj')
   TargetAdd('libp3tinydisplay.dll', input='p3tinydisplay_ztriangle_table.obj')
   TargetAdd('libp3tinydisplay.dll', input=COMMON_PANDA_LIBS)
 
@@ -15,6 +15,7 @@
     animChannelBase.h \
     animChannelMatrixDynamic.I animChannelMatrixDynamic.h \
     animChannelMatrixFixed.I animChannelMatrixFixed.h \
+    animChannelMatrixQuantized.I animChannelMatrixQuantized.h \
     animChannelMatrixXfmTable.I animChannelMatrixXfmTable.h \
     animChannelScalarDynamic.I animChannelScalarDynamic.h \
     animChannelScalarTable.I animChannelScalarTable.h \
@@ -42,6 +43,7 @@
     animChannelBase.cxx \
     animChannelMatrixDynamic.cxx  \
     animChannelMatrixFixed.cxx  \
+    animChannelMatrixQuantized.cxx  \
     animChannelMatrixXfmTable.cxx  \
     animChannelScalarDynamic.cxx \
     animChannelScalarTable.cxx \
@@ -65,6 +67,7 @@
     animChannelFixed.I animChannelFixed.h \
     animChannelMatrixDynamic.I animChannelMatrixDynamic.h \
     animChannelMatrixFixed.I animChannelMatrixFixed.h \
+    animChannelMatrixQuantized.I animChannelMatrixQuantized.h \
     animChannelMatrixXfmTable.I animChannelMatrixXfmTable.h \
     animChannelScalarDynamic.I animChannelScalarDynamic.h \
     animChannelScalarTable.I animChannelScalarTable.h \
@@ -88,3 +91,13 @@
 
 #end lib_target
 
+
+#begin test_bin_target
+  #define TARGET test_chan_quantized
+  #define LOCAL_LIBS \
+    p3chan p3pgraph p3putil p3linmath p3mathutil p3event
+
+  #define SOURCES \
+    test_chan_quantized.cxx
+
+#end test_bin_target
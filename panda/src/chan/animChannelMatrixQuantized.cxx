@@ -0,0 +1,745 @@
+// Filename: animChannelMatrixQuantized.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "animChannelMatrixQuantized.h"
+#include "animBundle.h"
+#include "config_chan.h"
+
+#include "compose_matrix.h"
+#include "indent.h"
+#include "datagram.h"
+#include "datagramIterator.h"
+#include "bamReader.h"
+#include "bamWriter.h"
+#include "config_linmath.h"
+
+#include <math.h>
+
+TypeHandle AnimChannelMatrixQuantized::_type_handle;
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Constructor
+//       Access: Protected
+//  Description: Used only for bam loader.
+////////////////////////////////////////////////////////////////////
+AnimChannelMatrixQuantized::
+AnimChannelMatrixQuantized() {
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Copy Constructor
+//       Access: Protected
+//  Description: Creates a new AnimChannelMatrixQuantized, just like
+//               this one, without copying any children.  The new
+//               copy is added to the indicated parent.  Intended to
+//               be called by make_copy() only.
+////////////////////////////////////////////////////////////////////
+AnimChannelMatrixQuantized::
+AnimChannelMatrixQuantized(AnimGroup *parent, const AnimChannelMatrixQuantized &copy) :
+  AnimChannelMatrix(parent, copy)
+{
+  for (int i = 0; i < num_matrix_components; i++) {
+    _components[i] = copy._components[i];
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Constructor
+//       Access: Published
+//  Description:
+////////////////////////////////////////////////////////////////////
+AnimChannelMatrixQuantized::
+AnimChannelMatrixQuantized(AnimGroup *parent, const string &name) :
+  AnimChannelMatrix(parent, name)
+{
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Destructor
+//       Access: Published, Virtual
+//  Description:
+////////////////////////////////////////////////////////////////////
+AnimChannelMatrixQuantized::
+~AnimChannelMatrixQuantized() {
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::has_changed
+//       Access: Public, Virtual
+//  Description: Returns true if the value has changed since the last
+//               call to has_changed().  last_frame is the frame
+//               number of the last call; this_frame is the current
+//               frame number.
+////////////////////////////////////////////////////////////////////
+bool AnimChannelMatrixQuantized::
+has_changed(int last_frame, double last_frac,
+            int this_frame, double this_frac) {
+  if (last_frame != this_frame) {
+    for (int i = 0; i < num_matrix_components; i++) {
+      const Component &comp = _components[i];
+      if (!comp.is_constant()) {
+        if (comp.decode(last_frame) != comp.decode(this_frame)) {
+          return true;
+        }
+      }
+    }
+  }
+
+  if (last_frac != this_frac) {
+    // If we have some fractional changes, also check the next
+    // subsequent frame (since we'll be blending with that).
+    for (int i = 0; i < num_matrix_components; i++) {
+      const Component &comp = _components[i];
+      if (!comp.is_constant()) {
+        if (comp.decode(last_frame) != comp.decode(this_frame + 1)) {
+          return true;
+        }
+      }
+    }
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::get_value
+//       Access: Public, Virtual
+//  Description: Gets the value of the channel at the indicated frame.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+get_value(int frame, LMatrix4 &mat) {
+  PN_stdfloat components[num_matrix_components];
+
+  for (int i = 0; i < num_matrix_components; i++) {
+    components[i] = get_component(i, frame);
+  }
+
+  compose_matrix(mat, components);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::get_value_no_scale_shear
+//       Access: Public, Virtual
+//  Description: Gets the value of the channel at the indicated frame,
+//               without any scale or shear information.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+get_value_no_scale_shear(int frame, LMatrix4 &mat) {
+  PN_stdfloat components[num_matrix_components];
+  components[0] = 1.0f;
+  components[1] = 1.0f;
+  components[2] = 1.0f;
+  components[3] = 0.0f;
+  components[4] = 0.0f;
+  components[5] = 0.0f;
+
+  for (int i = 6; i < num_matrix_components; i++) {
+    components[i] = get_component(i, frame);
+  }
+
+  compose_matrix(mat, components);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::get_scale
+//       Access: Public, Virtual
+//  Description: Gets the scale value at the indicated frame.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+get_scale(int frame, LVecBase3 &scale) {
+  for (int i = 0; i < 3; i++) {
+    scale[i] = get_component(i, frame);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::get_hpr
+//       Access: Public, Virtual
+//  Description: Returns the h, p, and r components associated
+//               with the current frame.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+get_hpr(int frame, LVecBase3 &hpr) {
+  for (int i = 0; i < 3; i++) {
+    hpr[i] = get_component(i + 6, frame);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::get_quat
+//       Access: Public, Virtual
+//  Description: Returns the rotation component associated with the
+//               current frame, expressed as a quaternion.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+get_quat(int frame, LQuaternion &quat) {
+  LVecBase3 hpr;
+  get_hpr(frame, hpr);
+  quat.set_hpr(hpr);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::get_pos
+//       Access: Public, Virtual
+//  Description: Returns the x, y, and z translation components
+//               associated with the current frame.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+get_pos(int frame, LVecBase3 &pos) {
+  for (int i = 0; i < 3; i++) {
+    pos[i] = get_component(i + 9, frame);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::get_shear
+//       Access: Public, Virtual
+//  Description: Returns the a, b, and c shear components associated
+//               with the current frame.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+get_shear(int frame, LVecBase3 &shear) {
+  for (int i = 0; i < 3; i++) {
+    shear[i] = get_component(i + 3, frame);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::set_table
+//       Access: Published
+//  Description: Quantizes and stores the indicated table.  table_id
+//               is one of 'i', 'j', 'k', for scale, 'a', 'b', 'c'
+//               for shear, 'h', 'p', 'r', for rotation, and 'x',
+//               'y', 'z', for translation.  The new table must have
+//               either zero, one, or get_num_frames() frames.
+//
+//               The table is reduced to as few keyframes as possible
+//               such that every frame is still reproduced to within
+//               the indicated tolerance.  If the tolerance is
+//               negative, the default tolerance for the table, from
+//               the quantize-chan-tolerance or
+//               quantize-chan-angle-tolerance config variable, is
+//               used.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+set_table(char table_id, const CPTA_stdfloat &table, PN_stdfloat tolerance) {
+  int num_frames = _root->get_num_frames();
+
+  if (table.size() > 1 && (int)table.size() < num_frames) {
+    // The new table has an invalid number of frames--it doesn't match
+    // the bundle's requirement.
+    nassertv(false);
+    return;
+  }
+
+  if (table.size() > 65536) {
+    // The keyframe numbers are stored in 16 bits.
+    chan_cat.error()
+      << "Cannot quantize table " << table_id << " of " << get_name()
+      << ": too many frames (" << table.size() << ").\n";
+    return;
+  }
+
+  int i = get_table_index(table_id);
+  if (i < 0) {
+    return;
+  }
+
+  if (tolerance < 0.0f) {
+    tolerance = get_default_tolerance(table_id);
+  }
+
+  if (table.empty()) {
+    _components[i] = Component();
+  } else {
+    _components[i].encode(table.p(), table.size(), tolerance);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::get_table
+//       Access: Published
+//  Description: Returns a newly-allocated table containing the
+//               decoded values of the indicated subtable, one for
+//               each frame, or an empty table if the subtable has
+//               not been assigned.  This is mainly useful for
+//               measuring the error introduced by quantization;
+//               the channel itself never expands its tables this
+//               way.
+////////////////////////////////////////////////////////////////////
+CPTA_stdfloat AnimChannelMatrixQuantized::
+get_table(char table_id) const {
+  int table_index = get_table_index(table_id);
+  if (table_index < 0 || _components[table_index].is_empty()) {
+    return CPTA_stdfloat(get_class_type());
+  }
+
+  const Component &comp = _components[table_index];
+  PTA_stdfloat table = PTA_stdfloat::empty_array(comp._num_frames, get_class_type());
+  for (int f = 0; f < comp._num_frames; f++) {
+    table[f] = comp.decode(f);
+  }
+  return table;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::clear_all_tables
+//       Access: Published
+//  Description: Removes all the tables from the channel, and resets
+//               it to its initial state.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+clear_all_tables() {
+  for (int i = 0; i < num_matrix_components; i++) {
+    _components[i] = Component();
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::get_default_tolerance
+//       Access: Published, Static
+//  Description: Returns the tolerance that set_table() uses for the
+//               indicated table when none is specified: the value of
+//               quantize-chan-angle-tolerance, in degrees, for the
+//               rotation tables, or quantize-chan-tolerance for all
+//               the others.
+////////////////////////////////////////////////////////////////////
+PN_stdfloat AnimChannelMatrixQuantized::
+get_default_tolerance(char table_id) {
+  int table_index = get_table_index(table_id);
+  if (table_index >= 6 && table_index < 9) {
+    return (PN_stdfloat)quantize_chan_angle_tolerance;
+  }
+  return (PN_stdfloat)quantize_chan_tolerance;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::write
+//       Access: Public, Virtual
+//  Description: Writes a brief description of the table and all of
+//               its descendants.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+write(ostream &out, int indent_level) const {
+  indent(out, indent_level)
+    << get_type() << " " << get_name() << " ";
+
+  // Write a list of all the sub-tables that have data, with the
+  // number of keys retained out of the number of frames.
+  bool found_any = false;
+  for (int i = 0; i < num_matrix_components; i++) {
+    const Component &comp = _components[i];
+    if (!comp.is_empty()) {
+      out << get_table_id(i) << comp.get_num_keys() << "/"
+          << comp._num_frames << " ";
+      found_any = true;
+    }
+  }
+
+  if (!found_any) {
+    out << "(no data)";
+  }
+
+  if (!_children.empty()) {
+    out << " {\n";
+    write_descendants(out, indent_level + 2);
+    indent(out, indent_level) << "}";
+  }
+
+  out << "\n";
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::make_copy
+//       Access: Protected, Virtual
+//  Description: Returns a copy of this object, and attaches it to the
+//               indicated parent (which may be NULL only if this is
+//               an AnimBundle).  Intended to be called by
+//               copy_subtree() only.
+////////////////////////////////////////////////////////////////////
+AnimGroup *AnimChannelMatrixQuantized::
+make_copy(AnimGroup *parent) const {
+  return new AnimChannelMatrixQuantized(parent, *this);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::get_table_index
+//       Access: Protected, Static
+//  Description: Returns the table index number, a value between 0 and
+//               num_matrix_components, that corresponds to the
+//               indicated table id.  Returns -1 if the table id is
+//               invalid.
+////////////////////////////////////////////////////////////////////
+int AnimChannelMatrixQuantized::
+get_table_index(char table_id) {
+  for (int i = 0; i < num_matrix_components; i++) {
+    if (table_id == get_table_id(i)) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::convert_hpr
+//       Access: Private
+//  Description: Converts the rotation tables, which were written in
+//               the new HPR form if new_hpr is true or the old form
+//               otherwise, to the form indicated by temp-hpr-fix.
+//               The tables are decoded, converted frame by frame, and
+//               quantized again.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+convert_hpr(bool new_hpr) {
+  int num_hprs = max(max(_components[6]._num_frames, _components[7]._num_frames),
+                     _components[8]._num_frames);
+  if (num_hprs == 0) {
+    return;
+  }
+
+  PTA_stdfloat h_table = PTA_stdfloat::empty_array(num_hprs, get_class_type());
+  PTA_stdfloat p_table = PTA_stdfloat::empty_array(num_hprs, get_class_type());
+  PTA_stdfloat r_table = PTA_stdfloat::empty_array(num_hprs, get_class_type());
+
+  for (int hi = 0; hi < num_hprs; hi++) {
+    LVecBase3 hpr(get_component(6, hi), get_component(7, hi),
+                  get_component(8, hi));
+    if (new_hpr) {
+      hpr = new_to_old_hpr(hpr);
+    } else {
+      hpr = old_to_new_hpr(hpr);
+    }
+    h_table[hi] = hpr[0];
+    p_table[hi] = hpr[1];
+    r_table[hi] = hpr[2];
+  }
+
+  PN_stdfloat tolerance = get_default_tolerance('h');
+  _components[6].encode(h_table.p(), num_hprs, tolerance);
+  _components[7].encode(p_table.p(), num_hprs, tolerance);
+  _components[8].encode(r_table.p(), num_hprs, tolerance);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::write_datagram
+//       Access: Public, Virtual
+//  Description: Function to write the important information in
+//               the particular object to a Datagram
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+write_datagram(BamWriter *manager, Datagram &me) {
+  AnimChannelMatrix::write_datagram(manager, me);
+
+  me.add_bool(temp_hpr_fix);
+  for (int i = 0; i < num_matrix_components; i++) {
+    _components[i].write_datagram(me);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::fillin
+//       Access: Protected
+//  Description: Function that reads out of the datagram (or asks
+//               manager to read) all of the data that is needed to
+//               re-create this object and stores it in the appropiate
+//               place
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+fillin(DatagramIterator &scan, BamReader *manager) {
+  AnimChannelMatrix::fillin(scan, manager);
+
+  bool new_hpr = scan.get_bool();
+  for (int i = 0; i < num_matrix_components; i++) {
+    if (!_components[i].fillin(scan, manager)) {
+      chan_cat.error()
+        << "Invalid table " << get_table_id(i) << " in " << get_name() << "\n";
+      _components[i] = Component();
+      manager->report_read_error();
+    }
+  }
+
+  if (new_hpr != temp_hpr_fix) {
+    convert_hpr(new_hpr);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::make_AnimChannelMatrixQuantized
+//       Access: Protected
+//  Description: Factory method to generate an
+//               AnimChannelMatrixQuantized object.
+////////////////////////////////////////////////////////////////////
+TypedWritable *AnimChannelMatrixQuantized::
+make_AnimChannelMatrixQuantized(const FactoryParams &params) {
+  AnimChannelMatrixQuantized *me = new AnimChannelMatrixQuantized;
+  DatagramIterator scan;
+  BamReader *manager;
+
+  parse_params(params, scan, manager);
+  me->fillin(scan, manager);
+  return me;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::register_with_read_factory
+//       Access: Public, Static
+//  Description: Factory method to generate an
+//               AnimChannelMatrixQuantized object.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::
+register_with_read_factory() {
+  BamReader::get_factory()->register_factory(get_class_type(), make_AnimChannelMatrixQuantized);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Component::encode
+//       Access: Public
+//  Description: Replaces the contents of the component with a
+//               quantized, keyframe-reduced version of the indicated
+//               table of num_frames values.
+//
+//               Each value is first quantized to 16 bits over the
+//               range of the table.  Then, beginning at the first
+//               frame, each key is extended as far forward as
+//               possible: the next key is placed at the last frame
+//               for which a straight line from the current key still
+//               passes within tolerance of every original value in
+//               between.
+//
+//               Finally, every frame is decoded again and compared
+//               with the original.  If the table's range is too
+//               large for 16-bit values to come within tolerance, the
+//               table is stored raw instead.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::Component::
+encode(const PN_stdfloat *table, int num_frames, PN_stdfloat tolerance) {
+  nassertv(num_frames > 0 && num_frames <= 65536);
+  _keys.clear();
+  _raw_values.clear();
+
+  PN_stdfloat min_value = table[0];
+  PN_stdfloat max_value = table[0];
+  for (int f = 1; f < num_frames; f++) {
+    min_value = min(min_value, table[f]);
+    max_value = max(max_value, table[f]);
+  }
+
+  Key key;
+  if (max_value - min_value <= tolerance * 2.0f) {
+    // The whole table is within tolerance of its midpoint; store a
+    // single value.
+    _min = (min_value + max_value) * 0.5f;
+    _scale = 0.0f;
+    _num_frames = 1;
+    key._frame = 0;
+    key._value = 0;
+    _keys.push_back(key);
+    return;
+  }
+
+  _min = min_value;
+  _scale = (max_value - min_value) / 65535.0f;
+  _num_frames = num_frames;
+  if (_scale * 0.5f > tolerance) {
+    // Even the keys themselves can't be quantized this finely.
+    encode_raw(table, num_frames);
+    return;
+  }
+
+  pvector<unsigned short> values(num_frames);
+  for (int f = 0; f < num_frames; f++) {
+    PN_stdfloat q = floor((table[f] - _min) / _scale + 0.5f);
+    values[f] = (unsigned short)max((PN_stdfloat)0.0f, min(q, (PN_stdfloat)65535.0f));
+  }
+
+  key._frame = 0;
+  key._value = values[0];
+  _keys.push_back(key);
+
+  int begin = 0;
+  while (begin < num_frames - 1) {
+    int end = begin + 1;
+    while (end + 1 < num_frames &&
+           fits(table, &values[0], begin, end + 1, tolerance)) {
+      ++end;
+    }
+    key._frame = (unsigned short)end;
+    key._value = values[end];
+    _keys.push_back(key);
+    begin = end;
+  }
+
+  if (!verify(table, num_frames, tolerance)) {
+    encode_raw(table, num_frames);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Component::encode_raw
+//       Access: Private
+//  Description: Replaces the contents of the component with the
+//               indicated table, unquantized.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::Component::
+encode_raw(const PN_stdfloat *table, int num_frames) {
+  _keys.clear();
+  _min = 0.0f;
+  _scale = 0.0f;
+  _num_frames = num_frames;
+  _raw_values.assign(table, table + num_frames);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Component::write_datagram
+//       Access: Public
+//  Description: Writes the component to the indicated datagram.
+////////////////////////////////////////////////////////////////////
+void AnimChannelMatrixQuantized::Component::
+write_datagram(Datagram &me) const {
+  me.add_uint32(_keys.size());
+  if (_keys.empty()) {
+    // A raw (or empty) table follows.
+    me.add_uint32(_raw_values.size());
+    Values::const_iterator vi;
+    for (vi = _raw_values.begin(); vi != _raw_values.end(); ++vi) {
+      me.add_stdfloat(*vi);
+    }
+    return;
+  }
+
+  me.add_uint32(_num_frames);
+  me.add_stdfloat(_min);
+  me.add_stdfloat(_scale);
+  Keys::const_iterator ki;
+  for (ki = _keys.begin(); ki != _keys.end(); ++ki) {
+    me.add_uint16((*ki)._frame);
+    me.add_uint16((*ki)._value);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Component::fillin
+//       Access: Public
+//  Description: Reads the component from the indicated datagram.
+//               Returns true on success, or false if the data is not
+//               a valid component, in which case the component
+//               should not be used.
+////////////////////////////////////////////////////////////////////
+bool AnimChannelMatrixQuantized::Component::
+fillin(DatagramIterator &scan, BamReader *manager) {
+  _keys.clear();
+  _raw_values.clear();
+  _min = 0.0f;
+  _scale = 0.0f;
+  _num_frames = 0;
+
+  size_t num_keys = scan.get_uint32();
+  if (num_keys == 0) {
+    size_t num_values = scan.get_uint32();
+    // Each value takes at least four bytes; don't believe a count
+    // that the datagram can't hold.
+    if (num_values > (size_t)scan.get_remaining_size() / 4) {
+      return false;
+    }
+    _raw_values.reserve(num_values);
+    for (size_t vi = 0; vi < num_values; ++vi) {
+      _raw_values.push_back(scan.get_stdfloat());
+    }
+    _num_frames = (int)num_values;
+    return is_valid();
+  }
+
+  if (num_keys > (size_t)scan.get_remaining_size() / 4) {
+    return false;
+  }
+  _num_frames = scan.get_uint32();
+  _min = scan.get_stdfloat();
+  _scale = scan.get_stdfloat();
+  _keys.reserve(num_keys);
+  for (size_t ki = 0; ki < num_keys; ++ki) {
+    Key key;
+    key._frame = scan.get_uint16();
+    key._value = scan.get_uint16();
+    _keys.push_back(key);
+  }
+  return is_valid();
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Component::is_valid
+//       Access: Private
+//  Description: Returns true if the component, as read from a bam
+//               file, meets the assumptions made by decode(): there
+//               is at least one frame; the keys begin at frame 0,
+//               are in increasing order, and end at the last frame.
+////////////////////////////////////////////////////////////////////
+bool AnimChannelMatrixQuantized::Component::
+is_valid() const {
+  if (_keys.empty()) {
+    return true;
+  }
+  if (_num_frames <= 0 || _num_frames > 65536 || _keys[0]._frame != 0) {
+    return false;
+  }
+  if (_keys.size() == 1) {
+    return true;
+  }
+  for (size_t ki = 1; ki < _keys.size(); ++ki) {
+    if (_keys[ki]._frame <= _keys[ki - 1]._frame) {
+      return false;
+    }
+  }
+  return (int)_keys.back()._frame == _num_frames - 1;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Component::verify
+//       Access: Private
+//  Description: Returns true if every frame of the component, as
+//               decoded, is within tolerance of the original table.
+////////////////////////////////////////////////////////////////////
+bool AnimChannelMatrixQuantized::Component::
+verify(const PN_stdfloat *table, int num_frames, PN_stdfloat tolerance) const {
+  for (int f = 0; f < num_frames; f++) {
+    if (cabs(decode(f) - table[f]) > tolerance) {
+      return false;
+    }
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: AnimChannelMatrixQuantized::Component::fits
+//       Access: Private
+//  Description: Returns true if a straight line between the
+//               quantized values at frames begin and end passes
+//               within tolerance of each of the original values in
+//               between.
+////////////////////////////////////////////////////////////////////
+bool AnimChannelMatrixQuantized::Component::
+fits(const PN_stdfloat *table, const unsigned short *values,
+     int begin, int end, PN_stdfloat tolerance) const {
+  PN_stdfloat a = (PN_stdfloat)values[begin];
+  PN_stdfloat b = (PN_stdfloat)values[end];
+  PN_stdfloat span = (PN_stdfloat)(end - begin);
+  for (int f = begin + 1; f < end; f++) {
+    PN_stdfloat t = (PN_stdfloat)(f - begin) / span;
+    PN_stdfloat v = _min + _scale * (a + t * (b - a));
+    if (cabs(v - table[f]) > tolerance) {
+      return false;
+    }
+  }
+  return true;
+}
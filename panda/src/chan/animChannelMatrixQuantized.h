@@ -0,0 +1,170 @@
+// Filename: animChannelMatrixQuantized.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef ANIMCHANNELMATRIXQUANTIZED_H
+#define ANIMCHANNELMATRIXQUANTIZED_H
+
+#include "pandabase.h"
+
+#include "animChannel.h"
+
+#include "pointerToArray.h"
+#include "pta_stdfloat.h"
+#include "pvector.h"
+#include "compose_matrix.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : AnimChannelMatrixQuantized
+// Description : An animation channel that issues a matrix each frame,
+//               like AnimChannelMatrixXfmTable, but stores each of
+//               its component tables in a compact, lossy form.
+//
+//               Each component is quantized to 16 bits over its own
+//               range of values, and then reduced to a list of
+//               keyframes: a frame is omitted if linear
+//               interpolation between its neighboring keys
+//               reproduces it to within a given tolerance.  A
+//               component that never varies by more than the
+//               tolerance is stored as a single value.  A component
+//               whose range is too large for 16 bits to represent
+//               within the tolerance is stored unquantized, one
+//               value per frame.
+//
+//               The table is never expanded in memory; each call to
+//               get_value() finds the pair of keys that bracket the
+//               requested frame and decodes only those.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_CHAN AnimChannelMatrixQuantized : public AnimChannelMatrix {
+protected:
+  AnimChannelMatrixQuantized();
+  AnimChannelMatrixQuantized(AnimGroup *parent, const AnimChannelMatrixQuantized &copy);
+
+PUBLISHED:
+  AnimChannelMatrixQuantized(AnimGroup *parent, const string &name);
+  virtual ~AnimChannelMatrixQuantized();
+
+public:
+  virtual bool has_changed(int last_frame, double last_frac,
+                           int this_frame, double this_frac);
+  virtual void get_value(int frame, LMatrix4 &mat);
+
+  virtual void get_value_no_scale_shear(int frame, LMatrix4 &value);
+  virtual void get_scale(int frame, LVecBase3 &scale);
+  virtual void get_hpr(int frame, LVecBase3 &hpr);
+  virtual void get_quat(int frame, LQuaternion &quat);
+  virtual void get_pos(int frame, LVecBase3 &pos);
+  virtual void get_shear(int frame, LVecBase3 &shear);
+
+PUBLISHED:
+  static INLINE bool is_valid_id(char table_id);
+
+  void set_table(char table_id, const CPTA_stdfloat &table,
+                 PN_stdfloat tolerance = -1.0f);
+  CPTA_stdfloat get_table(char table_id) const;
+
+  void clear_all_tables();
+  INLINE bool has_table(char table_id) const;
+  INLINE void clear_table(char table_id);
+  INLINE int get_num_keys(char table_id) const;
+
+  static PN_stdfloat get_default_tolerance(char table_id);
+
+public:
+  virtual void write(ostream &out, int indent_level) const;
+
+protected:
+  virtual AnimGroup *make_copy(AnimGroup *parent) const;
+
+  INLINE static char get_table_id(int table_index);
+  static int get_table_index(char table_id);
+  INLINE static PN_stdfloat get_default_value(int table_index);
+
+private:
+  class Key {
+  public:
+    unsigned short _frame;
+    unsigned short _value;
+  };
+  typedef pvector<Key> Keys;
+  typedef pvector<PN_stdfloat> Values;
+
+  // One component of the transform: the keys of a single sub-table,
+  // and the range needed to convert their quantized values back to
+  // floats, or else the raw values of every frame.  A component with
+  // neither is empty, and reports the default value for its table.
+  class Component {
+  public:
+    INLINE Component();
+
+    void encode(const PN_stdfloat *table, int num_frames,
+                PN_stdfloat tolerance);
+    INLINE bool is_empty() const;
+    INLINE bool is_constant() const;
+    INLINE int get_num_keys() const;
+    INLINE PN_stdfloat decode(int frame) const;
+
+    void write_datagram(Datagram &me) const;
+    bool fillin(DatagramIterator &scan, BamReader *manager);
+
+  private:
+    bool fits(const PN_stdfloat *table, const unsigned short *values,
+              int begin, int end, PN_stdfloat tolerance) const;
+    bool verify(const PN_stdfloat *table, int num_frames,
+                PN_stdfloat tolerance) const;
+    void encode_raw(const PN_stdfloat *table, int num_frames);
+    bool is_valid() const;
+
+  public:
+    PN_stdfloat _min;
+    PN_stdfloat _scale;
+    int _num_frames;
+    Keys _keys;
+    Values _raw_values;
+  };
+
+  INLINE PN_stdfloat get_component(int table_index, int frame) const;
+  void convert_hpr(bool new_hpr);
+
+  Component _components[num_matrix_components];
+
+public:
+  static void register_with_read_factory();
+  virtual void write_datagram(BamWriter *manager, Datagram &me);
+
+  static TypedWritable *make_AnimChannelMatrixQuantized(const FactoryParams &params);
+
+protected:
+  void fillin(DatagramIterator &scan, BamReader *manager);
+
+public:
+  virtual TypeHandle get_type() const {
+    return get_class_type();
+  }
+  virtual TypeHandle force_init_type() {init_type(); return get_class_type();}
+  static TypeHandle get_class_type() {
+    return _type_handle;
+  }
+  static void init_type() {
+    AnimChannelMatrix::init_type();
+    register_type(_type_handle, "AnimChannelMatrixQuantized",
+                  AnimChannelMatrix::get_class_type());
+  }
+
+private:
+  static TypeHandle _type_handle;
+};
+
+#include "animChannelMatrixQuantized.I"
+
+#endif
@@ -18,6 +18,7 @@
 #include "animBundleNode.h"
 #include "animChannelBase.h"
 #include "animChannelMatrixXfmTable.h"
+#include "animChannelMatrixQuantized.h"
 #include "animChannelMatrixDynamic.h"
 #include "animChannelMatrixFixed.h"
 #include "animChannelScalarTable.h"
@@ -81,6 +82,19 @@ PRC_DESC("Set this false to disable reading of compressed animation channels, "
          "might want to do this would be to speed load time when you don't "
          "care about what the animation looks like."));
 
+ConfigVariableDouble quantize_chan_tolerance
+("quantize-chan-tolerance", 0.001,
+PRC_DESC("The maximum error, in model units, that is allowed in the scale, "
+         "shear, and translation components of an animation channel when "
+         "it is stored as an AnimChannelMatrixQuantized.  Larger values "
+         "allow more keyframes to be discarded."));
+
+ConfigVariableDouble quantize_chan_angle_tolerance
+("quantize-chan-angle-tolerance", 0.01,
+PRC_DESC("The maximum error, in degrees, that is allowed in the rotation "
+         "components of an animation channel when it is stored as an "
+         "AnimChannelMatrixQuantized."));
+
 ConfigVariableBool interpolate_frames
 ("interpolate-frames", false,
 PRC_DESC("Set this true to interpolate character animations between frames, "
@@ -95,6 +109,15 @@ PRC_DESC("When this is true, setting all control effects on an Actor to 0 "
          "false, it retains whatever its last-computed pose was "
          "(which may or may not be the default pose)."));
 
+ConfigVariableBool flatten_part_bundles
+("flatten-part-bundles", true,
+PRC_DESC("When this is true, each PartBundle keeps a flattened list of its "
+         "moving parts in parent-before-child order, and updates them "
+         "with a pair of simple loops: one to sample all of the changed "
+         "animation channels, and one to propagate the results down the "
+         "hierarchy.  Set this false to walk the PartGroup tree "
+         "recursively instead, as in previous versions."));
+
 ConfigVariableInt async_bind_priority
 ("async-bind-priority", 100,
 PRC_DESC("This specifies the priority assign to an asynchronous bind "
@@ -109,6 +132,7 @@ ConfigureFn(config_chan) {
   AnimBundleNode::init_type();
   AnimChannelBase::init_type();
   AnimChannelMatrixXfmTable::init_type();
+  AnimChannelMatrixQuantized::init_type();
   AnimChannelMatrixDynamic::init_type();
   AnimChannelMatrixFixed::init_type();
   AnimChannelScalarTable::init_type();
@@ -141,6 +165,7 @@ ConfigureFn(config_chan) {
   AnimBundle::register_with_read_factory();
   AnimBundleNode::register_with_read_factory();
   AnimChannelMatrixXfmTable::register_with_read_factory();
+  AnimChannelMatrixQuantized::register_with_read_factory();
   AnimChannelMatrixDynamic::register_with_read_factory();
   AnimChannelMatrixFixed::register_with_read_factory();
   AnimChannelScalarTable::register_with_read_factory();
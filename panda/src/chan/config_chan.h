@@ -19,6 +19,7 @@
 #include "notifyCategoryProxy.h"
 #include "configVariableBool.h"
 #include "configVariableInt.h"
+#include "configVariableDouble.h"
 
 // Configure variables for chan package.
 NotifyCategoryDecl(chan, EXPCL_PANDA_CHAN, EXPTP_PANDA_CHAN);
@@ -26,8 +27,11 @@ NotifyCategoryDecl(chan, EXPCL_PANDA_CHAN, EXPTP_PANDA_CHAN);
 EXPCL_PANDA_CHAN extern ConfigVariableBool compress_channels;
 EXPCL_PANDA_CHAN extern ConfigVariableInt compress_chan_quality;
 EXPCL_PANDA_CHAN extern ConfigVariableBool read_compressed_channels;
+EXPCL_PANDA_CHAN extern ConfigVariableDouble quantize_chan_tolerance;
+EXPCL_PANDA_CHAN extern ConfigVariableDouble quantize_chan_angle_tolerance;
 EXPCL_PANDA_CHAN extern ConfigVariableBool interpolate_frames;
 EXPCL_PANDA_CHAN extern ConfigVariableBool restore_initial_pose;
+EXPCL_PANDA_CHAN extern ConfigVariableBool flatten_part_bundles;
 EXPCL_PANDA_CHAN extern ConfigVariableInt async_bind_priority;
 
 #endif
@@ -133,37 +133,7 @@ do_update(PartBundle *root, const CycleData *root_cdata, PartGroup *parent,
           bool parent_changed, bool anim_changed,
           Thread *current_thread) {
   bool any_changed = false;
-  bool needs_update = anim_changed;
-
-  // See if any of the channel values have changed since last time.
-
-  if (!needs_update) {
-    if (_forced_channel != (AnimChannelBase *)NULL) {
-      needs_update = _forced_channel->has_changed(0, 0.0, 0, 0.0);
-    
-    } else if (_effective_control != (AnimControl *)NULL) {
-      const PartBundle::CData *cdata = (const PartBundle::CData *)root_cdata;
-      needs_update = _effective_control->channel_has_changed(_effective_channel, cdata->_frame_blend_flag);
-      
-    } else {
-      const PartBundle::CData *cdata = (const PartBundle::CData *)root_cdata;
-      PartBundle::ChannelBlend::const_iterator bci;
-      for (bci = cdata->_blend.begin();
-           !needs_update && bci != cdata->_blend.end();
-           ++bci) {
-        AnimControl *control = (*bci).first;
-        
-        AnimChannelBase *channel = NULL;
-        int channel_index = control->get_channel_index();
-        if (channel_index >= 0 && channel_index < (int)_channels.size()) {
-          channel = _channels[channel_index];
-        }
-        if (channel != (AnimChannelBase*)NULL) {
-          needs_update = control->channel_has_changed(channel, cdata->_frame_blend_flag);
-        }
-      }
-    }
-  }
+  bool needs_update = check_needs_update(root_cdata, anim_changed);
 
   if (needs_update) {
     // Ok, get the latest value.
@@ -188,6 +158,49 @@ do_update(PartBundle *root, const CycleData *root_cdata, PartGroup *parent,
   return any_changed;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: MovingPartBase::check_needs_update
+//       Access: Public
+//  Description: Returns true if the value of this part must be
+//               recomputed for the current frame, either because
+//               anim_changed is true or because one of the channels
+//               that affect it has changed.  This does not consider
+//               the parts above it.
+////////////////////////////////////////////////////////////////////
+bool MovingPartBase::
+check_needs_update(const CycleData *root_cdata, bool anim_changed) const {
+  if (anim_changed) {
+    return true;
+  }
+
+  // See if any of the channel values have changed since last time.
+  if (_forced_channel != (AnimChannelBase *)NULL) {
+    return _forced_channel->has_changed(0, 0.0, 0, 0.0);
+  }
+
+  const PartBundle::CData *cdata = (const PartBundle::CData *)root_cdata;
+  if (_effective_control != (AnimControl *)NULL) {
+    return _effective_control->channel_has_changed(_effective_channel, cdata->_frame_blend_flag);
+  }
+
+  PartBundle::ChannelBlend::const_iterator bci;
+  for (bci = cdata->_blend.begin(); bci != cdata->_blend.end(); ++bci) {
+    AnimControl *control = (*bci).first;
+
+    AnimChannelBase *channel = NULL;
+    int channel_index = control->get_channel_index();
+    if (channel_index >= 0 && channel_index < (int)_channels.size()) {
+      channel = _channels[channel_index];
+    }
+    if (channel != (AnimChannelBase*)NULL &&
+        control->channel_has_changed(channel, cdata->_frame_blend_flag)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 
 ////////////////////////////////////////////////////////////////////
 //     Function: MovingPartBase::update_internals
@@ -5,6 +5,7 @@
 #include "animChannelBase.cxx"
 #include "animChannelMatrixDynamic.cxx"
 #include "animChannelMatrixFixed.cxx"
+#include "animChannelMatrixQuantized.cxx"
 #include "animChannelMatrixXfmTable.cxx"
 #include "animChannelScalarDynamic.cxx"
 #include "animChannelScalarTable.cxx"
@@ -29,6 +29,7 @@
 #include "bamWriter.h"
 #include "configVariableEnum.h"
 #include "loaderOptions.h"
+#include "movingPartBase.h"
 
 #include <algorithm>
 
@@ -55,6 +56,8 @@ PartBundle(const PartBundle &copy) :
 {
   _anim_preload = copy._anim_preload;
   _update_delay = 0.0;
+  _flat_seq = -1;
+  _flat_ok = false;
 
   CDWriter cdata(_cycler, true);
   CDReader cdata_from(copy._cycler);
@@ -76,6 +79,8 @@ PartBundle(const string &name) :
   PartGroup(name)
 {
   _update_delay = 0.0;
+  _flat_seq = -1;
+  _flat_ok = false;
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -551,8 +556,7 @@ update() {
     bool anim_changed = cdata->_anim_changed;
     bool frame_blend_flag = cdata->_frame_blend_flag;
 
-    any_changed = do_update(this, cdata, NULL, false, anim_changed, 
-                            current_thread);
+    any_changed = do_update_parts(cdata, false, anim_changed, current_thread);
     
     // Now update all the controls for next time.
     ChannelBlend::const_iterator cbi;
@@ -579,7 +583,7 @@ bool PartBundle::
 force_update() {
   Thread *current_thread = Thread::get_current_thread();
   CDWriter cdata(_cycler, false, current_thread);
-  bool any_changed = do_update(this, cdata, NULL, true, true, current_thread);
+  bool any_changed = do_update_parts(cdata, true, true, current_thread);
 
   // Now update all the controls for next time.
   ChannelBlend::const_iterator cbi;
@@ -816,6 +820,135 @@ clear_and_stop_intersecting(AnimControl *control, CData *cdata) {
   }
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: PartBundle::do_update_parts
+//       Access: Private
+//  Description: Updates all the parts in the bundle, using the
+//               flattened list of parts if flatten-part-bundles is
+//               set and the hierarchy allows it, or by walking the
+//               hierarchy with do_update() otherwise.  Returns true
+//               if any part has changed.
+////////////////////////////////////////////////////////////////////
+bool PartBundle::
+do_update_parts(const CData *cdata, bool parent_changed, bool anim_changed,
+                Thread *current_thread) {
+  if (flatten_part_bundles) {
+    if (_flat_seq != PartGroup::get_hierarchy_seq()) {
+      flatten_parts();
+    }
+    if (_flat_ok) {
+      return do_flat_update(cdata, parent_changed, anim_changed, current_thread);
+    }
+  }
+
+  return do_update(this, cdata, NULL, parent_changed, anim_changed,
+                   current_thread);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PartBundle::do_flat_update
+//       Access: Private
+//  Description: Updates all the parts in the bundle via
+//               _flat_parts.  This produces the same result as
+//               do_update(), but in two passes over the array instead
+//               of a recursive walk: first, the new value of each
+//               part whose channels have changed is sampled; then the
+//               changes are propagated from parent to child in order.
+////////////////////////////////////////////////////////////////////
+bool PartBundle::
+do_flat_update(const CData *cdata, bool parent_changed, bool anim_changed,
+               Thread *current_thread) {
+  size_t num_parts = _flat_parts.size();
+  _flat_changed.resize(num_parts);
+
+  // Sample the channels.  The value of a part doesn't depend on its
+  // parent, so these can all be done together.
+  size_t i;
+  for (i = 0; i < num_parts; ++i) {
+    MovingPartBase *part = _flat_parts[i]._part;
+    bool needs_update = part->check_needs_update(cdata, anim_changed);
+    if (needs_update) {
+      part->get_blend_value(this);
+    }
+    _flat_changed[i] = needs_update;
+  }
+
+  // Now propagate the changes down the hierarchy.  Since each part
+  // follows its parent, by the time we get to a part, the entry for
+  // its parent has been replaced with whether the parent's children
+  // should consider it changed.
+  bool any_changed = false;
+  for (i = 0; i < num_parts; ++i) {
+    const FlatPart &flat = _flat_parts[i];
+    bool self_changed = (_flat_changed[i] != 0);
+    bool part_parent_changed = (flat._parent_index < 0) ?
+      parent_changed : (_flat_changed[flat._parent_index] != 0);
+
+    if (self_changed || part_parent_changed) {
+      if (flat._part->update_internals(this, flat._parent, self_changed,
+                                       part_parent_changed, current_thread)) {
+        any_changed = true;
+      }
+    }
+    _flat_changed[i] = (self_changed || part_parent_changed);
+  }
+
+  return any_changed;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PartBundle::flatten_parts
+//       Access: Private
+//  Description: Rebuilds _flat_parts from the current hierarchy.
+//               If the hierarchy contains a kind of group we don't
+//               know how to flatten, _flat_ok is set false.
+////////////////////////////////////////////////////////////////////
+void PartBundle::
+flatten_parts() {
+  _flat_seq = PartGroup::get_hierarchy_seq();
+  _flat_parts.clear();
+  _flat_ok = r_flatten_parts(this, -1);
+  if (!_flat_ok) {
+    _flat_parts.clear();
+  }
+  _flat_changed.reserve(_flat_parts.size());
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PartBundle::r_flatten_parts
+//       Access: Private
+//  Description: The recursive implementation of flatten_parts().
+//               Returns false if some group beneath the indicated
+//               group may have its own do_update() behavior, in
+//               which case the hierarchy can't be flattened.
+////////////////////////////////////////////////////////////////////
+bool PartBundle::
+r_flatten_parts(PartGroup *group, int parent_index) {
+  Children::const_iterator ci;
+  for (ci = group->_children.begin(); ci != group->_children.end(); ++ci) {
+    PartGroup *child = (*ci);
+    int child_index = parent_index;
+
+    if (child->is_of_type(MovingPartBase::get_class_type())) {
+      FlatPart flat;
+      flat._part = DCAST(MovingPartBase, child);
+      flat._parent = group;
+      flat._parent_index = parent_index;
+      child_index = (int)_flat_parts.size();
+      _flat_parts.push_back(flat);
+
+    } else if (child->get_type() != PartGroup::get_class_type()) {
+      return false;
+    }
+
+    if (!r_flatten_parts(child, child_index)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: PartBundle::finalize
 //       Access: Public, Virtual
@@ -39,6 +39,7 @@ class PartBundleNode;
 class PartBundleNode;
 class TransformState;
 class AnimPreloadTable;
+class MovingPartBase;
 
 ////////////////////////////////////////////////////////////////////
 //       Class : PartBundle
@@ -166,6 +167,13 @@ private:
   void recompute_net_blend(CData *cdata);
   void clear_and_stop_intersecting(AnimControl *control, CData *cdata);
 
+  bool do_update_parts(const CData *cdata, bool parent_changed,
+                       bool anim_changed, Thread *current_thread);
+  bool do_flat_update(const CData *cdata, bool parent_changed,
+                      bool anim_changed, Thread *current_thread);
+  void flatten_parts();
+  bool r_flatten_parts(PartGroup *group, int parent_index);
+
   COWPT(AnimPreloadTable) _anim_preload;
 
   typedef pvector<PartBundleNode *> Nodes;
@@ -176,6 +184,29 @@ private:
 
   double _update_delay;
 
+  // The moving parts of the bundle, in an order such that each part
+  // appears after its parent, as built by flatten_parts().  This
+  // lets do_flat_update() visit the whole hierarchy in a single pass
+  // without recursion.  _parent_index is the index of the nearest
+  // MovingPartBase above the part, or -1 if there is none.
+  class FlatPart {
+  public:
+    MovingPartBase *_part;
+    PartGroup *_parent;
+    int _parent_index;
+  };
+  typedef pvector<FlatPart> FlatParts;
+  FlatParts _flat_parts;
+
+  // Scratch space for do_flat_update(), one entry per part.
+  typedef pvector<unsigned char> FlatChanged;
+  FlatChanged _flat_changed;
+
+  // The value of PartGroup::get_hierarchy_seq() when _flat_parts was
+  // built, and whether the hierarchy could be flattened at all.
+  AtomicAdjust::Integer _flat_seq;
+  bool _flat_ok;
+
   // This is the data that must be cycled between pipeline stages.
   class CData : public CycleData {
   public:
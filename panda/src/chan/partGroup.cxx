@@ -26,6 +26,7 @@
 #include <algorithm>
 
 TypeHandle PartGroup::_type_handle;
+AtomicAdjust::Integer PartGroup::_hierarchy_seq = 0;
 
 ////////////////////////////////////////////////////////////////////
 //     Function: PartGroup::Constructor
@@ -42,6 +43,7 @@ PartGroup(PartGroup *parent, const string &name) :
   nassertv(parent != NULL);
   
   parent->_children.push_back(this);
+  mark_hierarchy_changed();
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -96,6 +98,7 @@ copy_subgraph() const {
     PartGroup *child = (*ci)->copy_subgraph();
     root->_children.push_back(child);
   }
+  mark_hierarchy_changed();
 
   return root;
 }
@@ -190,6 +193,7 @@ public:
 void PartGroup::
 sort_descendants() {
   stable_sort(_children.begin(), _children.end(), PartGroupAlphabeticalOrder());
+  mark_hierarchy_changed();
 
   Children::iterator ci;
   for (ci = _children.begin(); ci != _children.end(); ++ci) {
@@ -760,6 +764,7 @@ complete_pointers(TypedWritable **p_list, BamReader *manager) {
   for (ci = _children.begin(); ci != _children.end(); ++ci) {
     (*ci) = DCAST(PartGroup, p_list[pi++]);
   }
+  mark_hierarchy_changed();
 
   return pi;
 }
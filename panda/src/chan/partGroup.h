@@ -24,6 +24,7 @@
 #include "thread.h"
 #include "plist.h"
 #include "luse.h"
+#include "atomicAdjust.h"
 
 class AnimControl;
 class AnimGroup;
@@ -102,7 +103,11 @@ public:
   virtual void do_xform(const LMatrix4 &mat, const LMatrix4 &inv_mat);
   virtual void determine_effective_channels(const CycleData *root_cdata);
 
+  INLINE static AtomicAdjust::Integer get_hierarchy_seq();
+
 protected:
+  INLINE static void mark_hierarchy_changed();
+
   void write_descendants(ostream &out, int indent_level) const;
   void write_descendants_with_value(ostream &out, int indent_level) const;
 
@@ -118,6 +123,11 @@ protected:
   typedef pvector< PT(PartGroup) > Children;
   Children _children;
 
+  // This is incremented whenever the children of any PartGroup
+  // change, so that PartBundle can tell when its flattened list of
+  // parts must be rebuilt.
+  static AtomicAdjust::Integer _hierarchy_seq;
+
 public:
   static void register_with_read_factory();
   virtual void write_datagram(BamWriter* manager, Datagram &me);
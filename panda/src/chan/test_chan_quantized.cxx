@@ -0,0 +1,111 @@
+// Filename: test_chan_quantized.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "animBundle.h"
+#include "animChannelMatrixQuantized.h"
+#include "config_chan.h"
+#include "pta_stdfloat.h"
+#include "compose_matrix.h"
+#include "cmath.h"
+
+// Checks that AnimChannelMatrixQuantized reproduces every frame of
+// its tables to within the requested tolerance, including tables
+// whose range is too large for 16-bit keys, and that the channel
+// survives a round trip through a bam stream unchanged.
+
+static const int num_frames = 500;
+
+static PTA_stdfloat
+make_table(PN_stdfloat range, PN_stdfloat freq) {
+  PTA_stdfloat table = PTA_stdfloat::empty_array(num_frames);
+  for (int f = 0; f < num_frames; ++f) {
+    table[f] = range * csin(f * freq) + (f % 7) * range * 0.001f;
+  }
+  return table;
+}
+
+static bool
+check_table(AnimChannelMatrixQuantized *chan, char table_id,
+            const PTA_stdfloat &table, PN_stdfloat tolerance) {
+  CPTA_stdfloat decoded = chan->get_table(table_id);
+  if (decoded.size() != table.size()) {
+    nout << table_id << ": got " << decoded.size() << " frames, expected "
+         << table.size() << "\n";
+    return false;
+  }
+  for (size_t f = 0; f < table.size(); ++f) {
+    if (cabs(decoded[f] - table[f]) > tolerance) {
+      nout << table_id << ": frame " << f << " is " << decoded[f]
+           << ", expected " << table[f] << "\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+int
+main(int argc, char *argv[]) {
+  PT(AnimBundle) bundle = new AnimBundle("bundle", 24.0f, num_frames);
+  PT(AnimChannelMatrixQuantized) chan =
+    new AnimChannelMatrixQuantized(bundle, "joint");
+
+  // A small range, easily keyframed; a huge range with a tolerance
+  // finer than 16 bits can represent; and a constant.
+  PTA_stdfloat h = make_table(90.0f, 0.05f);
+  PTA_stdfloat x = make_table(100000.0f, 0.3f);
+  PTA_stdfloat z = PTA_stdfloat::empty_array(1);
+  z[0] = 2.5f;
+
+  chan->set_table('h', h, 0.01f);
+  chan->set_table('x', x, 0.001f);
+  chan->set_table('z', z, 0.001f);
+
+  bool all_ok = true;
+  all_ok = check_table(chan, 'h', h, 0.01f) && all_ok;
+  all_ok = check_table(chan, 'x', x, 0.001f) && all_ok;
+  all_ok = check_table(chan, 'z', z, 0.001f) && all_ok;
+  nout << "h: " << chan->get_num_keys('h') << " keys, x: "
+       << chan->get_num_keys('x') << " keys\n";
+
+  string data;
+  if (!bundle->encode_to_bam_stream(data)) {
+    nout << "Could not encode bundle.\n";
+    return 1;
+  }
+
+  TypedWritable *ptr;
+  ReferenceCount *ref_ptr;
+  if (!TypedWritable::decode_raw_from_bam_stream(ptr, ref_ptr, data)) {
+    nout << "Could not decode bundle.\n";
+    return 1;
+  }
+  PT(AnimBundle) new_bundle = DCAST(AnimBundle, ptr);
+  AnimChannelMatrixQuantized *new_chan;
+  DCAST_INTO_R(new_chan, new_bundle->find_child("joint"), 1);
+
+  for (int i = 0; i < num_matrix_components; ++i) {
+    char table_id = "ijkabchprxyz"[i];
+    CPTA_stdfloat before = chan->get_table(table_id);
+    CPTA_stdfloat after = new_chan->get_table(table_id);
+    if (before.size() != after.size() ||
+        (!before.empty() &&
+         memcmp(before.p(), after.p(), before.size() * sizeof(PN_stdfloat)) != 0)) {
+      nout << table_id << ": changed in round trip\n";
+      all_ok = false;
+    }
+  }
+
+  nout << (all_ok ? "OK" : "FAILED") << "\n";
+  return all_ok ? 0 : 1;
+}
@@ -28,10 +28,14 @@
 #include "camera.h"
 #include "cullTraverser.h"
 #include "cullTraverserData.h"
+#include "nodePathCollection.h"
+#include "pset.h"
+#include "pmap.h"
 
 TypeHandle Character::_type_handle;
 
 PStatCollector Character::_animation_pcollector("*:Animation");
+PStatCollector Character::_parallel_pcollector("*:Animation:Parallel");
 
 ////////////////////////////////////////////////////////////////////
 //     Function: Character::Copy Constructor
@@ -521,6 +525,122 @@ update() {
   }
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: Character::update_characters
+//       Access: Published, Static
+//  Description: Calls update() on each of the Characters in the
+//               indicated collection (any other nodes are ignored).
+//               If character-update-threads is greater than 1, the
+//               characters are divided among that many threads, so
+//               that a large crowd can be animated in a fraction of
+//               the time.
+//
+//               Since update() does nothing if the character has
+//               already been updated this frame, calling this early
+//               in the frame, with all of the characters that are
+//               likely to be visible, takes the work away from the
+//               cull traversal, which would otherwise update each
+//               character one at a time as it is encountered.
+////////////////////////////////////////////////////////////////////
+void Character::
+update_characters(const NodePathCollection &characters) {
+  // The same Character may appear more than once, by way of
+  // instancing, but it must only be updated once.
+  pvector<Character *> chars;
+  pset<Character *> seen;
+  int num_paths = characters.get_num_paths();
+  chars.reserve(num_paths);
+  for (int i = 0; i < num_paths; ++i) {
+    NodePath np = characters.get_path(i);
+    if (!np.is_empty() && np.node()->is_of_type(Character::get_class_type())) {
+      Character *character = DCAST(Character, np.node());
+      if (seen.insert(character).second) {
+        chars.push_back(character);
+      }
+    }
+  }
+
+  if (chars.empty()) {
+    return;
+  }
+
+  PStatTimer timer(_parallel_pcollector);
+
+  int num_threads = character_update_threads;
+  if (num_threads <= 1 || chars.size() < 2) {
+    pvector<Character *>::iterator ci;
+    for (ci = chars.begin(); ci != chars.end(); ++ci) {
+      (*ci)->update();
+    }
+    return;
+  }
+
+  // Characters may also share a PartBundle, which must not be updated
+  // by two threads at once.  Group together all of the Characters
+  // that share any bundle, and make each group a single job.
+  UpdateJobs jobs;
+  pmap<PartBundle *, size_t> bundle_jobs;
+  pvector<Character *>::iterator ci;
+  for (ci = chars.begin(); ci != chars.end(); ++ci) {
+    Character *character = (*ci);
+    size_t job = jobs.size();
+    int num_bundles = character->get_num_bundles();
+    for (int i = 0; i < num_bundles; ++i) {
+      pmap<PartBundle *, size_t>::const_iterator bi =
+        bundle_jobs.find(character->get_bundle(i));
+      if (bi != bundle_jobs.end()) {
+        job = min(job, (*bi).second);
+      }
+    }
+    if (job == jobs.size()) {
+      jobs.push_back(UpdateJob());
+    }
+
+    // If the character's bundles were in several different jobs,
+    // merge them all into this one.
+    for (int i = 0; i < num_bundles; ++i) {
+      PartBundle *bundle = character->get_bundle(i);
+      pmap<PartBundle *, size_t>::iterator bi = bundle_jobs.find(bundle);
+      if (bi == bundle_jobs.end()) {
+        bundle_jobs[bundle] = job;
+
+      } else if ((*bi).second != job) {
+        size_t other = (*bi).second;
+        jobs[job].insert(jobs[job].end(), jobs[other].begin(), jobs[other].end());
+        jobs[other].clear();
+        pmap<PartBundle *, size_t>::iterator bj;
+        for (bj = bundle_jobs.begin(); bj != bundle_jobs.end(); ++bj) {
+          if ((*bj).second == other) {
+            (*bj).second = job;
+          }
+        }
+      }
+    }
+    jobs[job].push_back(character);
+  }
+
+  // Remove the jobs that were merged away.
+  UpdateJobs::iterator ji = jobs.begin();
+  while (ji != jobs.end()) {
+    if ((*ji).empty()) {
+      ji = jobs.erase(ji);
+    } else {
+      ++ji;
+    }
+  }
+
+  if (jobs.size() < 2) {
+    for (ci = chars.begin(); ci != chars.end(); ++ci) {
+      (*ci)->update();
+    }
+    return;
+  }
+
+  PT(WorkerThreadPool) pool =
+    WorkerThreadPool::get_shared("Animation", num_threads);
+  pool->run_jobs((int)jobs.size(), &update_job_func, &jobs);
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: Character::force_update
 //       Access: Published
@@ -668,6 +788,23 @@ do_update() {
   }
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: Character::update_job_func
+//       Access: Private, Static
+//  Description: The WorkerThreadPool job function for
+//               update_characters(); user_data is the UpdateJobs.
+//               Updates each of the Characters in the nth job, one
+//               after the other.
+////////////////////////////////////////////////////////////////////
+void Character::
+update_job_func(int job_index, Thread *current_thread, void *user_data) {
+  UpdateJobs &jobs = *(UpdateJobs *)user_data;
+  UpdateJob::const_iterator ci;
+  for (ci = jobs[job_index].begin(); ci != jobs[job_index].end(); ++ci) {
+    (*ci)->update();
+  }
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: Character::set_lod_current_delay
 //       Access: Private
@@ -826,6 +963,7 @@ r_merge_bundles(Character::JointMap &joint_map,
   }
 
   new_group->_children.swap(new_children);
+  PartGroup::mark_hierarchy_changed();
 }
 
 
@@ -29,6 +29,9 @@
 #include "transformTable.h"
 #include "transformBlendTable.h"
 #include "sliderTable.h"
+#include "workerThreadPool.h"
+
+class NodePathCollection;
 
 class CharacterJointBundle;
 class ComputedVertices;
@@ -81,6 +84,8 @@ PUBLISHED:
   void update();
   void force_update();
 
+  static void update_characters(const NodePathCollection &characters);
+
 protected:
   virtual void r_copy_children(const PandaNode *from, InstanceMap &inst_map,
                                Thread *current_thread);
@@ -92,6 +97,13 @@ private:
   void do_update();
   void set_lod_current_delay(double delay);
 
+  // Each job of update_characters() updates a group of Characters
+  // that share PartBundles.
+  typedef pvector<Character *> UpdateJob;
+  typedef pvector<UpdateJob> UpdateJobs;
+  static void update_job_func(int job_index, Thread *current_thread,
+                              void *user_data);
+
   typedef pmap<const PandaNode *, PandaNode *> NodeMap;
   typedef pmap<const PartGroup *, PartGroup *> JointMap;
   typedef pmap<const GeomVertexData *, GeomVertexData *> GeomVertexMap;
@@ -149,6 +161,7 @@ private:
   PStatCollector _joints_pcollector;
   PStatCollector _skinning_pcollector;
   static PStatCollector _animation_pcollector;
+  static PStatCollector _parallel_pcollector;
 
   // This variable is only used temporarily, while reading from the
   // bam file.
@@ -38,6 +38,14 @@ ConfigVariableBool even_animation
           "The default is to compute vertices only when they need to be "
           "computed, which can lead to an uneven frame rate."));
 
+ConfigVariableInt character_update_threads
+("character-update-threads", 1,
+ PRC_DESC("The number of threads that share the work when many characters "
+          "are animated together with Character::update_characters().  "
+          "Each thread updates the joints of a different character.  "
+          "The default of 1 updates them one at a time in the calling "
+          "thread."));
+
 
 ////////////////////////////////////////////////////////////////////
 //     Function: init_libchar
@@ -0,0 +1,898 @@
+// Filename: collisionBVH.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "collisionBVH.h"
+#include "collisionNode.h"
+#include "config_collide.h"
+#include "geomNode.h"
+#include "geom.h"
+#include "lodNode.h"
+#include "boundingSphere.h"
+#include "boundingLine.h"
+#include "finiteBoundingVolume.h"
+#include "transformState.h"
+#include "pStatTimer.h"
+#include "pmap.h"
+#include "indent.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define COLLISIONBVH_USE_SSE2
+#endif
+
+PStatCollector CollisionBVH::_update_pcollector("App:Collisions:BVH Update");
+PStatCollector CollisionBVH::_volume_pcollector("Collision Volumes:BVH");
+
+// The largest number of leaves that will be stored in one slot of a
+// node, rather than being split into another node.
+static const int max_leaves_per_slot = 4;
+
+// Used in place of an infinite coordinate, so that the box tests
+// never have to deal with inf - inf.
+static const float bvh_infinity = 1.0e30f;
+
+// Sorts leaves by the center of their boxes along a particular axis.
+class CompareLeafCenters {
+public:
+  CompareLeafCenters(int axis) : _axis(axis) { }
+  template<class Leaf>
+  bool operator () (const Leaf &a, const Leaf &b) const {
+    return (a._min[_axis] + a._max[_axis]) < (b._min[_axis] + b._max[_axis]);
+  }
+  int _axis;
+};
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::Constructor
+//       Access: Published
+//  Description: Creates a BVH for the solids at and below the
+//               indicated node.  The hierarchy is not actually built
+//               until the first call to update().
+////////////////////////////////////////////////////////////////////
+CollisionBVH::
+CollisionBVH(const NodePath &root) :
+  _root(root),
+  _all_dirty(true)
+{
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::Destructor
+//       Access: Published
+//  Description:
+////////////////////////////////////////////////////////////////////
+CollisionBVH::
+~CollisionBVH() {
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::mark_dirty
+//       Access: Published
+//  Description: Indicates that the indicated node, which should be
+//               the root or one of its descendants, has been moved,
+//               or that collision solids have been added to or
+//               removed from it or the nodes below it.  The BVH will
+//               recompute that part of the tree at the next call to
+//               update().
+//
+//               If a node has been removed from the subtree, mark its
+//               former parent dirty instead.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+mark_dirty(const NodePath &node_path) {
+  if (_all_dirty) {
+    return;
+  }
+  if (node_path == _root) {
+    mark_all_dirty();
+    return;
+  }
+
+  // There's no point in recording a path that is already covered by
+  // one we have.
+  DirtyPaths::const_iterator di;
+  for (di = _dirty.begin(); di != _dirty.end(); ++di) {
+    if ((*di) == node_path || (*di).is_ancestor_of(node_path)) {
+      return;
+    }
+  }
+  _dirty.push_back(node_path);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::update
+//       Access: Published
+//  Description: Recomputes whatever parts of the BVH have been marked
+//               dirty since the last call.  This is called
+//               automatically by the CollisionTraverser at the start
+//               of each traversal.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+update() {
+  if (!is_dirty()) {
+    return;
+  }
+
+  PStatTimer timer(_update_pcollector);
+
+  if (_all_dirty) {
+    rebuild();
+    return;
+  }
+
+  bool topology_changed = false;
+
+  DirtyPaths::const_iterator di;
+  for (di = _dirty.begin(); di != _dirty.end(); ++di) {
+    const NodePath &dirty = (*di);
+    if (dirty.is_empty() || !_root.is_ancestor_of(dirty)) {
+      // This node is no longer beneath our root, so we can't tell
+      // which of our leaves it used to own.
+      collide_cat.warning()
+        << "CollisionBVH: " << dirty << " is not below " << _root
+        << "; rebuilding.\n";
+      rebuild();
+      return;
+    }
+
+    Leaves new_leaves;
+    CPT(TransformState) transform = dirty.get_transform(_root);
+    r_collect_leaves(dirty, transform->get_mat(), get_include_mask(dirty),
+                     new_leaves);
+
+    typedef pmap<LeafKey, int> OldLeaves;
+    OldLeaves old_leaves;
+    int num_leaves = (int)_leaves.size();
+    for (int i = 0; i < num_leaves; ++i) {
+      const NodePath &leaf_path = _leaves[i]._node_path;
+      if (dirty == leaf_path || dirty.is_ancestor_of(leaf_path)) {
+        old_leaves[LeafKey(_leaves[i])] = i;
+      }
+    }
+
+    // If we have the same set of leaves as before, we can just copy
+    // in the new boxes.
+    pvector<int> indices;
+    if (new_leaves.size() == old_leaves.size()) {
+      indices.reserve(new_leaves.size());
+      Leaves::const_iterator li;
+      for (li = new_leaves.begin(); li != new_leaves.end(); ++li) {
+        OldLeaves::const_iterator oi = old_leaves.find(LeafKey(*li));
+        if (oi == old_leaves.end()) {
+          break;
+        }
+        indices.push_back((*oi).second);
+      }
+    }
+
+    if (indices.size() == new_leaves.size()) {
+      for (size_t i = 0; i < indices.size(); ++i) {
+        _leaves[indices[i]] = new_leaves[i];
+      }
+
+    } else {
+      // Otherwise, replace the old leaves with the new ones; the tree
+      // will have to be rebuilt.
+      pvector<bool> removed(num_leaves, false);
+      OldLeaves::const_iterator oi;
+      for (oi = old_leaves.begin(); oi != old_leaves.end(); ++oi) {
+        removed[(*oi).second] = true;
+      }
+      int ti = 0;
+      for (int i = 0; i < num_leaves; ++i) {
+        if (!removed[i]) {
+          if (ti != i) {
+            _leaves[ti] = _leaves[i];
+          }
+          ++ti;
+        }
+      }
+      _leaves.erase(_leaves.begin() + ti, _leaves.end());
+      _leaves.insert(_leaves.end(), new_leaves.begin(), new_leaves.end());
+      topology_changed = true;
+    }
+  }
+  _dirty.clear();
+
+  if (topology_changed) {
+    build_tree();
+  } else {
+    refit();
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::output
+//       Access: Published
+//  Description:
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+output(ostream &out) const {
+  out << "CollisionBVH " << _root << ", " << _leaves.size()
+      << " leaves, " << _nodes.size() << " nodes";
+  if (is_dirty()) {
+    out << " (dirty)";
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::write
+//       Access: Published
+//  Description:
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+write(ostream &out, int indent_level) const {
+  indent(out, indent_level) << *this << "\n";
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::query
+//       Access: Public
+//  Description: Fills results with the indices of all of the leaves
+//               whose boxes might intersect the indicated bounding
+//               volume, which should be in the coordinate space of
+//               the root node.  If bounds is NULL, all leaves are
+//               returned.
+//
+//               A BoundingLine is tested as an infinite line, which
+//               is conservative for rays and segments as well.
+//               Bounding volumes other than spheres, lines, and
+//               finite volumes are not tested at all.
+//
+//               If num_tests is not NULL, the number of boxes tested
+//               is added to it, rather than to the PStatCollector.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+query(const GeometricBoundingVolume *bounds, Results &results,
+      int *num_tests) const {
+  results.clear();
+  if (_nodes.empty() ||
+      (bounds != (GeometricBoundingVolume *)NULL && bounds->is_empty())) {
+    return;
+  }
+
+  Query q;
+  make_query(bounds, q);
+
+  // The tree is only as deep as log2 of the number of leaves, and
+  // each level can leave at most three entries behind on the stack.
+  static const int max_stack = 256;
+  int stack[max_stack];
+  int sp = 0;
+  stack[sp++] = 0;
+
+  while (sp > 0) {
+    const Node &node = _nodes[stack[--sp]];
+    int mask = test_node(node, q);
+    if (num_tests != (int *)NULL) {
+      ++(*num_tests);
+    } else {
+      _volume_pcollector.add_level(1);
+    }
+
+    for (int i = 3; i >= 0; --i) {
+      if ((mask & (1 << i)) == 0) {
+        continue;
+      }
+      if (node._num_leaves[i] == 0) {
+        nassertv(sp < max_stack);
+        stack[sp++] = node._child[i];
+      } else {
+        int begin = node._child[i];
+        int end = begin + node._num_leaves[i];
+        for (int li = begin; li < end; ++li) {
+          results.push_back(li);
+        }
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::rebuild
+//       Access: Private
+//  Description: Walks the entire subtree again and builds a new tree
+//               from scratch.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+rebuild() {
+  _leaves.clear();
+  _dirty.clear();
+  _all_dirty = false;
+
+  if (!_root.is_empty()) {
+    r_collect_leaves(_root, LMatrix4::ident_mat(), CollideMask::all_on(),
+                     _leaves);
+  }
+  build_tree();
+
+  if (collide_cat.is_debug()) {
+    collide_cat.debug()
+      << "Rebuilt " << *this << "\n";
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::r_collect_leaves
+//       Access: Private
+//  Description: Appends a Leaf for each collision solid or Geom at or
+//               below the indicated node.  mat is the transform from
+//               the node's coordinate space to the root's.
+//
+//               This visits the same nodes that the
+//               CollisionTraverser would, given the current state of
+//               any SwitchNodes, SequenceNodes, or LODNodes.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+r_collect_leaves(const NodePath &node_path, const LMatrix4 &mat,
+                 CollideMask include_mask, Leaves &leaves) const {
+  PandaNode *node = node_path.node();
+  if ((node->get_net_collide_mask() & include_mask).is_zero()) {
+    // Nothing down here could collide with anything.
+    return;
+  }
+
+  if (node->is_collision_node()) {
+    CollisionNode *cnode;
+    DCAST_INTO_V(cnode, node);
+    CollideMask into_mask = cnode->get_into_collide_mask() & include_mask;
+    if (!into_mask.is_zero()) {
+      int num_solids = cnode->get_num_solids();
+      for (int s = 0; s < num_solids; ++s) {
+        CPT(CollisionSolid) solid = cnode->get_solid(s);
+        CPT(BoundingVolume) bounds = solid->get_bounds();
+        add_leaf(leaves, node_path, solid, -1, into_mask, bounds, mat);
+      }
+    }
+
+  } else if (node->is_geom_node()) {
+    GeomNode *gnode;
+    DCAST_INTO_V(gnode, node);
+    CollideMask into_mask = gnode->get_into_collide_mask() & include_mask;
+    if (!into_mask.is_zero()) {
+      int num_geoms = gnode->get_num_geoms();
+      for (int g = 0; g < num_geoms; ++g) {
+        CPT(Geom) geom = gnode->get_geom(g);
+        CPT(BoundingVolume) bounds = geom->get_bounds();
+        add_leaf(leaves, node_path, NULL, g, into_mask, bounds, mat);
+      }
+    }
+  }
+
+  if (node->has_single_child_visibility()) {
+    int index = node->get_visible_child();
+    if (index >= 0 && index < node->get_num_children()) {
+      PandaNode *child = node->get_child(index);
+      r_collect_leaves(NodePath(node_path, child),
+                       child->get_transform()->get_mat() * mat,
+                       include_mask, leaves);
+    }
+
+  } else if (node->is_lod_node()) {
+    // As in the CollisionTraverser, only the lowest level of detail
+    // may collide with visible geometry.
+    int index = DCAST(LODNode, node)->get_lowest_switch();
+    PandaNode::Children children = node->get_children();
+    int num_children = children.get_num_children();
+    for (int i = 0; i < num_children; ++i) {
+      PandaNode *child = children.get_child(i);
+      CollideMask child_mask = include_mask;
+      if (i != index) {
+        child_mask &= ~GeomNode::get_default_collide_mask();
+      }
+      r_collect_leaves(NodePath(node_path, child),
+                       child->get_transform()->get_mat() * mat,
+                       child_mask, leaves);
+    }
+
+  } else {
+    PandaNode::Children children = node->get_children();
+    int num_children = children.get_num_children();
+    for (int i = 0; i < num_children; ++i) {
+      PandaNode *child = children.get_child(i);
+      r_collect_leaves(NodePath(node_path, child),
+                       child->get_transform()->get_mat() * mat,
+                       include_mask, leaves);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::get_include_mask
+//       Access: Private
+//  Description: Returns the include mask that r_collect_leaves()
+//               would have arrived at by the time it reached the
+//               indicated node, having started at the root.
+////////////////////////////////////////////////////////////////////
+CollideMask CollisionBVH::
+get_include_mask(const NodePath &node_path) const {
+  CollideMask include_mask = CollideMask::all_on();
+
+  NodePath child = node_path;
+  while (child != _root && child.has_parent()) {
+    NodePath parent = child.get_parent();
+    PandaNode *pnode = parent.node();
+    if (pnode->is_lod_node()) {
+      int index = DCAST(LODNode, pnode)->get_lowest_switch();
+      if (pnode->find_child(child.node()) != index) {
+        include_mask &= ~GeomNode::get_default_collide_mask();
+      }
+    }
+    child = parent;
+  }
+
+  return include_mask;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::add_leaf
+//       Access: Private, Static
+//  Description: Computes the box, in the root's coordinate space, of
+//               the indicated bounding volume, and appends a new Leaf
+//               with that box.  Leaves with empty bounding volumes
+//               are not added, since nothing can collide with them.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+add_leaf(Leaves &leaves, const NodePath &node_path,
+         const CollisionSolid *solid, int geom_index,
+         CollideMask into_mask, const BoundingVolume *bounds,
+         const LMatrix4 &mat) {
+  if (bounds->is_empty()) {
+    return;
+  }
+
+  Leaf leaf;
+  leaf._node_path = node_path;
+  leaf._solid = solid;
+  leaf._geom_index = geom_index;
+  leaf._into_mask = into_mask;
+
+  const FiniteBoundingVolume *fbv = bounds->as_finite_bounding_volume();
+  if (bounds->is_infinite() || fbv == (FiniteBoundingVolume *)NULL) {
+    for (int j = 0; j < 3; ++j) {
+      leaf._min[j] = -bvh_infinity;
+      leaf._max[j] = bvh_infinity;
+    }
+
+  } else {
+    LPoint3 bmin = fbv->get_min();
+    LPoint3 bmax = fbv->get_max();
+    for (int j = 0; j < 3; ++j) {
+      leaf._min[j] = bvh_infinity;
+      leaf._max[j] = -bvh_infinity;
+    }
+    for (int i = 0; i < 8; ++i) {
+      LPoint3 p((i & 1) ? bmax[0] : bmin[0],
+                (i & 2) ? bmax[1] : bmin[1],
+                (i & 4) ? bmax[2] : bmin[2]);
+      p = mat.xform_point(p);
+      for (int j = 0; j < 3; ++j) {
+        leaf._min[j] = min(leaf._min[j], (float)p[j]);
+        leaf._max[j] = max(leaf._max[j], (float)p[j]);
+      }
+    }
+
+    // Pad the box a little, to allow for roundoff in the transform and
+    // in the conversion to single precision.
+    for (int j = 0; j < 3; ++j) {
+      float pad = (leaf._max[j] - leaf._min[j]) * 1.0e-4f + 1.0e-4f;
+      leaf._min[j] -= pad;
+      leaf._max[j] += pad;
+    }
+  }
+
+  leaves.push_back(leaf);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::build_tree
+//       Access: Private
+//  Description: Builds a new tree over the current set of leaves,
+//               reordering _leaves so that each node's leaves are
+//               consecutive.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+build_tree() {
+  _nodes.clear();
+  if (_leaves.empty()) {
+    return;
+  }
+
+  _nodes.reserve(_leaves.size() / 2 + 1);
+  r_build(0, (int)_leaves.size());
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::r_build
+//       Access: Private
+//  Description: Creates a new node for the leaves in the range [begin,
+//               end), dividing them into up to four slots, and
+//               recursing on any slot with too many leaves.  Returns
+//               the index of the new node.
+////////////////////////////////////////////////////////////////////
+int CollisionBVH::
+r_build(int begin, int end) {
+  int index = (int)_nodes.size();
+  _nodes.push_back(Node());
+
+  // Keep splitting the largest range in half until we have four of
+  // them, or they are all small enough already.
+  int bounds[5];
+  int num_ranges = 1;
+  bounds[0] = begin;
+  bounds[1] = end;
+  while (num_ranges < 4) {
+    int best = -1;
+    int best_size = max_leaves_per_slot;
+    for (int i = 0; i < num_ranges; ++i) {
+      int size = bounds[i + 1] - bounds[i];
+      if (size > best_size) {
+        best = i;
+        best_size = size;
+      }
+    }
+    if (best < 0) {
+      break;
+    }
+
+    int mid = split_leaves(bounds[best], bounds[best + 1]);
+    for (int i = num_ranges; i > best; --i) {
+      bounds[i + 1] = bounds[i];
+    }
+    bounds[best + 1] = mid;
+    ++num_ranges;
+  }
+
+  Node node;
+  node._valid_mask = 0;
+  static const float empty_min[3] = { bvh_infinity, bvh_infinity, bvh_infinity };
+  static const float empty_max[3] = { -bvh_infinity, -bvh_infinity, -bvh_infinity };
+  for (int i = 0; i < 4; ++i) {
+    set_child_bounds(node, i, empty_min, empty_max);
+    node._child[i] = 0;
+    node._num_leaves[i] = 0;
+  }
+
+  for (int i = 0; i < num_ranges; ++i) {
+    int range_begin = bounds[i];
+    int range_end = bounds[i + 1];
+    float min_p[3], max_p[3];
+    if (range_end - range_begin <= max_leaves_per_slot) {
+      node._child[i] = range_begin;
+      node._num_leaves[i] = range_end - range_begin;
+      compute_leaf_bounds(range_begin, range_end, min_p, max_p);
+    } else {
+      int child = r_build(range_begin, range_end);
+      node._child[i] = child;
+      node._num_leaves[i] = 0;
+      compute_node_bounds(_nodes[child], min_p, max_p);
+    }
+    set_child_bounds(node, i, min_p, max_p);
+    node._valid_mask |= (1 << i);
+  }
+
+  // _nodes may have been reallocated by the recursive calls, so we
+  // don't store the new node until now.
+  _nodes[index] = node;
+  return index;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::split_leaves
+//       Access: Private
+//  Description: Partitions the leaves in the range [begin, end) about
+//               the median of their centers along the axis on which
+//               the centers are most spread out.  Returns the index of
+//               the first leaf of the upper half.
+////////////////////////////////////////////////////////////////////
+int CollisionBVH::
+split_leaves(int begin, int end) {
+  float min_c[3], max_c[3];
+  for (int j = 0; j < 3; ++j) {
+    min_c[j] = bvh_infinity;
+    max_c[j] = -bvh_infinity;
+  }
+  for (int i = begin; i < end; ++i) {
+    const Leaf &leaf = _leaves[i];
+    for (int j = 0; j < 3; ++j) {
+      float c = (leaf._min[j] + leaf._max[j]) * 0.5f;
+      min_c[j] = min(min_c[j], c);
+      max_c[j] = max(max_c[j], c);
+    }
+  }
+
+  int axis = 0;
+  for (int j = 1; j < 3; ++j) {
+    if (max_c[j] - min_c[j] > max_c[axis] - min_c[axis]) {
+      axis = j;
+    }
+  }
+
+  int mid = (begin + end) / 2;
+  nth_element(_leaves.begin() + begin, _leaves.begin() + mid,
+              _leaves.begin() + end, CompareLeafCenters(axis));
+  return mid;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::compute_leaf_bounds
+//       Access: Private
+//  Description: Computes the box around the leaves in the range
+//               [begin, end).
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+compute_leaf_bounds(int begin, int end, float min_p[3], float max_p[3]) const {
+  for (int j = 0; j < 3; ++j) {
+    min_p[j] = bvh_infinity;
+    max_p[j] = -bvh_infinity;
+  }
+  for (int i = begin; i < end; ++i) {
+    const Leaf &leaf = _leaves[i];
+    for (int j = 0; j < 3; ++j) {
+      min_p[j] = min(min_p[j], leaf._min[j]);
+      max_p[j] = max(max_p[j], leaf._max[j]);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::compute_node_bounds
+//       Access: Private, Static
+//  Description: Computes the box around all of the occupied slots of
+//               the indicated node.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+compute_node_bounds(const Node &node, float min_p[3], float max_p[3]) {
+  for (int j = 0; j < 3; ++j) {
+    min_p[j] = bvh_infinity;
+    max_p[j] = -bvh_infinity;
+  }
+  for (int i = 0; i < 4; ++i) {
+    if ((node._valid_mask & (1 << i)) != 0) {
+      min_p[0] = min(min_p[0], node._min_x[i]);
+      min_p[1] = min(min_p[1], node._min_y[i]);
+      min_p[2] = min(min_p[2], node._min_z[i]);
+      max_p[0] = max(max_p[0], node._max_x[i]);
+      max_p[1] = max(max_p[1], node._max_y[i]);
+      max_p[2] = max(max_p[2], node._max_z[i]);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::set_child_bounds
+//       Access: Private, Static
+//  Description: Stores the box of the ith slot of the node.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+set_child_bounds(Node &node, int i, const float min_p[3], const float max_p[3]) {
+  node._min_x[i] = min_p[0];
+  node._min_y[i] = min_p[1];
+  node._min_z[i] = min_p[2];
+  node._max_x[i] = max_p[0];
+  node._max_y[i] = max_p[1];
+  node._max_z[i] = max_p[2];
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::refit
+//       Access: Private
+//  Description: Recomputes the boxes of all of the nodes from the
+//               boxes of the leaves, without changing the shape of
+//               the tree.  This is used when leaves have moved, but
+//               none have been added or removed.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+refit() {
+  // Each node is always stored after its parent, so by walking
+  // backwards we refit the children before the parents that depend
+  // on them.
+  for (int ni = (int)_nodes.size() - 1; ni >= 0; --ni) {
+    Node &node = _nodes[ni];
+    for (int i = 0; i < 4; ++i) {
+      if ((node._valid_mask & (1 << i)) != 0) {
+        float min_p[3], max_p[3];
+        if (node._num_leaves[i] != 0) {
+          compute_leaf_bounds(node._child[i], node._child[i] + node._num_leaves[i],
+                              min_p, max_p);
+        } else {
+          compute_node_bounds(_nodes[node._child[i]], min_p, max_p);
+        }
+        set_child_bounds(node, i, min_p, max_p);
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::make_query
+//       Access: Private, Static
+//  Description: Extracts the parameters of the indicated bounding
+//               volume that test_node() will need.
+////////////////////////////////////////////////////////////////////
+void CollisionBVH::
+make_query(const GeometricBoundingVolume *bounds, Query &q) {
+  q._type = QT_all;
+  if (bounds == (GeometricBoundingVolume *)NULL || bounds->is_infinite()) {
+    return;
+  }
+
+  const BoundingSphere *sphere = bounds->as_bounding_sphere();
+  if (sphere != (BoundingSphere *)NULL) {
+    LPoint3 center = sphere->get_center();
+    float radius = (float)sphere->get_radius();
+    q._type = QT_sphere;
+    q._a[0] = (float)center[0];
+    q._a[1] = (float)center[1];
+    q._a[2] = (float)center[2];
+    q._radius_sq = radius * radius;
+    return;
+  }
+
+  const BoundingLine *line = bounds->as_bounding_line();
+  if (line != (BoundingLine *)NULL) {
+    LPoint3 a = line->get_point_a();
+    LVector3 dir = line->get_point_b() - a;
+    q._type = QT_line;
+    for (int j = 0; j < 3; ++j) {
+      // Store the reciprocal of the direction, avoiding infinities,
+      // which would produce NaNs in the slab test.
+      float d = (float)dir[j];
+      if (d >= 0.0f && d < 1.0e-20f) {
+        d = 1.0e-20f;
+      } else if (d < 0.0f && d > -1.0e-20f) {
+        d = -1.0e-20f;
+      }
+      q._a[j] = (float)a[j];
+      q._b[j] = 1.0f / d;
+    }
+    return;
+  }
+
+  const FiniteBoundingVolume *fbv = bounds->as_finite_bounding_volume();
+  if (fbv != (FiniteBoundingVolume *)NULL) {
+    LPoint3 bmin = fbv->get_min();
+    LPoint3 bmax = fbv->get_max();
+    q._type = QT_box;
+    for (int j = 0; j < 3; ++j) {
+      q._a[j] = (float)bmin[j];
+      q._b[j] = (float)bmax[j];
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionBVH::test_node
+//       Access: Private, Static
+//  Description: Tests the query volume against all four boxes of the
+//               node at once, and returns a bitmask of the slots that
+//               it might intersect.
+////////////////////////////////////////////////////////////////////
+int CollisionBVH::
+test_node(const Node &node, const Query &q) {
+#ifdef COLLISIONBVH_USE_SSE2
+  __m128 min_x = _mm_loadu_ps(node._min_x);
+  __m128 min_y = _mm_loadu_ps(node._min_y);
+  __m128 min_z = _mm_loadu_ps(node._min_z);
+  __m128 max_x = _mm_loadu_ps(node._max_x);
+  __m128 max_y = _mm_loadu_ps(node._max_y);
+  __m128 max_z = _mm_loadu_ps(node._max_z);
+  int mask;
+
+  switch (q._type) {
+  case QT_sphere:
+    {
+      // Distance from the center to the nearest point of each box.
+      __m128 zero = _mm_setzero_ps();
+      __m128 cx = _mm_set1_ps(q._a[0]);
+      __m128 cy = _mm_set1_ps(q._a[1]);
+      __m128 cz = _mm_set1_ps(q._a[2]);
+      __m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(min_x, cx), _mm_sub_ps(cx, max_x)), zero);
+      __m128 dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(min_y, cy), _mm_sub_ps(cy, max_y)), zero);
+      __m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(min_z, cz), _mm_sub_ps(cz, max_z)), zero);
+      __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                             _mm_mul_ps(dz, dz));
+      mask = _mm_movemask_ps(_mm_cmple_ps(d2, _mm_set1_ps(q._radius_sq)));
+    }
+    break;
+
+  case QT_box:
+    {
+      __m128 in_x = _mm_and_ps(_mm_cmple_ps(min_x, _mm_set1_ps(q._b[0])),
+                               _mm_cmpge_ps(max_x, _mm_set1_ps(q._a[0])));
+      __m128 in_y = _mm_and_ps(_mm_cmple_ps(min_y, _mm_set1_ps(q._b[1])),
+                               _mm_cmpge_ps(max_y, _mm_set1_ps(q._a[1])));
+      __m128 in_z = _mm_and_ps(_mm_cmple_ps(min_z, _mm_set1_ps(q._b[2])),
+                               _mm_cmpge_ps(max_z, _mm_set1_ps(q._a[2])));
+      mask = _mm_movemask_ps(_mm_and_ps(_mm_and_ps(in_x, in_y), in_z));
+    }
+    break;
+
+  case QT_line:
+    {
+      // The slab test: the line intersects the box if the intervals
+      // over which it lies between each pair of planes overlap.
+      __m128 ox = _mm_set1_ps(q._a[0]);
+      __m128 oy = _mm_set1_ps(q._a[1]);
+      __m128 oz = _mm_set1_ps(q._a[2]);
+      __m128 ix = _mm_set1_ps(q._b[0]);
+      __m128 iy = _mm_set1_ps(q._b[1]);
+      __m128 iz = _mm_set1_ps(q._b[2]);
+      __m128 tx0 = _mm_mul_ps(_mm_sub_ps(min_x, ox), ix);
+      __m128 tx1 = _mm_mul_ps(_mm_sub_ps(max_x, ox), ix);
+      __m128 ty0 = _mm_mul_ps(_mm_sub_ps(min_y, oy), iy);
+      __m128 ty1 = _mm_mul_ps(_mm_sub_ps(max_y, oy), iy);
+      __m128 tz0 = _mm_mul_ps(_mm_sub_ps(min_z, oz), iz);
+      __m128 tz1 = _mm_mul_ps(_mm_sub_ps(max_z, oz), iz);
+      __m128 t_near = _mm_max_ps(_mm_max_ps(_mm_min_ps(tx0, tx1), _mm_min_ps(ty0, ty1)),
+                                 _mm_min_ps(tz0, tz1));
+      __m128 t_far = _mm_min_ps(_mm_min_ps(_mm_max_ps(tx0, tx1), _mm_max_ps(ty0, ty1)),
+                                _mm_max_ps(tz0, tz1));
+      mask = _mm_movemask_ps(_mm_cmple_ps(t_near, t_far));
+    }
+    break;
+
+  default:
+    mask = 0xf;
+  }
+
+  return mask & node._valid_mask;
+
+#else  // COLLISIONBVH_USE_SSE2
+  int mask = 0;
+  for (int i = 0; i < 4; ++i) {
+    bool in;
+    switch (q._type) {
+    case QT_sphere:
+      {
+        float dx = max(max(node._min_x[i] - q._a[0], q._a[0] - node._max_x[i]), 0.0f);
+        float dy = max(max(node._min_y[i] - q._a[1], q._a[1] - node._max_y[i]), 0.0f);
+        float dz = max(max(node._min_z[i] - q._a[2], q._a[2] - node._max_z[i]), 0.0f);
+        in = (dx * dx + dy * dy + dz * dz <= q._radius_sq);
+      }
+      break;
+
+    case QT_box:
+      in = (node._min_x[i] <= q._b[0] && node._max_x[i] >= q._a[0] &&
+            node._min_y[i] <= q._b[1] && node._max_y[i] >= q._a[1] &&
+            node._min_z[i] <= q._b[2] && node._max_z[i] >= q._a[2]);
+      break;
+
+    case QT_line:
+      {
+        float tx0 = (node._min_x[i] - q._a[0]) * q._b[0];
+        float tx1 = (node._max_x[i] - q._a[0]) * q._b[0];
+        float ty0 = (node._min_y[i] - q._a[1]) * q._b[1];
+        float ty1 = (node._max_y[i] - q._a[1]) * q._b[1];
+        float tz0 = (node._min_z[i] - q._a[2]) * q._b[2];
+        float tz1 = (node._max_z[i] - q._a[2]) * q._b[2];
+        float t_near = max(max(min(tx0, tx1), min(ty0, ty1)), min(tz0, tz1));
+        float t_far = min(min(max(tx0, tx1), max(ty0, ty1)), max(tz0, tz1));
+        in = (t_near <= t_far);
+      }
+      break;
+
+    default:
+      in = true;
+    }
+    if (in) {
+      mask |= (1 << i);
+    }
+  }
+
+  return mask & node._valid_mask;
+#endif  // COLLISIONBVH_USE_SSE2
+}
@@ -0,0 +1,202 @@
+// Filename: collisionBVH.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef COLLISIONBVH_H
+#define COLLISIONBVH_H
+
+#include "pandabase.h"
+
+#include "referenceCount.h"
+#include "nodePath.h"
+#include "collisionSolid.h"
+#include "collideMask.h"
+#include "geometricBoundingVolume.h"
+#include "pointerTo.h"
+#include "pvector.h"
+#include "pStatCollector.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : CollisionBVH
+// Description : A flattened bounding volume hierarchy over all of the
+//               collision solids and visible Geoms at or below a
+//               static subtree of the scene graph.
+//
+//               Normally, the CollisionTraverser visits every node
+//               in the scene graph and compares each collider against
+//               each node's BoundingVolume in turn.  When a large part
+//               of the scene never moves (for instance, the terrain
+//               and buildings of a level), it is much faster to
+//               collect all of the solids beneath it once, compute an
+//               axis-aligned box for each one in the coordinate
+//               space of the subtree's root, and arrange these boxes
+//               into a tree in which each node stores the boxes of
+//               its four children side by side.  Four boxes can then
+//               be tested against a collider with a single set of
+//               SIMD instructions, and the traversal touches only a
+//               few contiguous arrays instead of chasing pointers
+//               through the scene graph.
+//
+//               Pass this object to
+//               CollisionTraverser::add_static_bvh(); thereafter,
+//               when the traverser reaches the root node of the
+//               subtree, it will consult the BVH instead of walking
+//               the nodes below it.  The CollisionEntries it
+//               generates are exactly those that would have been
+//               generated by the ordinary traversal, and are
+//               delivered to the same CollisionHandlers, although
+//               perhaps in a different order.
+//
+//               The hierarchy is not automatically notified when
+//               something changes beneath the root.  If a node is
+//               moved, or solids are added or removed, call
+//               mark_dirty() on that node (or on its parent, if it
+//               was removed); the affected part of the BVH will be
+//               recomputed the next time update() is called, which
+//               the CollisionTraverser does at the start of each
+//               traversal.  If only transforms have changed, the
+//               boxes are simply refit in place; if solids have been
+//               added or removed, the tree is rebuilt from the
+//               existing list of boxes.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_COLLIDE CollisionBVH : public ReferenceCount {
+PUBLISHED:
+  CollisionBVH(const NodePath &root);
+  ~CollisionBVH();
+
+  INLINE const NodePath &get_root() const;
+
+  void mark_dirty(const NodePath &node_path);
+  INLINE void mark_all_dirty();
+  INLINE bool is_dirty() const;
+  void update();
+
+  INLINE int get_num_leaves() const;
+  INLINE int get_num_nodes() const;
+
+  void output(ostream &out) const;
+  void write(ostream &out, int indent_level = 0) const;
+
+public:
+  typedef pvector<int> Results;
+  void query(const GeometricBoundingVolume *bounds, Results &results,
+             int *num_tests = NULL) const;
+
+  INLINE const NodePath &get_leaf_node_path(int n) const;
+  INLINE const CollisionSolid *get_leaf_solid(int n) const;
+  INLINE int get_leaf_geom_index(int n) const;
+  INLINE CollideMask get_leaf_into_mask(int n) const;
+
+  INLINE static void flush_level();
+
+private:
+  // One CollisionSolid of a CollisionNode, or one Geom of a GeomNode,
+  // with its bounding box in the coordinate space of _root.
+  class Leaf {
+  public:
+    NodePath _node_path;
+    CPT(CollisionSolid) _solid;
+    int _geom_index;
+    CollideMask _into_mask;
+    float _min[3];
+    float _max[3];
+  };
+  typedef pvector<Leaf> Leaves;
+
+  // Identifies a Leaf independently of its position in _leaves, so
+  // that it may be matched up again after it has been recomputed.
+  class LeafKey {
+  public:
+    INLINE LeafKey(const Leaf &leaf);
+    INLINE bool operator < (const LeafKey &other) const;
+
+    NodePath _node_path;
+    const CollisionSolid *_solid;
+    int _geom_index;
+  };
+
+  // A node of the tree has up to four children, stored as a
+  // structure of arrays so that all four boxes can be loaded into SIMD
+  // registers at once.  Each child is either another Node, in which
+  // case _num_leaves is 0 and _child is its index in _nodes, or a run
+  // of _num_leaves consecutive Leaves beginning at index _child.
+  class Node {
+  public:
+    float _min_x[4], _min_y[4], _min_z[4];
+    float _max_x[4], _max_y[4], _max_z[4];
+    int _child[4];
+    int _num_leaves[4];
+    int _valid_mask;
+  };
+  typedef pvector<Node> Nodes;
+
+  enum QueryType {
+    QT_all,
+    QT_sphere,
+    QT_box,
+    QT_line,
+  };
+
+  // The collider's bounding volume, reduced to the few numbers needed
+  // to test it against a node.
+  class Query {
+  public:
+    QueryType _type;
+    float _a[3];
+    float _b[3];
+    float _radius_sq;
+  };
+
+  void rebuild();
+  void r_collect_leaves(const NodePath &node_path, const LMatrix4 &mat,
+                        CollideMask include_mask, Leaves &leaves) const;
+  CollideMask get_include_mask(const NodePath &node_path) const;
+  static void add_leaf(Leaves &leaves, const NodePath &node_path,
+                       const CollisionSolid *solid, int geom_index,
+                       CollideMask into_mask, const BoundingVolume *bounds,
+                       const LMatrix4 &mat);
+
+  void build_tree();
+  int r_build(int begin, int end);
+  int split_leaves(int begin, int end);
+  void compute_leaf_bounds(int begin, int end, float min_p[3], float max_p[3]) const;
+  static void compute_node_bounds(const Node &node, float min_p[3], float max_p[3]);
+  static void set_child_bounds(Node &node, int i, const float min_p[3], const float max_p[3]);
+  void refit();
+
+  static void make_query(const GeometricBoundingVolume *bounds, Query &q);
+  static int test_node(const Node &node, const Query &q);
+
+private:
+  NodePath _root;
+  Leaves _leaves;
+  Nodes _nodes;
+
+  typedef pvector<NodePath> DirtyPaths;
+  DirtyPaths _dirty;
+  bool _all_dirty;
+
+  static PStatCollector _update_pcollector;
+  static PStatCollector _volume_pcollector;
+
+  friend class CollisionTraverser;
+};
+
+INLINE ostream &operator << (ostream &out, const CollisionBVH &bvh) {
+  bvh.output(out);
+  return out;
+}
+
+#include "collisionBVH.I"
+
+#endif
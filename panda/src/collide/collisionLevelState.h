@@ -21,6 +21,7 @@
 #include "collisionNode.h"
 #include "bitMask.h"
 #include "doubleBitMask.h"
+#include "bitArray.h"
 
 ////////////////////////////////////////////////////////////////////
 //       Class : CollisionLevelState
@@ -48,7 +49,7 @@ public:
   INLINE void clear();
   INLINE void prepare_collider(const ColliderDef &def, const NodePath &root);
 
-  bool any_in_bounds();
+  bool any_in_bounds(int *num_tests = NULL);
   bool apply_transform();
 
   INLINE static bool has_max_colliders();
@@ -76,11 +77,13 @@ private:
 
 // Now instantiate a handful of implementations of CollisionLevelState:
 // one that uses a word-at-a-time bitmask to track the active
-// colliders, and a couple that use more words at a time.
+// colliders, a couple that use more words at a time, and one that
+// uses a BitArray, which has no upper limit at all.
 
 typedef CollisionLevelState<BitMaskNative> CollisionLevelStateSingle;
 typedef CollisionLevelState<DoubleBitMaskNative> CollisionLevelStateDouble;
 typedef CollisionLevelState<QuadBitMaskNative> CollisionLevelStateQuad;
+typedef CollisionLevelState<BitArray> CollisionLevelStateArray;
 
 #endif
 
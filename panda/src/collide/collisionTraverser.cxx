@@ -35,6 +35,7 @@
 #include "lodNode.h"
 #include "nodePath.h"
 #include "pStatTimer.h"
+#include "workerThreadPool.h"
 #include "indent.h"
 
 #include <algorithm>
@@ -44,6 +45,8 @@ PStatCollector CollisionTraverser::_collisions_pcollector("App:Collisions");
 PStatCollector CollisionTraverser::_cnode_volume_pcollector("Collision Volumes:CollisionNode");
 PStatCollector CollisionTraverser::_gnode_volume_pcollector("Collision Volumes:GeomNode");
 PStatCollector CollisionTraverser::_geom_volume_pcollector("Collision Volumes:Geom");
+PStatCollector CollisionTraverser::_parallel_pcollector("App:Collisions:Parallel");
+PStatCollector CollisionTraverser::_merge_pcollector("App:Collisions:Parallel:Merge");
 
 TypeHandle CollisionTraverser::_type_handle;
 
@@ -64,6 +67,23 @@ public:
   const CollisionTraverser &_trav;
 };
 
+// This function object class is used in traverse_parallel(), below,
+// to put the entries found by all of the threads back into the order
+// in which a single thread would have found them.
+class SortByTraversalOrder {
+public:
+  inline bool operator () (const CollisionTraverser::BufferedEntry &a,
+                           const CollisionTraverser::BufferedEntry &b) const {
+    if (a._key != b._key) {
+      return a._key < b._key;
+    }
+    if (a._rank != b._rank) {
+      return a._rank < b._rank;
+    }
+    return a._seq < b._seq;
+  }
+};
+
 ////////////////////////////////////////////////////////////////////
 //     Function: CollisionTraverser::Constructor
 //       Access: Published
@@ -75,6 +95,8 @@ CollisionTraverser(const string &name) :
   _this_pcollector(_collisions_pcollector, name)
 {
   _respect_prev_transform = respect_prev_transform;
+  _num_threads = 1;
+  _buffer_entries = false;
   #ifdef DO_COLLISION_RECORDING
   _recorder = (CollisionRecorder *)NULL;
   #endif
@@ -90,6 +112,11 @@ CollisionTraverser::
   #ifdef DO_COLLISION_RECORDING
   clear_recorder();
   #endif
+
+  Workers::iterator wi;
+  for (wi = _workers.begin(); wi != _workers.end(); ++wi) {
+    delete (*wi);
+  }
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -269,6 +296,110 @@ clear_colliders() {
   _handlers.clear();
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::add_static_bvh
+//       Access: Published
+//  Description: Adds a CollisionBVH describing a static part of the
+//               scene graph.  Thereafter, when the traversal reaches
+//               the BVH's root node, the colliders will be tested
+//               against the BVH instead of against the nodes below
+//               it.  The BVH is brought up to date at the start of
+//               each traversal; see CollisionBVH::mark_dirty().
+////////////////////////////////////////////////////////////////////
+void CollisionTraverser::
+add_static_bvh(CollisionBVH *bvh) {
+  nassertv(bvh != (CollisionBVH *)NULL && !bvh->get_root().is_empty());
+  if (find(_static_bvhs.begin(), _static_bvhs.end(), bvh) == _static_bvhs.end()) {
+    _static_bvhs.push_back(bvh);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::remove_static_bvh
+//       Access: Published
+//  Description: Removes a CollisionBVH previously added with
+//               add_static_bvh().  Returns true if it was found,
+//               false if it was not.
+////////////////////////////////////////////////////////////////////
+bool CollisionTraverser::
+remove_static_bvh(CollisionBVH *bvh) {
+  StaticBVHs::iterator bi = find(_static_bvhs.begin(), _static_bvhs.end(), bvh);
+  if (bi == _static_bvhs.end()) {
+    return false;
+  }
+  _static_bvhs.erase(bi);
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::get_num_static_bvhs
+//       Access: Published
+//  Description: Returns the number of CollisionBVHs that have been
+//               added to the traverser.
+////////////////////////////////////////////////////////////////////
+int CollisionTraverser::
+get_num_static_bvhs() const {
+  return _static_bvhs.size();
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::get_static_bvh
+//       Access: Published
+//  Description: Returns the nth CollisionBVH that has been added to
+//               the traverser.
+////////////////////////////////////////////////////////////////////
+CollisionBVH *CollisionTraverser::
+get_static_bvh(int n) const {
+  nassertr(n >= 0 && n < (int)_static_bvhs.size(), NULL);
+  return _static_bvhs[n];
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::clear_static_bvhs
+//       Access: Published
+//  Description: Removes all of the CollisionBVHs from the traverser,
+//               so that the scene graph is traversed normally
+//               everywhere.
+////////////////////////////////////////////////////////////////////
+void CollisionTraverser::
+clear_static_bvhs() {
+  _static_bvhs.clear();
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::set_num_threads
+//       Access: Published
+//  Description: Specifies the number of threads that should share the
+//               work of each call to traverse().  The colliders are
+//               divided among the threads, each of which walks the
+//               scene graph with its own share of them.  The
+//               CollisionEntries found by each thread are saved up and
+//               handed to the CollisionHandlers once all of the
+//               threads have finished, in the same order in which a
+//               single-pass traversal would have found them, so the
+//               results do not depend on the number of threads.
+//
+//               The default is 1, which performs the traversal
+//               entirely within the calling thread.  Multiple threads
+//               are not used while a CollisionRecorder is attached.
+//
+//               The threads are shared with all other
+//               CollisionTraversers that ask for the same number.
+////////////////////////////////////////////////////////////////////
+void CollisionTraverser::
+set_num_threads(int num_threads) {
+  num_threads = max(num_threads, 1);
+  if (num_threads == _num_threads) {
+    return;
+  }
+  _num_threads = num_threads;
+  if (_num_threads > 1) {
+    _thread_pool = WorkerThreadPool::get_shared("Collision", _num_threads);
+  } else {
+    _thread_pool = NULL;
+  }
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: CollisionTraverser::traverse
 //       Access: Published
@@ -292,15 +423,38 @@ traverse(const NodePath &root) {
     (*hi).first->begin_group();
   }
 
+  StaticBVHs::iterator bi;
+  for (bi = _static_bvhs.begin(); bi != _static_bvhs.end(); ++bi) {
+    (*bi)->update();
+  }
+
+  // If we are allowed to use a BitArray, we never need more than one
+  // pass.
+  bool allow_multiple_passes = !allow_collider_array;
+
   bool traversal_done = false;
-  if ((int)_colliders.size() <= CollisionLevelStateSingle::get_max_colliders() ||
-      !allow_collider_multiple) {
+  if (_thread_pool != (WorkerThreadPool *)NULL && _colliders.size() > 1) {
+    bool can_thread = true;
+#ifdef DO_COLLISION_RECORDING
+    // The recorder is not prepared to be called from multiple threads.
+    can_thread = !has_recorder();
+#endif  // DO_COLLISION_RECORDING
+    if (can_thread) {
+      traverse_parallel(root);
+      traversal_done = true;
+    }
+  }
+
+  if (!traversal_done &&
+      ((int)_colliders.size() <= CollisionLevelStateSingle::get_max_colliders() ||
+       (!allow_collider_multiple && allow_multiple_passes))) {
     // Use the single-word-at-a-time traverser, which might need to make
     // lots of passes.
     LevelStatesSingle level_states;
     prepare_colliders_single(level_states, root);
 
-    if (level_states.size() == 1 || !allow_collider_multiple) {
+    if (level_states.size() == 1 ||
+        (!allow_collider_multiple && allow_multiple_passes)) {
       traversal_done = true;
 
       // Make a number of passes, one for each group of 32 Colliders (or
@@ -314,7 +468,7 @@ traverse(const NodePath &root) {
     }
   }
 
-  if (!traversal_done &&
+  if (!traversal_done && allow_collider_multiple &&
       (int)_colliders.size() <= CollisionLevelStateDouble::get_max_colliders()) {
     // Try the double-word-at-a-time traverser.
     LevelStatesDouble level_states;
@@ -332,18 +486,39 @@ traverse(const NodePath &root) {
     }
   }
 
-  if (!traversal_done) {
+  if (!traversal_done && allow_collider_multiple &&
+      ((int)_colliders.size() <= CollisionLevelStateQuad::get_max_colliders() ||
+       allow_multiple_passes)) {
     // OK, do the quad-word-at-a-time traverser.
     LevelStatesQuad level_states;
     prepare_colliders_quad(level_states, root);
 
+    if (level_states.size() == 1 || allow_multiple_passes) {
+      traversal_done = true;
+
+      for (size_t pass = 0; pass < level_states.size(); ++pass) {
+#ifdef DO_PSTATS
+        PStatTimer pass_timer(get_pass_collector(pass));
+#endif
+        r_traverse_quad(level_states[pass], pass);
+      }
+    }
+  }
+
+  if (!traversal_done) {
+    // There are too many colliders to fit in any of the fixed-size
+    // masks; use a BitArray, which can hold all of them, so that we
+    // only have to walk the scene graph once.
+    CollisionLevelStateArray level_state(root);
+    prepare_colliders_array(level_state, root);
+
     traversal_done = true;
 
-    for (size_t pass = 0; pass < level_states.size(); ++pass) {
+    if (level_state.get_num_colliders() != 0) {
 #ifdef DO_PSTATS
-      PStatTimer pass_timer(get_pass_collector(pass));
+      PStatTimer pass_timer(get_pass_collector(0));
 #endif
-      r_traverse_quad(level_states[pass], pass);
+      r_traverse_array(level_state, 0);
     }
   }
 
@@ -367,6 +542,7 @@ traverse(const NodePath &root) {
   _cnode_volume_pcollector.flush_level();
   _gnode_volume_pcollector.flush_level();
   _geom_volume_pcollector.flush_level();
+  CollisionBVH::flush_level();
 
   CollisionSphere::flush_level();
   CollisionTube::flush_level();
@@ -542,7 +718,7 @@ prepare_colliders_single(CollisionTraverser::LevelStatesSingle &level_states,
   for (i = 0; i < num_colliders; ++i) {
     indirect[i] = i;
   }
-  sort(indirect, indirect + num_colliders, SortByColliderSort(*this));
+  stable_sort(indirect, indirect + num_colliders, SortByColliderSort(*this));
 
   int num_remaining_colliders = num_colliders;
   for (i = 0; i < num_colliders; ++i) {
@@ -593,27 +769,39 @@ prepare_colliders_single(CollisionTraverser::LevelStatesSingle &level_states,
 }
 
 ////////////////////////////////////////////////////////////////////
-//     Function: CollisionTraverser::r_traverse_single
+//     Function: CollisionTraverser::compare_colliders_at_node
 //       Access: Private
-//  Description:
+//  Description: Tests each of the level state's remaining colliders
+//               against the contents of its current node: the solids
+//               of a CollisionNode, or the Geoms of a GeomNode.  If
+//               the node is the root of a static BVH, everything
+//               below it is tested via the BVH instead, and false is
+//               returned to indicate that the traversal should not
+//               continue on to the node's children; otherwise, this
+//               returns true.
+//
+//               This is shared by r_traverse_single() and the other
+//               flavors of the traversal.
 ////////////////////////////////////////////////////////////////////
-void CollisionTraverser::
-r_traverse_single(CollisionLevelStateSingle &level_state, size_t pass) {
-  if (!level_state.any_in_bounds()) {
-    return;
-  }
-  if (!level_state.apply_transform()) {
-    return;
-  }
-
+template<class LevelState>
+bool CollisionTraverser::
+compare_colliders_at_node(LevelState &level_state) {
   PandaNode *node = level_state.node();
+  if (!_static_bvhs.empty()) {
+    CollisionBVH *bvh = find_static_bvh(level_state);
+    if (bvh != (CollisionBVH *)NULL) {
+      // Everything at and below this node is described by the BVH.
+      compare_colliders_to_bvh(level_state, bvh);
+      return false;
+    }
+  }
   if (node->is_collision_node()) {
     CollisionNode *cnode;
-    DCAST_INTO_V(cnode, node);
+    DCAST_INTO_R(cnode, node, false);
     CPT(BoundingVolume) node_bv = cnode->get_bounds();
     const GeometricBoundingVolume *node_gbv = NULL;
     if (node_bv->is_of_type(GeometricBoundingVolume::get_class_type())) {
-      DCAST_INTO_V(node_gbv, node_bv);
+      DCAST_INTO_R(node_gbv, node_bv, false);
     }
 
     CollisionEntry entry;
@@ -654,11 +842,11 @@ r_traverse_single(CollisionLevelStateSingle &level_state, size_t pass) {
     #endif
     
     GeomNode *gnode;
-    DCAST_INTO_V(gnode, node);
+    DCAST_INTO_R(gnode, node, false);
     CPT(BoundingVolume) node_bv = gnode->get_bounds();
     const GeometricBoundingVolume *node_gbv = NULL;
     if (node_bv->is_of_type(GeometricBoundingVolume::get_class_type())) {
-      DCAST_INTO_V(node_gbv, node_bv);
+      DCAST_INTO_R(node_gbv, node_bv, false);
     }
 
     CollisionEntry entry;
@@ -691,6 +879,28 @@ r_traverse_single(CollisionLevelStateSingle &level_state, size_t pass) {
     }
   }
 
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::r_traverse_single
+//       Access: Private
+//  Description:
+////////////////////////////////////////////////////////////////////
+void CollisionTraverser::
+r_traverse_single(CollisionLevelStateSingle &level_state, size_t pass) {
+  if (!level_state.any_in_bounds()) {
+    return;
+  }
+  if (!level_state.apply_transform()) {
+    return;
+  }
+
+  if (!compare_colliders_at_node(level_state)) {
+    return;
+  }
+
+  PandaNode *node = level_state.node();
   if (node->has_single_child_visibility()) {
     // If it's a switch node or sequence node, visit just the one
     // visible child.
@@ -761,7 +971,7 @@ prepare_colliders_double(CollisionTraverser::LevelStatesDouble &level_states,
   for (i = 0; i < num_colliders; ++i) {
     indirect[i] = i;
   }
-  sort(indirect, indirect + num_colliders, SortByColliderSort(*this));
+  stable_sort(indirect, indirect + num_colliders, SortByColliderSort(*this));
 
   int num_remaining_colliders = num_colliders;
   for (i = 0; i < num_colliders; ++i) {
@@ -825,91 +1035,11 @@ r_traverse_double(CollisionLevelStateDouble &level_state, size_t pass) {
     return;
   }
 
-  PandaNode *node = level_state.node();
-  if (node->is_collision_node()) {
-    CollisionNode *cnode;
-    DCAST_INTO_V(cnode, node);
-    CPT(BoundingVolume) node_bv = cnode->get_bounds();
-    const GeometricBoundingVolume *node_gbv = NULL;
-    if (node_bv->is_of_type(GeometricBoundingVolume::get_class_type())) {
-      DCAST_INTO_V(node_gbv, node_bv);
-    }
-
-    CollisionEntry entry;
-    entry._into_node = cnode;
-    entry._into_node_path = level_state.get_node_path();
-    if (_respect_prev_transform) {
-      entry._flags |= CollisionEntry::F_respect_prev_transform;
-    }
-
-    int num_colliders = level_state.get_num_colliders();
-    for (int c = 0; c < num_colliders; ++c) {
-      if (level_state.has_collider(c)) {
-        entry._from_node = level_state.get_collider_node(c);
-
-        if ((entry._from_node->get_from_collide_mask() &
-             cnode->get_into_collide_mask()) != 0) {
-          #ifdef DO_PSTATS
-          //PStatTimer collide_timer(_solid_collide_collectors[pass]);
-          #endif
-          entry._from_node_path = level_state.get_collider_node_path(c);
-          entry._from = level_state.get_collider(c);
-
-          compare_collider_to_node(
-              entry, 
-              level_state.get_parent_bound(c),
-              level_state.get_local_bound(c),
-              node_gbv);
-        }
-      }
-    }
-
-  } else if (node->is_geom_node()) {
-    #ifndef NDEBUG
-    if (collide_cat.is_spam()) {
-      collide_cat.spam()
-        << "Reached " << *node << "\n";
-    }
-    #endif
-    
-    GeomNode *gnode;
-    DCAST_INTO_V(gnode, node);
-    CPT(BoundingVolume) node_bv = gnode->get_bounds();
-    const GeometricBoundingVolume *node_gbv = NULL;
-    if (node_bv->is_of_type(GeometricBoundingVolume::get_class_type())) {
-      DCAST_INTO_V(node_gbv, node_bv);
-    }
-
-    CollisionEntry entry;
-    entry._into_node = gnode;
-    entry._into_node_path = level_state.get_node_path();
-    if (_respect_prev_transform) {
-      entry._flags |= CollisionEntry::F_respect_prev_transform;
-    }
-
-    int num_colliders = level_state.get_num_colliders();
-    for (int c = 0; c < num_colliders; ++c) {
-      if (level_state.has_collider(c)) {
-        entry._from_node = level_state.get_collider_node(c);
-
-        if ((entry._from_node->get_from_collide_mask() &
-             gnode->get_into_collide_mask()) != 0) {
-          #ifdef DO_PSTATS
-          //PStatTimer collide_timer(_solid_collide_collectors[pass]);
-          #endif
-          entry._from_node_path = level_state.get_collider_node_path(c);
-          entry._from = level_state.get_collider(c);
-
-          compare_collider_to_geom_node(
-              entry, 
-              level_state.get_parent_bound(c),
-              level_state.get_local_bound(c),
-              node_gbv);
-        }
-      }
-    }
+  if (!compare_colliders_at_node(level_state)) {
+    return;
   }
 
+  PandaNode *node = level_state.node();
   if (node->has_single_child_visibility()) {
     // If it's a switch node or sequence node, visit just the one
     // visible child.
@@ -980,7 +1110,7 @@ prepare_colliders_quad(CollisionTraverser::LevelStatesQuad &level_states,
   for (i = 0; i < num_colliders; ++i) {
     indirect[i] = i;
   }
-  sort(indirect, indirect + num_colliders, SortByColliderSort(*this));
+  stable_sort(indirect, indirect + num_colliders, SortByColliderSort(*this));
 
   int num_remaining_colliders = num_colliders;
   for (i = 0; i < num_colliders; ++i) {
@@ -1044,98 +1174,140 @@ r_traverse_quad(CollisionLevelStateQuad &level_state, size_t pass) {
     return;
   }
 
-  PandaNode *node = level_state.node();
-  if (node->is_collision_node()) {
-    CollisionNode *cnode;
-    DCAST_INTO_V(cnode, node);
-    CPT(BoundingVolume) node_bv = cnode->get_bounds();
-    const GeometricBoundingVolume *node_gbv = NULL;
-    if (node_bv->is_of_type(GeometricBoundingVolume::get_class_type())) {
-      DCAST_INTO_V(node_gbv, node_bv);
-    }
+  if (!compare_colliders_at_node(level_state)) {
+    return;
+  }
 
-    CollisionEntry entry;
-    entry._into_node = cnode;
-    entry._into_node_path = level_state.get_node_path();
-    if (_respect_prev_transform) {
-      entry._flags |= CollisionEntry::F_respect_prev_transform;
+  PandaNode *node = level_state.node();
+  if (node->has_single_child_visibility()) {
+    // If it's a switch node or sequence node, visit just the one
+    // visible child.
+    int index = node->get_visible_child();
+    if (index >= 0 && index < node->get_num_children()) {
+      CollisionLevelStateQuad next_state(level_state, node->get_child(index));
+      r_traverse_quad(next_state, pass);
     }
 
-    int num_colliders = level_state.get_num_colliders();
-    for (int c = 0; c < num_colliders; ++c) {
-      if (level_state.has_collider(c)) {
-        entry._from_node = level_state.get_collider_node(c);
-
-        if ((entry._from_node->get_from_collide_mask() &
-             cnode->get_into_collide_mask()) != 0) {
-          #ifdef DO_PSTATS
-          //PStatTimer collide_timer(_solid_collide_collectors[pass]);
-          #endif
-          entry._from_node_path = level_state.get_collider_node_path(c);
-          entry._from = level_state.get_collider(c);
-
-          compare_collider_to_node(
-              entry, 
-              level_state.get_parent_bound(c),
-              level_state.get_local_bound(c),
-              node_gbv);
-        }
+  } else if (node->is_lod_node()) {
+    // If it's an LODNode, visit the lowest level of detail with all
+    // bits, allowing collision with geometry under the lowest level
+    // of default; and visit all other levels without
+    // GeomNode::get_default_collide_mask(), allowing only collision
+    // with CollisionNodes and special geometry under higher levels of
+    // detail.
+    int index = DCAST(LODNode, node)->get_lowest_switch();
+    PandaNode::Children children = node->get_children();
+    int num_children = children.get_num_children();
+    for (int i = 0; i < num_children; ++i) {
+      CollisionLevelStateQuad next_state(level_state, children.get_child(i));
+      if (i != index) {
+        next_state.set_include_mask(next_state.get_include_mask() &
+          ~GeomNode::get_default_collide_mask());
       }
+      r_traverse_quad(next_state, pass);
     }
 
-  } else if (node->is_geom_node()) {
-    #ifndef NDEBUG
-    if (collide_cat.is_spam()) {
-      collide_cat.spam()
-        << "Reached " << *node << "\n";
-    }
-    #endif
-    
-    GeomNode *gnode;
-    DCAST_INTO_V(gnode, node);
-    CPT(BoundingVolume) node_bv = gnode->get_bounds();
-    const GeometricBoundingVolume *node_gbv = NULL;
-    if (node_bv->is_of_type(GeometricBoundingVolume::get_class_type())) {
-      DCAST_INTO_V(node_gbv, node_bv);
+  } else {
+    // Otherwise, visit all the children.
+    PandaNode::Children children = node->get_children();
+    int num_children = children.get_num_children();
+    for (int i = 0; i < num_children; ++i) {
+      CollisionLevelStateQuad next_state(level_state, children.get_child(i));
+      r_traverse_quad(next_state, pass);
     }
+  }
+}
 
-    CollisionEntry entry;
-    entry._into_node = gnode;
-    entry._into_node_path = level_state.get_node_path();
-    if (_respect_prev_transform) {
-      entry._flags |= CollisionEntry::F_respect_prev_transform;
-    }
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::prepare_colliders_array
+//       Access: Private
+//  Description: Fills up the LevelState with all of the active
+//               colliders in use.
+//
+//               This flavor uses a CollisionLevelStateArray, which
+//               has no limit on the number of colliders, so all of
+//               them can be handled in a single pass.
+////////////////////////////////////////////////////////////////////
+void CollisionTraverser::
+prepare_colliders_array(CollisionLevelStateArray &level_state,
+                        const NodePath &root) {
+  int num_colliders = _colliders.size();
 
-    int num_colliders = level_state.get_num_colliders();
-    for (int c = 0; c < num_colliders; ++c) {
-      if (level_state.has_collider(c)) {
-        entry._from_node = level_state.get_collider_node(c);
+  // As above, this is only exactly right if there is one solid per
+  // collider.
+  level_state.reserve(num_colliders);
 
-        if ((entry._from_node->get_from_collide_mask() &
-             gnode->get_into_collide_mask()) != 0) {
-          #ifdef DO_PSTATS
-          //PStatTimer collide_timer(_solid_collide_collectors[pass]);
-          #endif
-          entry._from_node_path = level_state.get_collider_node_path(c);
-          entry._from = level_state.get_collider(c);
+  // Create an indirect index array to walk through the colliders in
+  // sorted order, without affect the actual collider order.
+  int *indirect = (int *)alloca(sizeof(int) * num_colliders);
+  int i;
+  for (i = 0; i < num_colliders; ++i) {
+    indirect[i] = i;
+  }
+  stable_sort(indirect, indirect + num_colliders, SortByColliderSort(*this));
 
-          compare_collider_to_geom_node(
-              entry, 
-              level_state.get_parent_bound(c),
-              level_state.get_local_bound(c),
-              node_gbv);
-        }
+  for (i = 0; i < num_colliders; ++i) {
+    OrderedColliderDef &ocd = _ordered_colliders[indirect[i]];
+    NodePath cnode_path = ocd._node_path;
+
+    if (!cnode_path.is_same_graph(root)) {
+      if (ocd._in_graph) {
+        // Only report this warning once.
+        collide_cat.info()
+          << "Collider " << cnode_path
+          << " is not in scene graph.  Ignoring.\n";
+        ocd._in_graph = false;
+      }
+
+    } else {
+      ocd._in_graph = true;
+      CollisionNode *cnode = DCAST(CollisionNode, cnode_path.node());
+      
+      CollisionLevelStateArray::ColliderDef def;
+      def._node = cnode;
+      def._node_path = cnode_path;
+      
+      int num_solids = cnode->get_num_solids();
+      for (int s = 0; s < num_solids; ++s) {
+        CPT(CollisionSolid) collider = cnode->get_solid(s);
+        def._collider = collider;
+        level_state.prepare_collider(def, root);
       }
     }
   }
+}
 
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::r_traverse_array
+//       Access: Private
+//  Description:
+////////////////////////////////////////////////////////////////////
+void CollisionTraverser::
+r_traverse_array(CollisionLevelStateArray &level_state, size_t pass) {
+  int num_tests = 0;
+  bool any_in = level_state.any_in_bounds(&num_tests);
+  count_level(CollisionLevelStateBase::_node_volume_pcollector, num_tests);
+  if (!any_in) {
+    return;
+  }
+  if (!level_state.apply_transform()) {
+    return;
+  }
+
+  if (!compare_colliders_at_node(level_state)) {
+    return;
+  }
+
+  PandaNode *node = level_state.node();
   if (node->has_single_child_visibility()) {
     // If it's a switch node or sequence node, visit just the one
     // visible child.
     int index = node->get_visible_child();
     if (index >= 0 && index < node->get_num_children()) {
-      CollisionLevelStateQuad next_state(level_state, node->get_child(index));
-      r_traverse_quad(next_state, pass);
+      CollisionLevelStateArray next_state(level_state, node->get_child(index));
+      _traversal_key.push_back(index);
+      r_traverse_array(next_state, pass);
+      _traversal_key.pop_back();
     }
 
   } else if (node->is_lod_node()) {
@@ -1149,12 +1321,14 @@ r_traverse_quad(CollisionLevelStateQuad &level_state, size_t pass) {
     PandaNode::Children children = node->get_children();
     int num_children = children.get_num_children();
     for (int i = 0; i < num_children; ++i) {
-      CollisionLevelStateQuad next_state(level_state, children.get_child(i));
+      CollisionLevelStateArray next_state(level_state, children.get_child(i));
       if (i != index) {
         next_state.set_include_mask(next_state.get_include_mask() &
           ~GeomNode::get_default_collide_mask());
       }
-      r_traverse_quad(next_state, pass);
+      _traversal_key.push_back(i);
+      r_traverse_array(next_state, pass);
+      _traversal_key.pop_back();
     }
 
   } else {
@@ -1162,8 +1336,10 @@ r_traverse_quad(CollisionLevelStateQuad &level_state, size_t pass) {
     PandaNode::Children children = node->get_children();
     int num_children = children.get_num_children();
     for (int i = 0; i < num_children; ++i) {
-      CollisionLevelStateQuad next_state(level_state, children.get_child(i));
-      r_traverse_quad(next_state, pass);
+      CollisionLevelStateArray next_state(level_state, children.get_child(i));
+      _traversal_key.push_back(i);
+      r_traverse_array(next_state, pass);
+      _traversal_key.pop_back();
     }
   }
 }
@@ -1182,7 +1358,7 @@ compare_collider_to_node(CollisionEntry &entry,
   if (from_parent_gbv != (GeometricBoundingVolume *)NULL &&
       into_node_gbv != (GeometricBoundingVolume *)NULL) {
     within_node_bounds = (into_node_gbv->contains(from_parent_gbv) != 0);
-    _cnode_volume_pcollector.add_level(1);
+    count_level(_cnode_volume_pcollector, 1);
   }
 
   if (within_node_bounds) {
@@ -1230,7 +1406,7 @@ compare_collider_to_geom_node(CollisionEntry &entry,
   if (from_parent_gbv != (GeometricBoundingVolume *)NULL &&
       into_node_gbv != (GeometricBoundingVolume *)NULL) {
     within_node_bounds = (into_node_gbv->contains(from_parent_gbv) != 0);
-    _gnode_volume_pcollector.add_level(1);
+    count_level(_gnode_volume_pcollector, 1);
   }
 
   if (within_node_bounds) {
@@ -1273,7 +1449,7 @@ compare_collider_to_solid(CollisionEntry &entry,
       solid_gbv != (GeometricBoundingVolume *)NULL) {
     within_solid_bounds = (solid_gbv->contains(from_node_gbv) != 0);
     #ifdef DO_PSTATS
-    ((CollisionSolid *)entry.get_into())->get_volume_pcollector().add_level(1);
+    count_level(((CollisionSolid *)entry.get_into())->get_volume_pcollector(), 1);
     #endif  // DO_PSTATS
 #ifndef NDEBUG
     if (collide_cat.is_spam()) {
@@ -1288,7 +1464,7 @@ compare_collider_to_solid(CollisionEntry &entry,
     Colliders::const_iterator ci;
     ci = _colliders.find(entry.get_from_node_path());
     nassertv(ci != _colliders.end());
-    entry.test_intersection((*ci).second, this);
+    test_intersection(entry, (*ci).second);
   }
 }
 
@@ -1305,7 +1481,7 @@ compare_collider_to_geom(CollisionEntry &entry, const Geom *geom,
   if (from_node_gbv != (GeometricBoundingVolume *)NULL &&
       geom_gbv != (GeometricBoundingVolume *)NULL) {
     within_geom_bounds = (geom_gbv->contains(from_node_gbv) != 0);
-    _geom_volume_pcollector.add_level(1);
+    count_level(_geom_volume_pcollector, 1);
   }
   if (within_geom_bounds) {
     Colliders::const_iterator ci;
@@ -1345,13 +1521,13 @@ compare_collider_to_geom(CollisionEntry &entry, const Geom *geom,
                 sphere->around(v, v + 3);
                 within_solid_bounds = (sphere->contains(from_node_gbv) != 0);
 #ifdef DO_PSTATS
-                CollisionGeom::_volume_pcollector.add_level(1);
+                count_level(CollisionGeom::_volume_pcollector, 1);
 #endif  // DO_PSTATS
               }
               if (within_solid_bounds) {
                 PT(CollisionGeom) cgeom = new CollisionGeom(LVecBase3(v[0]), LVecBase3(v[1]), LVecBase3(v[2]));
                 entry._into = cgeom;
-                entry.test_intersection((*ci).second, this);
+                test_intersection(entry, (*ci).second);
               }
             }
           }
@@ -1375,13 +1551,13 @@ compare_collider_to_geom(CollisionEntry &entry, const Geom *geom,
                 sphere->around(v, v + 3);
                 within_solid_bounds = (sphere->contains(from_node_gbv) != 0);
 #ifdef DO_PSTATS
-                CollisionGeom::_volume_pcollector.add_level(1);
+                count_level(CollisionGeom::_volume_pcollector, 1);
 #endif  // DO_PSTATS
               }
               if (within_solid_bounds) {
                 PT(CollisionGeom) cgeom = new CollisionGeom(LVecBase3(v[0]), LVecBase3(v[1]), LVecBase3(v[2]));
                 entry._into = cgeom;
-                entry.test_intersection((*ci).second, this);
+                test_intersection(entry, (*ci).second);
               }
             }
           }
@@ -1447,6 +1623,287 @@ remove_handler(CollisionTraverser::Handlers::iterator hi) {
   return hi;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::traverse_parallel
+//       Access: Private
+//  Description: Divides the colliders among the threads of the thread
+//               pool, each of which traverses the scene graph with a
+//               separate worker CollisionTraverser, and then hands the
+//               CollisionEntries they found to the handlers.
+////////////////////////////////////////////////////////////////////
+void CollisionTraverser::
+traverse_parallel(const NodePath &root) {
+  PStatTimer timer(_parallel_pcollector);
+
+  int num_colliders = _ordered_colliders.size();
+  int *indirect = (int *)alloca(sizeof(int) * num_colliders);
+  int i;
+  for (i = 0; i < num_colliders; ++i) {
+    indirect[i] = i;
+  }
+  stable_sort(indirect, indirect + num_colliders, SortByColliderSort(*this));
+
+  // Each collider's position in the sorted order is the order in
+  // which a single-pass traversal would test it at each node.
+  typedef pmap<NodePath, int> Ranks;
+  Ranks ranks;
+  for (i = 0; i < num_colliders; ++i) {
+    ranks[_ordered_colliders[indirect[i]]._node_path] = i;
+  }
+
+  int num_jobs = min(_thread_pool->get_num_threads(), num_colliders);
+  while ((int)_workers.size() < num_jobs) {
+    ostringstream name;
+    name << get_name() << "-" << _workers.size();
+    CollisionTraverser *worker = new CollisionTraverser(name.str());
+    worker->_buffer_entries = true;
+    _workers.push_back(worker);
+  }
+
+  // Give each worker a contiguous range of the sorted colliders.
+  for (int j = 0; j < num_jobs; ++j) {
+    CollisionTraverser *worker = _workers[j];
+    worker->_colliders.clear();
+    worker->_ordered_colliders.clear();
+    worker->_static_bvhs = _static_bvhs;
+    worker->_respect_prev_transform = _respect_prev_transform;
+
+    int begin = (num_colliders * j) / num_jobs;
+    int end = (num_colliders * (j + 1)) / num_jobs;
+    for (i = begin; i < end; ++i) {
+      const OrderedColliderDef &ocd = _ordered_colliders[indirect[i]];
+      worker->_colliders[ocd._node_path] = _colliders[ocd._node_path];
+      worker->_ordered_colliders.push_back(ocd);
+    }
+  }
+
+  ParallelJob job;
+  job._trav = this;
+  job._root = &root;
+  _thread_pool->run_jobs(num_jobs, &parallel_job_func, &job);
+
+  PStatTimer merge_timer(_merge_pcollector);
+
+  BufferedEntries entries;
+  for (int j = 0; j < num_jobs; ++j) {
+    CollisionTraverser *worker = _workers[j];
+
+    // Copy back the record of which colliders were found in the graph,
+    // so we only warn about each one once.
+    int begin = (num_colliders * j) / num_jobs;
+    for (size_t k = 0; k < worker->_ordered_colliders.size(); ++k) {
+      _ordered_colliders[indirect[begin + k]]._in_graph =
+        worker->_ordered_colliders[k]._in_graph;
+    }
+
+    BufferedEntries::iterator bi;
+    for (bi = worker->_buffered_entries.begin();
+         bi != worker->_buffered_entries.end();
+         ++bi) {
+      BufferedEntry &be = (*bi);
+      Ranks::const_iterator ri = ranks.find(be._entry->get_from_node_path());
+      nassertv(ri != ranks.end());
+      be._rank = (*ri).second;
+      entries.push_back(be);
+    }
+    worker->_buffered_entries.clear();
+
+    LevelCounts::const_iterator li;
+    for (li = worker->_level_counts.begin();
+         li != worker->_level_counts.end();
+         ++li) {
+      (*li)._collector->add_level((*li)._count);
+    }
+    worker->_level_counts.clear();
+  }
+
+  sort(entries.begin(), entries.end(), SortByTraversalOrder());
+
+  BufferedEntries::const_iterator ei;
+  for (ei = entries.begin(); ei != entries.end(); ++ei) {
+    CollisionEntry *entry = (*ei)._entry;
+    Colliders::const_iterator ci = _colliders.find(entry->get_from_node_path());
+    nassertv(ci != _colliders.end());
+    (*ci).second->add_entry(entry);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::parallel_job_func
+//       Access: Private, Static
+//  Description: The WorkerThreadPool callback for traverse_parallel().
+//               Traverses the scene graph with the nth worker's share
+//               of the colliders, saving up the entries it finds.
+////////////////////////////////////////////////////////////////////
+void CollisionTraverser::
+parallel_job_func(int job_index, Thread *current_thread, void *user_data) {
+  ParallelJob *job = (ParallelJob *)user_data;
+  CollisionTraverser *worker = job->_trav->_workers[job_index];
+  PStatTimer timer(worker->_this_pcollector, current_thread);
+
+  CollisionLevelStateArray level_state(*job->_root);
+  worker->_traversal_key.clear();
+  worker->prepare_colliders_array(level_state, *job->_root);
+  if (level_state.get_num_colliders() != 0) {
+    worker->r_traverse_array(level_state, 0);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::test_intersection
+//       Access: Private
+//  Description: Performs the intersection test described by the
+//               entry.  Normally, a positive result is passed straight
+//               to the handler; in a worker traverser, it is saved in
+//               _buffered_entries instead, for the main traverser to
+//               deliver later.
+////////////////////////////////////////////////////////////////////
+void CollisionTraverser::
+test_intersection(const CollisionEntry &entry, CollisionHandler *handler) {
+  if (!_buffer_entries) {
+    entry.test_intersection(handler, this);
+    return;
+  }
+
+  PT(CollisionEntry) result = entry.get_from()->test_intersection(entry);
+#ifdef DO_PSTATS
+  count_level(((CollisionSolid *)entry.get_into())->get_test_pcollector(), 1);
+#endif  // DO_PSTATS
+  if (handler->wants_all_potential_collidees() && result == (CollisionEntry *)NULL) {
+    result = new CollisionEntry(entry);
+    result->reset_collided();
+  }
+  if (result != (CollisionEntry *)NULL) {
+    BufferedEntry be;
+    be._entry = result;
+    be._key = _traversal_key;
+    be._rank = 0;
+    be._seq = (int)_buffered_entries.size();
+    _buffered_entries.push_back(be);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::add_level_count
+//       Access: Private
+//  Description: The out-of-line part of count_level() for a worker
+//               traverser: adds n to the worker's count for the
+//               indicated collector.
+////////////////////////////////////////////////////////////////////
+void CollisionTraverser::
+add_level_count(PStatCollector &collector, int n) {
+  // There are only ever a handful of different collectors, so a
+  // linear search is quicker than a map.
+  LevelCounts::iterator li;
+  for (li = _level_counts.begin(); li != _level_counts.end(); ++li) {
+    if ((*li)._collector == &collector) {
+      (*li)._count += n;
+      return;
+    }
+  }
+
+  LevelCount lc;
+  lc._collector = &collector;
+  lc._count = n;
+  _level_counts.push_back(lc);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::find_static_bvh
+//       Access: Private
+//  Description: Returns the CollisionBVH whose root is the current
+//               node of the level state, or NULL if there is none.
+////////////////////////////////////////////////////////////////////
+CollisionBVH *CollisionTraverser::
+find_static_bvh(const CollisionLevelStateBase &level_state) const {
+  PandaNode *node = level_state.node();
+  StaticBVHs::const_iterator bi;
+  for (bi = _static_bvhs.begin(); bi != _static_bvhs.end(); ++bi) {
+    const NodePath &root = (*bi)->get_root();
+    // Check the node first; building the NodePath is more expensive.
+    if (root.node() == node && root == level_state.get_node_path()) {
+      return (*bi);
+    }
+  }
+  return NULL;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CollisionTraverser::compare_colliders_to_bvh
+//       Access: Private
+//  Description: Tests each of the level state's remaining colliders
+//               against the leaves of the BVH, in place of
+//               traversing the scene graph below the current node.
+//               The colliders' bounding volumes have already been
+//               transformed into the space of the BVH's root.
+////////////////////////////////////////////////////////////////////
+template<class LevelState>
+void CollisionTraverser::
+compare_colliders_to_bvh(LevelState &level_state, CollisionBVH *bvh) {
+  CollisionBVH::Results results;
+
+  CollisionEntry entry;
+  if (_respect_prev_transform) {
+    entry._flags |= CollisionEntry::F_respect_prev_transform;
+  }
+
+  int num_colliders = level_state.get_num_colliders();
+  for (int c = 0; c < num_colliders; ++c) {
+    if (!level_state.has_collider(c)) {
+      continue;
+    }
+    CollisionNode *from_node = level_state.get_collider_node(c);
+    CollideMask from_mask = 
+      from_node->get_from_collide_mask() & level_state.get_include_mask();
+
+    int num_tests = 0;
+    bvh->query(level_state.get_local_bound(c), results, &num_tests);
+    count_level(CollisionBVH::_volume_pcollector, num_tests);
+    if (results.empty()) {
+      continue;
+    }
+
+    entry._from_node = from_node;
+    entry._from_node_path = level_state.get_collider_node_path(c);
+    entry._from = level_state.get_collider(c);
+
+    CollisionBVH::Results::const_iterator ri;
+    for (ri = results.begin(); ri != results.end(); ++ri) {
+      int li = (*ri);
+      if ((from_mask & bvh->get_leaf_into_mask(li)).is_zero()) {
+        continue;
+      }
+      const NodePath &into_node_path = bvh->get_leaf_node_path(li);
+      PandaNode *into_node = into_node_path.node();
+      if (into_node == from_node) {
+        // Don't test a node with itself.
+        continue;
+      }
+
+      entry._into_node = into_node;
+      entry._into_node_path = into_node_path;
+
+      // The BVH has already tested the leaf's box, so there's no need
+      // to pass any bounding volumes on to be tested again.
+      const CollisionSolid *solid = bvh->get_leaf_solid(li);
+      if (solid != (CollisionSolid *)NULL) {
+        entry._into = solid;
+        compare_collider_to_solid(entry, NULL, NULL);
+
+      } else {
+        entry._into = (CollisionSolid *)NULL;
+        GeomNode *gnode;
+        DCAST_INTO_V(gnode, into_node);
+        int gi = bvh->get_leaf_geom_index(li);
+        if (gi < gnode->get_num_geoms()) {
+          CPT(Geom) geom = gnode->get_geom(gi);
+          compare_collider_to_geom(entry, geom, NULL, NULL);
+        }
+      }
+    }
+  }
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: CollisionTraverser::get_pass_collector
 //       Access: Private
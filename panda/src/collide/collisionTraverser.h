@@ -19,8 +19,10 @@
 
 #include "collisionHandler.h"
 #include "collisionLevelState.h"
+#include "collisionBVH.h"
 
 #include "pointerTo.h"
+#include "workerThreadPool.h"
 #include "pStatCollector.h"
 
 #include "pset.h"
@@ -63,6 +65,16 @@ PUBLISHED:
   CollisionHandler *get_handler(const NodePath &collider) const;
   void clear_colliders();
 
+  void add_static_bvh(CollisionBVH *bvh);
+  bool remove_static_bvh(CollisionBVH *bvh);
+  int get_num_static_bvhs() const;
+  CollisionBVH *get_static_bvh(int n) const;
+  MAKE_SEQ(get_static_bvhs, get_num_static_bvhs, get_static_bvh);
+  void clear_static_bvhs();
+
+  void set_num_threads(int num_threads);
+  INLINE int get_num_threads() const;
+
   void traverse(const NodePath &root);
 
 #ifdef DO_COLLISION_RECORDING
@@ -91,6 +103,9 @@ private:
   void prepare_colliders_quad(LevelStatesQuad &level_states, const NodePath &root);
   void r_traverse_quad(CollisionLevelStateQuad &level_state, size_t pass);
 
+  void prepare_colliders_array(CollisionLevelStateArray &level_state, const NodePath &root);
+  void r_traverse_array(CollisionLevelStateArray &level_state, size_t pass);
+
   void compare_collider_to_node(CollisionEntry &entry,
                                 const GeometricBoundingVolume *from_parent_gbv,
                                 const GeometricBoundingVolume *from_node_gbv,
@@ -106,6 +121,23 @@ private:
                                 const GeometricBoundingVolume *from_node_gbv,
                                 const GeometricBoundingVolume *solid_gbv);
 
+  void traverse_parallel(const NodePath &root);
+  static void parallel_job_func(int job_index, Thread *current_thread,
+                                void *user_data);
+
+  typedef pvector<int> TraversalKey;
+  void test_intersection(const CollisionEntry &entry, CollisionHandler *handler);
+  INLINE void count_level(PStatCollector &collector, int n);
+  void add_level_count(PStatCollector &collector, int n);
+
+  CollisionBVH *find_static_bvh(const CollisionLevelStateBase &level_state) const;
+#ifndef CPPPARSER
+  template<class LevelState>
+  bool compare_colliders_at_node(LevelState &level_state);
+  template<class LevelState>
+  void compare_colliders_to_bvh(LevelState &level_state, CollisionBVH *bvh);
+#endif  // CPPPARSER
+
   PStatCollector &get_pass_collector(int pass);
 
 private:
@@ -128,6 +160,52 @@ private:
 
   Handlers::iterator remove_handler(Handlers::iterator hi);
 
+  typedef pvector< PT(CollisionBVH) > StaticBVHs;
+  StaticBVHs _static_bvhs;
+
+  // These are used when the traversal is divided among several
+  // threads.  Each thread runs one of the _workers, which are
+  // themselves CollisionTraversers that save up the entries they find
+  // in _buffered_entries.
+  class BufferedEntry {
+  public:
+    PT(CollisionEntry) _entry;
+    TraversalKey _key;
+    int _rank;
+    int _seq;
+  };
+  typedef pvector<BufferedEntry> BufferedEntries;
+
+  class ParallelJob {
+  public:
+    CollisionTraverser *_trav;
+    const NodePath *_root;
+  };
+
+  int _num_threads;
+  PT(WorkerThreadPool) _thread_pool;
+  typedef pvector<CollisionTraverser *> Workers;
+  Workers _workers;
+  bool _buffer_entries;
+  BufferedEntries _buffered_entries;
+
+  // The child indices leading from the root of the traversal to the
+  // node r_traverse_array() is currently visiting.  Sorting the
+  // buffered entries by these puts them back in traversal order.
+  TraversalKey _traversal_key;
+
+  // A worker may not change the levels of the PStatCollectors while
+  // the other threads are using them, so it counts its bounding volume
+  // and intersection tests here instead.  The main traverser adds
+  // these to the collectors once the workers have finished.
+  class LevelCount {
+  public:
+    PStatCollector *_collector;
+    int _count;
+  };
+  typedef pvector<LevelCount> LevelCounts;
+  LevelCounts _level_counts;
+
   bool _respect_prev_transform;
 #ifdef DO_COLLISION_RECORDING
   CollisionRecorder *_recorder;
@@ -140,6 +218,8 @@ private:
   static PStatCollector _cnode_volume_pcollector;
   static PStatCollector _gnode_volume_pcollector;
   static PStatCollector _geom_volume_pcollector;
+  static PStatCollector _parallel_pcollector;
+  static PStatCollector _merge_pcollector;
 
   PStatCollector _this_pcollector;
   typedef pvector<PStatCollector> PassCollectors;
@@ -160,6 +240,7 @@ private:
   static TypeHandle _type_handle;
 
   friend class SortByColliderSort;
+  friend class SortByTraversalOrder;
 };
 
 INLINE ostream &operator << (ostream &out, const CollisionTraverser &trav) {
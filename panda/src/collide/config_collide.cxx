@@ -74,6 +74,16 @@ ConfigVariableBool allow_collider_multiple
           "false, a one-word BitMask is always used instead, which is faster "
           "per pass, but may require more passes."));
 
+ConfigVariableBool allow_collider_array
+("allow-collider-array", true,
+ PRC_DESC("Set this true to allow the CollisionTraverser to use a BitArray "
+          "to manage all of its colliders in a single pass, whenever there "
+          "are too many of them to fit in the largest BitMask allowed by "
+          "allow-collider-multiple.  This means the scene graph is only "
+          "walked once per traversal, no matter how many colliders there "
+          "are.  If this is false, the colliders are instead divided into "
+          "groups, and the scene graph is walked once for each group."));
+
 ConfigVariableBool flatten_collision_nodes
 ("flatten-collision-nodes", false,
  PRC_DESC("Set this true to allow NodePath::flatten_medium() and "
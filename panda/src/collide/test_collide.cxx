@@ -15,58 +15,103 @@
 #include "collisionTraverser.h"
 #include "collisionNode.h"
 #include "collisionSphere.h"
-#include "collisionPlane.h"
-#include "collisionHandlerPusher.h"
+#include "collisionHandlerQueue.h"
+#include "config_collide.h"
 
-#include "namedNode.h"
-#include "pt_NamedNode.h"
+#include "pandaNode.h"
+#include "nodePath.h"
 #include "pointerTo.h"
-#include "transformTransition.h"
+#include "trueClock.h"
 #include "luse.h"
-#include "get_rel_pos.h"
-#include "renderRelation.h"
-
-int
-main(int argc, char *argv[]) {
-  PT_NamedNode r = new NamedNode("r");
-
-  PT_NamedNode a = new NamedNode("a");
-  PT_NamedNode b = new NamedNode("b");
-
-  PT(CollisionNode) aa = new CollisionNode("aa");
-  PT(CollisionNode) ab = new CollisionNode("ab");
-  PT(CollisionNode) ba = new CollisionNode("ba");
-
-  RenderRelation *r_a = new RenderRelation(r, a);
-  RenderRelation *r_b = new RenderRelation(r, b);
-
-  RenderRelation *a_aa = new RenderRelation(a, aa);
-  RenderRelation *a_ab = new RenderRelation(a, ab);
-  RenderRelation *b_ba = new RenderRelation(b, ba);
 
+// A simple benchmark of CollisionTraverser throughput as the number
+// of "from" colliders grows.  A fixed field of static spheres is
+// tested against an increasing number of moving spheres, once with
+// the colliders divided into one-word passes, and once with all of
+// them handled in a single pass using a BitArray.
 
-  CollisionSphere *aa1 = new CollisionSphere(LPoint3f(0, 0, 0), 1);
-  aa->add_solid(aa1);
-  a_aa->set_transition(new TransformTransition(LMatrix4f::translate_mat(0, -5, 0)));
+static const int num_static = 2000;
+static const double min_test_time = 0.5;
 
-  CollisionSphere *ab1 = new CollisionSphere(LPoint3f(0, 2, 0), 1.5);
-  ab->add_solid(ab1);
-
-  Planef plane(LVector3f(0, 1, 0), LPoint3f(0, 0, 0));
-  CollisionPlane *ba1 = new CollisionPlane(plane);
-  ba->add_solid(ba1);
+static double
+frand(double range) {
+  return ((double)rand() / (double)RAND_MAX) * range;
+}
 
-  CollisionTraverser ct;
-  PT(CollisionHandlerPusher) chp = new CollisionHandlerPusher;
-  chp->add_collider(aa, a_aa);
-  ct.add_collider(aa, chp);
+static NodePath
+make_scene() {
+  NodePath render("render");
+  NodePath statics = render.attach_new_node("statics");
+
+  // Group the static spheres into clumps of 20, so the traverser has
+  // some hierarchy to cull against.
+  NodePath group;
+  for (int i = 0; i < num_static; ++i) {
+    if (i % 20 == 0) {
+      group = statics.attach_new_node("group");
+      group.set_pos(frand(1000.0), frand(1000.0), 0.0);
+    }
+    PT(CollisionNode) cnode = new CollisionNode("static");
+    cnode->add_solid(new CollisionSphere(LPoint3(frand(50.0), frand(50.0), 0.0), 2.0));
+    cnode->set_from_collide_mask(CollideMask::all_off());
+    group.attach_new_node(cnode);
+  }
+
+  return render;
+}
 
-  ct.traverse(r);
+static void
+run_test(const NodePath &render, int num_colliders, bool use_array) {
+  allow_collider_array.set_value(use_array);
+
+  // Use the same arrangement of movers for both modes, so the results
+  // can be compared directly.
+  srand(num_colliders);
+
+  NodePath movers = render.attach_new_node("movers");
+  PT(CollisionHandlerQueue) queue = new CollisionHandlerQueue;
+  CollisionTraverser trav("bench");
+
+  for (int i = 0; i < num_colliders; ++i) {
+    PT(CollisionNode) cnode = new CollisionNode("mover");
+    cnode->add_solid(new CollisionSphere(LPoint3::zero(), 3.0));
+    cnode->set_into_collide_mask(CollideMask::all_off());
+    NodePath np = movers.attach_new_node(cnode);
+    np.set_pos(frand(1050.0), frand(1050.0), 0.0);
+    trav.add_collider(np, queue);
+  }
+
+  TrueClock *clock = TrueClock::get_global_ptr();
+  int num_traversals = 0;
+  int num_entries = 0;
+  double start = clock->get_short_time();
+  double elapsed;
+  do {
+    trav.traverse(render);
+    num_entries += queue->get_num_entries();
+    ++num_traversals;
+    elapsed = clock->get_short_time() - start;
+  } while (elapsed < min_test_time);
+
+  double per_sec = num_traversals / elapsed;
+  nout << "  " << num_colliders << " colliders, "
+       << (use_array ? "single pass" : "multiple passes") << ": "
+       << per_sec << " traversals/s, "
+       << per_sec * num_colliders << " colliders/s, "
+       << num_entries / num_traversals << " entries\n";
+
+  movers.remove_node();
+}
 
-  nout << "\nFrame 2:\n\n";
+int
+main(int argc, char *argv[]) {
+  srand(1);
+  NodePath render = make_scene();
 
-  ct.traverse(r);
+  for (int num_colliders = 16; num_colliders <= 1024; num_colliders *= 2) {
+    run_test(render, num_colliders, false);
+    run_test(render, num_colliders, true);
+  }
 
   return (0);
 }
-
@@ -17,6 +17,7 @@
 #include "cullBinBackToFront.h"
 #include "cullBinFixed.h"
 #include "cullBinFrontToBack.h"
+#include "cullBinRadixSorted.h"
 #include "cullBinStateSorted.h"
 #include "cullBinUnsorted.h"
 
@@ -49,6 +50,7 @@ init_libcull() {
   CullBinBackToFront::init_type();
   CullBinFixed::init_type();
   CullBinFrontToBack::init_type();
+  CullBinRadixSorted::init_type();
   CullBinStateSorted::init_type();
   CullBinUnsorted::init_type();
 
@@ -63,4 +65,10 @@ init_libcull() {
                                  CullBinFrontToBack::make_bin);
   bin_manager->register_bin_type(CullBinManager::BT_fixed,
                                  CullBinFixed::make_bin);
+  bin_manager->register_bin_type(CullBinManager::BT_radix_state_sorted,
+                                 CullBinRadixSorted::make_state_sorted_bin);
+  bin_manager->register_bin_type(CullBinManager::BT_radix_back_to_front,
+                                 CullBinRadixSorted::make_back_to_front_bin);
+  bin_manager->register_bin_type(CullBinManager::BT_radix_front_to_back,
+                                 CullBinRadixSorted::make_front_to_back_bin);
 }
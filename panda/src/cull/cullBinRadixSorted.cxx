@@ -0,0 +1,290 @@
+// Filename: cullBinRadixSorted.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "cullBinRadixSorted.h"
+#include "graphicsStateGuardianBase.h"
+#include "geometricBoundingVolume.h"
+#include "cullableObject.h"
+#include "cullHandler.h"
+#include "textureAttrib.h"
+#include "pStatTimer.h"
+
+#include <algorithm>
+#include <string.h>
+
+TypeHandle CullBinRadixSorted::_type_handle;
+
+// Bins with fewer objects than this are sorted with
+// std::stable_sort(), which is faster than a radix sort for small
+// arrays.  Both sorts are stable, so objects with equal keys are drawn
+// in the order they were added either way.
+static const size_t min_radix_sort_objects = 256;
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::Destructor
+//       Access: Public, Virtual
+//  Description: 
+////////////////////////////////////////////////////////////////////
+CullBinRadixSorted::
+~CullBinRadixSorted() {
+  Objects::iterator oi;
+  for (oi = _objects.begin(); oi != _objects.end(); ++oi) {
+    CullableObject *object = (*oi)._object;
+    delete object;
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::make_state_sorted_bin
+//       Access: Public, Static
+//  Description: Factory constructor for passing to the
+//               CullBinManager, for BT_radix_state_sorted.
+////////////////////////////////////////////////////////////////////
+CullBin *CullBinRadixSorted::
+make_state_sorted_bin(const string &name, GraphicsStateGuardianBase *gsg,
+                      const PStatCollector &draw_region_pcollector) {
+  return new CullBinRadixSorted(name, BT_radix_state_sorted, gsg,
+                                draw_region_pcollector);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::make_back_to_front_bin
+//       Access: Public, Static
+//  Description: Factory constructor for passing to the
+//               CullBinManager, for BT_radix_back_to_front.
+////////////////////////////////////////////////////////////////////
+CullBin *CullBinRadixSorted::
+make_back_to_front_bin(const string &name, GraphicsStateGuardianBase *gsg,
+                       const PStatCollector &draw_region_pcollector) {
+  return new CullBinRadixSorted(name, BT_radix_back_to_front, gsg,
+                                draw_region_pcollector);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::make_front_to_back_bin
+//       Access: Public, Static
+//  Description: Factory constructor for passing to the
+//               CullBinManager, for BT_radix_front_to_back.
+////////////////////////////////////////////////////////////////////
+CullBin *CullBinRadixSorted::
+make_front_to_back_bin(const string &name, GraphicsStateGuardianBase *gsg,
+                       const PStatCollector &draw_region_pcollector) {
+  return new CullBinRadixSorted(name, BT_radix_front_to_back, gsg,
+                                draw_region_pcollector);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::make_next
+//       Access: Public, Virtual
+//  Description: Returns a newly-allocated CullBin object that
+//               contains a copy of just the subset of the data from
+//               this CullBin object that is worth keeping around
+//               for next frame.
+//
+//               In this case, that is just the size of the bin, so
+//               that next frame's arrays may be allocated up front.
+////////////////////////////////////////////////////////////////////
+PT(CullBin) CullBinRadixSorted::
+make_next() const {
+  return new CullBinRadixSorted(*this);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::add_object
+//       Access: Public, Virtual
+//  Description: Adds a geom, along with its associated state, to
+//               the bin for rendering.
+////////////////////////////////////////////////////////////////////
+void CullBinRadixSorted::
+add_object(CullableObject *object, Thread *current_thread) {
+  // Determine the distance to the center of the bounding volume.
+  PN_uint32 distance_key = 0;
+  CPT(BoundingVolume) volume = object->_geom->get_bounds(current_thread);
+  if (volume->is_empty()) {
+    if (_bin_type != BT_radix_state_sorted) {
+      delete object;
+      return;
+    }
+  } else {
+    const GeometricBoundingVolume *gbv;
+    DCAST_INTO_V(gbv, volume);
+
+    LPoint3 center = gbv->get_approx_center();
+    nassertv(object->_modelview_transform != (const TransformState *)NULL);
+    center = center * object->_modelview_transform->get_mat();
+    distance_key = get_distance_key(_gsg->compute_distance_to(center));
+  }
+
+  PN_uint64 key;
+  switch (_bin_type) {
+  case BT_radix_state_sorted:
+    {
+      // The texture in the top 20 bits, the state in the next 24, and
+      // the distance in the low 20, so that objects are grouped by
+      // texture and then by state, and drawn front-to-back within
+      // each state.  If there are more than a million textures or
+      // 16 million states in a bin, the grouping becomes imperfect,
+      // but the result is still correct.
+      const RenderState *state = object->_state;
+      int texture_id = _texture_ids.get_id(state->get_attrib(TextureAttrib::get_class_slot()));
+      int state_id = _state_ids.get_id(state);
+      key = (((PN_uint64)(texture_id & 0xfffff) << 44) |
+             ((PN_uint64)(state_id & 0xffffff) << 20) |
+             (PN_uint64)(distance_key >> 12));
+    }
+    break;
+
+  case BT_radix_back_to_front:
+    key = (PN_uint64)(~distance_key);
+    break;
+
+  default:
+    key = (PN_uint64)distance_key;
+    break;
+  }
+
+  _objects.push_back(ObjectData(object, key));
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::finish_cull
+//       Access: Public
+//  Description: Called after all the geoms have been added, this
+//               indicates that the cull process is finished for this
+//               frame and gives the bins a chance to do any
+//               post-processing (like sorting) before moving on to
+//               draw.
+////////////////////////////////////////////////////////////////////
+void CullBinRadixSorted::
+finish_cull(SceneSetup *, Thread *current_thread) {
+  PStatTimer timer(_cull_this_pcollector, current_thread);
+  if (_objects.size() < min_radix_sort_objects) {
+    stable_sort(_objects.begin(), _objects.end());
+  } else {
+    radix_sort();
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::draw
+//       Access: Public, Virtual
+//  Description: Draws all the geoms in the bin, in the appropriate
+//               order.
+////////////////////////////////////////////////////////////////////
+void CullBinRadixSorted::
+draw(bool force, Thread *current_thread) {
+  PStatTimer timer(_draw_this_pcollector, current_thread);
+  Objects::const_iterator oi;
+  for (oi = _objects.begin(); oi != _objects.end(); ++oi) {
+    CullableObject *object = (*oi)._object;
+    CullHandler::draw(object, _gsg, force, current_thread);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::fill_result_graph
+//       Access: Protected, Virtual
+//  Description: Called by CullBin::make_result_graph() to add all the
+//               geoms to the special cull result scene graph.
+////////////////////////////////////////////////////////////////////
+void CullBinRadixSorted::
+fill_result_graph(CullBin::ResultGraphBuilder &builder) {
+  Objects::const_iterator oi;
+  for (oi = _objects.begin(); oi != _objects.end(); ++oi) {
+    CullableObject *object = (*oi)._object;
+    builder.add_object(object);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::radix_sort
+//       Access: Private
+//  Description: Sorts _objects by key, a byte at a time from the
+//               least significant, using _scratch as the second
+//               buffer.  A byte that is the same in every key is
+//               skipped, so keys that use only their low bits cost
+//               only the passes they need.
+////////////////////////////////////////////////////////////////////
+void CullBinRadixSorted::
+radix_sort() {
+  size_t num_objects = _objects.size();
+
+  // Count the values of all eight bytes in a single pass.
+  size_t counts[8][256];
+  memset(counts, 0, sizeof(counts));
+  Objects::const_iterator oi;
+  for (oi = _objects.begin(); oi != _objects.end(); ++oi) {
+    PN_uint64 key = (*oi)._key;
+    for (int b = 0; b < 8; ++b) {
+      ++counts[b][(key >> (b * 8)) & 0xff];
+    }
+  }
+
+  _scratch.resize(num_objects, _objects[0]);
+  ObjectData *source = &_objects[0];
+  ObjectData *dest = &_scratch[0];
+  for (int b = 0; b < 8; ++b) {
+    int shift = b * 8;
+    size_t *count = counts[b];
+    if (count[(source[0]._key >> shift) & 0xff] == num_objects) {
+      continue;
+    }
+
+    // Turn the counts into starting offsets, then scatter.  This is
+    // stable, so the order of the less significant bytes is kept.
+    size_t offset = 0;
+    for (int d = 0; d < 256; ++d) {
+      size_t c = count[d];
+      count[d] = offset;
+      offset += c;
+    }
+    for (size_t i = 0; i < num_objects; ++i) {
+      dest[count[(source[i]._key >> shift) & 0xff]++] = source[i];
+    }
+    swap(source, dest);
+  }
+
+  if (source != &_objects[0]) {
+    _objects.swap(_scratch);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBinRadixSorted::IdTable::grow
+//       Access: Private
+//  Description: Doubles the size of the hash table.
+////////////////////////////////////////////////////////////////////
+void CullBinRadixSorted::IdTable::
+grow() {
+  Keys keys;
+  Ids ids;
+  keys.swap(_keys);
+  ids.swap(_ids);
+
+  size_t size = max(keys.size() * 2, (size_t)64);
+  _keys.insert(_keys.end(), size, (const void *)NULL);
+  _ids.insert(_ids.end(), size, 0);
+
+  size_t mask = size - 1;
+  for (size_t j = 0; j < keys.size(); ++j) {
+    if (keys[j] != (const void *)NULL) {
+      size_t i = get_hash(keys[j]) & mask;
+      while (_keys[i] != (const void *)NULL) {
+        i = (i + 1) & mask;
+      }
+      _keys[i] = keys[j];
+      _ids[i] = ids[j];
+    }
+  }
+}
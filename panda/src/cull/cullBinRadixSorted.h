@@ -0,0 +1,128 @@
+// Filename: cullBinRadixSorted.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef CULLBINRADIXSORTED_H
+#define CULLBINRADIXSORTED_H
+
+#include "pandabase.h"
+
+#include "cullBin.h"
+#include "cullableObject.h"
+#include "numeric_types.h"
+#include "pvector.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : CullBinRadixSorted
+// Description : A kind of CullBin that computes a 64-bit sort key for
+//               each object as it is added, and then radix-sorts the
+//               objects by key, rather than comparing them pairwise.
+//               It implements three bin types, which are counterparts
+//               of the comparison-sorted bins:
+//
+//               BT_radix_state_sorted groups objects by texture,
+//               then by complete RenderState, and then sorts them
+//               roughly front-to-back within each state.  Unlike
+//               CullBinStateSorted, it does not group by transform.
+//
+//               BT_radix_back_to_front and BT_radix_front_to_back
+//               sort by the distance to the camera, just like
+//               CullBinBackToFront and CullBinFrontToBack.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_CULL CullBinRadixSorted : public CullBin {
+protected:
+  INLINE CullBinRadixSorted(const CullBinRadixSorted &copy);
+public:
+  INLINE CullBinRadixSorted(const string &name, BinType bin_type,
+                            GraphicsStateGuardianBase *gsg,
+                            const PStatCollector &draw_region_pcollector);
+  virtual ~CullBinRadixSorted();
+
+  static CullBin *make_state_sorted_bin(const string &name,
+                                        GraphicsStateGuardianBase *gsg,
+                                        const PStatCollector &draw_region_pcollector);
+  static CullBin *make_back_to_front_bin(const string &name,
+                                         GraphicsStateGuardianBase *gsg,
+                                         const PStatCollector &draw_region_pcollector);
+  static CullBin *make_front_to_back_bin(const string &name,
+                                         GraphicsStateGuardianBase *gsg,
+                                         const PStatCollector &draw_region_pcollector);
+
+  virtual PT(CullBin) make_next() const;
+
+  virtual void add_object(CullableObject *object, Thread *current_thread);
+  virtual void finish_cull(SceneSetup *scene_setup, Thread *current_thread);
+  virtual void draw(bool force, Thread *current_thread);
+
+protected:
+  virtual void fill_result_graph(ResultGraphBuilder &builder);
+
+private:
+  void radix_sort();
+  INLINE static PN_uint32 get_distance_key(PN_stdfloat distance);
+
+  class ObjectData {
+  public:
+    INLINE ObjectData(CullableObject *object, PN_uint64 key);
+    INLINE bool operator < (const ObjectData &other) const;
+
+    PN_uint64 _key;
+    CullableObject *_object;
+  };
+
+  typedef pvector<ObjectData> Objects;
+  Objects _objects;
+  Objects _scratch;
+
+  // This assigns small, consecutive integers to the states and
+  // textures seen in this bin, for use in the sort keys.
+  class IdTable {
+  public:
+    INLINE IdTable();
+    INLINE int get_id(const void *pointer);
+
+  private:
+    void grow();
+    INLINE static size_t get_hash(const void *pointer);
+
+    typedef pvector<const void *> Keys;
+    typedef pvector<int> Ids;
+    Keys _keys;
+    Ids _ids;
+    int _num_ids;
+  };
+
+  IdTable _state_ids;
+  IdTable _texture_ids;
+
+public:
+  static TypeHandle get_class_type() {
+    return _type_handle;
+  }
+  static void init_type() {
+    CullBin::init_type();
+    register_type(_type_handle, "CullBinRadixSorted",
+                  CullBin::get_class_type());
+  }
+  virtual TypeHandle get_type() const {
+    return get_class_type();
+  }
+  virtual TypeHandle force_init_type() {init_type(); return get_class_type();}
+
+private:
+  static TypeHandle _type_handle;
+};
+
+#include "cullBinRadixSorted.I"
+
+#endif
@@ -152,3 +152,13 @@
 
 #end test_bin_target
 
+
+#begin test_bin_target
+  #define TARGET test_cull_cache
+  #define LOCAL_LIBS \
+    p3display p3pgraphnodes p3pgraph p3gobj p3putil
+
+  #define SOURCES \
+    test_cull_cache.cxx
+
+#end test_bin_target
@@ -292,6 +292,17 @@ ConfigVariableBool allow_incomplete_render
           "geometry is always paged in immediately when needed, holding up "
           "the frame render if necessary."));
 
+ConfigVariableInt parallel_cull_threads
+("parallel-cull-threads", 1,
+ PRC_DESC("The default number of threads used to walk the scene graph "
+          "during the cull traversal of each DisplayRegion.  Values "
+          "greater than 1 divide the scene graph into subtrees whose "
+          "nodes are visited and view-frustum culled in parallel.  The "
+          "objects they find are still sorted into the cull bins by the "
+          "cull thread alone, after the parallel walk has finished.  This "
+          "may be overridden per DisplayRegion with "
+          "DisplayRegion::set_cull_num_threads()."));
+
 ConfigVariableInt win_size
 ("win-size", "640 480",
  PRC_DESC("This is the default size at which to open a new window.  This "
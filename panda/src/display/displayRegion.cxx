@@ -37,6 +37,7 @@ DisplayRegion(GraphicsOutput *window, const LVecBase4 &dimensions) :
   _window(window),
   _incomplete_render(true),
   _texture_reload_priority(0),
+  _cull_num_threads(parallel_cull_threads),
   _cull_region_pcollector("Cull:Invalid"),
   _draw_region_pcollector("Draw:Invalid")
 {
@@ -359,6 +360,28 @@ set_texture_reload_priority(int texture_reload_priority) {
   _texture_reload_priority = texture_reload_priority;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: DisplayRegion::set_cull_num_threads
+//       Access: Published, Virtual
+//  Description: Specifies the number of threads that should walk
+//               the scene graph during the cull traversal for this
+//               DisplayRegion.  When this is greater than 1, the
+//               scene graph is divided into subtrees that are culled
+//               in parallel; the results are then merged and sorted
+//               into the cull bins by the cull thread alone; see
+//               CullTraverser::set_num_threads().  This is most
+//               useful for a single large scene on a machine with
+//               many cores.  Subtrees with cull callbacks or fog are
+//               still culled by the cull thread itself.
+//
+//               The default is taken from the parallel-cull-threads
+//               config variable.
+////////////////////////////////////////////////////////////////////
+void DisplayRegion::
+set_cull_num_threads(int cull_num_threads) {
+  _cull_num_threads = cull_num_threads;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: DisplayRegion::set_cull_traverser
 //       Access: Published, Virtual
@@ -105,6 +105,9 @@ PUBLISHED:
   virtual void set_texture_reload_priority(int texture_reload_priority);
   INLINE int get_texture_reload_priority() const;
 
+  virtual void set_cull_num_threads(int cull_num_threads);
+  INLINE int get_cull_num_threads() const;
+
   void set_lens_index(int index);
   INLINE int get_lens_index() const;
 
@@ -174,6 +177,7 @@ protected:
 
   bool _incomplete_render;
   int _texture_reload_priority;
+  int _cull_num_threads;
 
   // Ditto for the cull traverser.
   PT(CullTraverser) _trav;
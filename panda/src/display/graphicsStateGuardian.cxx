@@ -1571,6 +1571,14 @@ end_frame(Thread *current_thread) {
   _transform_state_pcollector.flush_level();
   _draw_primitive_pcollector.flush_level();
 
+  // Ask for the larger mipmap levels of any streamed textures that
+  // were drawn big enough to need them.
+  TextureResidencyManager *residency_manager =
+    _prepared_objects->get_texture_residency_manager();
+  if (residency_manager != (TextureResidencyManager *)NULL) {
+    residency_manager->update(_prepared_objects, this);
+  }
+
   // Evict any textures and/or vbuffers that exceed our texture memory.
   _prepared_objects->_graphics_memory_lru.begin_epoch();
 }
@@ -285,6 +285,19 @@ set_texture_reload_priority(int texture_reload_priority) {
   _right_eye->set_texture_reload_priority(texture_reload_priority);
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: StereoDisplayRegion::set_cull_num_threads
+//       Access: Published, Virtual
+//  Description: Sets the cull_num_threads on both the left and right
+//               DisplayRegions to the indicated value.
+////////////////////////////////////////////////////////////////////
+void StereoDisplayRegion::
+set_cull_num_threads(int cull_num_threads) {
+  DisplayRegion::set_cull_num_threads(cull_num_threads);
+  _left_eye->set_cull_num_threads(cull_num_threads);
+  _right_eye->set_cull_num_threads(cull_num_threads);
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: StereoDisplayRegion::set_cull_traverser
 //       Access: Published, Virtual
@@ -60,6 +60,7 @@ PUBLISHED:
   virtual void set_tex_view_offset(int tex_view_offset);
   virtual void set_incomplete_render(bool incomplete_render);
   virtual void set_texture_reload_priority(int texture_reload_priority);
+  virtual void set_cull_num_threads(int cull_num_threads);
   virtual void set_cull_traverser(CullTraverser *trav);
   virtual void set_cube_map_index(int cube_map_index);
 
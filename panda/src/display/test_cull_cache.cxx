@@ -0,0 +1,197 @@
+// Filename: test_cull_cache.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "graphicsStateGuardian.h"
+#include "cullCacheNode.h"
+#include "cullTraverser.h"
+#include "cullHandler.h"
+#include "cullableObject.h"
+#include "sceneSetup.h"
+#include "camera.h"
+#include "perspectiveLens.h"
+#include "planeNode.h"
+#include "geomNode.h"
+#include "geom.h"
+#include "geomTriangles.h"
+#include "geomVertexData.h"
+#include "geomVertexFormat.h"
+#include "geomVertexWriter.h"
+#include "colorAttrib.h"
+#include "renderState.h"
+#include "nodePath.h"
+#include "pmap.h"
+
+// Checks that a CullCacheNode gives the same result as an ordinary
+// traversal of its subgraph as cameras are switched, their tag
+// states are changed, and the subgraph is modified in ways that don't
+// change any node's bounding volume.
+
+// Records the objects it is given, by Geom, and whether each has a
+// flat color.
+class TestHandler : public CullHandler {
+public:
+  virtual void record_object(CullableObject *object,
+                             const CullTraverser *traverser) {
+    const ColorAttrib *ca = DCAST(ColorAttrib, object->_state->get_attrib(ColorAttrib::get_class_slot()));
+    _colored[object->_geom] =
+      (ca != (ColorAttrib *)NULL && ca->get_color_type() == ColorAttrib::T_flat);
+    delete object;
+  }
+
+  pmap<CPT(Geom), bool> _colored;
+};
+
+static PT(GeomVertexData)
+make_triangle(NodePath &parent, const string &name, PT(Geom) &geom,
+              NodePath &np) {
+  PT(GeomVertexData) vdata = new GeomVertexData
+    (name, GeomVertexFormat::get_v3(), Geom::UH_static);
+  GeomVertexWriter vertex(vdata, InternalName::get_vertex());
+  vertex.add_data3(-1.0f, 0.0f, -1.0f);
+  vertex.add_data3(1.0f, 0.0f, -1.0f);
+  vertex.add_data3(0.0f, 0.0f, 1.0f);
+
+  PT(GeomTriangles) tris = new GeomTriangles(Geom::UH_static);
+  tris->add_vertices(0, 1, 2);
+  geom = new Geom(vdata);
+  geom->add_primitive(tris);
+
+  PT(GeomNode) node = new GeomNode(name);
+  node->add_geom(geom);
+  np = parent.attach_new_node(node);
+  return vdata;
+}
+
+static void
+cull(GraphicsStateGuardian *gsg, const NodePath &root,
+     const NodePath &camera_np, TestHandler &handler) {
+  Camera *camera = DCAST(Camera, camera_np.node());
+  CPT(TransformState) camera_transform = camera_np.get_transform(root);
+
+  PT(SceneSetup) scene = new SceneSetup;
+  scene->set_scene_root(root);
+  scene->set_camera_path(camera_np);
+  scene->set_camera_node(camera);
+  scene->set_lens(camera->get_lens());
+  scene->set_initial_state(RenderState::make_empty());
+  scene->set_camera_transform(camera_transform);
+  scene->set_world_transform(camera_transform->get_inverse());
+  scene->set_cs_transform(TransformState::make_identity());
+
+  PT(GeometricBoundingVolume) frustum =
+    DCAST(GeometricBoundingVolume, camera->get_lens()->make_bounds());
+  frustum->xform(camera_transform->get_mat());
+
+  handler._colored.clear();
+  CullTraverser trav;
+  trav.set_cull_handler(&handler);
+  trav.set_scene(scene, gsg, true);
+  trav.set_view_frustum(frustum);
+  trav.traverse(root);
+  trav.end_traverse();
+}
+
+static bool
+check(const char *what, TestHandler &handler, const Geom *geom,
+      bool visible, bool colored) {
+  pmap<CPT(Geom), bool>::const_iterator gi = handler._colored.find(geom);
+  bool is_visible = (gi != handler._colored.end());
+  bool is_colored = is_visible && (*gi).second;
+  if (is_visible != visible || is_colored != colored) {
+    nout << what << ": visible " << is_visible << ", colored "
+         << is_colored << "; expected visible " << visible
+         << ", colored " << colored << "\n";
+    return false;
+  }
+  return true;
+}
+
+int
+main(int argc, char *argv[]) {
+  PT(GraphicsStateGuardian) gsg = new GraphicsStateGuardian(CS_default, NULL, NULL);
+  CPT(RenderState) red = RenderState::make(ColorAttrib::make_flat(LColor(1, 0, 0, 1)));
+
+  NodePath root("root");
+  NodePath cache = root.attach_new_node(new CullCacheNode("cache"));
+  PT(Geom) geom_a, geom_b;
+  NodePath np_a, np_b;
+  PT(GeomVertexData) vdata_a = make_triangle(cache, "a", geom_a, np_a);
+  make_triangle(cache, "b", geom_b, np_b);
+
+  NodePath cam1 = root.attach_new_node(new Camera("cam1", new PerspectiveLens));
+  NodePath cam2 = root.attach_new_node(new Camera("cam2", new PerspectiveLens));
+  cam1.set_pos(0, -20, 0);
+  cam2.set_pos(0, -30, 0);
+  DCAST(Camera, cam2.node())->set_tag_state_key("key");
+  DCAST(Camera, cam2.node())->set_tag_state("red", red);
+
+  TestHandler handler;
+  bool ok = true;
+
+  // Switching cameras, one of which has a tag state key.
+  np_b.set_tag("key", "red");
+  cull(gsg, root, cam1, handler);
+  ok = check("cam1 a", handler, geom_a, true, false) && ok;
+  ok = check("cam1 b", handler, geom_b, true, false) && ok;
+  cull(gsg, root, cam2, handler);
+  ok = check("cam2 b", handler, geom_b, true, true) && ok;
+  cull(gsg, root, cam1, handler);
+  ok = check("cam1 again b", handler, geom_b, true, false) && ok;
+
+  // Giving a tag state key to a camera whose result is already
+  // cached.
+  cull(gsg, root, cam1, handler);
+  DCAST(Camera, cam1.node())->set_tag_state_key("key");
+  DCAST(Camera, cam1.node())->set_tag_state("red", red);
+  cull(gsg, root, cam1, handler);
+  ok = check("cam1 with key b", handler, geom_b, true, true) && ok;
+
+  // Tagging a node below a cached subgraph.
+  np_b.clear_tag("key");
+  cull(gsg, root, cam1, handler);
+  ok = check("untagged b", handler, geom_b, true, false) && ok;
+  np_a.set_tag("key", "red");
+  cull(gsg, root, cam1, handler);
+  ok = check("tagged a", handler, geom_a, true, true) && ok;
+  np_a.clear_tag("key");
+
+  // Moving vertices in place, which changes no node's bounds.
+  cull(gsg, root, cam1, handler);
+  ok = check("before edit a", handler, geom_a, true, false) && ok;
+  {
+    GeomVertexWriter vertex(vdata_a, InternalName::get_vertex());
+    vertex.set_data3(999.0f, 0.0f, -1.0f);
+    vertex.set_data3(1001.0f, 0.0f, -1.0f);
+    vertex.set_data3(1000.0f, 0.0f, 1.0f);
+  }
+  cull(gsg, root, cam1, handler);
+  ok = check("after edit a", handler, geom_a, false, false) && ok;
+  ok = check("after edit b", handler, geom_b, true, false) && ok;
+
+  // A clip plane within the subgraph, moved from outside it.
+  PT(PlaneNode) plane = new PlaneNode("plane", LPlane(LVector3(-1, 0, 0), LPoint3(-5, 0, 0)));
+  NodePath plane_np = root.attach_new_node(plane);
+  np_b.set_clip_plane(plane_np);
+  cull(gsg, root, cam1, handler);
+  ok = check("clipped b", handler, geom_b, false, false) && ok;
+  plane->set_plane(LPlane(LVector3(1, 0, 0), LPoint3(-5, 0, 0)));
+  cull(gsg, root, cam1, handler);
+  ok = check("unclipped b", handler, geom_b, true, false) && ok;
+  plane_np.set_x(10);
+  cull(gsg, root, cam1, handler);
+  ok = check("moved plane b", handler, geom_b, false, false) && ok;
+
+  nout << (ok ? "OK" : "FAILED") << "\n";
+  return ok ? 0 : 1;
+}
@@ -24,6 +24,7 @@
 #include "animBundle.h"
 #include "animBundleNode.h"
 #include "animChannelMatrixXfmTable.h"
+#include "animChannelMatrixQuantized.h"
 #include "animChannelScalarTable.h"
 
 ////////////////////////////////////////////////////////////////////
@@ -252,10 +253,11 @@ create_s_channel(EggSAnimData *egg_anim, const string &name,
 ////////////////////////////////////////////////////////////////////
 //     Function: AnimBundleMaker::create_xfm_channel (EggNode)
 //       Access: Private
-//  Description: Creates an AnimChannelMatrixXfmTable corresponding to
-//               the given EggNode structure, if possible.
+//  Description: Creates an AnimChannelMatrixXfmTable (or an
+//               AnimChannelMatrixQuantized) corresponding to the
+//               given EggNode structure, if possible.
 ////////////////////////////////////////////////////////////////////
-AnimChannelMatrixXfmTable *AnimBundleMaker::
+AnimGroup *AnimBundleMaker::
 create_xfm_channel(EggNode *egg_node, const string &name,
                    AnimGroup *parent) {
   if (egg_node->is_of_type(EggXfmAnimData::get_class_type())) {
@@ -279,17 +281,27 @@ create_xfm_channel(EggNode *egg_node, const string &name,
 //     Function: AnimBundleMaker::create_xfm_channel (EggXfmSAnim)
 //       Access: Private
 //  Description: Creates an AnimChannelMatrixXfmTable corresponding to
-//               the given EggXfmSAnim structure.
+//               the given EggXfmSAnim structure.  If
+//               egg-quantize-anim-channels is true, creates an
+//               AnimChannelMatrixQuantized instead.
 ////////////////////////////////////////////////////////////////////
-AnimChannelMatrixXfmTable *AnimBundleMaker::
+AnimGroup *AnimBundleMaker::
 create_xfm_channel(EggXfmSAnim *egg_anim, const string &name,
                    AnimGroup *parent) {
   // Ensure that the anim table is optimal and that it is standard
   // order.
   egg_anim->optimize_to_standard_order();
 
-  AnimChannelMatrixXfmTable *table
-    = new AnimChannelMatrixXfmTable(parent, name);
+  AnimChannelMatrixXfmTable *table = NULL;
+  AnimChannelMatrixQuantized *quantized = NULL;
+  AnimGroup *channel;
+  if (egg_quantize_anim_channels) {
+    quantized = new AnimChannelMatrixQuantized(parent, name);
+    channel = quantized;
+  } else {
+    table = new AnimChannelMatrixXfmTable(parent, name);
+    channel = table;
+  }
 
   // The EggXfmSAnim structure has a number of children which are
   // EggSAnimData tables.  Each of these represents a separate
@@ -306,14 +318,16 @@ create_xfm_channel(EggXfmSAnim *egg_anim, const string &name,
           << "\n";
       } else {
         char table_id = child->get_name()[0];
+        bool has_table = (quantized != (AnimChannelMatrixQuantized *)NULL) ?
+          quantized->has_table(table_id) : table->has_table(table_id);
 
         if (child->get_name().length() > 1 ||
-            !table->is_valid_id(table_id)) {
+            !AnimChannelMatrixXfmTable::is_valid_id(table_id)) {
           egg2pg_cat.warning()
             << "Unexpected table name " << child->get_name()
             << ", child of " << name << "\n";
 
-        } else if (table->has_table(table_id)) {
+        } else if (has_table) {
           egg2pg_cat.warning()
             << "Duplicate table definition for " << table_id
             << " under " << name << "\n";
@@ -323,17 +337,21 @@ create_xfm_channel(EggXfmSAnim *egg_anim, const string &name,
           // Now we have to copy the table data from PTA_double to
           // PTA_stdfloat.
           PTA_stdfloat new_data=PTA_stdfloat::empty_array(child->get_num_rows(),
-                                                    table->get_class_type());
+                                                    channel->get_type());
           for (int i = 0; i < child->get_num_rows(); i++) {
             new_data[i] = (PN_stdfloat)child->get_value(i);
           }
 
           // Now we can assign the table.
-          table->set_table(table_id, new_data);
+          if (quantized != (AnimChannelMatrixQuantized *)NULL) {
+            quantized->set_table(table_id, new_data);
+          } else {
+            table->set_table(table_id, new_data);
+          }
         }
       }
     }
   }
 
-  return table;
+  return channel;
 }
@@ -28,6 +28,7 @@ class AnimBundle;
 class AnimBundleNode;
 class AnimChannelScalarTable;
 class AnimChannelMatrixXfmTable;
+class AnimChannelMatrixQuantized;
 
 ////////////////////////////////////////////////////////////////////
 //       Class : AnimBundleMaker
@@ -49,10 +50,10 @@ private:
   AnimChannelScalarTable *
   create_s_channel(EggSAnimData *egg_anim, const string &name,
                    AnimGroup *parent);
-  AnimChannelMatrixXfmTable *
+  AnimGroup *
   create_xfm_channel(EggNode *egg_node, const string &name,
                      AnimGroup *parent);
-  AnimChannelMatrixXfmTable *
+  AnimGroup *
   create_xfm_channel(EggXfmSAnim *egg_anim, const string &name,
                      AnimGroup *parent);
 
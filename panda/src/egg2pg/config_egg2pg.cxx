@@ -191,6 +191,14 @@ ConfigVariableBool egg_implicit_alpha_binary
           "will automatically be downgraded to alpha type \"binary\" instead of "
           "whatever appears in the egg file."));
 
+ConfigVariableBool egg_quantize_anim_channels
+("egg-quantize-anim-channels", false,
+ PRC_DESC("Set this true to load the transform tables of an egg animation "
+          "as AnimChannelMatrixQuantized channels, which store each "
+          "component as a reduced set of 16-bit keyframes, instead of "
+          "as full tables of floats.  The allowable error is controlled "
+          "by quantize-chan-tolerance and quantize-chan-angle-tolerance."));
+
 ConfigureFn(config_egg2pg) {
   init_libegg2pg();
 }
@@ -55,6 +55,7 @@ extern EXPCL_PANDAEGG ConfigVariableBool egg_preload_simple_textures;
 extern EXPCL_PANDAEGG ConfigVariableDouble egg_vertex_membership_quantize;
 extern EXPCL_PANDAEGG ConfigVariableInt egg_vertex_max_num_joints;
 extern EXPCL_PANDAEGG ConfigVariableBool egg_implicit_alpha_binary;
+extern EXPCL_PANDAEGG ConfigVariableBool egg_quantize_anim_channels;
 
 extern EXPCL_PANDAEGG void init_libegg2pg();
 
@@ -24,7 +24,8 @@
     event.I event.h eventHandler.h eventHandler.I \
     eventParameter.I eventParameter.h \
     eventQueue.I eventQueue.h eventReceiver.h \
-    pt_Event.h throw_event.I throw_event.h 
+    pt_Event.h throw_event.I throw_event.h \
+    workerThreadPool.h workerThreadPool.I
     
   #define INCLUDED_SOURCES \
     asyncTask.cxx \
@@ -41,7 +42,8 @@
     pythonTask.cxx \
     config_event.cxx event.cxx eventHandler.cxx \ 
     eventParameter.cxx eventQueue.cxx eventReceiver.cxx \
-    pt_Event.cxx
+    pt_Event.cxx \
+    workerThreadPool.cxx
 
   #define INSTALL_HEADERS \
     asyncTask.h asyncTask.I \
@@ -59,7 +61,8 @@
     event.I event.h eventHandler.h eventHandler.I \
     eventParameter.I eventParameter.h \
     eventQueue.I eventQueue.h eventReceiver.h \
-    pt_Event.h throw_event.I throw_event.h 
+    pt_Event.h throw_event.I throw_event.h \
+    workerThreadPool.h workerThreadPool.I
 
   #define IGATESCAN all
 
@@ -5,4 +5,5 @@
 #include "eventQueue.cxx"
 #include "eventReceiver.cxx"
 #include "pt_Event.cxx"
+#include "workerThreadPool.cxx"
 
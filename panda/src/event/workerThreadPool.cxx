@@ -0,0 +1,331 @@
+// Filename: workerThreadPool.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "workerThreadPool.h"
+#include "mutexHolder.h"
+#include "lightMutexHolder.h"
+#include "pStatClient.h"
+#include "pStatTimer.h"
+#include "config_event.h"
+
+WorkerThreadPool::SharedPools *WorkerThreadPool::_shared_pools = NULL;
+LightMutex WorkerThreadPool::_shared_pools_lock("WorkerThreadPool::_shared_pools_lock");
+PStatCollector WorkerThreadPool::_wait_pcollector("Wait");
+
+////////////////////////////////////////////////////////////////////
+//     Function: WorkerThreadPool::Constructor
+//       Access: Public
+//  Description: Creates a pool that divides each batch of jobs among
+//               num_threads threads.  The thread calling run_jobs()
+//               counts as one of these, so num_threads - 1 new
+//               threads are started.  If threading is not available,
+//               all jobs will be run by the calling thread.
+////////////////////////////////////////////////////////////////////
+WorkerThreadPool::
+WorkerThreadPool(const string &name, int num_threads) :
+  _name(name),
+  _requested_num_threads(num_threads),
+  _run_lock("WorkerThreadPool::_run_lock"),
+  _run_thread(NULL),
+  _lock("WorkerThreadPool::_lock"),
+  _start_cvar(_lock),
+  _done_cvar(_lock),
+  _batch_seq(0),
+  _func(NULL),
+  _user_data(NULL),
+  _num_active(0),
+  _shutdown(false)
+{
+  if (!Thread::is_threading_supported()) {
+    num_threads = 1;
+  }
+  _num_queues = max(num_threads, 1);
+  _queues = new JobQueue[_num_queues];
+
+  _workers.reserve(_num_queues - 1);
+  for (int i = 1; i < _num_queues; ++i) {
+    ostringstream name_strm;
+    name_strm << _name << "_" << i;
+    PT(Worker) worker = new Worker(this, name_strm.str(), i);
+    if (!worker->start(TP_normal, true)) {
+      task_cat.error()
+        << "Unable to start thread " << worker->get_name() << "\n";
+      _num_queues = i;
+      break;
+    }
+    _workers.push_back(worker);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: WorkerThreadPool::Destructor
+//       Access: Public
+//  Description: Stops all of the threads and waits for them to exit.
+////////////////////////////////////////////////////////////////////
+WorkerThreadPool::
+~WorkerThreadPool() {
+  {
+    MutexHolder holder(_lock);
+    _shutdown = true;
+    _start_cvar.notify_all();
+  }
+
+  Workers::iterator wi;
+  for (wi = _workers.begin(); wi != _workers.end(); ++wi) {
+    (*wi)->join();
+  }
+  _workers.clear();
+
+  delete[] _queues;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: WorkerThreadPool::run_jobs
+//       Access: Public
+//  Description: Calls func(job_index, current_thread, user_data) once
+//               for each job_index in the range [0, num_jobs), spread
+//               across all of the threads in the pool, and returns
+//               when all of the calls have returned.  The calling
+//               thread runs its share of the jobs too.
+//
+//               The jobs are initially divided among the threads in
+//               contiguous ranges, so neighboring jobs tend to run on
+//               the same thread.
+//
+//               This may not be called from within one of this pool's
+//               own jobs.
+////////////////////////////////////////////////////////////////////
+void WorkerThreadPool::
+run_jobs(int num_jobs, JobFunc *func, void *user_data) {
+  if (num_jobs <= 0) {
+    return;
+  }
+
+  Thread *current_thread = Thread::get_current_thread();
+
+  // A job of this pool can't start a new batch on it; see the class
+  // description.
+  nassertv(!is_running_jobs(current_thread));
+
+  if (_num_queues <= 1 || num_jobs == 1) {
+    // No point in waking up anyone else.
+    for (int i = 0; i < num_jobs; ++i) {
+      (*func)(i, current_thread, user_data);
+    }
+    return;
+  }
+
+  MutexHolder run_holder(_run_lock);
+  AtomicAdjust::set_ptr(_run_thread, current_thread);
+
+  {
+    MutexHolder holder(_lock);
+
+    // A worker that woke up too late for the previous batch may still
+    // be looking for jobs; wait for it to give up before we fill the
+    // queues again, so it doesn't run one of our jobs with the old
+    // function.
+    while (_num_active != 0) {
+      _done_cvar.wait();
+    }
+
+    for (int qi = 0; qi < _num_queues; ++qi) {
+      JobQueue &queue = _queues[qi];
+      LightMutexHolder queue_holder(queue._lock);
+      nassertv(queue._jobs.empty());
+      int begin = (int)(((PN_int64)num_jobs * qi) / _num_queues);
+      int end = (int)(((PN_int64)num_jobs * (qi + 1)) / _num_queues);
+      for (int ji = begin; ji < end; ++ji) {
+        queue._jobs.push_back(ji);
+      }
+    }
+
+    _func = func;
+    _user_data = user_data;
+    ++_batch_seq;
+    _start_cvar.notify_all();
+  }
+
+  do_jobs(0, current_thread, func, user_data);
+
+  // Once we have run out of jobs, the batch is finished as soon as
+  // every worker that picked up a job has finished it.
+  MutexHolder holder(_lock);
+  while (_num_active != 0) {
+    PStatTimer timer(_wait_pcollector, current_thread);
+    _done_cvar.wait();
+  }
+  _func = NULL;
+  _user_data = NULL;
+  AtomicAdjust::set_ptr(_run_thread, NULL);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: WorkerThreadPool::get_shared
+//       Access: Public, Static
+//  Description: Returns the pool of the indicated name and number of
+//               threads that is shared by all callers, creating it
+//               if necessary.  Pools are kept by the requested count,
+//               not get_num_threads(), so a pool that could not start
+//               all of its threads is still found again.  Callers
+//               that ask for different counts under the same name get
+//               separate pools, each of which lasts for the rest of
+//               the session.
+//
+//               Since only one batch may run on a pool at a time,
+//               callers that share a pool also share its threads.
+////////////////////////////////////////////////////////////////////
+PT(WorkerThreadPool) WorkerThreadPool::
+get_shared(const string &name, int num_threads) {
+  LightMutexHolder holder(_shared_pools_lock);
+  if (_shared_pools == (SharedPools *)NULL) {
+    _shared_pools = new SharedPools;
+  }
+
+  PT(WorkerThreadPool) &pool = (*_shared_pools)[SharedKey(name, num_threads)];
+  if (pool == (WorkerThreadPool *)NULL) {
+    pool = new WorkerThreadPool(name, num_threads);
+  }
+  return pool;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: WorkerThreadPool::do_jobs
+//       Access: Private
+//  Description: Runs jobs from the indicated queue until it is empty,
+//               and then steals from the other queues until they are
+//               all empty.
+////////////////////////////////////////////////////////////////////
+void WorkerThreadPool::
+do_jobs(int queue_index, Thread *current_thread,
+        JobFunc *func, void *user_data) {
+  int job_index;
+  while (pop_job(queue_index, job_index) ||
+         steal_job(queue_index, job_index)) {
+    (*func)(job_index, current_thread, user_data);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: WorkerThreadPool::pop_job
+//       Access: Private
+//  Description: Takes the next job from the front of the indicated
+//               queue.  Returns true if there was one, false if the
+//               queue is empty.
+////////////////////////////////////////////////////////////////////
+bool WorkerThreadPool::
+pop_job(int queue_index, int &job_index) {
+  JobQueue &queue = _queues[queue_index];
+  LightMutexHolder holder(queue._lock);
+  if (queue._jobs.empty()) {
+    return false;
+  }
+  job_index = queue._jobs.front();
+  queue._jobs.pop_front();
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: WorkerThreadPool::steal_job
+//       Access: Private
+//  Description: Takes a job from the back of some other thread's
+//               queue, checking the queues in turn starting with the
+//               one after queue_index.  Returns true if a job was
+//               found, false if all the queues are empty.
+////////////////////////////////////////////////////////////////////
+bool WorkerThreadPool::
+steal_job(int queue_index, int &job_index) {
+  for (int i = 1; i < _num_queues; ++i) {
+    JobQueue &queue = _queues[(queue_index + i) % _num_queues];
+    LightMutexHolder holder(queue._lock);
+    if (!queue._jobs.empty()) {
+      job_index = queue._jobs.back();
+      queue._jobs.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: WorkerThreadPool::is_running_jobs
+//       Access: Private
+//  Description: Returns true if the indicated thread is one of the
+//               threads started by this pool, or the thread that is
+//               running the current batch; that is, if it might be in
+//               the middle of one of this pool's jobs.
+////////////////////////////////////////////////////////////////////
+bool WorkerThreadPool::
+is_running_jobs(Thread *thread) const {
+  if (AtomicAdjust::get_ptr(_run_thread) == thread) {
+    return true;
+  }
+  Workers::const_iterator wi;
+  for (wi = _workers.begin(); wi != _workers.end(); ++wi) {
+    if ((*wi).p() == thread) {
+      return true;
+    }
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: WorkerThreadPool::Worker::Constructor
+//       Access: Public
+//  Description:
+////////////////////////////////////////////////////////////////////
+WorkerThreadPool::Worker::
+Worker(WorkerThreadPool *pool, const string &name, int queue_index) :
+  Thread(name, pool->get_name()),
+  _pool(pool),
+  _queue_index(queue_index)
+{
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: WorkerThreadPool::Worker::thread_main
+//       Access: Protected, Virtual
+//  Description: The main loop for each worker thread: wait for a new
+//               batch, then help run it.
+////////////////////////////////////////////////////////////////////
+void WorkerThreadPool::Worker::
+thread_main() {
+  MutexHolder holder(_pool->_lock);
+  int last_seq = _pool->_batch_seq;
+
+  while (true) {
+    while (_pool->_batch_seq == last_seq && !_pool->_shutdown) {
+      PStatTimer timer(_wait_pcollector);
+      _pool->_start_cvar.wait();
+    }
+    if (_pool->_shutdown) {
+      return;
+    }
+
+    last_seq = _pool->_batch_seq;
+    JobFunc *func = _pool->_func;
+    void *user_data = _pool->_user_data;
+    ++_pool->_num_active;
+
+    _pool->_lock.release();
+    _pool->do_jobs(_queue_index, this, func, user_data);
+    PStatClient::thread_tick(get_sync_name());
+    _pool->_lock.acquire();
+
+    --_pool->_num_active;
+    if (_pool->_num_active == 0) {
+      _pool->_done_cvar.notify_all();
+    }
+  }
+}
@@ -0,0 +1,145 @@
+// Filename: workerThreadPool.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef WORKERTHREADPOOL_H
+#define WORKERTHREADPOOL_H
+
+#include "pandabase.h"
+
+#include "referenceCount.h"
+#include "thread.h"
+#include "pmutex.h"
+#include "lightMutex.h"
+#include "conditionVarFull.h"
+#include "pvector.h"
+#include "pdeque.h"
+#include "pmap.h"
+#include "atomicAdjust.h"
+#include "pStatCollector.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : WorkerThreadPool
+// Description : A fixed set of threads that cooperate to run a batch
+//               of independent, indexed jobs, returning only when all
+//               of them have finished.  This is intended for
+//               fine-grained data-parallel work within a single
+//               frame, such as splitting up a traversal, where the
+//               scheduling overhead of AsyncTaskManager would be too
+//               great.
+//
+//               Each thread (including the thread that calls
+//               run_jobs(), which does its share of the work) is
+//               given a contiguous range of the jobs to start with.
+//               A thread that runs out of work steals jobs from the
+//               far end of another thread's range, so that an uneven
+//               distribution of work balances itself out.
+//
+//               Jobs may finish in any order and on any thread; it is
+//               up to the caller to store its results in a way that
+//               does not depend on this (for instance, in a separate
+//               slot for each job index).
+//
+//               Most callers share one pool per purpose, by name,
+//               through get_shared().
+//
+//               A job must not call run_jobs() on the pool that is
+//               running it; the nested batch would wait forever for
+//               the batch it belongs to.  Use a different pool for
+//               nested work.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_EVENT WorkerThreadPool : public ReferenceCount {
+public:
+  typedef void JobFunc(int job_index, Thread *current_thread, void *user_data);
+
+  WorkerThreadPool(const string &name, int num_threads);
+  ~WorkerThreadPool();
+
+  INLINE const string &get_name() const;
+  INLINE int get_num_threads() const;
+  INLINE int get_requested_num_threads() const;
+
+  void run_jobs(int num_jobs, JobFunc *func, void *user_data);
+
+  static PT(WorkerThreadPool) get_shared(const string &name, int num_threads);
+
+private:
+  void do_jobs(int queue_index, Thread *current_thread,
+               JobFunc *func, void *user_data);
+  bool pop_job(int queue_index, int &job_index);
+  bool steal_job(int queue_index, int &job_index);
+  bool is_running_jobs(Thread *thread) const;
+
+  // The queue of job indices assigned to one thread.  The owner takes
+  // from the front; thieves take from the back.
+  class JobQueue {
+  public:
+    typedef pdeque<int> Jobs;
+    LightMutex _lock;
+    Jobs _jobs;
+  };
+
+  class Worker : public Thread {
+  public:
+    Worker(WorkerThreadPool *pool, const string &name, int queue_index);
+
+  protected:
+    virtual void thread_main();
+
+  private:
+    WorkerThreadPool *_pool;
+    int _queue_index;
+  };
+  typedef pvector<PT(Worker) > Workers;
+
+  string _name;
+  int _requested_num_threads;
+
+  // There is one queue for each thread.  _queues[0] belongs to the
+  // thread calling run_jobs(); the rest belong to _workers, in order.
+  int _num_queues;
+  JobQueue *_queues;
+  Workers _workers;
+
+  // Only one batch may run at a time.
+  Mutex _run_lock;
+
+  // The thread that called run_jobs() for the current batch, or NULL.
+  // This is only used to catch nested calls.
+  AtomicAdjust::Pointer _run_thread;
+
+  // This protects the members below.
+  Mutex _lock;
+  ConditionVarFull _start_cvar;
+  ConditionVarFull _done_cvar;
+  int _batch_seq;
+  JobFunc *_func;
+  void *_user_data;
+  int _num_active;
+  bool _shutdown;
+
+  // The pools returned by get_shared(), by name and requested number
+  // of threads.
+  typedef pair<string, int> SharedKey;
+  typedef pmap<SharedKey, PT(WorkerThreadPool) > SharedPools;
+  static SharedPools *_shared_pools;
+  static LightMutex _shared_pools_lock;
+
+  static PStatCollector _wait_pcollector;
+
+  friend class Worker;
+};
+
+#include "workerThreadPool.I"
+
+#endif
@@ -16,6 +16,7 @@
     compress_string.h \
     config_express.h \
     copy_stream.h \
+    cpuFeatures.h \
     datagram.I datagram.h datagramGenerator.I \
     datagramGenerator.h \
     datagramIterator.I datagramIterator.h datagramSink.I datagramSink.h \
@@ -28,6 +29,7 @@
     hashVal.I hashVal.h \
     indirectLess.I indirectLess.h \
     memoryInfo.I memoryInfo.h \
+    memoryMappedFile.I memoryMappedFile.h \
     memoryUsage.I memoryUsage.h \
     memoryUsagePointerCounts.I memoryUsagePointerCounts.h \
     memoryUsagePointers.I memoryUsagePointers.h \
@@ -83,6 +85,7 @@
     compress_string.cxx \
     config_express.cxx \
     copy_stream.cxx \
+    cpuFeatures.cxx \
     datagram.cxx datagramGenerator.cxx \
     datagramIterator.cxx \
     datagramSink.cxx dcast.cxx \
@@ -90,7 +93,8 @@
     error_utils.cxx \
     fileReference.cxx \
     hashGeneratorBase.cxx hashVal.cxx \
-    memoryInfo.cxx memoryUsage.cxx memoryUsagePointerCounts.cxx \
+    memoryInfo.cxx memoryMappedFile.cxx \
+    memoryUsage.cxx memoryUsagePointerCounts.cxx \
     memoryUsagePointers.cxx multifile.cxx \
     namable.cxx \
     nodePointerTo.cxx \
@@ -140,6 +144,7 @@
     compress_string.h \
     config_express.h \
     copy_stream.h \
+    cpuFeatures.h \
     datagram.I datagram.h datagramGenerator.I \
     datagramGenerator.h \
     datagramIterator.I datagramIterator.h datagramSink.I datagramSink.h \
@@ -151,6 +156,7 @@
     hashVal.I hashVal.h \
     indirectLess.I indirectLess.h \
     memoryInfo.I memoryInfo.h \
+    memoryMappedFile.I memoryMappedFile.h \
     memoryUsage.I memoryUsage.h \
     memoryUsagePointerCounts.I memoryUsagePointerCounts.h \
     memoryUsagePointers.I memoryUsagePointers.h \
@@ -0,0 +1,89 @@
+// Filename: cpuFeatures.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "cpuFeatures.h"
+
+#if defined(_MSC_VER) && _MSC_VER >= 1700 && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#define CPUFEATURES_MSVC_CPUID
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define CPUFEATURES_GCC_CPUID
+#endif
+
+int CPUFeatures::_has_avx2 = -1;
+
+////////////////////////////////////////////////////////////////////
+//     Function: CPUFeatures::has_avx2
+//       Access: Public, Static
+//  Description: Returns true if AVX2 instructions may be used.
+////////////////////////////////////////////////////////////////////
+bool CPUFeatures::
+has_avx2() {
+  if (_has_avx2 < 0) {
+    // It doesn't matter if two threads get here at once; they will
+    // both come up with the same answer.
+    _has_avx2 = detect_avx2() ? 1 : 0;
+  }
+  return (_has_avx2 != 0);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CPUFeatures::detect_avx2
+//       Access: Private, Static
+//  Description: Asks the CPU whether it, and the operating system,
+//               support AVX2.
+////////////////////////////////////////////////////////////////////
+bool CPUFeatures::
+detect_avx2() {
+#if defined(CPUFEATURES_MSVC_CPUID)
+  int regs[4];
+  __cpuid(regs, 0);
+  if (regs[0] < 7) {
+    return false;
+  }
+  __cpuid(regs, 1);
+  // The OS must have enabled the AVX register state (OSXSAVE + AVX).
+  if ((regs[2] & (1 << 27)) == 0 || (regs[2] & (1 << 28)) == 0) {
+    return false;
+  }
+  if ((_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+  __cpuidex(regs, 7, 0);
+  return (regs[1] & (1 << 5)) != 0;
+
+#elif defined(CPUFEATURES_GCC_CPUID)
+  unsigned int eax, ebx, ecx, edx;
+  if (__get_cpuid_max(0, NULL) < 7) {
+    return false;
+  }
+  __cpuid(1, eax, ebx, ecx, edx);
+  // The OS must have enabled the AVX register state (OSXSAVE + AVX).
+  if ((ecx & (1 << 27)) == 0 || (ecx & (1 << 28)) == 0) {
+    return false;
+  }
+  unsigned int xcr0_lo, xcr0_hi;
+  __asm__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+  if ((xcr0_lo & 0x6) != 0x6) {
+    return false;
+  }
+  __cpuid_count(7, 0, eax, ebx, ecx, edx);
+  return (ebx & (1 << 5)) != 0;
+
+#else
+  return false;
+#endif
+}
@@ -0,0 +1,43 @@
+// Filename: cpuFeatures.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef CPUFEATURES_H
+#define CPUFEATURES_H
+
+#include "pandabase.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : CPUFeatures
+// Description : Reports which optional instruction sets may be used
+//               on the machine we are running on.  Code that is
+//               compiled for an instruction set beyond the
+//               compiler's target options should check this before
+//               calling it.
+//
+//               An instruction set is only reported as available if
+//               both the CPU and the operating system support it;
+//               the OS must save the wider registers on a context
+//               switch.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDAEXPRESS CPUFeatures {
+public:
+  static bool has_avx2();
+
+private:
+  static bool detect_avx2();
+
+  static int _has_avx2;
+};
+
+#endif
@@ -0,0 +1,341 @@
+// Filename: memoryMappedFile.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "memoryMappedFile.h"
+#include "virtualFileSystem.h"
+#include "subfileInfo.h"
+#include "config_express.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// The data pointer for an empty file, which has nothing to map.
+static const unsigned char empty_file_data = 0;
+
+////////////////////////////////////////////////////////////////////
+//     Function: MemoryMappedFile::Constructor
+//       Access: Published
+//  Description:
+////////////////////////////////////////////////////////////////////
+MemoryMappedFile::
+MemoryMappedFile() :
+  _data(NULL),
+  _size(0),
+  _map_start(NULL),
+  _map_size(0)
+{
+#ifdef _WIN32
+  _map_handle = NULL;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: MemoryMappedFile::Destructor
+//       Access: Published
+//  Description:
+////////////////////////////////////////////////////////////////////
+MemoryMappedFile::
+~MemoryMappedFile() {
+  close();
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: MemoryMappedFile::open
+//       Access: Published
+//  Description: Makes the contents of the indicated file available
+//               through get_data(), mapping it from disk if possible,
+//               and reading it otherwise.  Returns true on success,
+//               false if the file could not be read.
+////////////////////////////////////////////////////////////////////
+bool MemoryMappedFile::
+open(const Filename &filename) {
+  close();
+
+  VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
+  Filename binary_filename = Filename::binary_filename(filename);
+  PT(VirtualFile) file = vfs->get_file(binary_filename);
+  if (file == (VirtualFile *)NULL) {
+    express_cat.error()
+      << "Could not find " << filename << "\n";
+    return false;
+  }
+
+  _filename = filename;
+
+  // A compressed file must be read, so that it will be decompressed.
+  SubfileInfo info;
+  if (file->get_system_info(info) && !info.is_empty() &&
+      !is_compressed(file, info)) {
+    if (info.get_size() == 0) {
+      _data = &empty_file_data;
+      return true;
+    }
+    if (do_map(info.get_filename(), info.get_start(), (size_t)info.get_size())) {
+      return true;
+    }
+  }
+
+  if (!file->read_file(_buffer, true)) {
+    express_cat.error()
+      << "Could not read " << filename << "\n";
+    _filename = Filename();
+    return false;
+  }
+
+  _size = _buffer.size();
+  _data = _buffer.empty() ? &empty_file_data : &_buffer[0];
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: MemoryMappedFile::open
+//       Access: Published
+//  Description: Makes the indicated range of bytes within a file
+//               available through get_data(), mapping it from disk if
+//               possible, and reading it otherwise.  This is intended
+//               for a block of data stored within a larger file, such
+//               as the file data records of a bam file; the
+//               SubfileInfo's filename is looked up through the vfs,
+//               so the file may itself be stored within a Multifile.
+//               Returns true on success, false if the data could not
+//               be read.
+////////////////////////////////////////////////////////////////////
+bool MemoryMappedFile::
+open(const SubfileInfo &info) {
+  close();
+  nassertr(!info.is_empty() && info.get_start() >= 0, false);
+
+  VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
+  Filename binary_filename = Filename::binary_filename(info.get_filename());
+  PT(VirtualFile) file = vfs->get_file(binary_filename);
+  if (file == (VirtualFile *)NULL) {
+    express_cat.error()
+      << "Could not find " << info.get_filename() << "\n";
+    return false;
+  }
+
+  _filename = info.get_filename();
+  // If the data is in a temporary file, this keeps it around for as
+  // long as we are using it.
+  _file_ref = info.get_file();
+  size_t size = (size_t)info.get_size();
+  if (size == 0) {
+    _data = &empty_file_data;
+    return true;
+  }
+
+  // The start of the range is relative to the decompressed stream, if
+  // the file is compressed, so it can't be mapped.
+  SubfileInfo sys_info;
+  if (file->get_system_info(sys_info) && !sys_info.is_empty() &&
+      !is_compressed(file, sys_info)) {
+    streampos start = sys_info.get_start() + (streamoff)info.get_start();
+    if (do_map(sys_info.get_filename(), start, size)) {
+      return true;
+    }
+  }
+
+  if (!do_read(file, info.get_start(), size)) {
+    express_cat.error()
+      << "Could not read " << info << "\n";
+    _filename = Filename();
+    _file_ref.clear();
+    return false;
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: MemoryMappedFile::close
+//       Access: Published
+//  Description: Releases the file's contents.  Any pointers into the
+//               data are no longer valid.
+////////////////////////////////////////////////////////////////////
+void MemoryMappedFile::
+close() {
+  do_unmap();
+  _buffer.clear();
+  _data = NULL;
+  _size = 0;
+  _filename = Filename();
+  _file_ref.clear();
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: MemoryMappedFile::do_map
+//       Access: Private
+//  Description: Maps size bytes of the indicated operating system
+//               file, beginning at start.  Returns true on success.
+////////////////////////////////////////////////////////////////////
+bool MemoryMappedFile::
+do_map(const Filename &os_filename, streampos start, size_t size) {
+#ifdef _WIN32
+  wstring os_specific = os_filename.to_os_specific_w();
+  HANDLE file_handle =
+    CreateFileW(os_specific.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file_handle == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+
+  HANDLE map_handle =
+    CreateFileMapping(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(file_handle);
+  if (map_handle == NULL) {
+    return false;
+  }
+
+  // The view must begin on an allocation boundary.
+  SYSTEM_INFO sysinfo;
+  GetSystemInfo(&sysinfo);
+  PN_uint64 offset = (PN_uint64)start;
+  PN_uint64 map_offset = offset - (offset % sysinfo.dwAllocationGranularity);
+  size_t map_size = (size_t)(offset - map_offset) + size;
+
+  void *map_start =
+    MapViewOfFile(map_handle, FILE_MAP_READ, (DWORD)(map_offset >> 32),
+                  (DWORD)(map_offset & 0xffffffff), map_size);
+  if (map_start == NULL) {
+    CloseHandle(map_handle);
+    return false;
+  }
+  _map_handle = map_handle;
+
+#else  // _WIN32
+  string os_specific = os_filename.to_os_specific();
+  int fd = ::open(os_specific.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return false;
+  }
+
+  // The mapping must begin on a page boundary.
+  off_t offset = (off_t)start;
+  off_t page_size = (off_t)sysconf(_SC_PAGESIZE);
+  off_t map_offset = offset - (offset % page_size);
+  size_t map_size = (size_t)(offset - map_offset) + size;
+
+  void *map_start = mmap(NULL, map_size, PROT_READ, MAP_SHARED, fd, map_offset);
+  ::close(fd);
+  if (map_start == MAP_FAILED) {
+    return false;
+  }
+#endif  // _WIN32
+
+  _map_start = map_start;
+  _map_size = map_size;
+  _data = (const unsigned char *)map_start + (map_size - size);
+  _size = size;
+
+  if (express_cat.is_debug()) {
+    express_cat.debug()
+      << "Mapped " << size << " bytes of " << os_filename << "\n";
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: MemoryMappedFile::do_read
+//       Access: Private
+//  Description: Reads size bytes of the indicated file, beginning at
+//               start, into _buffer, for when they can't be mapped.
+//               Returns true on success.
+////////////////////////////////////////////////////////////////////
+bool MemoryMappedFile::
+do_read(VirtualFile *file, streampos start, size_t size) {
+  istream *in = file->open_read_file(true);
+  if (in == (istream *)NULL) {
+    return false;
+  }
+
+  in->seekg(start);
+  if (in->fail()) {
+    // A decompressing stream can't seek, so we have to start over and
+    // read our way forward to the start of the range.
+    file->close_read_file(in);
+    in = file->open_read_file(true);
+    if (in == (istream *)NULL) {
+      return false;
+    }
+    streamoff skip = (streamoff)start;
+    in->ignore(skip);
+    if (in->fail() || (streamoff)in->gcount() != skip) {
+      file->close_read_file(in);
+      return false;
+    }
+  }
+
+  _buffer.resize(size);
+  in->read((char *)&_buffer[0], size);
+  bool success = (!in->fail() && (size_t)in->gcount() == size);
+  file->close_read_file(in);
+
+  if (!success) {
+    _buffer.clear();
+    return false;
+  }
+
+  _size = size;
+  _data = &_buffer[0];
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: MemoryMappedFile::is_compressed
+//       Access: Private, Static
+//  Description: Returns true if the file, whose system info is given,
+//               is stored compressed on disk, so that its contents
+//               can't be mapped directly.  We must check the name of
+//               the file the vfs actually found, not the name that
+//               was asked for, since the vfs will implicitly find
+//               foo.bam.pz when asked for foo.bam.
+////////////////////////////////////////////////////////////////////
+bool MemoryMappedFile::
+is_compressed(VirtualFile *file, const SubfileInfo &sys_info) {
+  string extension = file->get_filename().get_extension();
+  if (extension == "pz" || extension == "gz") {
+    return true;
+  }
+  extension = sys_info.get_filename().get_extension();
+  return (extension == "pz" || extension == "gz");
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: MemoryMappedFile::do_unmap
+//       Access: Private
+//  Description: Releases the mapping made by do_map(), if any.
+////////////////////////////////////////////////////////////////////
+void MemoryMappedFile::
+do_unmap() {
+  if (_map_start == (void *)NULL) {
+    return;
+  }
+
+#ifdef _WIN32
+  UnmapViewOfFile(_map_start);
+  CloseHandle((HANDLE)_map_handle);
+  _map_handle = NULL;
+#else
+  munmap(_map_start, _map_size);
+#endif
+
+  _map_start = NULL;
+  _map_size = 0;
+}
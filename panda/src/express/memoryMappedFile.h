@@ -0,0 +1,90 @@
+// Filename: memoryMappedFile.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef MEMORYMAPPEDFILE_H
+#define MEMORYMAPPEDFILE_H
+
+#include "pandabase.h"
+#include "referenceCount.h"
+#include "filename.h"
+#include "subfileInfo.h"
+#include "fileReference.h"
+#include "pvector.h"
+
+class VirtualFile;
+
+////////////////////////////////////////////////////////////////////
+//       Class : MemoryMappedFile
+// Description : The read-only contents of a file, mapped directly
+//               into the address space of the process, so that the
+//               operating system reads in only the pages that are
+//               actually touched, and may discard them again when
+//               memory is short.
+//
+//               The file is found through the VirtualFileSystem.  It
+//               may also be just a range of bytes within a file, as
+//               described by a SubfileInfo.  If the file is not
+//               stored as-is in some operating system file
+//               (for instance, if it is compressed within a
+//               Multifile), its contents are read into memory
+//               instead, so that the data is always available one way
+//               or the other; is_mapped() reports which.
+//
+//               The data remains valid until the object is destroyed,
+//               so anything that points into it should keep a
+//               reference.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDAEXPRESS MemoryMappedFile : public ReferenceCount {
+PUBLISHED:
+  MemoryMappedFile();
+  ~MemoryMappedFile();
+
+  BLOCKING bool open(const Filename &filename);
+  BLOCKING bool open(const SubfileInfo &info);
+  void close();
+
+  INLINE bool is_open() const;
+  INLINE bool is_mapped() const;
+  INLINE const Filename &get_filename() const;
+  INLINE size_t get_size() const;
+
+public:
+  INLINE const unsigned char *get_data() const;
+
+private:
+  bool do_map(const Filename &os_filename, streampos start, size_t size);
+  bool do_read(VirtualFile *file, streampos start, size_t size);
+  static bool is_compressed(VirtualFile *file, const SubfileInfo &sys_info);
+  void do_unmap();
+
+  Filename _filename;
+  CPT(FileReference) _file_ref;
+  const unsigned char *_data;
+  size_t _size;
+
+  // The actual extent of the mapping, which begins on a page boundary
+  // at or before _data.
+  void *_map_start;
+  size_t _map_size;
+#ifdef _WIN32
+  void *_map_handle;
+#endif
+
+  // The contents of the file, if it could not be mapped.
+  pvector<unsigned char> _buffer;
+};
+
+#include "memoryMappedFile.I"
+
+#endif
@@ -3,6 +3,7 @@
 #include "config_express.cxx"
 #include "compress_string.cxx"
 #include "copy_stream.cxx"
+#include "cpuFeatures.cxx"
 #include "datagram.cxx"
 #include "datagramGenerator.cxx"
 #include "datagramIterator.cxx"
@@ -14,6 +15,7 @@
 #include "hashGeneratorBase.cxx"
 #include "hashVal.cxx"
 #include "memoryInfo.cxx"
+#include "memoryMappedFile.cxx"
 #include "memoryUsage.cxx"
 #include "memoryUsagePointerCounts.cxx"
 #include "memoryUsagePointers.cxx"
@@ -8579,14 +8579,17 @@ upload_texture(CLP(TextureContext) *gtc, bool force) {
   if (_effective_incomplete_render && !force) {
     bool has_image = _supports_compressed_texture ? tex->has_ram_image() : tex->has_uncompressed_ram_image();
     if (!has_image && tex->might_have_ram_image() &&
-        tex->has_simple_ram_image() &&
+        (tex->has_simple_ram_image() ||
+         (gtc->is_residency_managed() && gtc->_already_applied)) &&
         !_loader.is_null()) {
       // If we don't have the texture data right now, go get it, but in
-      // the meantime load a temporary simple image in its place.
+      // the meantime load a temporary simple image in its place.  A
+      // streamed texture that is being reloaded at a different mipmap
+      // level can simply keep the level it already has.
       async_reload_texture(gtc);
       has_image = _supports_compressed_texture ? tex->has_ram_image() : tex->has_uncompressed_ram_image();
       if (!has_image) {
-        if (gtc->was_simple_image_modified()) {
+        if (gtc->was_simple_image_modified() && tex->has_simple_ram_image()) {
           return upload_simple_texture(gtc);
         }
         return true;
@@ -8594,27 +8597,40 @@ upload_texture(CLP(TextureContext) *gtc, bool force) {
     }
   }
 
+  // If the image is mapped from a txm file, and is already in a form
+  // we can use, we load it straight from the mapping, rather than
+  // asking for it as a CPTA_uchar, which would copy it into memory.
   CPTA_uchar image;
-  if (_supports_compressed_texture) {
-    image = tex->get_ram_image();
-  } else {
-    image = tex->get_uncompressed_ram_image();
-  }
-
-  Texture::CompressionMode image_compression;
-  if (image.is_null()) {
-    image_compression = Texture::CM_off;
-  } else {
+  bool has_image = false;
+  Texture::CompressionMode image_compression = Texture::CM_off;
+  if (tex->is_ram_image_mapped()) {
     image_compression = tex->get_ram_image_compression();
+    has_image = get_supports_compressed_texture_format(image_compression) &&
+      (_supports_compressed_texture || image_compression == Texture::CM_off);
   }
 
-  if (!get_supports_compressed_texture_format(image_compression)) {
-    image = tex->get_uncompressed_ram_image();
-    image_compression = Texture::CM_off;
-  } 
+  if (!has_image) {
+    if (_supports_compressed_texture) {
+      image = tex->get_ram_image();
+    } else {
+      image = tex->get_uncompressed_ram_image();
+    }
 
-  if (GLCAT.is_debug()) {
     if (image.is_null()) {
+      image_compression = Texture::CM_off;
+    } else {
+      image_compression = tex->get_ram_image_compression();
+    }
+
+    if (!get_supports_compressed_texture_format(image_compression)) {
+      image = tex->get_uncompressed_ram_image();
+      image_compression = Texture::CM_off;
+    } 
+    has_image = !image.is_null();
+  }
+
+  if (GLCAT.is_debug()) {
+    if (!has_image) {
       GLCAT.debug()
         << "Got NULL image: " << tex->get_name() << "\n";
     }
@@ -8743,6 +8759,19 @@ upload_texture(CLP(TextureContext) *gtc, bool force) {
   }
 #endif
 
+  // If the texture is being streamed, load only the mipmap levels
+  // that the TextureResidencyManager has asked for.  The smaller
+  // levels are normally generated when the texture is loaded (see
+  // Texture::consider_auto_process_ram_image()); we don't generate
+  // them here, in the draw thread.  A texture that arrives without
+  // them is simply loaded from the smallest level it has.
+  if (gtc->is_residency_managed() && uses_mipmaps && has_image) {
+    int level = gtc->get_residency_level();
+    if (level > mipmap_bias) {
+      mipmap_bias = max(mipmap_bias, min(level, tex->get_num_ram_mipmap_images() - 1));
+    }
+  }
+
   bool success = true;
 
   GLenum target = get_texture_target(tex->get_texture_type());
@@ -8805,15 +8834,19 @@ upload_texture(CLP(TextureContext) *gtc, bool force) {
     gtc->_already_applied = true;
     gtc->_uses_mipmaps = uses_mipmaps;
     gtc->_internal_format = internal_format;
-    gtc->_width = width;
-    gtc->_height = height;
-    gtc->_depth = depth;
+    gtc->_width = tex->get_expected_mipmap_x_size(mipmap_bias);
+    gtc->_height = tex->get_expected_mipmap_y_size(mipmap_bias);
+    gtc->_depth = tex->get_expected_mipmap_z_size(mipmap_bias);
 
-    if (!image.is_null()) {
+    if (has_image) {
       gtc->update_data_size_bytes(get_texture_memory_size(tex));
     }
 
-    if (tex->get_post_load_store_cache()) {
+    // A streamed texture that is not yet loaded at its full size would
+    // read back (and then store, and keep) the reduced image; leave the
+    // flag set, so that this happens when its largest level arrives.
+    if (tex->get_post_load_store_cache() &&
+        (!gtc->is_residency_managed() || mipmap_bias == 0)) {
       tex->set_post_load_store_cache(false);
       // OK, get the RAM image, and save it in a BamCache record.
       if (do_extract_texture_data(gtc)) {
@@ -8881,7 +8914,12 @@ upload_texture_image(CLP(TextureContext) *gtc,
   Texture *tex = gtc->get_texture();
   nassertr(tex != (Texture *)NULL, false);
 
-  CPTA_uchar image = tex->get_ram_mipmap_image(mipmap_bias);
+  // A mapped image (see upload_texture()) is loaded through
+  // get_ram_mipmap_pointer(), below, without being copied.
+  bool has_image = (tex->get_ram_mipmap_pointer(mipmap_bias) != NULL);
+  if (!has_image) {
+    has_image = !tex->get_ram_mipmap_image(mipmap_bias).is_null();
+  }
   int width = tex->get_expected_mipmap_x_size(mipmap_bias);
   int height = tex->get_expected_mipmap_y_size(mipmap_bias);
   int depth = tex->get_expected_mipmap_z_size(mipmap_bias);
@@ -8902,7 +8940,7 @@ upload_texture_image(CLP(TextureContext) *gtc,
   int num_ram_mipmap_levels = 0;
   bool load_ram_mipmaps = false;
 
-  if (image.is_null()) {
+  if (!has_image) {
     if (GLCAT.is_debug()) {
       GLCAT.debug()
         << "Not loading NULL image " << tex->get_name() << "\n";
@@ -8993,7 +9031,10 @@ upload_texture_image(CLP(TextureContext) *gtc,
     for (int n = mipmap_bias; n < num_ram_mipmap_levels; ++n) {
       // we grab the mipmap pointer first, if it is NULL we grab the
       // normal mipmap image pointer which is a PTA_uchar
-      const unsigned char *image_ptr = (unsigned char*)tex->get_ram_mipmap_pointer(n);
+      // If the level is mapped from a txm file, mapped_file keeps
+      // the mapping alive until we are done with image_ptr.
+      PT(MemoryMappedFile) mapped_file;
+      const unsigned char *image_ptr = (unsigned char*)tex->get_ram_mipmap_pointer(n, mapped_file);
       CPTA_uchar ptimage;
       if (image_ptr == (const unsigned char *)NULL) {
         ptimage = tex->get_ram_mipmap_image(n);
@@ -9144,7 +9185,10 @@ upload_texture_image(CLP(TextureContext) *gtc,
     }
     
     for (int n = mipmap_bias; n < num_ram_mipmap_levels; ++n) {
-      const unsigned char *image_ptr = (unsigned char*)tex->get_ram_mipmap_pointer(n);
+      // If the level is mapped from a txm file, mapped_file keeps
+      // the mapping alive until we are done with image_ptr.
+      PT(MemoryMappedFile) mapped_file;
+      const unsigned char *image_ptr = (unsigned char*)tex->get_ram_mipmap_pointer(n, mapped_file);
       CPTA_uchar ptimage;
       if (image_ptr == (const unsigned char *)NULL) {
         ptimage = tex->get_ram_mipmap_image(n);
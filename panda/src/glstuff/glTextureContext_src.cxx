@@ -34,6 +34,12 @@ TypeHandle CLP(TextureContext)::_type_handle;
 ////////////////////////////////////////////////////////////////////
 void CLP(TextureContext)::
 evict_lru() {
+  // A streamed texture comes back at half its former size, rather
+  // than at full size, the next time it is rendered.
+  if (is_residency_managed()) {
+    drop_residency_level();
+  }
+
   dequeue_lru();
   reset_data();
   update_data_size_bytes(0);
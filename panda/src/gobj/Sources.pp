@@ -63,6 +63,7 @@
     texturePool.I texturePool.h \
     texturePoolFilter.I texturePoolFilter.h \
     textureReloadRequest.I textureReloadRequest.h \
+    textureResidencyManager.I textureResidencyManager.h \
     textureStage.I textureStage.h \
     textureStagePool.I textureStagePool.h \
     transformBlend.I transformBlend.h \
@@ -70,6 +71,7 @@
     transformTable.I transformTable.h \
     userVertexSlider.I userVertexSlider.h \
     userVertexTransform.I userVertexTransform.h \
+    vertexBlendKernel.h \
     vertexBufferContext.I vertexBufferContext.h \
     vertexDataBlock.I vertexDataBlock.h \
     vertexDataBook.I vertexDataBook.h \
@@ -133,6 +135,7 @@
     texturePool.cxx \
     texturePoolFilter.cxx \
     textureReloadRequest.cxx \
+    textureResidencyManager.cxx \
     textureStage.cxx \
     textureStagePool.cxx \
     transformBlend.cxx \
@@ -140,6 +143,7 @@
     transformTable.cxx \
     userVertexSlider.cxx \
     userVertexTransform.cxx \
+    vertexBlendKernel.cxx \
     vertexBufferContext.cxx \
     vertexDataBlock.cxx \
     vertexDataBook.cxx \
@@ -205,6 +209,7 @@
     texturePool.I texturePool.h \
     texturePoolFilter.I texturePoolFilter.h \
     textureReloadRequest.I textureReloadRequest.h \
+    textureResidencyManager.I textureResidencyManager.h \
     textureStage.I textureStage.h \
     textureStagePool.I textureStagePool.h \
     transformBlend.I transformBlend.h \
@@ -212,6 +217,7 @@
     transformTable.I transformTable.h \
     userVertexSlider.I userVertexSlider.h \
     userVertexTransform.I userVertexTransform.h \
+    vertexBlendKernel.h \
     vertexBufferContext.I vertexBufferContext.h \
     vertexDataBlock.I vertexDataBlock.h \
     vertexDataBook.I vertexDataBook.h \
@@ -237,3 +243,23 @@
 
 #end test_bin_target
 
+#begin test_bin_target
+  #define TARGET test_vertex_blend
+  #define LOCAL_LIBS \
+    p3gobj p3putil
+
+  #define SOURCES \
+    test_vertex_blend.cxx
+
+#end test_bin_target
+
+#begin test_bin_target
+  #define TARGET test_bam_vertex_data
+  #define LOCAL_LIBS \
+    p3gobj p3putil
+
+  #define SOURCES \
+    test_bam_vertex_data.cxx
+
+#end test_bin_target
+
@@ -26,12 +26,20 @@ TypeHandle AnimateVerticesRequest::_type_handle;
 AsyncTask::DoneStatus AnimateVerticesRequest::
 do_task() {
   Thread *current_thread = Thread::get_current_thread();
+  int orig_pipeline_stage = current_thread->get_pipeline_stage();
+  if (orig_pipeline_stage != _pipeline_stage) {
+    current_thread->set_pipeline_stage(_pipeline_stage);
+  }
 
   // There is no need to store or return a result.  The GeomVertexData caches
   // the result and it will be used later in the rendering process.
   _geom_vertex_data->animate_vertices(true, current_thread);
   _is_ready = true;
 
+  if (orig_pipeline_stage != _pipeline_stage) {
+    current_thread->set_pipeline_stage(orig_pipeline_stage);
+  }
+
   // Don't continue the task; we're done.
   return AsyncTask::DS_done;
 }
@@ -42,6 +42,9 @@ public:
 
 PUBLISHED:
   INLINE AnimateVerticesRequest(GeomVertexData *geom_vertex_data);
+
+  INLINE void set_pipeline_stage(int pipeline_stage);
+  INLINE int get_pipeline_stage() const;
   
   INLINE bool is_ready() const;
   
@@ -50,6 +53,7 @@ protected:
   
 private:
   PT(GeomVertexData) _geom_vertex_data;
+  int _pipeline_stage;
   bool _is_ready;
   
 public:
@@ -60,6 +60,9 @@
 #include "indexBufferContext.h"
 #include "internalName.h"
 
+#include "pnmImage.h"
+#include "workerThreadPool.h"
+
 #include "dconfig.h"
 #include "string_utils.h"
 
@@ -134,6 +137,48 @@ ConfigVariableBool driver_generate_mipmaps
           "automatically in all cases, if supported.  Set it false "
           "to generate mipmaps in software when possible."));
 
+ConfigVariableInt texture_process_threads
+("texture-process-threads", 0,
+ PRC_DESC("Set this greater than 1 to divide the work of generating "
+          "mipmap levels and of compressing textures in software among "
+          "this many threads, including the thread that asks for it.  "
+          "This can shorten the time taken to load or preprocess many "
+          "textures with compression-mode on.  The threads are shared "
+          "by all textures, so only one texture is processed this way "
+          "at a time."));
+
+ConfigVariableBool texture_streaming
+("texture-streaming", false,
+ PRC_DESC("Set this true to load mipmapped textures into graphics memory "
+          "progressively.  Each texture is first loaded at a small size "
+          "(see texture-streaming-initial-size), and its larger mipmap "
+          "levels are loaded later, in a sub-thread if "
+          "allow-incomplete-render is true, once the texture is seen "
+          "on screen at a size that needs them.  The smaller mipmap levels "
+          "are generated in software when the texture is loaded.  When "
+          "graphics-memory-limit is exceeded, textures are still evicted "
+          "entirely, but an evicted texture is reloaded one mipmap level "
+          "smaller than before when it is next rendered."));
+
+ConfigVariableInt texture_streaming_initial_size
+("texture-streaming-initial-size", 64,
+ PRC_DESC("When texture-streaming is true, this is the size, in pixels, "
+          "of the largest mipmap level that is loaded into graphics memory "
+          "when a texture is first rendered."));
+
+ConfigVariableDouble texture_streaming_lod_bias
+("texture-streaming-lod-bias", 0.0,
+ PRC_DESC("When texture-streaming is true, this is added to the mipmap "
+          "level that is computed for each texture from its size on "
+          "screen.  Make it positive to load smaller textures, or "
+          "negative to load larger ones."));
+
+ConfigVariableInt texture_streaming_max_upgrades
+("texture-streaming-max-upgrades", 8,
+ PRC_DESC("When texture-streaming is true, this is the maximum number of "
+          "textures that will be asked to load a larger mipmap level "
+          "in any one frame."));
+
 ConfigVariableBool vertex_buffers
 ("vertex-buffers", true,
  PRC_DESC("Set this true to allow the use of vertex buffers (or buffer "
@@ -303,6 +348,15 @@ ConfigVariableBool vertex_animation_align_16
           "impacts only vertex formats created within Panda subsystems; custom "
           "vertex formats are not affected."));
 
+ConfigVariableEnum<VertexBlendKernel::Kernel> vertex_blend_kernel
+("vertex-blend-kernel", VertexBlendKernel::K_auto,
+ PRC_DESC("Specifies the routine used to compute vertex animation on the "
+          "CPU, for 32-bit float three-component points and vectors that "
+          "are indexed into a TransformBlendTable.  The default, auto, "
+          "chooses the fastest routine supported by the CPU (avx2, sse2, "
+          "or scalar).  Set this to none to transform each run of vertices "
+          "that shares a blend separately, as in previous versions."));
+
 ConfigVariableEnum<AutoTextureScale> textures_power_2
 ("textures-power-2", ATS_down,
  PRC_DESC("Specify whether textures should automatically be constrained to "
@@ -466,6 +520,28 @@ ConfigVariableInt vertex_data_page_threads
           "is 0, this work will be done in the main thread, which may "
           "introduce occasional random chugs in rendering."));
 
+ConfigVariableInt vertex_data_lazy_size
+("vertex-data-lazy-size", 0,
+ PRC_DESC("When this is nonzero, a GeomVertexArrayData read from a bam file "
+          "whose data is at least this number of bytes does not copy its "
+          "data out of the bam stream when it is read.  Instead, it keeps "
+          "a reference to the datagram it was read from, and reads the "
+          "vertices directly from there; the data is copied only if the "
+          "array is later modified or paged out.  This can save a lot "
+          "of load time for large static models."));
+
+ConfigVariableInt vertex_data_mmap_size
+("vertex-data-mmap-size", 0,
+ PRC_DESC("When this is nonzero, a GeomVertexArrayData written to a bam "
+          "file whose data is at least this number of bytes is stored "
+          "outside of the object stream, aligned to "
+          "bam-file-data-alignment bytes.  When the bam file is read "
+          "again, the array is mapped directly from the file rather than "
+          "copied into memory, and it is copied only if it is modified.  "
+          "This only applies to bam files written to disk uncompressed; "
+          "it reduces both the load time and the resident memory of "
+          "large static models."));
+
 ConfigVariableInt graphics_memory_limit
 ("graphics-memory-limit", -1,
  PRC_DESC("This is a default limit that is imposed on each GSG at "
@@ -510,6 +586,23 @@ ConfigVariableInt lens_geom_segments
           "lens; for a normal perspective or orthographic lens, the "
           "wireframe is not subdivided."));
 
+////////////////////////////////////////////////////////////////////
+//     Function: run_pnmimage_jobs
+//  Description: The function installed with
+//               PNMImage::set_run_jobs_func(), which runs the jobs
+//               of PNMImage::process_rows() on a WorkerThreadPool of
+//               the requested size.  This is installed here, rather
+//               than by the event module, because pnmimage is itself
+//               built on top of event (via mathutil).
+////////////////////////////////////////////////////////////////////
+static void
+run_pnmimage_jobs(int num_threads, int num_jobs,
+                  PNMImage::JobFunc *func, void *user_data) {
+  PT(WorkerThreadPool) pool =
+    WorkerThreadPool::get_shared("PNMImageProcess", num_threads);
+  pool->run_jobs(num_jobs, func, user_data);
+}
+
 ConfigureFn(config_gobj) {
   AnimateVerticesRequest::init_type();
   BufferContext::init_type();
@@ -590,6 +683,8 @@ ConfigureFn(config_gobj) {
   TransformTable::register_with_read_factory();
   UserVertexSlider::register_with_read_factory();
   UserVertexTransform::register_with_read_factory();
+
+  PNMImage::set_run_jobs_func(&run_pnmimage_jobs);
 }
 
 ostream &
@@ -24,6 +24,7 @@
 #include "configVariableFilename.h"
 #include "configVariableString.h"
 #include "autoTextureScale.h"
+#include "vertexBlendKernel.h"
 
 NotifyCategoryDecl(gobj, EXPCL_PANDA_GOBJ, EXPTP_PANDA_GOBJ);
 
@@ -50,6 +51,11 @@ extern EXPCL_PANDA_GOBJ ConfigVariableBool keep_texture_ram;
 extern EXPCL_PANDA_GOBJ ConfigVariableBool compressed_textures;
 extern EXPCL_PANDA_GOBJ ConfigVariableBool driver_compress_textures;
 extern EXPCL_PANDA_GOBJ ConfigVariableBool driver_generate_mipmaps;
+extern EXPCL_PANDA_GOBJ ConfigVariableInt texture_process_threads;
+extern EXPCL_PANDA_GOBJ ConfigVariableBool texture_streaming;
+extern EXPCL_PANDA_GOBJ ConfigVariableInt texture_streaming_initial_size;
+extern EXPCL_PANDA_GOBJ ConfigVariableDouble texture_streaming_lod_bias;
+extern EXPCL_PANDA_GOBJ ConfigVariableInt texture_streaming_max_upgrades;
 extern EXPCL_PANDA_GOBJ ConfigVariableBool vertex_buffers;
 extern EXPCL_PANDA_GOBJ ConfigVariableBool vertex_arrays;
 extern EXPCL_PANDA_GOBJ ConfigVariableBool display_lists;
@@ -66,6 +72,7 @@ extern EXPCL_PANDA_GOBJ ConfigVariableBool enforce_attrib_lock;
 extern EXPCL_PANDA_GOBJ ConfigVariableBool vertices_float64;
 extern EXPCL_PANDA_GOBJ ConfigVariableInt vertex_column_alignment;
 extern EXPCL_PANDA_GOBJ ConfigVariableBool vertex_animation_align_16;
+extern EXPCL_PANDA_GOBJ ConfigVariableEnum<VertexBlendKernel::Kernel> vertex_blend_kernel;
 
 extern EXPCL_PANDA_GOBJ ConfigVariableEnum<AutoTextureScale> textures_power_2;
 extern EXPCL_PANDA_GOBJ ConfigVariableEnum<AutoTextureScale> textures_square;
@@ -93,6 +100,8 @@ extern EXPCL_PANDA_GOBJ ConfigVariableFilename vertex_save_file_directory;
 extern EXPCL_PANDA_GOBJ ConfigVariableString vertex_save_file_prefix;
 extern EXPCL_PANDA_GOBJ ConfigVariableInt vertex_data_small_size;
 extern EXPCL_PANDA_GOBJ ConfigVariableInt vertex_data_page_threads;
+extern EXPCL_PANDA_GOBJ ConfigVariableInt vertex_data_lazy_size;
+extern EXPCL_PANDA_GOBJ ConfigVariableInt vertex_data_mmap_size;
 extern EXPCL_PANDA_GOBJ ConfigVariableInt graphics_memory_limit;
 extern EXPCL_PANDA_GOBJ ConfigVariableDouble adaptive_lru_weight;
 extern EXPCL_PANDA_GOBJ ConfigVariableInt adaptive_lru_max_updates_per_frame;
@@ -24,6 +24,7 @@
 #include "configVariableInt.h"
 #include "simpleAllocator.h"
 #include "vertexDataBuffer.h"
+#include "memoryMappedFile.h"
 #include "texture.h"
 
 ConfigVariableInt max_independent_vertex_data
@@ -415,23 +416,25 @@ clear_prepared(PreparedGraphicsObjects *prepared_objects) {
 
 ////////////////////////////////////////////////////////////////////
 //     Function: GeomVertexArrayData::reverse_data_endianness
-//       Access: Private
+//       Access: Private, Static
 //  Description: Fills a new data array with all numeric values
 //               expressed in the indicated array reversed,
 //               byte-for-byte, to convert littleendian to bigendian
-//               and vice-versa.
+//               and vice-versa, according to the columns of the
+//               indicated format.
 ////////////////////////////////////////////////////////////////////
 void GeomVertexArrayData::
-reverse_data_endianness(unsigned char *dest, const unsigned char *source, 
+reverse_data_endianness(const GeomVertexArrayFormat *array_format,
+                        unsigned char *dest, const unsigned char *source, 
                         size_t size) {
-  int num_columns = _array_format->get_num_columns();
+  int num_columns = array_format->get_num_columns();
 
   // Walk through each row of the data.
-  for (size_t pi = 0; pi < size; pi += _array_format->get_stride()) {
+  for (size_t pi = 0; pi < size; pi += array_format->get_stride()) {
     // For each row, visit all of the columns; and for each column,
     // visit all of the components of that column.
     for (int ci = 0; ci < num_columns; ++ci) {
-      const GeomVertexColumn *col = _array_format->get_column(ci);
+      const GeomVertexColumn *col = array_format->get_column(ci);
       int component_bytes = col->get_component_bytes();
       if (component_bytes > 1) {
         // Get the index of the beginning of the column.
@@ -537,7 +540,7 @@ finalize(BamReader *manager) {
     if (aux_data->_endian_reversed) {
       // Now is the time to endian-reverse the data.
       VertexDataBuffer new_buffer(cdata->_buffer.get_size());
-      reverse_data_endianness(new_buffer.get_write_pointer(), cdata->_buffer.get_read_pointer(true), cdata->_buffer.get_size());
+      reverse_data_endianness(_array_format, new_buffer.get_write_pointer(), cdata->_buffer.get_read_pointer(true), cdata->_buffer.get_size());
       cdata->_buffer.swap(new_buffer);
     }
   }
@@ -611,17 +614,27 @@ write_datagram(BamWriter *manager, Datagram &dg, void *extra_data) const {
   GeomVertexArrayData *array_data = (GeomVertexArrayData *)extra_data;
   dg.add_uint8(_usage_hint);
 
-  dg.add_uint32(_buffer.get_size());
-
-  if (manager->get_file_endian() == BamWriter::BE_native) {
-    // For native endianness, we only have to write the data directly.
-    dg.append_data(_buffer.get_read_pointer(true), _buffer.get_size());
+  size_t size = _buffer.get_size();
+  const unsigned char *data = _buffer.get_read_pointer(true);
+  pvector<unsigned char> reversed_data;
+  if (manager->get_file_endian() != BamWriter::BE_native && size != 0) {
+    // We have to convert the data to the file's endianness.
+    reversed_data.resize(size);
+    reverse_data_endianness(array_data->_array_format, &reversed_data[0], data, size);
+    data = &reversed_data[0];
+  }
 
-  } else {
-    // Otherwise, we have to convert it.
-    unsigned char *new_data = (unsigned char *)alloca(_buffer.get_size());
-    array_data->reverse_data_endianness(new_data, _buffer.get_read_pointer(true), _buffer.get_size());
-    dg.append_data(new_data, _buffer.get_size());
+  // A large enough array is written as a separate block of file data,
+  // which the reader can map directly from disk.  This fails quietly
+  // if the bam stream isn't being written to a file.
+  bool external = (vertex_data_mmap_size > 0 &&
+                   size >= (size_t)vertex_data_mmap_size &&
+                   manager->write_file_data(data, size));
+  dg.add_bool(external);
+
+  if (!external) {
+    dg.add_uint32(size);
+    dg.append_data(data, size);
   }
 }
 
@@ -645,15 +658,39 @@ fillin(DatagramIterator &scan, BamReader *manager, void *extra_data) {
     _buffer.set_size(new_data.size());
     memcpy(_buffer.get_write_pointer(), &new_data[0], new_data.size());
 
+  } else if (manager->get_file_minor_ver() >= 34 && scan.get_bool()) {
+    // The array data was stored as a separate block of file data,
+    // which we can map directly from the bam file.
+    SubfileInfo info;
+    manager->read_file_data(info);
+    PT(MemoryMappedFile) file = new MemoryMappedFile;
+    if (file->open(info)) {
+      _buffer.share_data(file);
+    } else {
+      // Leave the array empty, but fail the load as a whole, rather
+      // than returning a model with missing vertices.
+      gobj_cat.error()
+        << "Unable to read vertex data from " << info << "\n";
+      manager->report_read_error();
+    }
+
   } else {
     // Now, the array data is just stored directly.
     size_t size = scan.get_uint32();
-    _buffer.unclean_realloc(size);
-    _buffer.set_size(size);
+    if (vertex_data_lazy_size > 0 && size >= (size_t)vertex_data_lazy_size) {
+      // Don't copy the data now; just share the datagram's array.  It
+      // will be copied only if it is modified.
+      _buffer.share_data(scan.get_datagram().get_array(),
+                         scan.get_current_index(), size);
 
-    const unsigned char *source_data = 
-      (const unsigned char *)scan.get_datagram().get_data();
-    memcpy(_buffer.get_write_pointer(), source_data + scan.get_current_index(), size);
+    } else {
+      _buffer.unclean_realloc(size);
+      _buffer.set_size(size);
+
+      const unsigned char *source_data = 
+        (const unsigned char *)scan.get_datagram().get_data();
+      memcpy(_buffer.get_write_pointer(), source_data + scan.get_current_index(), size);
+    }
     scan.skip_bytes(size);
   }
 
@@ -671,7 +708,7 @@ fillin(DatagramIterator &scan, BamReader *manager, void *extra_data) {
       // it immediately (and we should, to support threaded CData
       // updates).
       VertexDataBuffer new_buffer(_buffer.get_size());
-      array_data->reverse_data_endianness(new_buffer.get_write_pointer(), _buffer.get_read_pointer(true), _buffer.get_size());
+      reverse_data_endianness(array_data->_array_format, new_buffer.get_write_pointer(), _buffer.get_read_pointer(true), _buffer.get_size());
       _buffer.swap(new_buffer);
     }
   }
@@ -92,6 +92,7 @@ PUBLISHED:
 
   INLINE int get_data_size_bytes() const;
   INLINE UpdateSeq get_modified() const;
+  INLINE bool is_data_shared() const;
 
   void output(ostream &out) const;
   void write(ostream &out, int indent_level = 0) const;
@@ -121,8 +122,9 @@ private:
   INLINE void set_lru_size(size_t lru_size);
 
   void clear_prepared(PreparedGraphicsObjects *prepared_objects);
-  void reverse_data_endianness(unsigned char *dest, 
-                               const unsigned char *source, size_t size);
+  static void reverse_data_endianness(const GeomVertexArrayFormat *array_format,
+                                      unsigned char *dest, 
+                                      const unsigned char *source, size_t size);
 
 
   CPT(GeomVertexArrayFormat) _array_format;
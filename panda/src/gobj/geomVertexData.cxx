@@ -17,6 +17,7 @@
 #include "geomVertexReader.h"
 #include "geomVertexWriter.h"
 #include "geomVertexRewriter.h"
+#include "vertexBlendKernel.h"
 #include "pStatTimer.h"
 #include "bamReader.h"
 #include "bamWriter.h"
@@ -1127,6 +1128,46 @@ animate_vertices(bool force, Thread *current_thread) const {
   return cdataw->_animated_vertices;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: GeomVertexData::is_animation_stale
+//       Access: Published
+//  Description: Returns true if this vertex data is animated on the
+//               CPU, and the next call to animate_vertices() will
+//               have to recompute the animation, or false if it is
+//               not animated or the cached result is still good.
+//
+//               This is a quick test that doesn't actually compute
+//               anything; it allows the caller to decide whether it
+//               is worth handing the work to another thread.
+////////////////////////////////////////////////////////////////////
+bool GeomVertexData::
+is_animation_stale(Thread *current_thread) const {
+  CDReader cdata(_cycler, current_thread);
+  if (cdata->_format->get_animation().get_animation_type() != AT_panda) {
+    return false;
+  }
+
+  if (cdata->_transform_blend_table.is_null() &&
+      cdata->_slider_table == (SliderTable *)NULL) {
+    // As in animate_vertices(), there's nothing to animate, and
+    // nothing will ever be cached.
+    return false;
+  }
+
+  if (cdata->_animated_vertices == (GeomVertexData *)NULL) {
+    return true;
+  }
+
+  UpdateSeq modified;
+  if (!cdata->_transform_blend_table.is_null()) {
+    modified = cdata->_transform_blend_table.get_read_pointer()->get_modified(current_thread);
+  }
+  if (cdata->_slider_table != (SliderTable *)NULL) {
+    modified = max(modified, cdata->_slider_table->get_modified(current_thread));
+  }
+  return cdata->_animated_vertices_modified != modified;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: GeomVertexData::clear_animated_vertices
 //       Access: Published
@@ -1671,10 +1712,68 @@ update_animated_vertices(GeomVertexData::CData *cdata, Thread *current_thread) {
       CPT(GeomVertexArrayDataHandle) blend_array_handle = cdata->_arrays[blend_array_index].get_read_pointer()->get_handle(current_thread);
       const unsigned short *blendt = (const unsigned short *)blend_array_handle->get_read_pointer(true);
 
+      // If we have a blend kernel, collect the matrices of all the
+      // blends into one table, so that the kernel can look up the
+      // matrix for each vertex directly, instead of transforming each
+      // run of vertices that shares a blend separately.
+      VertexBlendKernel::Kernel kernel = VertexBlendKernel::get_kernel();
+      int num_blends = tb_table->get_num_blends();
+      pvector<float> blend_table;
+      if (kernel != VertexBlendKernel::K_none && num_blends != 0) {
+        blend_table.resize(num_blends * VertexBlendKernel::matrix_size);
+        for (int bi = 0; bi < num_blends; ++bi) {
+          LMatrix4 mat;
+          tb_table->get_blend(bi).get_blend(mat, current_thread);
+          VertexBlendKernel::pack_matrix(&blend_table[bi * VertexBlendKernel::matrix_size], mat);
+        }
+      } else {
+        kernel = VertexBlendKernel::K_none;
+      }
+
+      if (kernel != VertexBlendKernel::K_none) {
+        // The kernels look up each vertex's matrix directly by its
+        // blend index, so an index beyond the end of the table must
+        // not reach them.  Any such vertex gets the identity matrix.
+        int max_bi = 0;
+        for (int i = 0; i < num_subranges; ++i) {
+          int end = rows.get_subrange_end(i);
+          for (int r = rows.get_subrange_begin(i); r < end; ++r) {
+            max_bi = max(max_bi, (int)blendt[r]);
+          }
+        }
+        if (max_bi >= num_blends) {
+          gobj_cat.error()
+            << "Vertex data " << get_name() << " references blend "
+            << max_bi << ", but its transform blend table has only "
+            << num_blends << " blends.\n";
+          blend_table.resize((max_bi + 1) * VertexBlendKernel::matrix_size);
+          for (int bi = num_blends; bi <= max_bi; ++bi) {
+            VertexBlendKernel::pack_matrix(&blend_table[bi * VertexBlendKernel::matrix_size], LMatrix4::ident_mat());
+          }
+        }
+      }
+
       int ci;
       for (ci = 0; ci < new_format->get_num_points(); ci++) {
         GeomVertexRewriter data(new_data, new_format->get_point(ci));
 
+        const GeomVertexColumn *data_column = data.get_column();
+        if (kernel != VertexBlendKernel::K_none &&
+            data_column->get_num_values() == 3 &&
+            data_column->get_numeric_type() == NT_float32) {
+          // The table of points is a table of LPoint3f's.  Hand the
+          // whole thing to the kernel.
+          unsigned char *datat = data.get_array_handle()->get_write_pointer();
+          datat += data_column->get_start();
+          for (int i = 0; i < num_subranges; ++i) {
+            VertexBlendKernel::xform_points3f
+              (kernel, datat, data.get_stride(), blendt,
+               rows.get_subrange_begin(i), rows.get_subrange_end(i),
+               &blend_table[0]);
+          }
+          continue;
+        }
+
         for (int i = 0; i < num_subranges; ++i) {
           int begin = rows.get_subrange_begin(i);
           int end = rows.get_subrange_end(i);
@@ -1715,6 +1814,21 @@ update_animated_vertices(GeomVertexData::CData *cdata, Thread *current_thread) {
       for (ci = 0; ci < new_format->get_num_vectors(); ci++) {
         GeomVertexRewriter data(new_data, new_format->get_vector(ci));
 
+        const GeomVertexColumn *data_column = data.get_column();
+        if (kernel != VertexBlendKernel::K_none &&
+            data_column->get_num_values() == 3 &&
+            data_column->get_numeric_type() == NT_float32) {
+          unsigned char *datat = data.get_array_handle()->get_write_pointer();
+          datat += data_column->get_start();
+          for (int i = 0; i < num_subranges; ++i) {
+            VertexBlendKernel::xform_vectors3f
+              (kernel, datat, data.get_stride(), blendt,
+               rows.get_subrange_begin(i), rows.get_subrange_end(i),
+               &blend_table[0]);
+          }
+          continue;
+        }
+
         for (int i = 0; i < num_subranges; ++i) {
           int begin = rows.get_subrange_begin(i);
           int end = rows.get_subrange_end(i);
@@ -153,6 +153,7 @@ PUBLISHED:
   CPT(GeomVertexData) reverse_normals() const;
 
   CPT(GeomVertexData) animate_vertices(bool force, Thread *current_thread) const;
+  bool is_animation_stale(Thread *current_thread) const;
   void clear_animated_vertices();
   void transform_vertices(const LMatrix4 &mat);
   void transform_vertices(const LMatrix4 &mat, int begin_row, int end_row);
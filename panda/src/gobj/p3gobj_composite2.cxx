@@ -19,6 +19,7 @@
 #include "texturePool.cxx"
 #include "texturePoolFilter.cxx"
 #include "textureReloadRequest.cxx"
+#include "textureResidencyManager.cxx"
 #include "textureStage.cxx"
 #include "textureStagePool.cxx"
 #include "transformBlend.cxx"
@@ -26,6 +27,7 @@
 #include "transformTable.cxx"
 #include "userVertexSlider.cxx"
 #include "userVertexTransform.cxx"
+#include "vertexBlendKernel.cxx"
 #include "vertexBufferContext.cxx"
 #include "vertexDataBlock.cxx"
 #include "vertexDataBook.cxx"
@@ -49,6 +49,10 @@ PreparedGraphicsObjects() :
   // disable this feature for DX8/DX9 for now, until we work out the
   // fine points of updating the fvf properly.
   _support_released_buffer_cache = false;
+
+  if (texture_streaming) {
+    _texture_residency_manager = new TextureResidencyManager;
+  }
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -353,6 +357,10 @@ prepare_texture_now(Texture *tex, int view, GraphicsStateGuardianBase *gsg) {
   if (tc != (TextureContext *)NULL) {
     bool prepared = _prepared_textures.insert(tc).second;
     nassertr(prepared, tc);
+
+    if (_texture_residency_manager != (TextureResidencyManager *)NULL) {
+      _texture_residency_manager->init_context(tc);
+    }
   }
 
   return tc;
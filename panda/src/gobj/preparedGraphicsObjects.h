@@ -28,6 +28,7 @@
 #include "reMutex.h"
 #include "bufferResidencyTracker.h"
 #include "adaptiveLru.h"
+#include "textureResidencyManager.h"
 
 class TextureContext;
 class GeomContext;
@@ -138,6 +139,8 @@ public:
                    Thread *current_thread);
   void end_frame(Thread *current_thread);
 
+  INLINE TextureResidencyManager *get_texture_residency_manager() const;
+
 private:
   static string init_name();
 
@@ -205,6 +208,10 @@ public:
 
   AdaptiveLru _graphics_memory_lru;
 
+private:
+  // This is only created when texture-streaming is enabled.
+  PT(TextureResidencyManager) _texture_residency_manager;
+
 public:
   // This is only public as a temporary hack.  Don't mess with it
   // unless you know what you're doing.
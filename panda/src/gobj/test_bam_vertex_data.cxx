@@ -0,0 +1,212 @@
+// Filename: test_bam_vertex_data.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "geomVertexData.h"
+#include "geomVertexFormat.h"
+#include "geomVertexArrayFormat.h"
+#include "geomVertexWriter.h"
+#include "config_gobj.h"
+#include "internalName.h"
+#include "bamWriter.h"
+#include "bamReader.h"
+#include "datagramOutputFile.h"
+#include "datagramInputFile.h"
+
+// Round-trips a GeomVertexData through a bam file with each of the
+// ways GeomVertexArrayData may read its data back (copied, shared
+// lazily with the bam stream, or mapped from the file), and checks
+// that the vertices that come back are the ones that went out.
+
+static const int num_rows = 4096;
+
+static PT(GeomVertexData)
+make_data() {
+  PT(GeomVertexArrayFormat) vertex_format = new GeomVertexArrayFormat
+    (InternalName::get_vertex(), 3, Geom::NT_float32, Geom::C_point);
+  PT(GeomVertexArrayFormat) color_format = new GeomVertexArrayFormat
+    (InternalName::get_color(), 4, Geom::NT_uint8, Geom::C_color);
+
+  PT(GeomVertexFormat) format = new GeomVertexFormat(vertex_format);
+  format->add_array(color_format);
+
+  PT(GeomVertexData) data = new GeomVertexData
+    ("test", GeomVertexFormat::register_format(format), Geom::UH_static);
+  data->unclean_set_num_rows(num_rows);
+
+  GeomVertexWriter vertex(data, InternalName::get_vertex());
+  GeomVertexWriter color(data, InternalName::get_color());
+  for (int i = 0; i < num_rows; ++i) {
+    vertex.set_data3(i * 0.5f, (i % 17) * 0.25f, -(float)(i % 101));
+    color.set_data4i(i & 0xff, (i >> 8) & 0xff, (i * 7) & 0xff, 0xff);
+  }
+
+  return data;
+}
+
+static bool
+write_bam(DatagramOutputFile &dout, const GeomVertexData *data) {
+  BamWriter writer(&dout);
+  return writer.init() && writer.write_object(data);
+}
+
+static bool
+write_bam(const Filename &filename, const GeomVertexData *data) {
+  DatagramOutputFile dout;
+  if (!dout.open(filename)) {
+    nout << "Couldn't open " << filename << " for writing.\n";
+    return false;
+  }
+  return write_bam(dout, data);
+}
+
+static PT(GeomVertexData)
+read_bam(DatagramInputFile &din) {
+  BamReader reader(&din);
+  if (!reader.init()) {
+    return NULL;
+  }
+
+  TypedWritable *object;
+  ReferenceCount *ref_ptr;
+  if (!reader.read_object(object, ref_ptr) || object == (TypedWritable *)NULL) {
+    return NULL;
+  }
+  PT(GeomVertexData) data = DCAST(GeomVertexData, object);
+  if (!reader.resolve()) {
+    return NULL;
+  }
+  return data;
+}
+
+static PT(GeomVertexData)
+read_bam(const Filename &filename) {
+  DatagramInputFile din;
+  if (!din.open(filename)) {
+    nout << "Couldn't open " << filename << " for reading.\n";
+    return NULL;
+  }
+  return read_bam(din);
+}
+
+static bool
+check_data(const GeomVertexData *expected, const GeomVertexData *data,
+           int share_size) {
+  if (data == (GeomVertexData *)NULL) {
+    nout << "  couldn't read data\n";
+    return false;
+  }
+  if (data->get_num_arrays() != expected->get_num_arrays() ||
+      data->get_num_rows() != expected->get_num_rows()) {
+    nout << "  wrong shape: " << *data << "\n";
+    return false;
+  }
+
+  bool all_ok = true;
+  for (int ai = 0; ai < data->get_num_arrays(); ++ai) {
+    const GeomVertexArrayData *array = data->get_array(ai);
+    if (array->get_handle()->get_data() !=
+        expected->get_array(ai)->get_handle()->get_data()) {
+      nout << "  array " << ai << ": vertex data differs\n";
+      all_ok = false;
+    }
+
+    bool should_share = (share_size > 0 &&
+                         array->get_data_size_bytes() >= share_size);
+    if (array->is_data_shared() != should_share) {
+      nout << "  array " << ai << ": expected data to be "
+           << (should_share ? "shared" : "copied") << "\n";
+      all_ok = false;
+    }
+  }
+  return all_ok;
+}
+
+int
+main(int argc, char *argv[]) {
+  PT(GeomVertexData) data = make_data();
+  Filename filename = Filename::binary_filename(string("test_bam_vertex_data.bam"));
+  bool all_ok = true;
+
+  // The vertex array is 48K and the color array 16K, so the middle
+  // setting shares only the first of them.
+  static const int share_sizes[] = { 0, 32768, 1 };
+  static const int num_share_sizes = sizeof(share_sizes) / sizeof(share_sizes[0]);
+
+  if (!write_bam(filename, data)) {
+    nout << "Couldn't write " << filename << "\n";
+    return 1;
+  }
+
+  for (int i = 0; i < num_share_sizes; ++i) {
+    vertex_data_lazy_size.set_value(share_sizes[i]);
+    nout << "vertex-data-lazy-size " << share_sizes[i] << "\n";
+    if (!check_data(data, read_bam(filename), share_sizes[i])) {
+      all_ok = false;
+    }
+  }
+  vertex_data_lazy_size.set_value(0);
+
+  // Large enough arrays are written outside of the object stream, and
+  // mapped directly from the file when it is read again.
+  for (int i = 0; i < num_share_sizes; ++i) {
+    vertex_data_mmap_size.set_value(share_sizes[i]);
+    nout << "vertex-data-mmap-size " << share_sizes[i] << "\n";
+    if (!write_bam(filename, data)) {
+      nout << "  couldn't write " << filename << "\n";
+      all_ok = false;
+    } else if (!check_data(data, read_bam(filename), share_sizes[i])) {
+      all_ok = false;
+    }
+  }
+
+  // Where the bam stream can't report a position in a file, the writer
+  // falls back to writing the arrays inline, and they are copied.
+  vertex_data_mmap_size.set_value(1);
+  {
+    nout << "vertex-data-mmap-size 1, in memory\n";
+    ostringstream out;
+    DatagramOutputFile dout;
+    PT(GeomVertexData) result;
+    if (dout.open(out) && write_bam(dout, data)) {
+      dout.close();
+      istringstream in(out.str());
+      DatagramInputFile din;
+      if (din.open(in)) {
+        result = read_bam(din);
+      }
+    }
+    if (!check_data(data, result, 0)) {
+      all_ok = false;
+    }
+  }
+
+#ifdef HAVE_ZLIB
+  {
+    Filename pz_filename = Filename::binary_filename(string("test_bam_vertex_data.bam.pz"));
+    nout << "vertex-data-mmap-size 1, compressed\n";
+    if (!write_bam(pz_filename, data)) {
+      nout << "  couldn't write " << pz_filename << "\n";
+      all_ok = false;
+    } else if (!check_data(data, read_bam(pz_filename), 0)) {
+      all_ok = false;
+    }
+    pz_filename.unlink();
+  }
+#endif  // HAVE_ZLIB
+
+  vertex_data_lazy_size.clear_local_value();
+  vertex_data_mmap_size.clear_local_value();
+  filename.unlink();
+  return all_ok ? 0 : 1;
+}
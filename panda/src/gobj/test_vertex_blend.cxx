@@ -0,0 +1,206 @@
+// Filename: test_vertex_blend.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "geom.h"
+#include "geomVertexData.h"
+#include "geomVertexFormat.h"
+#include "geomVertexArrayFormat.h"
+#include "geomVertexWriter.h"
+#include "geomVertexReader.h"
+#include "transformBlendTable.h"
+#include "userVertexTransform.h"
+#include "vertexBlendKernel.h"
+#include "config_gobj.h"
+#include "internalName.h"
+#include "trueClock.h"
+#include "thread.h"
+
+// A benchmark of CPU vertex animation with each of the available
+// vertex blend kernels.  A mesh skinned to a number of joints, with
+// short runs of vertices sharing each blend as in a typical character,
+// is animated repeatedly; the results of each kernel are also checked
+// against those of the original per-run code path.
+
+static const int num_rows = 100000;
+static const int num_joints = 64;
+static const int num_blends = 256;
+static const double min_test_time = 0.5;
+
+static double
+frand(double range) {
+  return ((double)rand() / (double)RAND_MAX) * range;
+}
+
+static LMatrix4
+make_matrix(int joint, int frame) {
+  double angle = joint * 5.0 + frame * 0.5;
+  return LMatrix4::rotate_mat(angle, LVector3(0.0f, 0.0f, 1.0f)) *
+    LMatrix4::translate_mat(joint * 0.1f, frame * 0.01f, 0.0f);
+}
+
+static PT(GeomVertexData)
+make_data(pvector<PT(UserVertexTransform)> &joints) {
+  PT(GeomVertexArrayFormat) array_format = new GeomVertexArrayFormat
+    (InternalName::get_vertex(), 3, Geom::NT_float32, Geom::C_point,
+     InternalName::get_normal(), 3, Geom::NT_float32, Geom::C_vector);
+  PT(GeomVertexArrayFormat) blend_format = new GeomVertexArrayFormat
+    (InternalName::get_transform_blend(), 1, Geom::NT_uint16, Geom::C_index);
+
+  PT(GeomVertexFormat) format = new GeomVertexFormat(array_format);
+  format->add_array(blend_format);
+  GeomVertexAnimationSpec spec;
+  spec.set_panda();
+  format->set_animation(spec);
+
+  PT(GeomVertexData) data = new GeomVertexData
+    ("skin", GeomVertexFormat::register_format(format), Geom::UH_static);
+
+  joints.clear();
+  for (int j = 0; j < num_joints; ++j) {
+    joints.push_back(new UserVertexTransform("joint"));
+    joints.back()->set_matrix(make_matrix(j, 0));
+  }
+
+  PT(TransformBlendTable) table = new TransformBlendTable;
+  for (int b = 0; b < num_blends; ++b) {
+    int j0 = rand() % num_joints;
+    int j1 = rand() % num_joints;
+    PN_stdfloat w0 = 0.25f + frand(0.5);
+    table->add_blend(TransformBlend(joints[j0], w0, joints[j1], 1.0f - w0));
+  }
+  table->set_rows(SparseArray::range(0, num_rows));
+  data->set_transform_blend_table(table);
+
+  GeomVertexWriter vertex(data, InternalName::get_vertex());
+  GeomVertexWriter normal(data, InternalName::get_normal());
+  GeomVertexWriter blend(data, InternalName::get_transform_blend());
+  int bi = 0;
+  int run = 0;
+  for (int i = 0; i < num_rows; ++i) {
+    if (run == 0) {
+      bi = rand() % num_blends;
+      run = 1 + rand() % 6;
+    }
+    --run;
+    vertex.add_data3(frand(10.0), frand(10.0), frand(10.0));
+    LVector3 n(frand(1.0) - 0.5, frand(1.0) - 0.5, frand(1.0) - 0.5);
+    n.normalize();
+    normal.add_data3(n);
+    blend.add_data1i(bi);
+  }
+
+  return data;
+}
+
+static void
+set_frame(pvector<PT(UserVertexTransform)> &joints, int frame) {
+  for (int j = 0; j < num_joints; ++j) {
+    joints[j]->set_matrix(make_matrix(j, frame));
+  }
+}
+
+static pvector<LPoint3>
+get_results(const GeomVertexData *animated) {
+  pvector<LPoint3> results;
+  GeomVertexReader vertex(animated, InternalName::get_vertex());
+  GeomVertexReader normal(animated, InternalName::get_normal());
+  while (!vertex.is_at_end()) {
+    results.push_back(vertex.get_data3());
+    results.push_back(normal.get_data3());
+  }
+  return results;
+}
+
+static bool
+check_results(const pvector<LPoint3> &a, const pvector<LPoint3> &b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (!a[i].almost_equal(b[i], 0.001f)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static double
+run_test(GeomVertexData *data, pvector<PT(UserVertexTransform)> &joints,
+         VertexBlendKernel::Kernel kernel, pvector<LPoint3> &results) {
+  vertex_blend_kernel.set_value(kernel);
+  data->clear_animated_vertices();
+  Thread *current_thread = Thread::get_current_thread();
+
+  set_frame(joints, 1);
+  results = get_results(data->animate_vertices(true, current_thread));
+
+  TrueClock *clock = TrueClock::get_global_ptr();
+  int frame = 2;
+  double start = clock->get_short_time();
+  double elapsed;
+  do {
+    set_frame(joints, frame);
+    data->animate_vertices(true, current_thread);
+    ++frame;
+    elapsed = clock->get_short_time() - start;
+  } while (elapsed < min_test_time);
+
+  return (double)(frame - 2) * num_rows / elapsed;
+}
+
+int
+main(int argc, char *argv[]) {
+  srand(1);
+  pvector<PT(UserVertexTransform)> joints;
+  PT(GeomVertexData) data = make_data(joints);
+
+  static const VertexBlendKernel::Kernel kernels[] = {
+    VertexBlendKernel::K_none,
+    VertexBlendKernel::K_scalar,
+    VertexBlendKernel::K_sse2,
+    VertexBlendKernel::K_avx2,
+  };
+  static const int num_kernels = sizeof(kernels) / sizeof(kernels[0]);
+
+  pvector<LPoint3> reference;
+  double reference_rate = 0.0;
+  bool all_ok = true;
+
+  for (int ki = 0; ki < num_kernels; ++ki) {
+    VertexBlendKernel::Kernel kernel = kernels[ki];
+    if (!VertexBlendKernel::is_kernel_supported(kernel)) {
+      nout << "  " << kernel << ": not supported\n";
+      continue;
+    }
+
+    pvector<LPoint3> results;
+    double rate = run_test(data, joints, kernel, results);
+    nout << "  " << kernel << ": " << rate / 1000000.0 << " Mverts/s";
+
+    if (kernel == VertexBlendKernel::K_none) {
+      reference.swap(results);
+      reference_rate = rate;
+    } else {
+      nout << " (" << rate / reference_rate << "x)";
+      if (!check_results(reference, results)) {
+        nout << " MISMATCH";
+        all_ok = false;
+      }
+    }
+    nout << "\n";
+  }
+
+  vertex_blend_kernel.set_value(VertexBlendKernel::K_auto);
+  return all_ok ? 0 : 1;
+}
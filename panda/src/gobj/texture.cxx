@@ -48,6 +48,11 @@
 
 #include <stddef.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TEXTURE_FILTER_SSE2
+#endif
+
 ConfigVariableEnum<Texture::QualityLevel> texture_quality_level
 ("texture-quality-level", Texture::QL_normal,
  PRC_DESC("This specifies a global quality level for all textures.  You "
@@ -89,10 +94,70 @@ ConfigVariableInt texture_anisotropic_degree
           "in order to change their visible properties."));
 
 PStatCollector Texture::_texture_read_pcollector("*:Texture:Read");
+PStatCollector Texture::_texture_mipmap_pcollector("*:Texture:Generate mipmaps");
+PStatCollector Texture::_texture_compress_pcollector("*:Texture:Compress");
+PStatCollector Texture::_texture_unmap_pcollector("*:Texture:Unmap");
 TypeHandle Texture::_type_handle;
 TypeHandle Texture::CData::_type_handle;
 AutoTextureScale Texture::_textures_power_2 = ATS_unspecified;
 
+// The first bytes of a txm file, and the version of its header that
+// we read and write.  Each mipmap level within the file begins on a
+// multiple of txm_alignment, which is at least the page size on any
+// platform we care about.
+static const char txm_magic[] = "pandatxm";
+static const size_t txm_magic_size = 8;
+static const int txm_version = 1;
+static const size_t txm_alignment = 4096;
+
+// The number of bytes in the fixed part of the txm header, following
+// the name, and in each entry of its table of mipmap levels.
+static const size_t txm_min_properties_size = 40 + 4 * sizeof(PN_stdfloat);
+static const size_t txm_level_size = 20;
+
+// A range of rows of one page of a mipmap level, to be filtered down
+// from the previous level by one thread.
+class Texture::Filter2DJob {
+public:
+  unsigned char *_to_page;
+  const unsigned char *_from_page;
+  int _begin_row;
+  int _end_row;
+};
+
+class Texture::Filter2DJobs {
+public:
+  typedef pvector<Filter2DJob> Jobs;
+  Jobs _jobs;
+  int _x_size;
+  int _y_size;
+  int _num_components;
+  size_t _pixel_size;
+  bool _unsigned_byte;
+  Filter2DComponent *_filter_component;
+};
+
+// A range of rows of 4x4 cells of one page of one mipmap level, to be
+// compressed by one thread.
+class Texture::SquishJob {
+public:
+  unsigned char *_dest;
+  const unsigned char *_source_page;
+  const unsigned char *_source_page_end;
+  int _x_size;
+  int _begin_y;
+  int _end_y;
+};
+
+class Texture::SquishJobs {
+public:
+  typedef pvector<SquishJob> Jobs;
+  Jobs _jobs;
+  int _num_components;
+  int _squish_flags;
+  int _cell_size;
+};
+
 // Stuff to read and write DDS files.
 
 //  little-endian, of course
@@ -434,6 +499,10 @@ read(const Filename &fullpath, int z, int n,
 //               be read, since a single .txo file can contain all
 //               pages and mipmaps necessary to define a texture.
 //
+//               The same is true of the extension .txm, except that
+//               the image data is not read at all, but is mapped
+//               directly from the file; see is_ram_image_mapped().
+//
 //               If alpha_fullpath is not empty, it specifies the name
 //               of a file from which to retrieve the alpha.  In this
 //               case, alpha_file_channel represents the numeric
@@ -1026,7 +1095,7 @@ is_cacheable() const {
 int Texture::
 get_num_loadable_ram_mipmap_images() const {
   CDReader cdata(_cycler);
-  if (cdata->_ram_images.empty() || cdata->_ram_images[0]._image.empty()) {
+  if (!do_has_ram_mipmap_image(cdata, 0)) {
     // If we don't even have a base image, the answer is none.
     return 0;
   }
@@ -1044,7 +1113,7 @@ get_num_loadable_ram_mipmap_images() const {
   while (x < size) {
     x = (x << 1);
     ++n;
-    if (n >= (int)cdata->_ram_images.size() || cdata->_ram_images[n]._image.empty()) {
+    if (!do_has_ram_mipmap_image(cdata, n)) {
       return n;
     }
   }
@@ -1062,7 +1131,16 @@ get_num_loadable_ram_mipmap_images() const {
 ////////////////////////////////////////////////////////////////////
 CPTA_uchar Texture::
 get_ram_mipmap_image(int n) const {
-  CDReader cdata(_cycler);
+  CDLockedReader cdata(_cycler);
+  if (n >= 0 && n < (int)cdata->_ram_images.size() &&
+      cdata->_ram_images[n]._mapped_file != (MemoryMappedFile *)NULL) {
+    // The image is still in its mapped file; it has to be copied into
+    // memory before we can return it as a CPTA_uchar.  We upgrade the
+    // lock we already hold, rather than taking a second one.
+    CDWriter cdataw(((Texture *)this)->_cycler, cdata, false);
+    ((Texture *)this)->do_unmap_ram_images(cdataw);
+    return cdataw->_ram_images[n]._image;
+  }
   if (n < (int)cdata->_ram_images.size() && !cdata->_ram_images[n]._image.empty()) {
     return cdata->_ram_images[n]._image;
   }
@@ -1086,6 +1164,28 @@ get_ram_mipmap_pointer(int n) const {
   return NULL;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: Texture::get_ram_mipmap_pointer
+//       Access: Public
+//  Description: As above, but if the level is still referenced from
+//               a memory-mapped txm file, also fills mapped_file
+//               with that file.  The returned pointer is valid for
+//               as long as the caller holds mapped_file, even if
+//               the texture unmaps its images in the meantime (for
+//               instance, because another thread called
+//               get_ram_mipmap_image()).
+////////////////////////////////////////////////////////////////////
+void *Texture::
+get_ram_mipmap_pointer(int n, PT(MemoryMappedFile) &mapped_file) const {
+  CDReader cdata(_cycler);
+  if (n >= 0 && n < (int)cdata->_ram_images.size()) {
+    mapped_file = cdata->_ram_images[n]._mapped_file;
+    return cdata->_ram_images[n]._pointer_image;
+  }
+  mapped_file = NULL;
+  return NULL;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: Texture::set_ram_mipmap_pointer
 //       Access: Published
@@ -1112,6 +1212,8 @@ set_ram_mipmap_pointer(int n, void *image, size_t page_size) {
   cdata->_ram_images[n]._page_size = page_size;
   //_ram_images[n]._image.clear(); wtf is going on?!
   cdata->_ram_images[n]._pointer_image = image;
+  cdata->_ram_images[n]._mapped_file = NULL;
+  cdata->_ram_images[n]._mapped_size = 0;
   ++(cdata->_image_modified);
 }
 
@@ -1146,6 +1248,8 @@ clear_ram_mipmap_image(int n) {
   cdata->_ram_images[n]._page_size = 0;
   cdata->_ram_images[n]._image.clear();
   cdata->_ram_images[n]._pointer_image = NULL;
+  cdata->_ram_images[n]._mapped_file = NULL;
+  cdata->_ram_images[n]._mapped_size = 0;
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -1715,9 +1819,9 @@ write(ostream &out, int indent_level) const {
       int count = 0;
       size_t total_size = 0;
       for (size_t n = 1; n < cdata->_ram_images.size(); ++n) {
-        if (!cdata->_ram_images[n]._image.empty()) {
+        if (do_has_ram_mipmap_image(cdata, n)) {
           ++count;
-          total_size += cdata->_ram_images[n]._image.size();
+          total_size += do_get_ram_mipmap_image_size(cdata, n);
         } else {
           // Stop at the first gap.
           break;
@@ -2701,6 +2805,13 @@ do_read(CData *cdata, const Filename &fullpath, const Filename &alpha_fullpath,
     return do_read_dds_file(cdata, fullpath, header_only);
   }
 
+  if (is_txm_filename(fullpath)) {
+    if (record != (BamCacheRecord *)NULL) {
+      record->add_dependent_file(fullpath);
+    }
+    return do_read_txm_file(cdata, fullpath);
+  }
+
   // If read_pages or read_mipmaps is specified, then z and n actually
   // indicate z_size and n_size, respectively--the numerical limits on
   // which to search for filenames.
@@ -3696,6 +3807,165 @@ do_read_dds(CData *cdata, istream &in, const string &filename, bool header_only)
   return true;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: Texture::do_read_txm_file
+//       Access: Private
+//  Description: Called internally when read() detects a txm file.
+//               Assumes the lock is already held.
+//
+//               A txm file holds a small header, followed by the
+//               image data for each mipmap level, each beginning on a
+//               page boundary; see do_write_txm_file().  The file is
+//               mapped into memory, and the RamImages are pointed
+//               directly into the mapping, so that nothing is
+//               actually read from disk until the image is used.
+////////////////////////////////////////////////////////////////////
+bool Texture::
+do_read_txm_file(CData *cdata, const Filename &fullpath) {
+  PT(MemoryMappedFile) file = new MemoryMappedFile;
+  if (!file->open(fullpath)) {
+    return false;
+  }
+
+  if (gobj_cat.is_debug()) {
+    gobj_cat.debug()
+      << "Mapping texture " << fullpath
+      << (file->is_mapped() ? "" : " (not mappable; read instead)") << "\n";
+  }
+
+  const unsigned char *data = file->get_data();
+  size_t file_size = file->get_size();
+  if (file_size < txm_magic_size + 4 ||
+      memcmp(data, txm_magic, txm_magic_size) != 0) {
+    gobj_cat.error()
+      << fullpath << " is not a txm file.\n";
+    return false;
+  }
+
+  Datagram size_dg(data + txm_magic_size, 4);
+  DatagramIterator size_scan(size_dg);
+  size_t header_size = size_scan.get_uint32();
+  if (header_size > file_size - txm_magic_size - 4) {
+    gobj_cat.error()
+      << fullpath << ": truncated txm file.\n";
+    return false;
+  }
+
+  Datagram header(data + txm_magic_size + 4, header_size);
+  DatagramIterator scan(header);
+  int version = scan.get_uint16();
+  if (version != txm_version) {
+    gobj_cat.error()
+      << fullpath << " is txm version " << version
+      << ", expected version " << txm_version << ".\n";
+    return false;
+  }
+
+  string name = scan.get_string();
+  if ((size_t)scan.get_remaining_size() < txm_min_properties_size) {
+    gobj_cat.error()
+      << fullpath << ": truncated txm file.\n";
+    return false;
+  }
+  cdata->_texture_type = (TextureType)scan.get_uint8();
+  cdata->_x_size = scan.get_uint32();
+  cdata->_y_size = scan.get_uint32();
+  cdata->_z_size = scan.get_uint32();
+  cdata->_num_views = scan.get_uint32();
+  cdata->_component_type = (ComponentType)scan.get_uint8();
+  cdata->_component_width = scan.get_uint8();
+  cdata->_format = (Format)scan.get_uint8();
+  cdata->_num_components = scan.get_uint8();
+  cdata->_compression = (CompressionMode)scan.get_uint8();
+  cdata->_quality_level = (QualityLevel)scan.get_uint8();
+  cdata->_wrap_u = (WrapMode)scan.get_uint8();
+  cdata->_wrap_v = (WrapMode)scan.get_uint8();
+  cdata->_wrap_w = (WrapMode)scan.get_uint8();
+  cdata->_minfilter = (FilterType)scan.get_uint8();
+  cdata->_magfilter = (FilterType)scan.get_uint8();
+  cdata->_anisotropic_degree = scan.get_int16();
+  cdata->_border_color.read_datagram(scan);
+  cdata->_orig_file_x_size = scan.get_uint32();
+  cdata->_orig_file_y_size = scan.get_uint32();
+  do_set_pad_size(cdata, 0, 0, 0);
+
+  cdata->_ram_image_compression = (CompressionMode)scan.get_uint8();
+  int num_levels = scan.get_uint8();
+
+  // Everything after this point indexes into the mapped file, so
+  // don't trust any of it.
+  if ((unsigned int)cdata->_texture_type > (unsigned int)TT_cube_map ||
+      (unsigned int)cdata->_component_type > (unsigned int)T_unsigned_int_24_8 ||
+      cdata->_format < F_depth_stencil || cdata->_format > F_depth_component32 ||
+      (unsigned int)cdata->_compression > (unsigned int)CM_pvr1_4bpp ||
+      (unsigned int)cdata->_ram_image_compression > (unsigned int)CM_pvr1_4bpp ||
+      (unsigned int)cdata->_quality_level > (unsigned int)QL_best ||
+      (unsigned int)cdata->_wrap_u >= (unsigned int)WM_invalid ||
+      (unsigned int)cdata->_wrap_v >= (unsigned int)WM_invalid ||
+      (unsigned int)cdata->_wrap_w >= (unsigned int)WM_invalid ||
+      (unsigned int)cdata->_minfilter >= (unsigned int)FT_invalid ||
+      (unsigned int)cdata->_magfilter >= (unsigned int)FT_invalid ||
+      cdata->_x_size <= 0 || cdata->_y_size <= 0 || cdata->_z_size <= 0 ||
+      cdata->_num_views <= 0 ||
+      cdata->_num_components <= 0 || cdata->_num_components > 4 ||
+      cdata->_component_width <= 0 || cdata->_component_width > 4 ||
+      (size_t)num_levels * txm_level_size > (size_t)scan.get_remaining_size()) {
+    gobj_cat.error()
+      << fullpath << ": invalid txm header.\n";
+    do_clear(cdata);
+    return false;
+  }
+
+  cdata->_ram_images.clear();
+  cdata->_ram_images.reserve(num_levels);
+  for (int n = 0; n < num_levels; ++n) {
+    PN_uint64 offset = scan.get_uint64();
+    PN_uint64 size = scan.get_uint64();
+    size_t page_size = scan.get_uint32();
+    if (offset > file_size || size > file_size - offset) {
+      gobj_cat.error()
+        << fullpath << ": truncated txm file.\n";
+      do_clear(cdata);
+      return false;
+    }
+
+    // The level must hold every page of every view, and an
+    // uncompressed level must be exactly the size the texture's
+    // properties imply; the upload code relies on both.
+    PN_uint64 num_pages = (PN_uint64)do_get_expected_mipmap_num_pages(cdata, n);
+    if (page_size == 0 || page_size > size || num_pages > size / page_size ||
+        (cdata->_ram_image_compression == CM_off &&
+         page_size != do_get_expected_ram_mipmap_page_size(cdata, n))) {
+      gobj_cat.error()
+        << fullpath << ": invalid size for mipmap level " << n << ".\n";
+      do_clear(cdata);
+      return false;
+    }
+
+    RamImage ram_image;
+    ram_image._page_size = page_size;
+    ram_image._pointer_image = (void *)(data + offset);
+    ram_image._mapped_file = file;
+    ram_image._mapped_size = (size_t)size;
+    cdata->_ram_images.push_back(ram_image);
+  }
+
+  if (!name.empty()) {
+    set_name(name);
+  }
+
+  cdata->_fullpath = fullpath;
+  cdata->_alpha_fullpath = Filename();
+  cdata->_keep_ram_image = false;
+  cdata->_loaded_from_image = true;
+  cdata->_loaded_from_txo = true;
+  cdata->_has_read_pages = false;
+  cdata->_has_read_mipmaps = false;
+  cdata->_num_mipmap_levels_read = 0;
+
+  return true;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: Texture::do_write
 //       Access: Protected
@@ -3713,6 +3983,10 @@ do_write(CData *cdata,
     return do_write_txo_file(cdata, fullpath);
   }
 
+  if (is_txm_filename(fullpath)) {
+    return do_write_txm_file(cdata, fullpath);
+  }
+
   if (!do_has_uncompressed_ram_image(cdata)) {
     do_get_uncompressed_ram_image(cdata);
   }
@@ -3973,6 +4247,123 @@ do_write_txo(const CData *cdata, ostream &out, const string &filename) const {
   return true;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: Texture::do_write_txm_file
+//       Access: Private
+//  Description: Called internally when write() detects a txm
+//               filename.  The texture's image is first brought into
+//               the form in which it will be sent to the graphics
+//               card: its mipmap levels are generated, and it is
+//               compressed, if appropriate.
+////////////////////////////////////////////////////////////////////
+bool Texture::
+do_write_txm_file(CData *cdata, const Filename &fullpath) {
+  do_get_ram_image(cdata);
+  if (!do_has_ram_image(cdata)) {
+    gobj_cat.error()
+      << get_name() << " does not have ram image\n";
+    return false;
+  }
+
+  if (uses_mipmaps() && !do_has_all_ram_mipmap_images(cdata) &&
+      cdata->_component_type != T_float) {
+    do_generate_ram_mipmap_images(cdata);
+  }
+
+  if (cdata->_ram_image_compression == CM_off && do_has_compression(cdata)) {
+    CompressionMode compression = cdata->_compression;
+    if (compression == CM_default) {
+      compression = CM_on;
+    }
+    do_compress_ram_image(cdata, compression, QL_default, NULL);
+  }
+
+  // Write only the mipmap levels we have, up to the first gap.
+  int num_levels = 0;
+  while (num_levels < (int)cdata->_ram_images.size() && num_levels < 255 &&
+         do_has_ram_mipmap_image(cdata, num_levels)) {
+    ++num_levels;
+  }
+
+  // The header has a fixed size for a given texture, so we can build
+  // it once to learn where the image data will begin, and then again
+  // with the final offsets.
+  pvector<PN_uint64> offsets(num_levels, 0);
+  Datagram header;
+  for (int pass = 0; pass < 2; ++pass) {
+    header.clear();
+    header.add_uint16(txm_version);
+    header.add_string(get_name());
+    header.add_uint8(cdata->_texture_type);
+    header.add_uint32(cdata->_x_size);
+    header.add_uint32(cdata->_y_size);
+    header.add_uint32(cdata->_z_size);
+    header.add_uint32(cdata->_num_views);
+    header.add_uint8(cdata->_component_type);
+    header.add_uint8(cdata->_component_width);
+    header.add_uint8(cdata->_format);
+    header.add_uint8(cdata->_num_components);
+    header.add_uint8(cdata->_compression);
+    header.add_uint8(cdata->_quality_level);
+    header.add_uint8(cdata->_wrap_u);
+    header.add_uint8(cdata->_wrap_v);
+    header.add_uint8(cdata->_wrap_w);
+    header.add_uint8(cdata->_minfilter);
+    header.add_uint8(cdata->_magfilter);
+    header.add_int16(cdata->_anisotropic_degree);
+    cdata->_border_color.write_datagram(header);
+    header.add_uint32(cdata->_orig_file_x_size);
+    header.add_uint32(cdata->_orig_file_y_size);
+    header.add_uint8(cdata->_ram_image_compression);
+    header.add_uint8(num_levels);
+    for (int n = 0; n < num_levels; ++n) {
+      header.add_uint64(offsets[n]);
+      header.add_uint64(cdata->_ram_images[n]._image.size());
+      header.add_uint32(cdata->_ram_images[n]._page_size);
+    }
+
+    PN_uint64 offset = txm_magic_size + 4 + header.get_length();
+    for (int n = 0; n < num_levels; ++n) {
+      offset = (offset + txm_alignment - 1) & ~(PN_uint64)(txm_alignment - 1);
+      offsets[n] = offset;
+      offset += cdata->_ram_images[n]._image.size();
+    }
+  }
+
+  VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
+  Filename filename = Filename::binary_filename(fullpath);
+  ostream *out = vfs->open_write_file(filename, false, true);
+  if (out == NULL) {
+    gobj_cat.error()
+      << "Unable to open " << filename << "\n";
+    return false;
+  }
+
+  Datagram size_dg;
+  size_dg.add_uint32(header.get_length());
+  out->write(txm_magic, txm_magic_size);
+  out->write((const char *)size_dg.get_data(), size_dg.get_length());
+  out->write((const char *)header.get_data(), header.get_length());
+
+  PN_uint64 pos = txm_magic_size + 4 + header.get_length();
+  for (int n = 0; n < num_levels && !out->fail(); ++n) {
+    for (; pos < offsets[n]; ++pos) {
+      out->put(0);
+    }
+    const RamImage &ram_image = cdata->_ram_images[n];
+    out->write((const char *)ram_image._image.p(), ram_image._image.size());
+    pos += ram_image._image.size();
+  }
+
+  bool success = !out->fail();
+  vfs->close_write_file(out);
+  if (!success) {
+    gobj_cat.error()
+      << "Unable to write to " << filename << "\n";
+  }
+  return success;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: Texture::unlocked_ensure_ram_image
 //       Access: Protected, Virtual
@@ -4107,9 +4498,12 @@ do_reload_ram_image(CData *cdata, bool allow_compression) {
     allow_compression = false;
   }
 
-  if ((cache->get_cache_textures() || (allow_compression && cache->get_cache_compressed_textures())) && !textures_header_only) {
+  if ((cache->get_cache_textures() || (allow_compression && cache->get_cache_compressed_textures())) && !textures_header_only &&
+      !is_txm_filename(cdata->_fullpath)) {
     // See if the texture can be found in the on-disk cache, if it is
-    // active.
+    // active.  (A txm file is never cached; it is already in its
+    // final form, and mapping it is cheaper than reading any cache
+    // record.)
 
     record = cache->lookup(cdata->_fullpath, "txo");
     if (record != (BamCacheRecord *)NULL &&
@@ -4226,6 +4620,7 @@ do_reload_ram_image(CData *cdata, bool allow_compression) {
 ////////////////////////////////////////////////////////////////////
 PTA_uchar Texture::
 do_modify_ram_image(CData *cdata) {
+  do_unmap_ram_images(cdata);
   if (cdata->_ram_images.empty() || cdata->_ram_images[0]._image.empty() ||
       cdata->_ram_image_compression != CM_off) {
     do_make_ram_image(cdata);
@@ -4248,6 +4643,8 @@ do_make_ram_image(CData *cdata) {
   cdata->_ram_images[0]._page_size = do_get_expected_ram_page_size(cdata);
   cdata->_ram_images[0]._image = PTA_uchar::empty_array(do_get_expected_ram_image_size(cdata), get_class_type());
   cdata->_ram_images[0]._pointer_image = NULL;
+  cdata->_ram_images[0]._mapped_file = NULL;
+  cdata->_ram_images[0]._mapped_size = 0;
   cdata->_ram_image_compression = CM_off;
   return cdata->_ram_images[0]._image;
 }
@@ -4277,10 +4674,13 @@ do_set_ram_image(CData *cdata, CPTA_uchar image, Texture::CompressionMode compre
   }
   if (cdata->_ram_images[0]._image != image ||
       cdata->_ram_images[0]._page_size != page_size ||
+      cdata->_ram_images[0]._mapped_file != (MemoryMappedFile *)NULL ||
       cdata->_ram_image_compression != compression) {
     cdata->_ram_images[0]._image = image.cast_non_const();
     cdata->_ram_images[0]._page_size = page_size;
     cdata->_ram_images[0]._pointer_image = NULL;
+    cdata->_ram_images[0]._mapped_file = NULL;
+    cdata->_ram_images[0]._mapped_size = 0;
     cdata->_ram_image_compression = compression;
     ++(cdata->_image_modified);
   }
@@ -4296,6 +4696,7 @@ PTA_uchar Texture::
 do_modify_ram_mipmap_image(CData *cdata, int n) {
   nassertr(cdata->_ram_image_compression == CM_off, PTA_uchar());
 
+  do_unmap_ram_images(cdata);
   if (n >= (int)cdata->_ram_images.size() ||
       cdata->_ram_images[n]._image.empty()) {
     do_make_ram_mipmap_image(cdata, n);
@@ -4318,6 +4719,8 @@ do_make_ram_mipmap_image(CData *cdata, int n) {
 
   cdata->_ram_images[n]._image = PTA_uchar::empty_array(do_get_expected_ram_mipmap_image_size(cdata, n), get_class_type());
   cdata->_ram_images[n]._pointer_image = NULL;
+  cdata->_ram_images[n]._mapped_file = NULL;
+  cdata->_ram_images[n]._mapped_size = 0;
   cdata->_ram_images[n]._page_size = do_get_expected_ram_mipmap_page_size(cdata, n);
   return cdata->_ram_images[n]._image;
 }
@@ -4339,9 +4742,12 @@ do_set_ram_mipmap_image(CData *cdata, int n, CPTA_uchar image, size_t page_size)
   }
 
   if (cdata->_ram_images[n]._image != image ||
-      cdata->_ram_images[n]._page_size != page_size) {
+      cdata->_ram_images[n]._page_size != page_size ||
+      cdata->_ram_images[n]._mapped_file != (MemoryMappedFile *)NULL) {
     cdata->_ram_images[n]._image = image.cast_non_const();
     cdata->_ram_images[n]._pointer_image = NULL;
+    cdata->_ram_images[n]._mapped_file = NULL;
+    cdata->_ram_images[n]._mapped_size = 0;
     cdata->_ram_images[n]._page_size = page_size;
     ++(cdata->_image_modified);
   }
@@ -4378,7 +4784,11 @@ do_consider_auto_process_ram_image(CData *cdata, bool generate_mipmaps,
                                    bool allow_compression) {
   bool modified = false;
 
-  if (generate_mipmaps && !driver_generate_mipmaps &&
+  // A streamed texture is uploaded from one of its smaller mipmap
+  // levels, which the driver can't generate for us, so we make them
+  // now, while the texture is being loaded, rather than in the draw
+  // thread when it is first rendered.
+  if (generate_mipmaps && (!driver_generate_mipmaps || texture_streaming) &&
       cdata->_ram_images.size() == 1) {
     do_generate_ram_mipmap_images(cdata);
     modified = true;
@@ -4415,6 +4825,7 @@ do_compress_ram_image(CData *cdata, Texture::CompressionMode compression,
                       Texture::QualityLevel quality_level,
                       GraphicsStateGuardianBase *gsg) {
   nassertr(compression != CM_off, false);
+  do_unmap_ram_images(cdata);
 
   if (compression == CM_on) {
     // Select an appropriate compression mode automatically.
@@ -4526,6 +4937,7 @@ do_compress_ram_image(CData *cdata, Texture::CompressionMode compression,
 ////////////////////////////////////////////////////////////////////
 bool Texture::
 do_uncompress_ram_image(CData *cdata) {
+  do_unmap_ram_images(cdata);
 
 #ifdef HAVE_SQUISH
   if (cdata->_texture_type != TT_3d_texture &&
@@ -4567,7 +4979,7 @@ do_uncompress_ram_image(CData *cdata) {
 ////////////////////////////////////////////////////////////////////
 bool Texture::
 do_has_all_ram_mipmap_images(const CData *cdata) const {
-  if (cdata->_ram_images.empty() || cdata->_ram_images[0]._image.empty()) {
+  if (!do_has_ram_mipmap_image(cdata, 0)) {
     // If we don't even have a base image, the answer is no.
     return false;
   }
@@ -4585,7 +4997,7 @@ do_has_all_ram_mipmap_images(const CData *cdata) const {
   while (x < size) {
     x = (x << 1);
     ++n;
-    if (n >= (int)cdata->_ram_images.size() || cdata->_ram_images[n]._image.empty()) {
+    if (!do_has_ram_mipmap_image(cdata, n)) {
       return false;
     }
   }
@@ -5236,7 +5648,7 @@ do_has_compression(const CData *cdata) const {
 ////////////////////////////////////////////////////////////////////
 bool Texture::
 do_has_ram_image(const CData *cdata) const {
-  return !cdata->_ram_images.empty() && !cdata->_ram_images[0]._image.empty();
+  return do_has_ram_mipmap_image(cdata, 0);
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -5248,7 +5660,7 @@ do_has_ram_image(const CData *cdata) const {
 ////////////////////////////////////////////////////////////////////
 bool Texture::
 do_has_uncompressed_ram_image(const CData *cdata) const {
-  return !cdata->_ram_images.empty() && !cdata->_ram_images[0]._image.empty() && cdata->_ram_image_compression == CM_off;
+  return do_has_ram_mipmap_image(cdata, 0) && cdata->_ram_image_compression == CM_off;
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -5273,6 +5685,7 @@ do_get_ram_image(CData *cdata) {
     return CPTA_uchar(get_class_type());
   }
 
+  do_unmap_ram_images(cdata);
   return cdata->_ram_images[0]._image;
 }
 
@@ -5283,6 +5696,7 @@ do_get_ram_image(CData *cdata) {
 ////////////////////////////////////////////////////////////////////
 CPTA_uchar Texture::
 do_get_uncompressed_ram_image(CData *cdata) {
+  do_unmap_ram_images(cdata);
   if (!cdata->_ram_images.empty() && cdata->_ram_image_compression != CM_off) {
     // We have an image in-ram, but it's compressed.  Try to
     // uncompress it first.
@@ -5313,6 +5727,8 @@ do_get_uncompressed_ram_image(CData *cdata) {
     return CPTA_uchar(get_class_type());
   }
 
+  // The reload may have mapped the image from a txm file.
+  do_unmap_ram_images(cdata);
   return cdata->_ram_images[0]._image;
 }
 
@@ -5595,6 +6011,31 @@ do_clear_ram_mipmap_images(CData *cdata) {
   }
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: Texture::do_unmap_ram_images
+//       Access: Protected
+//  Description: Copies any mipmap levels that are still referenced
+//               from a memory-mapped txm file into ordinary
+//               PTA_uchar storage, and releases the file.  This must
+//               be called before any operation that accesses the
+//               _image member of the RamImages directly.
+////////////////////////////////////////////////////////////////////
+void Texture::
+do_unmap_ram_images(CData *cdata) {
+  for (size_t n = 0; n < cdata->_ram_images.size(); ++n) {
+    RamImage &ram_image = cdata->_ram_images[n];
+    if (ram_image._mapped_file != (MemoryMappedFile *)NULL) {
+      PStatTimer timer(_texture_unmap_pcollector);
+      PTA_uchar image = PTA_uchar::empty_array(ram_image._mapped_size, get_class_type());
+      memcpy(image.p(), ram_image._pointer_image, ram_image._mapped_size);
+      ram_image._image = image;
+      ram_image._pointer_image = NULL;
+      ram_image._mapped_file = NULL;
+      ram_image._mapped_size = 0;
+    }
+  }
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: Texture::do_generate_ram_mipmap_images
 //       Access: Protected
@@ -5609,6 +6050,8 @@ do_generate_ram_mipmap_images(CData *cdata) {
     return;
   }
 
+  do_unmap_ram_images(cdata);
+
   RamImage orig_compressed_image;
   CompressionMode orig_compression_mode = CM_off;
 
@@ -5632,6 +6075,8 @@ do_generate_ram_mipmap_images(CData *cdata) {
       << "Generating mipmap levels for " << *this << "\n";
   }
 
+  PStatTimer timer(_texture_mipmap_pcollector);
+
   if (cdata->_texture_type == Texture::TT_3d_texture && cdata->_z_size != 1) {
     // Eek, a 3-D texture.
     int x_size = cdata->_x_size;
@@ -5912,11 +6357,24 @@ convert_from_pfm(PTA_uchar &image, size_t page_size, int z,
   nassertv(idx + page_size <= image.size());
   PN_float32 *p = (PN_float32 *)&image[idx];
 
-  for (int j = y_size-1; j >= 0; j--) {
-    for (int i = 0; i < x_size; i++) {
-      for (int c = 0; c < num_components; ++c) {
-        *p = pfm.get_component(i, j, c);
-        ++p;
+  if (pfm.get_num_channels() == num_components) {
+    // The PfmFile's table is already laid out the way we want, except
+    // that its rows are stored top to bottom, so we can copy it a row
+    // at a time, with no per-component conversion.
+    const vector_float &table = pfm.get_table();
+    size_t row_size = (size_t)x_size * num_components;
+    for (int j = y_size-1; j >= 0; j--) {
+      memcpy(p, &table[(size_t)j * row_size], row_size * sizeof(PN_float32));
+      p += row_size;
+    }
+
+  } else {
+    for (int j = y_size-1; j >= 0; j--) {
+      for (int i = 0; i < x_size; i++) {
+        for (int c = 0; c < num_components; ++c) {
+          *p = pfm.get_component(i, j, c);
+          ++p;
+        }
       }
     }
   }
@@ -5997,22 +6455,26 @@ convert_to_pfm(PfmFile &pfm, int x_size, int y_size,
                int num_components, int component_width,
                CPTA_uchar image, size_t page_size, int z) {
   nassertr(component_width == 4, false);  // Currently only PN_float32 is expected.
-  pfm.clear(x_size, y_size, num_components);
 
   int idx = page_size * z;
   nassertr(idx + page_size <= image.size(), false);
   const PN_float32 *p = (const PN_float32 *)&image[idx];
 
+  // Fill in the PfmFile's table directly, a row at a time, reversing
+  // the order of the rows.
+  pfm.clear(x_size, y_size, num_components);
+  vector_float table;
+  pfm.swap_table(table);
+
+  size_t row_size = (size_t)x_size * num_components;
   for (int j = y_size-1; j >= 0; j--) {
-    for (int i = 0; i < x_size; i++) {
-      for (int c = 0; c < num_components; ++c) {
-        pfm.set_component(i, j, c, *p);
-        ++p;
-      }
-    }
+    memcpy(&table[(size_t)j * row_size], p, row_size * sizeof(PN_float32));
+    p += row_size;
   }
 
-  nassertr((unsigned char *)p == &image[idx] + page_size, false);
+  pfm.swap_table(table);
+
+  nassertr((const unsigned char *)p == &image[idx] + page_size, false);
   return true;
 }
 
@@ -6673,6 +7135,9 @@ compare_images(const PNMImage &a, const PNMImage &b) {
 //               They need not be a power of 2, or even a multiple of
 //               2.
 //
+//               The pages, and bands of rows within each page, are
+//               divided among the texture-process-threads.
+//
 //               Assumes the lock is already held.
 ////////////////////////////////////////////////////////////////////
 void Texture::
@@ -6680,7 +7145,6 @@ do_filter_2d_mipmap_pages(const CData *cdata,
                           Texture::RamImage &to, const Texture::RamImage &from,
                           int x_size, int y_size) const {
   size_t pixel_size = cdata->_num_components * cdata->_component_width;
-  size_t row_size = (size_t)x_size * pixel_size;
 
   int to_x_size = max(x_size >> 1, 1);
   int to_y_size = max(y_size >> 1, 1);
@@ -6689,76 +7153,42 @@ do_filter_2d_mipmap_pages(const CData *cdata,
   to._page_size = (size_t)to_y_size * to_row_size;
   to._image = PTA_uchar::empty_array(to._page_size * cdata->_z_size * cdata->_num_views, get_class_type());
 
-  Filter2DComponent *filter_component = (cdata->_component_type == T_unsigned_byte ? &filter_2d_unsigned_byte : filter_2d_unsigned_short);
+  Filter2DJobs jobs;
+  jobs._x_size = x_size;
+  jobs._y_size = y_size;
+  jobs._num_components = cdata->_num_components;
+  jobs._pixel_size = pixel_size;
+  jobs._unsigned_byte = (cdata->_component_type == T_unsigned_byte);
+  jobs._filter_component = (cdata->_component_type == T_unsigned_byte ? &filter_2d_unsigned_byte : filter_2d_unsigned_short);
+
+  // Each page is divided into bands of about 64K of the new level, so
+  // that a large page can be shared among several threads.
+  int rows_per_job = max((int)(65536 / to_row_size), 1);
 
   int num_pages = cdata->_z_size * cdata->_num_views;
+  nassertv(from._image.size() >= from._page_size * num_pages);
   for (int z = 0; z < num_pages; ++z) {
-    // For each level.
-    unsigned char *p = to._image.p() + z * to._page_size;
-    nassertv(p <= to._image.p() + to._image.size() + to._page_size);
-    const unsigned char *q = from._image.p() + z * from._page_size;
-    nassertv(q <= from._image.p() + from._image.size() + from._page_size);
-    if (y_size != 1) {
-      int y;
-      for (y = 0; y < y_size - 1; y += 2) {
-        // For each row.
-        nassertv(p == to._image.p() + z * to._page_size + (y / 2) * to_row_size);
-        nassertv(q == from._image.p() + z * from._page_size + y * row_size);
-        if (x_size != 1) {
-          int x;
-          for (x = 0; x < x_size - 1; x += 2) {
-            // For each pixel.
-            for (int c = 0; c < cdata->_num_components; ++c) {
-              // For each component.
-              filter_component(p, q, pixel_size, row_size);
-            }
-            q += pixel_size;
-          }
-          if (x < x_size) {
-            // Skip the last odd pixel.
-            q += pixel_size;
-          }
-        } else {
-          // Just one pixel.
-          for (int c = 0; c < cdata->_num_components; ++c) {
-            // For each component.
-            filter_component(p, q, 0, row_size);
-          }
-        }
-        q += row_size;
-        Thread::consider_yield();
-      }
-      if (y < y_size) {
-        // Skip the last odd row.
-        q += row_size;
-      }
-    } else {
-      // Just one row.
-      if (x_size != 1) {
-        int x;
-        for (x = 0; x < x_size - 1; x += 2) {
-          // For each pixel.
-          for (int c = 0; c < cdata->_num_components; ++c) {
-            // For each component.
-            filter_component(p, q, pixel_size, 0);
-          }
-          q += pixel_size;
-        }
-        if (x < x_size) {
-          // Skip the last odd pixel.
-          q += pixel_size;
-        }
-      } else {
-        // Just one pixel.
-        for (int c = 0; c < cdata->_num_components; ++c) {
-          // For each component.
-          filter_component(p, q, 0, 0);
-        }
-      }
+    Filter2DJob job;
+    job._to_page = to._image.p() + z * to._page_size;
+    job._from_page = from._image.p() + z * from._page_size;
+    for (int y = 0; y < to_y_size; y += rows_per_job) {
+      job._begin_row = y;
+      job._end_row = min(y + rows_per_job, to_y_size);
+      jobs._jobs.push_back(job);
     }
+  }
 
-    nassertv(p == to._image.p() + (z + 1) * to._page_size);
-    nassertv(q == from._image.p() + (z + 1) * from._page_size);
+  PT(WorkerThreadPool) pool;
+  if (jobs._jobs.size() > 1) {
+    pool = get_thread_pool();
+  }
+  if (pool != (WorkerThreadPool *)NULL) {
+    pool->run_jobs((int)jobs._jobs.size(), &filter_2d_job_func, &jobs);
+  } else {
+    Filter2DJobs::Jobs::const_iterator ji;
+    for (ji = jobs._jobs.begin(); ji != jobs._jobs.end(); ++ji) {
+      filter_2d_rows(jobs, *ji);
+    }
   }
 }
 
@@ -6940,6 +7370,154 @@ do_filter_3d_mipmap_level(const CData *cdata,
   }
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: Texture::filter_2d_rows
+//       Access: Private, Static
+//  Description: Generates the indicated rows of one page of the next
+//               mipmap level, as described by the job.  The last
+//               odd pixel of each row, and the last odd row, of the
+//               previous level are skipped.
+////////////////////////////////////////////////////////////////////
+void Texture::
+filter_2d_rows(const Filter2DJobs &jobs, const Filter2DJob &job) {
+  int x_size = jobs._x_size;
+  int y_size = jobs._y_size;
+  int num_components = jobs._num_components;
+  size_t pixel_size = jobs._pixel_size;
+  size_t row_size = (size_t)x_size * pixel_size;
+
+  int to_x_size = max(x_size >> 1, 1);
+  size_t to_row_size = (size_t)to_x_size * pixel_size;
+
+  // A level only one pixel wide (or high) is filtered in just the
+  // other direction.
+  size_t pixel_step = (x_size != 1) ? pixel_size : 0;
+  size_t row_step = (y_size != 1) ? row_size : 0;
+  bool use_row_filter = (jobs._unsigned_byte && pixel_step != 0 && row_step != 0);
+
+  for (int y = job._begin_row; y < job._end_row; ++y) {
+    unsigned char *p = job._to_page + y * to_row_size;
+    const unsigned char *q = job._from_page + y * 2 * row_step;
+    if (use_row_filter) {
+      filter_2d_unsigned_byte_row(p, q, row_size, to_x_size, num_components);
+    } else {
+      for (int x = 0; x < to_x_size; ++x) {
+        const unsigned char *qx = q + x * 2 * pixel_step;
+        for (int c = 0; c < num_components; ++c) {
+          jobs._filter_component(p, qx, pixel_step, row_step);
+        }
+      }
+    }
+    Thread::consider_yield();
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: Texture::filter_2d_job_func
+//       Access: Private, Static
+//  Description: The WorkerThreadPool job function for
+//               do_filter_2d_mipmap_pages(); user_data is the
+//               Filter2DJobs.
+////////////////////////////////////////////////////////////////////
+void Texture::
+filter_2d_job_func(int job_index, Thread *current_thread, void *user_data) {
+  const Filter2DJobs &jobs = *(const Filter2DJobs *)user_data;
+  filter_2d_rows(jobs, jobs._jobs[job_index]);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: Texture::filter_2d_unsigned_byte_row
+//       Access: Private, Static
+//  Description: Averages each 2x2 block of pixels in the row of
+//               unsigned bytes beginning at q, and the row following
+//               it, into a row of to_x_size pixels at p.  This gives
+//               the same result as filter_2d_unsigned_byte(), but
+//               does several pixels at once where it can.
+////////////////////////////////////////////////////////////////////
+void Texture::
+filter_2d_unsigned_byte_row(unsigned char *p, const unsigned char *q,
+                            size_t row_size, int to_x_size,
+                            int num_components) {
+  const unsigned char *q1 = q + row_size;
+  int x = 0;
+
+#ifdef TEXTURE_FILTER_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  switch (num_components) {
+  case 1:
+    {
+      // Sixteen source pixels give eight new ones.
+      const __m128i low_byte = _mm_set1_epi16(0xff);
+      for (; x + 8 <= to_x_size; x += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(q + x * 2));
+        __m128i b = _mm_loadu_si128((const __m128i *)(q1 + x * 2));
+        __m128i sum = _mm_add_epi16(_mm_add_epi16(_mm_and_si128(a, low_byte),
+                                                  _mm_srli_epi16(a, 8)),
+                                    _mm_add_epi16(_mm_and_si128(b, low_byte),
+                                                  _mm_srli_epi16(b, 8)));
+        sum = _mm_srli_epi16(sum, 2);
+        _mm_storel_epi64((__m128i *)(p + x), _mm_packus_epi16(sum, sum));
+      }
+    }
+    break;
+
+  case 2:
+    // Eight source pixels give four new ones.  Each pixel is one
+    // 32-bit lane once the components are widened to 16 bits.
+    for (; x + 4 <= to_x_size; x += 4) {
+      __m128i a = _mm_loadu_si128((const __m128i *)(q + x * 4));
+      __m128i b = _mm_loadu_si128((const __m128i *)(q1 + x * 4));
+      __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+      __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+      lo = _mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 1, 2, 0));
+      hi = _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 1, 2, 0));
+      __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi),
+                                  _mm_unpackhi_epi64(lo, hi));
+      sum = _mm_srli_epi16(sum, 2);
+      _mm_storel_epi64((__m128i *)(p + x * 2), _mm_packus_epi16(sum, sum));
+    }
+    break;
+
+  case 4:
+    // Eight source pixels give four new ones.  Each pixel is one
+    // 64-bit lane once the components are widened to 16 bits.
+    for (; x + 4 <= to_x_size; x += 4) {
+      __m128i a0 = _mm_loadu_si128((const __m128i *)(q + x * 8));
+      __m128i a1 = _mm_loadu_si128((const __m128i *)(q + x * 8 + 16));
+      __m128i b0 = _mm_loadu_si128((const __m128i *)(q1 + x * 8));
+      __m128i b1 = _mm_loadu_si128((const __m128i *)(q1 + x * 8 + 16));
+      __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+      __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+      __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+      __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+      __m128i r0 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+      __m128i r1 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+      r0 = _mm_srli_epi16(r0, 2);
+      r1 = _mm_srli_epi16(r1, 2);
+      _mm_storeu_si128((__m128i *)(p + x * 4), _mm_packus_epi16(r0, r1));
+    }
+    break;
+
+  default:
+    break;
+  }
+#endif  // TEXTURE_FILTER_SSE2
+
+  // The remaining pixels, one component at a time.
+  size_t pixel_size = (size_t)num_components;
+  for (; x < to_x_size; ++x) {
+    const unsigned char *a = q + x * 2 * pixel_size;
+    const unsigned char *b = q1 + x * 2 * pixel_size;
+    unsigned char *d = p + x * pixel_size;
+    for (int c = 0; c < num_components; ++c) {
+      d[c] = (unsigned char)(((unsigned int)a[c] +
+                              (unsigned int)a[c + pixel_size] +
+                              (unsigned int)b[c] +
+                              (unsigned int)b[c + pixel_size]) >> 2);
+    }
+  }
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: Texture::filter_2d_unsigned_byte
 //       Access: Public, Static
@@ -7042,6 +7620,13 @@ do_squish(CData *cdata, Texture::CompressionMode compression, int squish_flags)
     do_generate_ram_mipmap_images(cdata);
   }
 
+  PStatTimer timer(_texture_compress_pcollector);
+
+  SquishJobs jobs;
+  jobs._num_components = cdata->_num_components;
+  jobs._squish_flags = squish_flags;
+  jobs._cell_size = squish::GetStorageRequirements(4, 4, squish_flags);
+
   RamImages compressed_ram_images;
   compressed_ram_images.reserve(cdata->_ram_images.size());
   for (size_t n = 0; n < cdata->_ram_images.size(); ++n) {
@@ -7050,67 +7635,46 @@ do_squish(CData *cdata, Texture::CompressionMode compression, int squish_flags)
     int y_size = do_get_expected_mipmap_y_size(cdata, n);
     int num_pages = do_get_expected_mipmap_num_pages(cdata, n);
     int page_size = squish::GetStorageRequirements(x_size, y_size, squish_flags);
-    int cell_size = squish::GetStorageRequirements(4, 4, squish_flags);
 
     compressed_image._page_size = page_size;
     compressed_image._image = PTA_uchar::empty_array(page_size * num_pages);
-    for (int z = 0; z < num_pages; ++z) {
-      unsigned char *dest_page = compressed_image._image.p() + z * page_size;
-      unsigned const char *source_page = cdata->_ram_images[n]._image.p() + z * cdata->_ram_images[n]._page_size;
-      unsigned const char *source_page_end = source_page + cdata->_ram_images[n]._page_size;
-      // Convert one 4 x 4 cell at a time.
-      unsigned char *d = dest_page;
-      for (int y = 0; y < y_size; y += 4) {
-        for (int x = 0; x < x_size; x += 4) {
-          unsigned char tb[16 * 4];
-          int mask = 0;
-          unsigned char *t = tb;
-          for (int i = 0; i < 16; ++i) {
-            int xi = x + i % 4;
-            int yi = y + i / 4;
-            unsigned const char *s = source_page + (yi * x_size + xi) * cdata->_num_components;
-            if (s < source_page_end) {
-              switch (cdata->_num_components) {
-              case 1:
-                t[0] = s[0];   // r
-                t[1] = s[0];   // g
-                t[2] = s[0];   // b
-                t[3] = 255;    // a
-                break;
-
-              case 2:
-                t[0] = s[0];   // r
-                t[1] = s[0];   // g
-                t[2] = s[0];   // b
-                t[3] = s[1];   // a
-                break;
 
-              case 3:
-                t[0] = s[2];   // r
-                t[1] = s[1];   // g
-                t[2] = s[0];   // b
-                t[3] = 255;    // a
-                break;
+    // Each job compresses a band of rows of 4 x 4 cells, of at least
+    // 64 cells, so that a large page can be shared among several
+    // threads.
+    int row_cells = (x_size + 3) / 4;
+    int rows_per_job = max(64 / row_cells, 1) * 4;
+    size_t row_bytes = (size_t)row_cells * jobs._cell_size;
 
-              case 4:
-                t[0] = s[2];   // r
-                t[1] = s[1];   // g
-                t[2] = s[0];   // b
-                t[3] = s[3];   // a
-                break;
-              }
-              mask |= (1 << i);
-            }
-            t += 4;
-          }
-          squish::CompressMasked(tb, mask, d, squish_flags);
-          d += cell_size;
-          Thread::consider_yield();
-        }
+    for (int z = 0; z < num_pages; ++z) {
+      SquishJob job;
+      job._source_page = cdata->_ram_images[n]._image.p() + z * cdata->_ram_images[n]._page_size;
+      job._source_page_end = job._source_page + cdata->_ram_images[n]._page_size;
+      job._x_size = x_size;
+      unsigned char *dest_page = compressed_image._image.p() + z * page_size;
+      for (int y = 0; y < y_size; y += rows_per_job) {
+        job._dest = dest_page + (y / 4) * row_bytes;
+        job._begin_y = y;
+        job._end_y = min(y + rows_per_job, y_size);
+        jobs._jobs.push_back(job);
       }
     }
     compressed_ram_images.push_back(compressed_image);
   }
+
+  PT(WorkerThreadPool) pool;
+  if (jobs._jobs.size() > 1) {
+    pool = get_thread_pool();
+  }
+  if (pool != (WorkerThreadPool *)NULL) {
+    pool->run_jobs((int)jobs._jobs.size(), &squish_job_func, &jobs);
+  } else {
+    SquishJobs::Jobs::const_iterator ji;
+    for (ji = jobs._jobs.begin(); ji != jobs._jobs.end(); ++ji) {
+      squish_rows(jobs, *ji);
+    }
+  }
+
   cdata->_ram_images.swap(compressed_ram_images);
   cdata->_ram_image_compression = compression;
   return true;
@@ -7121,6 +7685,102 @@ do_squish(CData *cdata, Texture::CompressionMode compression, int squish_flags)
 #endif  // HAVE_SQUISH
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: Texture::squish_rows
+//       Access: Private, Static
+//  Description: Compresses the rows of 4 x 4 cells described by the
+//               job, one cell at a time.
+////////////////////////////////////////////////////////////////////
+void Texture::
+squish_rows(const SquishJobs &jobs, const SquishJob &job) {
+#ifdef HAVE_SQUISH
+  int num_components = jobs._num_components;
+  int x_size = job._x_size;
+  unsigned const char *source_page = job._source_page;
+  unsigned const char *source_page_end = job._source_page_end;
+
+  unsigned char *d = job._dest;
+  for (int y = job._begin_y; y < job._end_y; y += 4) {
+    for (int x = 0; x < x_size; x += 4) {
+      unsigned char tb[16 * 4];
+      int mask = 0;
+      unsigned char *t = tb;
+      for (int i = 0; i < 16; ++i) {
+        int xi = x + i % 4;
+        int yi = y + i / 4;
+        unsigned const char *s = source_page + (yi * x_size + xi) * num_components;
+        if (s < source_page_end) {
+          switch (num_components) {
+          case 1:
+            t[0] = s[0];   // r
+            t[1] = s[0];   // g
+            t[2] = s[0];   // b
+            t[3] = 255;    // a
+            break;
+
+          case 2:
+            t[0] = s[0];   // r
+            t[1] = s[0];   // g
+            t[2] = s[0];   // b
+            t[3] = s[1];   // a
+            break;
+
+          case 3:
+            t[0] = s[2];   // r
+            t[1] = s[1];   // g
+            t[2] = s[0];   // b
+            t[3] = 255;    // a
+            break;
+
+          case 4:
+            t[0] = s[2];   // r
+            t[1] = s[1];   // g
+            t[2] = s[0];   // b
+            t[3] = s[3];   // a
+            break;
+          }
+          mask |= (1 << i);
+        }
+        t += 4;
+      }
+      squish::CompressMasked(tb, mask, d, jobs._squish_flags);
+      d += jobs._cell_size;
+      Thread::consider_yield();
+    }
+  }
+#endif  // HAVE_SQUISH
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: Texture::squish_job_func
+//       Access: Private, Static
+//  Description: The WorkerThreadPool job function for do_squish();
+//               user_data is the SquishJobs.
+////////////////////////////////////////////////////////////////////
+void Texture::
+squish_job_func(int job_index, Thread *current_thread, void *user_data) {
+  const SquishJobs &jobs = *(const SquishJobs *)user_data;
+  squish_rows(jobs, jobs._jobs[job_index]);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: Texture::get_thread_pool
+//       Access: Private, Static
+//  Description: Returns the WorkerThreadPool with which to generate
+//               mipmaps and compress textures, or NULL if this work
+//               should all be done in the calling thread, according
+//               to texture-process-threads.
+////////////////////////////////////////////////////////////////////
+PT(WorkerThreadPool) Texture::
+get_thread_pool() {
+  int num_threads = texture_process_threads;
+  if (num_threads <= 1) {
+    return NULL;
+  }
+
+  return WorkerThreadPool::get_shared("TextureProcess", num_threads);
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: Texture::do_unsquish
 //       Access: Private
@@ -7409,6 +8069,8 @@ do_write_datagram_body(CData *cdata, BamWriter *manager, Datagram &me) {
 ////////////////////////////////////////////////////////////////////
 void Texture::
 do_write_datagram_rawdata(CData *cdata, BamWriter *manager, Datagram &me) {
+  do_unmap_ram_images(cdata);
+
   me.add_uint32(cdata->_x_size);
   me.add_uint32(cdata->_y_size);
   me.add_uint32(cdata->_z_size);
@@ -7698,8 +8360,12 @@ do_fillin_rawdata(CData *cdata, DatagramIterator &scan, BamReader *manager) {
     
     // fill the cdata->_image buffer with image data
     PTA_uchar image = PTA_uchar::empty_array(u_size, get_class_type());
-    for (size_t u_idx = 0; u_idx < u_size; ++u_idx) {
-      image[(int)u_idx] = scan.get_uint8();
+    nassertv((size_t)scan.get_remaining_size() >= u_size);
+    if (u_size != 0) {
+      const unsigned char *source_data =
+        (const unsigned char *)scan.get_datagram().get_data();
+      memcpy(image.p(), source_data + scan.get_current_index(), u_size);
+      scan.skip_bytes(u_size);
     }
     cdata->_ram_images[n]._image = image;
   }
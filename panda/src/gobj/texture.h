@@ -39,6 +39,8 @@
 #include "cycleDataStageReader.h"
 #include "cycleDataStageWriter.h"
 #include "pipelineCycler.h"
+#include "workerThreadPool.h"
+#include "memoryMappedFile.h"
 
 class PNMImage;
 class PfmFile;
@@ -329,6 +331,7 @@ PUBLISHED:
   INLINE bool has_ram_image() const;
   INLINE bool has_uncompressed_ram_image() const;
   INLINE bool might_have_ram_image() const;
+  INLINE bool is_ram_image_mapped() const;
   INLINE size_t get_ram_image_size() const;
   INLINE size_t get_ram_view_size() const;
   INLINE size_t get_ram_page_size() const;
@@ -499,6 +502,7 @@ PUBLISHED:
   static QualityLevel string_quality_level(const string &str);
     
 public:
+  void *get_ram_mipmap_pointer(int n, PT(MemoryMappedFile) &mapped_file) const;
   void texture_uploaded();
   
   virtual bool has_cull_callback() const;
@@ -553,6 +557,7 @@ protected:
   bool do_read_txo(CData *cdata, istream &in, const string &filename);
   bool do_read_dds_file(CData *cdata, const Filename &fullpath, bool header_only);
   bool do_read_dds(CData *cdata, istream &in, const string &filename, bool header_only);
+  bool do_read_txm_file(CData *cdata, const Filename &fullpath);
 
   bool do_write(CData *cdata, const Filename &fullpath, int z, int n, 
                 bool write_pages, bool write_mipmaps);
@@ -561,6 +566,7 @@ protected:
   bool do_store_one(CData *cdata, PfmFile &pfm, int z, int n);
   bool do_write_txo_file(const CData *cdata, const Filename &fullpath) const;
   bool do_write_txo(const CData *cdata, ostream &out, const string &filename) const;
+  bool do_write_txm_file(CData *cdata, const Filename &fullpath);
 
   virtual CData *unlocked_ensure_ram_image(bool allow_compression);
   virtual void do_reload_ram_image(CData *cdata, bool allow_compression);
@@ -622,6 +628,7 @@ protected:
   CPTA_uchar do_get_uncompressed_ram_image(CData *cdata);
   void do_set_simple_ram_image(CData *cdata, CPTA_uchar image, int x_size, int y_size);
   INLINE size_t do_get_ram_image_size(const CData *cdata) const;
+  INLINE size_t do_get_ram_mipmap_image_size(const CData *cdata, int n) const;
   INLINE bool do_has_ram_mipmap_image(const CData *cdata, int n) const;
   int do_get_expected_num_mipmap_levels(const CData *cdata) const;
   INLINE size_t do_get_expected_ram_image_size(const CData *cdata) const;
@@ -638,6 +645,7 @@ protected:
   INLINE void do_clear_ram_image(CData *cdata);
   void do_clear_simple_ram_image(CData *cdata);
   void do_clear_ram_mipmap_images(CData *cdata);
+  void do_unmap_ram_images(CData *cdata);
   void do_generate_ram_mipmap_images(CData *cdata);
   void do_set_pad_size(CData *cdata, int x, int y, int z);
   virtual bool do_can_reload(const CData *cdata) const;
@@ -659,6 +667,12 @@ protected:
     // If _pointer_image is non-NULL, it represents an external block
     // of memory that is used instead of the above PTA_uchar.
     void *_pointer_image;
+
+    // If _mapped_file is non-NULL, _pointer_image points to
+    // _mapped_size bytes within it, and _image is empty.  See
+    // do_read_txm_file().
+    PT(MemoryMappedFile) _mapped_file;
+    size_t _mapped_size;
   };
 
 private:
@@ -715,6 +729,7 @@ private:
 
   INLINE static bool is_txo_filename(const Filename &fullpath);
   INLINE static bool is_dds_filename(const Filename &fullpath);
+  INLINE static bool is_txm_filename(const Filename &fullpath);
 
   void do_filter_2d_mipmap_pages(const CData *cdata,
                                  RamImage &to, const RamImage &from,
@@ -748,10 +763,28 @@ private:
                                        const unsigned char *&q,
                                        size_t pixel_size, size_t row_size,
                                        size_t page_size);
+
+  class Filter2DJob;
+  class Filter2DJobs;
+  static void filter_2d_rows(const Filter2DJobs &jobs, const Filter2DJob &job);
+  static void filter_2d_job_func(int job_index, Thread *current_thread,
+                                 void *user_data);
+  static void filter_2d_unsigned_byte_row(unsigned char *p,
+                                          const unsigned char *q,
+                                          size_t row_size, int to_x_size,
+                                          int num_components);
   
   bool do_squish(CData *cdata, CompressionMode compression, int squish_flags);
   bool do_unsquish(CData *cdata, int squish_flags);
 
+  class SquishJob;
+  class SquishJobs;
+  static void squish_rows(const SquishJobs &jobs, const SquishJob &job);
+  static void squish_job_func(int job_index, Thread *current_thread,
+                              void *user_data);
+
+  static PT(WorkerThreadPool) get_thread_pool();
+
 protected:
   typedef pvector<RamImage> RamImages;
 
@@ -894,6 +927,9 @@ private:
 
   static AutoTextureScale _textures_power_2;
   static PStatCollector _texture_read_pcollector;
+  static PStatCollector _texture_mipmap_pcollector;
+  static PStatCollector _texture_compress_pcollector;
+  static PStatCollector _texture_unmap_pcollector;
 
   // Datagram stuff
 public:
@@ -48,6 +48,8 @@ PUBLISHED:
   INLINE bool was_image_modified() const;
   INLINE bool was_simple_image_modified() const;
 
+  INLINE int get_residency_level() const;
+
 public:
   INLINE void update_data_size_bytes(size_t new_data_size_bytes);
   INLINE void mark_loaded();
@@ -55,6 +57,10 @@ public:
   INLINE void mark_unloaded();
   INLINE void mark_needs_reload();
 
+  INLINE bool is_residency_managed() const;
+  INLINE void set_residency_level(int level);
+  INLINE bool drop_residency_level();
+
   virtual void output(ostream &out) const;
   virtual void write(ostream &out, int indent_level) const;
 
@@ -67,7 +73,12 @@ private:
   UpdateSeq _properties_modified;
   UpdateSeq _image_modified;
   UpdateSeq _simple_image_modified;
-  
+
+  // The first mipmap level that is to be loaded into graphics memory,
+  // when texture-streaming is in effect.
+  int _residency_level;
+  bool _residency_managed;
+
 public:
   static TypeHandle get_class_type() {
     return _type_handle;
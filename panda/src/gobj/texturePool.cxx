@@ -1088,8 +1088,11 @@ try_load_cache(PT(Texture) &tex, BamCache *cache, const Filename &filename,
                const LoaderOptions &options) {
   if (tex == (Texture *)NULL) {
     // The texture was not supplied by a texture filter.  See if it
-    // can be found in the on-disk cache, if it is active.
-    if ((cache->get_cache_textures() || cache->get_cache_compressed_textures()) && !textures_header_only) {
+    // can be found in the on-disk cache, if it is active.  A txm file
+    // is never cached, since it is already stored in its final form,
+    // and mapping it is cheaper than reading any cache record.
+    if ((cache->get_cache_textures() || cache->get_cache_compressed_textures()) && !textures_header_only &&
+        downcase(filename.get_extension()) != "txm") {
       record = cache->lookup(filename, "txo");
       if (record != (BamCacheRecord *)NULL) {
         if (record->has_data()) {
@@ -0,0 +1,227 @@
+// Filename: textureResidencyManager.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "textureResidencyManager.h"
+#include "textureContext.h"
+#include "preparedGraphicsObjects.h"
+#include "config_gobj.h"
+#include "lightMutexHolder.h"
+#include "pStatTimer.h"
+#include "cmath.h"
+#include <algorithm>
+
+PStatCollector TextureResidencyManager::_update_pcollector("Draw:Texture streaming");
+
+////////////////////////////////////////////////////////////////////
+//     Function: TextureResidencyManager::Constructor
+//       Access: Public
+//  Description:
+////////////////////////////////////////////////////////////////////
+TextureResidencyManager::
+TextureResidencyManager() :
+  _num_upgrades(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TextureResidencyManager::request_size
+//       Access: Public
+//  Description: Records that the indicated texture is being drawn
+//               this frame across the indicated number of pixels on
+//               screen.  This may be called from any thread, and any
+//               number of times per texture; the largest size seen
+//               before the next update() is the one that counts.
+////////////////////////////////////////////////////////////////////
+void TextureResidencyManager::
+request_size(Texture *tex, PN_stdfloat pixels) {
+  LightMutexHolder holder(_lock);
+  pair<Requests::iterator, bool> result =
+    _requests.insert(Requests::value_type(tex, pixels));
+  if (!result.second && pixels > (*result.first).second) {
+    (*result.first).second = pixels;
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TextureResidencyManager::init_context
+//       Access: Public
+//  Description: Called by PreparedGraphicsObjects when a new
+//               TextureContext is created, this sets its residency
+//               level so that only the small mipmap levels of the
+//               texture are loaded the first time.
+////////////////////////////////////////////////////////////////////
+void TextureResidencyManager::
+init_context(TextureContext *tc) const {
+  Texture *tex = tc->get_texture();
+  if (is_streamable(tex)) {
+    tc->set_residency_level(get_initial_level(tex));
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TextureResidencyManager::update
+//       Access: Public
+//  Description: Called by the GSG at the end of each frame, in the
+//               draw thread, this compares the sizes requested since
+//               the last call with the mipmap levels that are loaded,
+//               and asks the most needful textures to load their
+//               larger levels, up to texture-streaming-max-upgrades
+//               textures per frame, and only so far as the graphics
+//               memory limit allows.
+////////////////////////////////////////////////////////////////////
+void TextureResidencyManager::
+update(PreparedGraphicsObjects *pgo, GraphicsStateGuardianBase *gsg) {
+  PStatTimer timer(_update_pcollector);
+
+  Requests requests;
+  {
+    LightMutexHolder holder(_lock);
+    requests.swap(_requests);
+  }
+
+  Candidates candidates;
+  Requests::const_iterator ri;
+  for (ri = requests.begin(); ri != requests.end(); ++ri) {
+    Texture *tex = (*ri).first;
+    if (!is_streamable(tex)) {
+      continue;
+    }
+    int level = get_level_for_size(tex, (*ri).second);
+
+    int num_views = tex->get_num_views();
+    for (int view = 0; view < num_views; ++view) {
+      TextureContext *tc = tex->prepare_now(view, pgo, gsg);
+      if (tc == (TextureContext *)NULL || !tc->is_residency_managed()) {
+        continue;
+      }
+      int gain = tc->get_residency_level() - level;
+      if (gain > 0) {
+        candidates.push_back(Candidate(tc, level, gain));
+      }
+    }
+  }
+
+  sort(candidates.begin(), candidates.end());
+
+  const AdaptiveLru &lru = pgo->_graphics_memory_lru;
+  size_t total_size = lru.get_total_size();
+  size_t max_size = lru.get_max_size();
+  int max_upgrades = texture_streaming_max_upgrades;
+
+  _num_upgrades = 0;
+  Candidates::const_iterator ci;
+  for (ci = candidates.begin();
+       ci != candidates.end() && _num_upgrades < max_upgrades;
+       ++ci) {
+    TextureContext *tc = (*ci)._tc;
+    size_t new_size = estimate_level_size(tc->get_texture(), (*ci)._level);
+    size_t old_size = tc->get_data_size_bytes();
+    if (new_size > old_size) {
+      size_t cost = new_size - old_size;
+      if (total_size + cost > max_size || total_size + cost < total_size) {
+        // This one won't fit; perhaps a smaller one will.
+        continue;
+      }
+      total_size += cost;
+    }
+
+    tc->set_residency_level((*ci)._level);
+    ++_num_upgrades;
+  }
+
+  if (gobj_cat.is_debug() && _num_upgrades != 0) {
+    gobj_cat.debug()
+      << "Texture streaming: " << _num_upgrades << " of "
+      << candidates.size() << " textures upgraded, "
+      << total_size << " of " << max_size << " bytes\n";
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TextureResidencyManager::is_streamable
+//       Access: Public, Static
+//  Description: Returns true if the indicated texture may be loaded
+//               progressively, or false if it must always be loaded
+//               in full.  Only mipmapped textures that are loaded
+//               from RAM are streamed.
+////////////////////////////////////////////////////////////////////
+bool TextureResidencyManager::
+is_streamable(Texture *tex) {
+  return tex->uses_mipmaps() && !tex->get_render_to_texture() &&
+    tex->get_expected_num_mipmap_levels() > 1;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TextureResidencyManager::get_initial_level
+//       Access: Public, Static
+//  Description: Returns the first mipmap level of the indicated
+//               texture that is no larger than
+//               texture-streaming-initial-size.
+////////////////////////////////////////////////////////////////////
+int TextureResidencyManager::
+get_initial_level(Texture *tex) {
+  int num_levels = tex->get_expected_num_mipmap_levels();
+  int initial_size = max((int)texture_streaming_initial_size, 1);
+
+  int level = 0;
+  while (level < num_levels - 1 &&
+         max(tex->get_expected_mipmap_x_size(level),
+             tex->get_expected_mipmap_y_size(level)) > initial_size) {
+    ++level;
+  }
+  return level;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TextureResidencyManager::get_level_for_size
+//       Access: Public, Static
+//  Description: Returns the first mipmap level of the indicated
+//               texture that is needed to draw it across the
+//               indicated number of pixels on screen, allowing for
+//               texture-streaming-lod-bias.
+////////////////////////////////////////////////////////////////////
+int TextureResidencyManager::
+get_level_for_size(Texture *tex, PN_stdfloat pixels) {
+  int num_levels = tex->get_expected_num_mipmap_levels();
+  int size = max(tex->get_x_size(), tex->get_y_size());
+  if (pixels <= 0.0f || size <= 0) {
+    return num_levels - 1;
+  }
+
+  double lod = log((double)size / (double)pixels) / log(2.0) +
+    texture_streaming_lod_bias;
+  int level = (int)floor(lod);
+  return max(min(level, num_levels - 1), 0);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TextureResidencyManager::estimate_level_size
+//       Access: Private, Static
+//  Description: Returns roughly the number of bytes of graphics
+//               memory the indicated texture will occupy when it is
+//               loaded from the indicated mipmap level down.
+////////////////////////////////////////////////////////////////////
+size_t TextureResidencyManager::
+estimate_level_size(Texture *tex, int level) {
+  size_t full_size = tex->estimate_texture_memory();
+  if (level <= 0) {
+    return full_size;
+  }
+
+  double x_scale = (double)tex->get_expected_mipmap_x_size(level) /
+    (double)max(tex->get_x_size(), 1);
+  double y_scale = (double)tex->get_expected_mipmap_y_size(level) /
+    (double)max(tex->get_y_size(), 1);
+  return (size_t)((double)full_size * x_scale * y_scale);
+}
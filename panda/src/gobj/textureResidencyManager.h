@@ -0,0 +1,97 @@
+// Filename: textureResidencyManager.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef TEXTURERESIDENCYMANAGER_H
+#define TEXTURERESIDENCYMANAGER_H
+
+#include "pandabase.h"
+#include "referenceCount.h"
+#include "texture.h"
+#include "pointerTo.h"
+#include "pmap.h"
+#include "lightMutex.h"
+#include "pStatCollector.h"
+
+class PreparedGraphicsObjects;
+class GraphicsStateGuardianBase;
+class TextureContext;
+
+////////////////////////////////////////////////////////////////////
+//       Class : TextureResidencyManager
+// Description : This object decides how much of each mipmapped
+//               texture should be kept in graphics memory, when
+//               texture-streaming is enabled.  There is one for each
+//               PreparedGraphicsObjects.
+//
+//               A texture is first loaded only from the mipmap level
+//               that is no larger than texture-streaming-initial-size.
+//               Each frame, the cull traversal reports the largest
+//               size on screen at which each texture is drawn, via
+//               request_size(); at the end of the frame, update()
+//               asks for the larger mipmap levels of the textures that
+//               need them, a few at a time, as long as they fit
+//               within graphics-memory-limit.  The GSG then reloads
+//               those textures as it would any modified texture,
+//               which happens in a sub-thread if allow-incomplete-render
+//               is in effect, while the smaller version remains on the
+//               card in the meantime.
+//
+//               When the graphics memory LRU evicts a texture, the
+//               texture's residency level is reduced by one, so that
+//               it comes back at half its previous size when it is
+//               next rendered.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_GOBJ TextureResidencyManager : public ReferenceCount {
+public:
+  TextureResidencyManager();
+
+  INLINE int get_num_upgrades() const;
+
+  void request_size(Texture *tex, PN_stdfloat pixels);
+  void init_context(TextureContext *tc) const;
+  void update(PreparedGraphicsObjects *pgo, GraphicsStateGuardianBase *gsg);
+
+  static bool is_streamable(Texture *tex);
+  static int get_initial_level(Texture *tex);
+  static int get_level_for_size(Texture *tex, PN_stdfloat pixels);
+
+private:
+  static size_t estimate_level_size(Texture *tex, int level);
+
+  // The largest size on screen, in pixels, at which each texture has
+  // been seen since the last update().
+  typedef pmap<PT(Texture), PN_stdfloat> Requests;
+  Requests _requests;
+  LightMutex _lock;
+
+  // A texture that would like to load a larger mipmap level.
+  class Candidate {
+  public:
+    INLINE Candidate(TextureContext *tc, int level, int gain);
+    INLINE bool operator < (const Candidate &other) const;
+
+    TextureContext *_tc;
+    int _level;
+    int _gain;
+  };
+  typedef pvector<Candidate> Candidates;
+
+  int _num_upgrades;
+
+  static PStatCollector _update_pcollector;
+};
+
+#include "textureResidencyManager.I"
+
+#endif
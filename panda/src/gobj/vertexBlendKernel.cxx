@@ -0,0 +1,444 @@
+// Filename: vertexBlendKernel.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "vertexBlendKernel.h"
+#include "config_gobj.h"
+#include "string_utils.h"
+#include "cpuFeatures.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VERTEXBLENDKERNEL_SSE2
+#endif
+
+// The AVX2 kernel is compiled regardless of the compiler's target
+// options, and only called if the CPU turns out to support it.
+#if defined(__GNUC__) && !defined(__clang__) && \
+  (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)) && \
+  (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define VERTEXBLENDKERNEL_AVX2
+#define AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define VERTEXBLENDKERNEL_AVX2
+#define AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && _MSC_VER >= 1700 && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#define VERTEXBLENDKERNEL_AVX2
+#define AVX2_TARGET
+#endif
+
+AtomicAdjust::Integer VertexBlendKernel::_best_kernel = VertexBlendKernel::K_auto;
+AtomicAdjust::Integer VertexBlendKernel::_warned_kernel = VertexBlendKernel::K_auto;
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::get_kernel
+//       Access: Public, Static
+//  Description: Returns the kernel that should be used to animate
+//               vertices, according to the vertex-blend-kernel config
+//               variable and the capabilities of the CPU.  This never
+//               returns K_auto, but it may return K_none.  If the
+//               config variable names a kernel the CPU doesn't
+//               support, the best supported kernel is returned
+//               instead; the variable itself is left alone.
+////////////////////////////////////////////////////////////////////
+VertexBlendKernel::Kernel VertexBlendKernel::
+get_kernel() {
+  Kernel kernel = vertex_blend_kernel;
+  if (kernel == K_auto) {
+    return get_best_kernel();
+  }
+  if (!is_kernel_supported(kernel)) {
+    // Only warn the first time we see each unsupported setting, since
+    // this is called every time vertices are animated.
+    if (AtomicAdjust::get(_warned_kernel) != kernel &&
+        AtomicAdjust::set(_warned_kernel, kernel) != kernel) {
+      gobj_cat.warning()
+        << "vertex-blend-kernel " << kernel
+        << " is not supported on this CPU.\n";
+    }
+    return get_best_kernel();
+  }
+  return kernel;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::get_best_kernel
+//       Access: Public, Static
+//  Description: Returns the fastest kernel supported by the CPU.
+////////////////////////////////////////////////////////////////////
+VertexBlendKernel::Kernel VertexBlendKernel::
+get_best_kernel() {
+  Kernel kernel = (Kernel)AtomicAdjust::get(_best_kernel);
+  if (kernel == K_auto) {
+    // It doesn't matter if two threads get here at once; they will
+    // both come up with the same answer.
+    if (is_kernel_supported(K_avx2)) {
+      kernel = K_avx2;
+    } else {
+#ifdef VERTEXBLENDKERNEL_SSE2
+      kernel = K_sse2;
+#else
+      kernel = K_scalar;
+#endif
+    }
+    if (AtomicAdjust::set(_best_kernel, kernel) == K_auto &&
+        gobj_cat.is_debug()) {
+      gobj_cat.debug()
+        << "Using " << kernel << " vertex blend kernel.\n";
+    }
+  }
+  return kernel;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::is_kernel_supported
+//       Access: Public, Static
+//  Description: Returns true if the indicated kernel may be used on
+//               this machine.
+////////////////////////////////////////////////////////////////////
+bool VertexBlendKernel::
+is_kernel_supported(Kernel kernel) {
+  switch (kernel) {
+  case K_none:
+  case K_auto:
+  case K_scalar:
+    return true;
+
+  case K_sse2:
+#ifdef VERTEXBLENDKERNEL_SSE2
+    return true;
+#else
+    return false;
+#endif
+
+  case K_avx2:
+#ifdef VERTEXBLENDKERNEL_AVX2
+    return CPUFeatures::has_avx2();
+#else
+    return false;
+#endif
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::pack_matrix
+//       Access: Public, Static
+//  Description: Stores the upper 4x3 of the indicated matrix into
+//               matrix_size consecutive floats, in the form expected
+//               by the kernels.  The blend table passed to
+//               xform_points3f() is simply the packed matrix of each
+//               blend, one after the other, in order of blend index.
+////////////////////////////////////////////////////////////////////
+void VertexBlendKernel::
+pack_matrix(float *dest, const LMatrix4 &mat) {
+  for (int i = 0; i < 4; ++i) {
+    dest[i * 3 + 0] = (float)mat(i, 0);
+    dest[i * 3 + 1] = (float)mat(i, 1);
+    dest[i * 3 + 2] = (float)mat(i, 2);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::xform_points3f
+//       Access: Public, Static
+//  Description: Transforms each of the three-component float points
+//               from begin_row up to but not including end_row, by
+//               the matrix in blend_table indicated by the
+//               corresponding entry in blendt.  datat points to the
+//               first component of row 0.
+////////////////////////////////////////////////////////////////////
+void VertexBlendKernel::
+xform_points3f(Kernel kernel, unsigned char *datat, size_t stride,
+               const unsigned short *blendt, int begin_row, int end_row,
+               const float *blend_table) {
+  switch (kernel) {
+  case K_avx2:
+    avx2_xform(datat, stride, blendt, begin_row, end_row, blend_table, true);
+    break;
+
+  case K_sse2:
+    sse2_xform(datat, stride, blendt, begin_row, end_row, blend_table, true);
+    break;
+
+  default:
+    scalar_xform(datat, stride, blendt, begin_row, end_row, blend_table, true);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::xform_vectors3f
+//       Access: Public, Static
+//  Description: As xform_points3f(), but the values are transformed
+//               as vectors, ignoring the translation component of
+//               each matrix.
+////////////////////////////////////////////////////////////////////
+void VertexBlendKernel::
+xform_vectors3f(Kernel kernel, unsigned char *datat, size_t stride,
+                const unsigned short *blendt, int begin_row, int end_row,
+                const float *blend_table) {
+  switch (kernel) {
+  case K_avx2:
+    avx2_xform(datat, stride, blendt, begin_row, end_row, blend_table, false);
+    break;
+
+  case K_sse2:
+    sse2_xform(datat, stride, blendt, begin_row, end_row, blend_table, false);
+    break;
+
+  default:
+    scalar_xform(datat, stride, blendt, begin_row, end_row, blend_table, false);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::scalar_xform
+//       Access: Private, Static
+//  Description: The portable implementation, one vertex at a time.
+//               This is also used to finish up the last few vertices
+//               for the SIMD implementations.
+////////////////////////////////////////////////////////////////////
+void VertexBlendKernel::
+scalar_xform(unsigned char *datat, size_t stride,
+             const unsigned short *blendt, int begin_row, int end_row,
+             const float *blend_table, bool is_point) {
+  float w = is_point ? 1.0f : 0.0f;
+  for (int r = begin_row; r < end_row; ++r) {
+    float *v = (float *)(datat + r * stride);
+    const float *m = blend_table + blendt[r] * matrix_size;
+    float x = v[0];
+    float y = v[1];
+    float z = v[2];
+    v[0] = x * m[0] + y * m[3] + z * m[6] + w * m[9];
+    v[1] = x * m[1] + y * m[4] + z * m[7] + w * m[10];
+    v[2] = x * m[2] + y * m[5] + z * m[8] + w * m[11];
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::sse2_xform
+//       Access: Private, Static
+//  Description: Transforms four vertices at a time.  The components
+//               of the four vertices are gathered into one register
+//               per component, and likewise for each element of the
+//               four vertices' matrices.  Since neighboring vertices
+//               very often share a blend, we can usually just
+//               broadcast the elements of a single matrix instead.
+////////////////////////////////////////////////////////////////////
+void VertexBlendKernel::
+sse2_xform(unsigned char *datat, size_t stride,
+           const unsigned short *blendt, int begin_row, int end_row,
+           const float *blend_table, bool is_point) {
+#ifdef VERTEXBLENDKERNEL_SSE2
+  int r = begin_row;
+  for (; r + 4 <= end_row; r += 4) {
+    float *v0 = (float *)(datat + r * stride);
+    float *v1 = (float *)(datat + (r + 1) * stride);
+    float *v2 = (float *)(datat + (r + 2) * stride);
+    float *v3 = (float *)(datat + (r + 3) * stride);
+
+    __m128 x = _mm_set_ps(v3[0], v2[0], v1[0], v0[0]);
+    __m128 y = _mm_set_ps(v3[1], v2[1], v1[1], v0[1]);
+    __m128 z = _mm_set_ps(v3[2], v2[2], v1[2], v0[2]);
+
+    __m128 m[matrix_size];
+    const float *m0 = blend_table + blendt[r] * matrix_size;
+    if (blendt[r] == blendt[r + 1] && blendt[r] == blendt[r + 2] &&
+        blendt[r] == blendt[r + 3]) {
+      for (int k = 0; k < matrix_size; ++k) {
+        m[k] = _mm_set1_ps(m0[k]);
+      }
+    } else {
+      const float *m1 = blend_table + blendt[r + 1] * matrix_size;
+      const float *m2 = blend_table + blendt[r + 2] * matrix_size;
+      const float *m3 = blend_table + blendt[r + 3] * matrix_size;
+      for (int k = 0; k < matrix_size; ++k) {
+        m[k] = _mm_set_ps(m3[k], m2[k], m1[k], m0[k]);
+      }
+    }
+
+    __m128 ox = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m[0]), _mm_mul_ps(y, m[3])),
+                           _mm_mul_ps(z, m[6]));
+    __m128 oy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m[1]), _mm_mul_ps(y, m[4])),
+                           _mm_mul_ps(z, m[7]));
+    __m128 oz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m[2]), _mm_mul_ps(y, m[5])),
+                           _mm_mul_ps(z, m[8]));
+    if (is_point) {
+      ox = _mm_add_ps(ox, m[9]);
+      oy = _mm_add_ps(oy, m[10]);
+      oz = _mm_add_ps(oz, m[11]);
+    }
+
+    float rx[4], ry[4], rz[4];
+    _mm_storeu_ps(rx, ox);
+    _mm_storeu_ps(ry, oy);
+    _mm_storeu_ps(rz, oz);
+    v0[0] = rx[0]; v0[1] = ry[0]; v0[2] = rz[0];
+    v1[0] = rx[1]; v1[1] = ry[1]; v1[2] = rz[1];
+    v2[0] = rx[2]; v2[1] = ry[2]; v2[2] = rz[2];
+    v3[0] = rx[3]; v3[1] = ry[3]; v3[2] = rz[3];
+  }
+
+  scalar_xform(datat, stride, blendt, r, end_row, blend_table, is_point);
+
+#else  // VERTEXBLENDKERNEL_SSE2
+  scalar_xform(datat, stride, blendt, begin_row, end_row, blend_table, is_point);
+#endif  // VERTEXBLENDKERNEL_SSE2
+}
+
+#ifdef VERTEXBLENDKERNEL_AVX2
+////////////////////////////////////////////////////////////////////
+//     Function: avx2_xform_impl
+//  Description: The body of VertexBlendKernel::avx2_xform().  This is
+//               a separate function so that it alone may be compiled
+//               for AVX2.
+//
+//               Eight vertices are transformed at a time.  The
+//               components of the vertices and the elements of their
+//               matrices are fetched with gather instructions, using
+//               the vertex stride and the blend indices as offsets.
+////////////////////////////////////////////////////////////////////
+static AVX2_TARGET void
+avx2_xform_impl(unsigned char *datat, size_t stride,
+                const unsigned short *blendt, int &r, int end_row,
+                const float *blend_table, bool is_point) {
+  int istride = (int)stride;
+  __m256i row_offsets = _mm256_setr_epi32(0, istride, istride * 2, istride * 3,
+                                          istride * 4, istride * 5,
+                                          istride * 6, istride * 7);
+  __m256i matrix_size = _mm256_set1_epi32(VertexBlendKernel::matrix_size);
+
+  for (; r + 8 <= end_row; r += 8) {
+    unsigned char *base = datat + r * stride;
+    __m256 x = _mm256_i32gather_ps((const float *)base, row_offsets, 1);
+    __m256 y = _mm256_i32gather_ps((const float *)(base + 4), row_offsets, 1);
+    __m256 z = _mm256_i32gather_ps((const float *)(base + 8), row_offsets, 1);
+
+    __m128i blend16 = _mm_loadu_si128((const __m128i *)(blendt + r));
+    __m256i m_offsets = _mm256_mullo_epi32(_mm256_cvtepu16_epi32(blend16),
+                                           matrix_size);
+
+#define GATHER_M(k) _mm256_i32gather_ps(blend_table + (k), m_offsets, 4)
+    __m256 ox = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, GATHER_M(0)),
+                                            _mm256_mul_ps(y, GATHER_M(3))),
+                              _mm256_mul_ps(z, GATHER_M(6)));
+    __m256 oy = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, GATHER_M(1)),
+                                            _mm256_mul_ps(y, GATHER_M(4))),
+                              _mm256_mul_ps(z, GATHER_M(7)));
+    __m256 oz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, GATHER_M(2)),
+                                            _mm256_mul_ps(y, GATHER_M(5))),
+                              _mm256_mul_ps(z, GATHER_M(8)));
+    if (is_point) {
+      ox = _mm256_add_ps(ox, GATHER_M(9));
+      oy = _mm256_add_ps(oy, GATHER_M(10));
+      oz = _mm256_add_ps(oz, GATHER_M(11));
+    }
+#undef GATHER_M
+
+    // There's no scatter instruction in AVX2, so write the results
+    // back one vertex at a time.
+    float rx[8], ry[8], rz[8];
+    _mm256_storeu_ps(rx, ox);
+    _mm256_storeu_ps(ry, oy);
+    _mm256_storeu_ps(rz, oz);
+    for (int i = 0; i < 8; ++i) {
+      float *v = (float *)(base + i * stride);
+      v[0] = rx[i];
+      v[1] = ry[i];
+      v[2] = rz[i];
+    }
+  }
+
+  _mm256_zeroupper();
+}
+#endif  // VERTEXBLENDKERNEL_AVX2
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::avx2_xform
+//       Access: Private, Static
+//  Description: Transforms eight vertices at a time, if the CPU
+//               supports AVX2.  The caller should already have
+//               checked this with is_kernel_supported().
+////////////////////////////////////////////////////////////////////
+void VertexBlendKernel::
+avx2_xform(unsigned char *datat, size_t stride,
+           const unsigned short *blendt, int begin_row, int end_row,
+           const float *blend_table, bool is_point) {
+  int r = begin_row;
+#ifdef VERTEXBLENDKERNEL_AVX2
+  // The gather offsets are 32-bit, so the stride must be small enough
+  // that eight rows fit.
+  if (stride <= 0x0fffffff) {
+    avx2_xform_impl(datat, stride, blendt, r, end_row, blend_table, is_point);
+  }
+#endif  // VERTEXBLENDKERNEL_AVX2
+  sse2_xform(datat, stride, blendt, r, end_row, blend_table, is_point);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::Kernel output operator
+//  Description:
+////////////////////////////////////////////////////////////////////
+ostream &
+operator << (ostream &out, VertexBlendKernel::Kernel kernel) {
+  switch (kernel) {
+  case VertexBlendKernel::K_none:
+    return out << "none";
+
+  case VertexBlendKernel::K_auto:
+    return out << "auto";
+
+  case VertexBlendKernel::K_scalar:
+    return out << "scalar";
+
+  case VertexBlendKernel::K_sse2:
+    return out << "sse2";
+
+  case VertexBlendKernel::K_avx2:
+    return out << "avx2";
+  }
+
+  return out << "**invalid VertexBlendKernel::Kernel (" << (int)kernel << ")**";
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexBlendKernel::Kernel input operator
+//  Description:
+////////////////////////////////////////////////////////////////////
+istream &
+operator >> (istream &in, VertexBlendKernel::Kernel &kernel) {
+  string word;
+  in >> word;
+
+  if (cmp_nocase(word, "none") == 0) {
+    kernel = VertexBlendKernel::K_none;
+  } else if (cmp_nocase(word, "auto") == 0) {
+    kernel = VertexBlendKernel::K_auto;
+  } else if (cmp_nocase(word, "scalar") == 0) {
+    kernel = VertexBlendKernel::K_scalar;
+  } else if (cmp_nocase(word, "sse2") == 0) {
+    kernel = VertexBlendKernel::K_sse2;
+  } else if (cmp_nocase(word, "avx2") == 0) {
+    kernel = VertexBlendKernel::K_avx2;
+  } else {
+    gobj_cat->error()
+      << "Invalid VertexBlendKernel::Kernel value: " << word << "\n";
+    kernel = VertexBlendKernel::K_auto;
+  }
+
+  return in;
+}
@@ -0,0 +1,96 @@
+// Filename: vertexBlendKernel.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef VERTEXBLENDKERNEL_H
+#define VERTEXBLENDKERNEL_H
+
+#include "pandabase.h"
+#include "luse.h"
+#include "atomicAdjust.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : VertexBlendKernel
+// Description : A set of low-level routines used by
+//               GeomVertexData::animate_vertices() to apply the
+//               matrices of a TransformBlendTable to a column of
+//               32-bit float three-component points or vectors.
+//
+//               Rather than looking up the TransformBlend for each
+//               run of vertices, the caller first packs the matrices
+//               of all of the blends into a single array of floats
+//               with pack_matrix(); the kernel then transforms the
+//               vertices several at a time, fetching the matrix for
+//               each vertex directly from that array by its blend
+//               index.
+//
+//               There are several implementations of each kernel;
+//               the fastest one supported by the CPU is chosen at
+//               runtime, unless the vertex-blend-kernel config
+//               variable says otherwise.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_GOBJ VertexBlendKernel {
+public:
+  enum Kernel {
+    // Don't use a kernel at all; transform each run of vertices that
+    // shares a blend with a separate matrix multiply, as before.
+    K_none,
+
+    K_auto,
+    K_scalar,
+    K_sse2,
+    K_avx2,
+  };
+
+  // The number of floats pack_matrix() stores for each blend.
+  enum { matrix_size = 12 };
+
+  static Kernel get_kernel();
+  static Kernel get_best_kernel();
+  static bool is_kernel_supported(Kernel kernel);
+
+  static void pack_matrix(float *dest, const LMatrix4 &mat);
+
+  static void xform_points3f(Kernel kernel, unsigned char *datat,
+                             size_t stride, const unsigned short *blendt,
+                             int begin_row, int end_row,
+                             const float *blend_table);
+  static void xform_vectors3f(Kernel kernel, unsigned char *datat,
+                              size_t stride, const unsigned short *blendt,
+                              int begin_row, int end_row,
+                              const float *blend_table);
+
+private:
+  static void scalar_xform(unsigned char *datat, size_t stride,
+                           const unsigned short *blendt,
+                           int begin_row, int end_row,
+                           const float *blend_table, bool is_point);
+  static void sse2_xform(unsigned char *datat, size_t stride,
+                         const unsigned short *blendt,
+                         int begin_row, int end_row,
+                         const float *blend_table, bool is_point);
+  static void avx2_xform(unsigned char *datat, size_t stride,
+                         const unsigned short *blendt,
+                         int begin_row, int end_row,
+                         const float *blend_table, bool is_point);
+
+  // These are stored as Kernel values, and may be read and written
+  // by several animating threads at once.
+  static AtomicAdjust::Integer _best_kernel;
+  static AtomicAdjust::Integer _warned_kernel;
+};
+
+EXPCL_PANDA_GOBJ ostream &operator << (ostream &out, VertexBlendKernel::Kernel kernel);
+EXPCL_PANDA_GOBJ istream &operator >> (istream &in, VertexBlendKernel::Kernel &kernel);
+
+#endif
@@ -43,9 +43,65 @@ operator = (const VertexDataBuffer &copy) {
   _size = copy._size;
   _reserved_size = copy._size;
   _block = copy._block;
+  _shared_array = copy._shared_array;
+  _shared_file = copy._shared_file;
+  _shared_data = copy._shared_data;
   nassertv(_reserved_size >= _size);
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: VertexDataBuffer::share_data
+//       Access: Public
+//  Description: Replaces the contents of the buffer with the size
+//               bytes beginning at start within the indicated array,
+//               without copying them.  The buffer keeps a reference
+//               to the array, and reads directly from it until the
+//               buffer is modified, at which point the bytes are
+//               copied into independent memory.
+//
+//               This is intended for reading a large array out of a
+//               Datagram, which is never modified once it has been
+//               read.
+////////////////////////////////////////////////////////////////////
+void VertexDataBuffer::
+share_data(CPTA_uchar array, size_t start, size_t size) {
+  LightMutexHolder holder(_lock);
+  nassertv(start + size <= array.size());
+
+  do_unclean_realloc(0);
+  if (size != 0) {
+    _shared_array = array;
+    _shared_data = array.p() + start;
+    _size = size;
+    _reserved_size = size;
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: VertexDataBuffer::share_data
+//       Access: Public
+//  Description: Replaces the contents of the buffer with the entire
+//               contents of the indicated file, which should already
+//               be open, without copying them.  The buffer keeps a
+//               reference to the file, and reads directly from it
+//               until the buffer is modified, at which point the
+//               bytes are copied into independent memory.
+////////////////////////////////////////////////////////////////////
+void VertexDataBuffer::
+share_data(MemoryMappedFile *file) {
+  LightMutexHolder holder(_lock);
+  nassertv(file != (MemoryMappedFile *)NULL && file->is_open());
+
+  do_unclean_realloc(0);
+  size_t size = file->get_size();
+  if (size != 0) {
+    _shared_file = file;
+    _shared_data = file->get_data();
+    _size = size;
+    _reserved_size = size;
+  }
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: VertexDataBuffer::swap
 //       Access: Public
@@ -61,16 +117,25 @@ swap(VertexDataBuffer &other) {
   size_t size = _size;
   size_t reserved_size = _reserved_size;
   PT(VertexDataBlock) block = _block;
+  CPTA_uchar shared_array = _shared_array;
+  PT(MemoryMappedFile) shared_file = _shared_file;
+  const unsigned char *shared_data = _shared_data;
 
   _resident_data = other._resident_data;
   _size = other._size;
   _reserved_size = other._reserved_size;
   _block = other._block;
+  _shared_array = other._shared_array;
+  _shared_file = other._shared_file;
+  _shared_data = other._shared_data;
 
   other._resident_data = resident_data;
   other._size = size;
   other._reserved_size = reserved_size;
   other._block = block;
+  other._shared_array = shared_array;
+  other._shared_file = shared_file;
+  other._shared_data = shared_data;
   nassertv(_reserved_size >= _size);
 }
 
@@ -134,8 +199,12 @@ do_unclean_realloc(size_t reserved_size) {
         << this << ".unclean_realloc(" << reserved_size << ")\n";
     }
 
-    // If we're paged out, discard the page.
+    // If we're paged out, discard the page; if we're shared, release
+    // the shared array.
     _block = NULL;
+    _shared_array.clear();
+    _shared_file.clear();
+    _shared_data = NULL;
         
     if (_resident_data != (unsigned char *)NULL) {
       nassertv(_reserved_size != 0);
@@ -176,6 +245,26 @@ do_page_out(VertexDataBook &book) {
     // We're already paged out.
     return;
   }
+
+  if (_shared_file != (MemoryMappedFile *)NULL) {
+    // The file's pages are already backed by the disk; there's no
+    // point in copying them anywhere else.
+    return;
+  }
+
+  if (_shared_data != (const unsigned char *)NULL) {
+    // Copy the shared data directly to the block.
+    _block = book.alloc(_size);
+    nassertv(_block != (VertexDataBlock *)NULL);
+    unsigned char *pointer = _block->get_pointer(true);
+    nassertv(pointer != (unsigned char *)NULL);
+    memcpy(pointer, _shared_data, _size);
+
+    _shared_array.clear();
+    _shared_file.clear();
+    _shared_data = NULL;
+    return;
+  }
   nassertv(_resident_data != (unsigned char *)NULL);
 
   if (_size == 0) {
@@ -207,9 +296,10 @@ do_page_out(VertexDataBook &book) {
 ////////////////////////////////////////////////////////////////////
 //     Function: VertexDataBuffer::do_page_in
 //       Access: Private
-//  Description: Moves the buffer off of its current page and into
-//               independent memory.  If the page is not already
-//               resident, it is forced resident first.
+//  Description: Moves the buffer off of its current page, or out of
+//               its shared array, and into independent memory.  If
+//               the page is not already resident, it is forced
+//               resident first.
 //
 //               Assumes the lock is already held.
 ////////////////////////////////////////////////////////////////////
@@ -220,9 +310,22 @@ do_page_in() {
     return;
   }
 
-  nassertv(_block != (VertexDataBlock *)NULL);
   nassertv(_reserved_size == _size);
 
+  if (_shared_data != (const unsigned char *)NULL) {
+    get_class_type().inc_memory_usage(TypeHandle::MC_array, (int)_size);
+    _resident_data = (unsigned char *)PANDA_MALLOC_ARRAY(_size);
+    nassertv(_resident_data != (unsigned char *)NULL);
+
+    memcpy(_resident_data, _shared_data, _size);
+    _shared_array.clear();
+    _shared_file.clear();
+    _shared_data = NULL;
+    return;
+  }
+
+  nassertv(_block != (VertexDataBlock *)NULL);
+
   get_class_type().inc_memory_usage(TypeHandle::MC_array, (int)_size);
   _resident_data = (unsigned char *)PANDA_MALLOC_ARRAY(_size);
   nassertv(_resident_data != (unsigned char *)NULL);
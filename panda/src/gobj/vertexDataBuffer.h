@@ -19,6 +19,8 @@
 #include "vertexDataBook.h"
 #include "vertexDataBlock.h"
 #include "pointerTo.h"
+#include "pta_uchar.h"
+#include "memoryMappedFile.h"
 #include "virtualFile.h"
 #include "pStatCollector.h"
 #include "lightMutex.h"
@@ -29,7 +31,7 @@
 // Description : A block of bytes that stores the actual raw vertex
 //               data referenced by a GeomVertexArrayData object.
 //
-//               At any point, a buffer may be in any of two states:
+//               At any point, a buffer may be in any of three states:
 //
 //               independent - the buffer's memory is resident, and
 //               owned by the VertexDataBuffer object itself (in
@@ -44,12 +46,25 @@
 //               read-only.  In this state, _reserved_size will always
 //               equal _size.
 //
+//               shared - the buffer's memory is a read-only range
+//               within a PTA_uchar owned by someone else, such as the
+//               Datagram it was read from, or within a
+//               MemoryMappedFile.  The buffer keeps a reference to
+//               the array or file.  In this state, _reserved_size
+//               will always equal _size.
+//
 //               VertexDataBuffers start out in independent state.
 //               They get moved to paged state when their owning
 //               GeomVertexArrayData objects get evicted from the
 //               _independent_lru.  They can get moved back to
 //               independent state if they are modified
 //               (e.g. get_write_pointer() or realloc() is called).
+//               Similarly, a shared buffer is copied into independent
+//               memory the first time it is modified; until then, it
+//               is read directly from the shared array.  A buffer
+//               shared from a MemoryMappedFile is never moved to
+//               paged state, since the operating system can already
+//               discard its pages as needed.
 //
 //               The idea is to keep the highly dynamic and
 //               frequently-modified VertexDataBuffers resident in
@@ -78,6 +93,10 @@ public:
 
   INLINE void page_out(VertexDataBook &book);
 
+  void share_data(CPTA_uchar array, size_t start, size_t size);
+  void share_data(MemoryMappedFile *file);
+  INLINE bool is_shared() const;
+
   void swap(VertexDataBuffer &other);
 
 private:
@@ -91,6 +110,9 @@ private:
   size_t _size;
   size_t _reserved_size;
   PT(VertexDataBlock) _block;
+  CPTA_uchar _shared_array;
+  PT(MemoryMappedFile) _shared_file;
+  const unsigned char *_shared_data;
   LightMutex _lock;
 
 public:
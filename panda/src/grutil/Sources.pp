@@ -25,8 +25,10 @@
     lineSegs.I lineSegs.h \
     multitexReducer.I multitexReducer.h multitexReducer.cxx \
     nodeVertexTransform.I nodeVertexTransform.h \
+    occlusionDepthBuffer.I occlusionDepthBuffer.h \
     pfmVizzer.I pfmVizzer.h \
-    rigidBodyCombiner.I rigidBodyCombiner.h
+    rigidBodyCombiner.I rigidBodyCombiner.h \
+    softOcclusionCullTraverser.I softOcclusionCullTraverser.h
     
   #define INCLUDED_SOURCES \
     cardMaker.cxx \
@@ -40,10 +42,12 @@
     sceneGraphAnalyzerMeter.cxx \
     heightfieldTesselator.cxx \
     nodeVertexTransform.cxx \    
+    occlusionDepthBuffer.cxx \
     pfmVizzer.cxx \
     pipeOcclusionCullTraverser.cxx \
     lineSegs.cxx \
-    rigidBodyCombiner.cxx
+    rigidBodyCombiner.cxx \
+    softOcclusionCullTraverser.cxx
     
   #define INSTALL_HEADERS \
     cardMaker.I cardMaker.h \
@@ -58,10 +62,31 @@
     lineSegs.I lineSegs.h \
     multitexReducer.I multitexReducer.h \
     nodeVertexTransform.I nodeVertexTransform.h \
+    occlusionDepthBuffer.I occlusionDepthBuffer.h \
     pfmVizzer.I pfmVizzer.h \
-    rigidBodyCombiner.I rigidBodyCombiner.h
+    rigidBodyCombiner.I rigidBodyCombiner.h \
+    softOcclusionCullTraverser.I softOcclusionCullTraverser.h
 
   #define IGATESCAN all
 
 #end lib_target
 
+#begin test_bin_target
+  #define TARGET test_occlusion_buffer
+  #define LOCAL_LIBS \
+    p3grutil p3linmath p3putil
+
+  #define SOURCES \
+    test_occlusion_buffer.cxx
+
+#end test_bin_target
+
+#begin test_bin_target
+  #define TARGET test_soft_occlusion
+  #define LOCAL_LIBS \
+    p3grutil p3display p3pgraph p3gobj p3linmath p3putil
+
+  #define SOURCES \
+    test_soft_occlusion.cxx
+
+#end test_bin_target
@@ -24,6 +24,7 @@
 #include "nodeVertexTransform.h"
 #include "rigidBodyCombiner.h"
 #include "pipeOcclusionCullTraverser.h"
+#include "softOcclusionCullTraverser.h"
 
 #include "dconfig.h"
 
@@ -113,6 +114,7 @@ init_libgrutil() {
   NodeVertexTransform::init_type();
   RigidBodyCombiner::init_type();
   PipeOcclusionCullTraverser::init_type();
+  SoftOcclusionCullTraverser::init_type();
   SceneGraphAnalyzerMeter::init_type();
 
 #ifdef HAVE_AUDIO
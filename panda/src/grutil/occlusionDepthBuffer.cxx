@@ -0,0 +1,305 @@
+// Filename: occlusionDepthBuffer.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "occlusionDepthBuffer.h"
+
+#include <float.h>
+#include <math.h>
+
+// The value of a pixel with no occluder in it.
+static const float empty_depth = -FLT_MAX;
+
+// A box is occluded only if the occluders are nearer than its nearest
+// point by at least this fraction, to allow for rounding, so that an
+// occluder lying on the surface of the box does not hide it.
+static const double occlusion_tolerance = 1.0e-5;
+
+////////////////////////////////////////////////////////////////////
+//     Function: pixel_ceil
+//  Description: Returns the first pixel whose center is at or after
+//               the indicated coordinate, clamped to [0, limit].
+////////////////////////////////////////////////////////////////////
+static INLINE int
+pixel_ceil(double v, int limit) {
+  v = ceil(v - 0.5);
+  if (v <= 0.0) {
+    return 0;
+  }
+  if (v >= (double)limit) {
+    return limit;
+  }
+  return (int)v;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: OcclusionDepthBuffer::Constructor
+//       Access: Public
+//  Description:
+////////////////////////////////////////////////////////////////////
+OcclusionDepthBuffer::
+OcclusionDepthBuffer() :
+  _x_size(0),
+  _y_size(0),
+  _x_tiles(0),
+  _y_tiles(0),
+  _num_triangles(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: OcclusionDepthBuffer::set_size
+//       Access: Public
+//  Description: Changes the size of the buffer, and clears it.
+////////////////////////////////////////////////////////////////////
+void OcclusionDepthBuffer::
+set_size(int x_size, int y_size) {
+  _x_size = max(x_size, 1);
+  _y_size = max(y_size, 1);
+  _x_tiles = (_x_size + tile_size - 1) >> tile_bits;
+  _y_tiles = (_y_size + tile_size - 1) >> tile_bits;
+  _depth.resize(_x_size * _y_size);
+  _tile_far.resize(_x_tiles * _y_tiles);
+  clear();
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: OcclusionDepthBuffer::clear
+//       Access: Public
+//  Description: Removes all of the occluders from the buffer.
+////////////////////////////////////////////////////////////////////
+void OcclusionDepthBuffer::
+clear() {
+  fill(_depth.begin(), _depth.end(), empty_depth);
+  fill(_tile_far.begin(), _tile_far.end(), empty_depth);
+  _num_triangles = 0;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: OcclusionDepthBuffer::draw_triangle
+//       Access: Public
+//  Description: Draws an occluder triangle, given in the clip
+//               coordinates of the lens.  The triangle is clipped to
+//               the near plane.  finish() must be called after the
+//               last triangle, before testing any boxes.
+////////////////////////////////////////////////////////////////////
+void OcclusionDepthBuffer::
+draw_triangle(const LVecBase4 &v0, const LVecBase4 &v1,
+              const LVecBase4 &v2) {
+  LVecBase4d in[3] = { LCAST(double, v0), LCAST(double, v1), LCAST(double, v2) };
+
+  // Clip to the near plane, z >= -w, which leaves at most a
+  // quadrilateral.
+  LVecBase4d poly[4];
+  int num_points = 0;
+  for (int i = 0; i < 3; ++i) {
+    const LVecBase4d &a = in[i];
+    const LVecBase4d &b = in[(i + 1) % 3];
+    double da = a[2] + a[3];
+    double db = b[2] + b[3];
+    if (da >= 0.0) {
+      poly[num_points++] = a;
+    }
+    if ((da >= 0.0) != (db >= 0.0)) {
+      poly[num_points++] = a + (b - a) * (da / (da - db));
+    }
+  }
+  if (num_points < 3) {
+    return;
+  }
+
+  LPoint3d p[4];
+  for (int i = 0; i < num_points; ++i) {
+    double w = poly[i][3];
+    if (w <= 0.0) {
+      // A lens without a proper near plane; we can't draw this.
+      return;
+    }
+    p[i].set((poly[i][0] / w + 1.0) * 0.5 * _x_size,
+             (poly[i][1] / w + 1.0) * 0.5 * _y_size,
+             1.0 - poly[i][2] / w);
+  }
+
+  draw_screen_triangle(p[0], p[1], p[2]);
+  if (num_points == 4) {
+    draw_screen_triangle(p[0], p[2], p[3]);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: OcclusionDepthBuffer::finish
+//       Access: Public
+//  Description: Brings the coarse buffer up to date after a series of
+//               draw_triangle() calls.
+////////////////////////////////////////////////////////////////////
+void OcclusionDepthBuffer::
+finish() {
+  for (int ty = 0; ty < _y_tiles; ++ty) {
+    int y0 = ty << tile_bits;
+    int y1 = min(y0 + (int)tile_size, _y_size);
+    for (int tx = 0; tx < _x_tiles; ++tx) {
+      int x0 = tx << tile_bits;
+      int x1 = min(x0 + (int)tile_size, _x_size);
+      float far_depth = FLT_MAX;
+      for (int y = y0; y < y1; ++y) {
+        const float *row = &_depth[y * _x_size];
+        for (int x = x0; x < x1; ++x) {
+          far_depth = min(far_depth, row[x]);
+        }
+      }
+      _tile_far[ty * _x_tiles + tx] = far_depth;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: OcclusionDepthBuffer::is_box_occluded
+//       Access: Public
+//  Description: Returns true if the indicated box, transformed into
+//               clip coordinates by to_clip, lies entirely behind
+//               the occluders drawn so far.  Returns false if any
+//               part of it may be visible, or if it crosses the near
+//               plane or lies entirely outside of the buffer.
+////////////////////////////////////////////////////////////////////
+bool OcclusionDepthBuffer::
+is_box_occluded(const LPoint3 &min_point, const LPoint3 &max_point,
+                const LMatrix4 &to_clip) const {
+  if (_num_triangles == 0) {
+    return false;
+  }
+
+  double sx0 = DBL_MAX, sy0 = DBL_MAX;
+  double sx1 = -DBL_MAX, sy1 = -DBL_MAX;
+  double nearest = -DBL_MAX;
+  for (int i = 0; i < 8; ++i) {
+    LVecBase4 corner((i & 1) ? max_point[0] : min_point[0],
+                     (i & 2) ? max_point[1] : min_point[1],
+                     (i & 4) ? max_point[2] : min_point[2],
+                     1.0f);
+    LVecBase4 c = to_clip.xform(corner);
+    double w = c[3];
+    if (w <= 0.0 || c[2] < -w) {
+      return false;
+    }
+    double x = (c[0] / w + 1.0) * 0.5 * _x_size;
+    double y = (c[1] / w + 1.0) * 0.5 * _y_size;
+    sx0 = min(sx0, x);
+    sx1 = max(sx1, x);
+    sy0 = min(sy0, y);
+    sy1 = max(sy1, y);
+    nearest = max(nearest, 1.0 - c[2] / w);
+  }
+
+  if (sx1 < 0.0 || sy1 < 0.0 || sx0 >= _x_size || sy0 >= _y_size) {
+    return false;
+  }
+
+  // Consider every pixel the box touches, and one more all around,
+  // since the occluders were only sampled at the pixel centers.
+  int px0 = max((int)floor(max(sx0, 0.0)) - 1, 0);
+  int py0 = max((int)floor(max(sy0, 0.0)) - 1, 0);
+  int px1 = min((int)floor(min(sx1, (double)_x_size)) + 1, _x_size - 1);
+  int py1 = min((int)floor(min(sy1, (double)_y_size)) + 1, _y_size - 1);
+  float threshold = (float)(nearest + fabs(nearest) * occlusion_tolerance);
+
+  int tx0 = px0 >> tile_bits;
+  int tx1 = px1 >> tile_bits;
+  int ty1 = py1 >> tile_bits;
+  for (int ty = py0 >> tile_bits; ty <= ty1; ++ty) {
+    int y0 = max(ty << tile_bits, py0);
+    int y1 = min((ty << tile_bits) + (int)tile_size - 1, py1);
+    for (int tx = tx0; tx <= tx1; ++tx) {
+      if (_tile_far[ty * _x_tiles + tx] > threshold) {
+        // Everything in this tile is nearer than the box.
+        continue;
+      }
+      int x0 = max(tx << tile_bits, px0);
+      int x1 = min((tx << tile_bits) + (int)tile_size - 1, px1);
+      for (int y = y0; y <= y1; ++y) {
+        const float *row = &_depth[y * _x_size];
+        for (int x = x0; x <= x1; ++x) {
+          if (row[x] <= threshold) {
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: OcclusionDepthBuffer::draw_screen_triangle
+//       Access: Private
+//  Description: Scans out a triangle in pixel coordinates, with the
+//               stored depth value in z, keeping the nearer value at
+//               each pixel whose center it covers.
+////////////////////////////////////////////////////////////////////
+void OcclusionDepthBuffer::
+draw_screen_triangle(const LPoint3d &p0, const LPoint3d &p1,
+                     const LPoint3d &p2) {
+  // Sort the vertices with increasing y.
+  const LPoint3d *a = &p0, *b = &p1, *c = &p2;
+  if (b->get_y() < a->get_y()) {
+    swap(a, b);
+  }
+  if (c->get_y() < a->get_y()) {
+    swap(a, c);
+  }
+  if (c->get_y() < b->get_y()) {
+    swap(b, c);
+  }
+
+  LVector3d ab = *b - *a;
+  LVector3d ac = *c - *a;
+  double area = ab[0] * ac[1] - ac[0] * ab[1];
+  if (area == 0.0) {
+    return;
+  }
+  ++_num_triangles;
+
+  // The depth is a linear function of the pixel coordinates.
+  double dzdx = (ab[2] * ac[1] - ac[2] * ab[1]) / area;
+  double dzdy = (ab[0] * ac[2] - ac[0] * ab[2]) / area;
+
+  int y0 = pixel_ceil(a->get_y(), _y_size);
+  int y1 = pixel_ceil(c->get_y(), _y_size);
+  for (int y = y0; y < y1; ++y) {
+    double py = y + 0.5;
+
+    // The long edge, from a to c, and whichever short edge spans this
+    // row.
+    double xl = a->get_x() + ac[0] * (py - a->get_y()) / ac[1];
+    double xs;
+    if (py < b->get_y()) {
+      xs = a->get_x() + ab[0] * (py - a->get_y()) / ab[1];
+    } else {
+      xs = b->get_x() + (c->get_x() - b->get_x()) * (py - b->get_y()) / (c->get_y() - b->get_y());
+    }
+    if (xs < xl) {
+      swap(xl, xs);
+    }
+
+    int x0 = pixel_ceil(xl, _x_size);
+    int x1 = pixel_ceil(xs, _x_size);
+    double z = a->get_z() + dzdx * (x0 + 0.5 - a->get_x()) + dzdy * (py - a->get_y());
+    float *row = &_depth[y * _x_size];
+    for (int x = x0; x < x1; ++x) {
+      if (z > row[x]) {
+        row[x] = (float)z;
+      }
+      z += dzdx;
+    }
+  }
+}
@@ -0,0 +1,77 @@
+// Filename: occlusionDepthBuffer.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef OCCLUSIONDEPTHBUFFER_H
+#define OCCLUSIONDEPTHBUFFER_H
+
+#include "pandabase.h"
+#include "luse.h"
+#include "pvector.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : OcclusionDepthBuffer
+// Description : A small depth-only buffer, filled on the CPU, used
+//               by the SoftOcclusionCullTraverser.  Occluder
+//               triangles are scanned out into it a row at a time,
+//               in the manner of the tinydisplay rasterizer, and
+//               bounding boxes are then tested against it to see
+//               whether they are entirely hidden.
+//
+//               The buffer covers the clip-space square [-1, 1] of
+//               the lens, and stores 1 - z of the normalized device
+//               coordinates, so that larger values are nearer; this
+//               keeps its precision for distant objects.  A coarser
+//               buffer of the farthest value in each tile of
+//               tile_size x tile_size pixels allows most boxes to be
+//               tested without visiting individual pixels.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_GRUTIL OcclusionDepthBuffer {
+public:
+  OcclusionDepthBuffer();
+
+  void set_size(int x_size, int y_size);
+  INLINE int get_x_size() const;
+  INLINE int get_y_size() const;
+
+  void clear();
+  void draw_triangle(const LVecBase4 &v0, const LVecBase4 &v1,
+                     const LVecBase4 &v2);
+  void finish();
+
+  INLINE bool is_empty() const;
+  INLINE int get_num_triangles() const;
+  INLINE float get_depth(int x, int y) const;
+
+  bool is_box_occluded(const LPoint3 &min_point, const LPoint3 &max_point,
+                       const LMatrix4 &to_clip) const;
+
+private:
+  void draw_screen_triangle(const LPoint3d &p0, const LPoint3d &p1,
+                            const LPoint3d &p2);
+
+  enum { tile_bits = 3, tile_size = 1 << tile_bits };
+
+  int _x_size, _y_size;
+  int _x_tiles, _y_tiles;
+  int _num_triangles;
+
+  // The nearer a surface, the greater its value here; see above.
+  typedef pvector<float> Depths;
+  Depths _depth;
+  Depths _tile_far;
+};
+
+#include "occlusionDepthBuffer.I"
+
+#endif
@@ -2,7 +2,9 @@
 #include "meshDrawer2D.cxx"
 #include "movieTexture.cxx"
 #include "nodeVertexTransform.cxx"
+#include "occlusionDepthBuffer.cxx"
 #include "pipeOcclusionCullTraverser.cxx"
 #include "pfmVizzer.cxx"
 #include "rigidBodyCombiner.cxx"
+#include "softOcclusionCullTraverser.cxx"
 
@@ -0,0 +1,217 @@
+// Filename: softOcclusionCullTraverser.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "softOcclusionCullTraverser.h"
+#include "cullTraverserData.h"
+#include "cullableObject.h"
+#include "sceneSetup.h"
+#include "lens.h"
+#include "geom.h"
+#include "geomPrimitive.h"
+#include "geomVertexReader.h"
+#include "internalName.h"
+#include "finiteBoundingVolume.h"
+#include "pStatTimer.h"
+#include "configVariableInt.h"
+
+PStatCollector SoftOcclusionCullTraverser::_draw_occlusion_pcollector("Cull:Occlusion:Occluders");
+PStatCollector SoftOcclusionCullTraverser::_occlusion_passed_pcollector("Occlusion results:Visible");
+PStatCollector SoftOcclusionCullTraverser::_occlusion_failed_pcollector("Occlusion results:Occluded");
+PStatCollector SoftOcclusionCullTraverser::_occlusion_tests_pcollector("Occlusion tests");
+
+TypeHandle SoftOcclusionCullTraverser::_type_handle;
+
+static ConfigVariableInt soft_occlusion_size
+("soft-occlusion-size", "256 128",
+ PRC_DESC("Specify the x y size of the depth buffer into which the "
+          "SoftOcclusionCullTraverser draws the occluders.  This need not "
+          "match the aspect ratio of the window; it is stretched to fill "
+          "the lens."));
+
+////////////////////////////////////////////////////////////////////
+//     Function: SoftOcclusionCullTraverser::Constructor
+//       Access: Published
+//  Description:
+////////////////////////////////////////////////////////////////////
+SoftOcclusionCullTraverser::
+SoftOcclusionCullTraverser() :
+  _occlusion_mask(DrawMask::all_off()),
+  _drawn_occluders(false),
+  _dr_incomplete_render(false)
+{
+  if (soft_occlusion_size.get_num_words() < 2) {
+    _buffer.set_size(soft_occlusion_size, soft_occlusion_size);
+  } else {
+    _buffer.set_size(soft_occlusion_size[0], soft_occlusion_size[1]);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: SoftOcclusionCullTraverser::Copy Constructor
+//       Access: Published
+//  Description:
+////////////////////////////////////////////////////////////////////
+SoftOcclusionCullTraverser::
+SoftOcclusionCullTraverser(const SoftOcclusionCullTraverser &copy) :
+  CullTraverser(copy),
+  _occlusion_mask(copy._occlusion_mask),
+  _drawn_occluders(false),
+  _dr_incomplete_render(copy._dr_incomplete_render)
+{
+  _buffer.set_size(copy._buffer.get_x_size(), copy._buffer.get_y_size());
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: SoftOcclusionCullTraverser::set_scene
+//       Access: Published, Virtual
+//  Description: Sets the SceneSetup and GSG for the traversal.  The
+//               occluders are not drawn until the traversal begins,
+//               since the view frustum is not yet known.
+////////////////////////////////////////////////////////////////////
+void SoftOcclusionCullTraverser::
+set_scene(SceneSetup *scene_setup, GraphicsStateGuardianBase *gsg,
+          bool dr_incomplete_render) {
+  CullTraverser::set_scene(scene_setup, gsg, dr_incomplete_render);
+  _dr_incomplete_render = dr_incomplete_render;
+  _buffer.clear();
+  _drawn_occluders = false;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: SoftOcclusionCullTraverser::end_traverse
+//       Access: Published, Virtual
+//  Description: Should be called when the traverser has finished
+//               traversing its scene, this gives it a chance to do
+//               any necessary finalization.
+////////////////////////////////////////////////////////////////////
+void SoftOcclusionCullTraverser::
+end_traverse() {
+  CullTraverser::end_traverse();
+  _drawn_occluders = false;
+
+  _occlusion_passed_pcollector.flush_level();
+  _occlusion_failed_pcollector.flush_level();
+  _occlusion_tests_pcollector.flush_level();
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: SoftOcclusionCullTraverser::is_in_view
+//       Access: Protected, Virtual
+//  Description: Returns true if the current node is within the view
+//               frustum and not hidden behind the occluders, false
+//               otherwise.  This is called for each node that
+//               traverse_below() visits.
+////////////////////////////////////////////////////////////////////
+bool SoftOcclusionCullTraverser::
+is_in_view(CullTraverserData &data) {
+  if (!CullTraverser::is_in_view(data)) {
+    return false;
+  }
+
+  if (!_drawn_occluders) {
+    draw_occluders();
+  }
+  if (_buffer.is_empty()) {
+    return true;
+  }
+
+  CPT(BoundingVolume) vol = data.node_reader()->get_bounds();
+  if (vol->is_empty() || vol->is_infinite() ||
+      !vol->is_of_type(FiniteBoundingVolume::get_class_type())) {
+    return true;
+  }
+  const FiniteBoundingVolume *fvol = DCAST(FiniteBoundingVolume, vol);
+
+  // The bounding volume is in the coordinate space of the node's
+  // parent, which is also the space of the node's net transform.
+  CPT(TransformState) modelview_transform = data.get_modelview_transform(this);
+  LMatrix4 to_clip = modelview_transform->get_mat() * get_scene()->get_lens()->get_projection_mat();
+
+  _occlusion_tests_pcollector.add_level(1);
+  if (_buffer.is_box_occluded(fvol->get_min(), fvol->get_max(), to_clip)) {
+    _occlusion_failed_pcollector.add_level(1);
+    return false;
+  }
+
+  _occlusion_passed_pcollector.add_level(1);
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: SoftOcclusionCullTraverser::draw_occluders
+//       Access: Private
+//  Description: Traverses the scene for the Geoms visible to the
+//               occlusion mask, and draws them into the depth buffer.
+////////////////////////////////////////////////////////////////////
+void SoftOcclusionCullTraverser::
+draw_occluders() {
+  _drawn_occluders = true;
+  _buffer.clear();
+
+  SceneSetup *scene = get_scene();
+  if (_occlusion_mask.is_zero() || scene == (SceneSetup *)NULL ||
+      scene->get_lens() == (Lens *)NULL) {
+    return;
+  }
+
+  PStatTimer timer(_draw_occlusion_pcollector);
+
+  OccluderHandler handler(_buffer, scene->get_lens()->get_projection_mat());
+  PT(CullTraverser) trav = new CullTraverser;
+  trav->set_cull_handler(&handler);
+  trav->set_scene(scene, get_gsg(), _dr_incomplete_render);
+  trav->set_view_frustum(get_view_frustum());
+  trav->set_camera_mask(_occlusion_mask);
+  trav->traverse(scene->get_scene_root());
+  trav->end_traverse();
+
+  _buffer.finish();
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: SoftOcclusionCullTraverser::OccluderHandler::record_object
+//       Access: Public, Virtual
+//  Description: Draws the polygons of an occluder Geom into the depth
+//               buffer.
+////////////////////////////////////////////////////////////////////
+void SoftOcclusionCullTraverser::OccluderHandler::
+record_object(CullableObject *object, const CullTraverser *traverser) {
+  Thread *current_thread = traverser->get_current_thread();
+  const Geom *geom = object->_geom;
+  LMatrix4 to_clip = object->_modelview_transform->get_mat() * _projection_mat;
+
+  CPT(GeomVertexData) data = geom->get_vertex_data(current_thread)->animate_vertices(true, current_thread);
+  GeomVertexReader vertex(data, InternalName::get_vertex(), current_thread);
+  if (vertex.has_column()) {
+    int num_primitives = geom->get_num_primitives();
+    for (int pi = 0; pi < num_primitives; ++pi) {
+      const GeomPrimitive *prim = geom->get_primitive(pi);
+      if (prim->get_primitive_type() != GeomPrimitive::PT_polygons) {
+        continue;
+      }
+      CPT(GeomPrimitive) tris = prim->decompose();
+      int num_vertices = tris->get_num_vertices();
+      for (int i = 0; i + 2 < num_vertices; i += 3) {
+        LVecBase4 v[3];
+        for (int j = 0; j < 3; ++j) {
+          vertex.set_row_unsafe(tris->get_vertex(i + j));
+          v[j] = to_clip.xform(LVecBase4(vertex.get_data3(), 1.0f));
+        }
+        _buffer.draw_triangle(v[0], v[1], v[2]);
+      }
+    }
+  }
+
+  delete object;
+}
@@ -0,0 +1,114 @@
+// Filename: softOcclusionCullTraverser.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef SOFTOCCLUSIONCULLTRAVERSER_H
+#define SOFTOCCLUSIONCULLTRAVERSER_H
+
+#include "pandabase.h"
+#include "cullTraverser.h"
+#include "cullHandler.h"
+#include "occlusionDepthBuffer.h"
+#include "pStatCollector.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : SoftOcclusionCullTraverser
+// Description : This specialization of CullTraverser performs
+//               occlusion culling entirely on the CPU, so it may be
+//               used with any GSG, or with none at all.
+//
+//               Before the first node is tested, the occluder
+//               geometry is rasterized into a small
+//               OcclusionDepthBuffer.  Each node visited thereafter
+//               has its bounding volume tested against this buffer,
+//               and is culled, along with all of its descendants, if
+//               it is hidden entirely behind the occluders.
+//
+//               The occluders are those Geoms visible to the
+//               occlusion mask.  They will normally be simple,
+//               low-polygon proxies for large, solid objects in the
+//               scene, hidden from the camera's own mask; any Geom
+//               visible to both is drawn and also occludes.  Only
+//               polygons are considered; points and lines never
+//               occlude anything.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_GRUTIL SoftOcclusionCullTraverser : public CullTraverser {
+PUBLISHED:
+  SoftOcclusionCullTraverser();
+  SoftOcclusionCullTraverser(const SoftOcclusionCullTraverser &copy);
+
+  virtual void set_scene(SceneSetup *scene_setup,
+                         GraphicsStateGuardianBase *gsg,
+                         bool dr_incomplete_render);
+  virtual void end_traverse();
+
+  INLINE void set_occlusion_mask(const DrawMask &occlusion_mask);
+  INLINE const DrawMask &get_occlusion_mask() const;
+
+  INLINE void set_buffer_size(int x_size, int y_size);
+  INLINE int get_buffer_x_size() const;
+  INLINE int get_buffer_y_size() const;
+
+  INLINE int get_num_occluder_triangles() const;
+
+protected:
+  virtual bool is_in_view(CullTraverserData &data);
+
+private:
+  void draw_occluders();
+
+  // This receives the occluder Geoms from the internal traverser and
+  // draws them into the depth buffer.
+  class OccluderHandler : public CullHandler {
+  public:
+    INLINE OccluderHandler(OcclusionDepthBuffer &buffer,
+                           const LMatrix4 &projection_mat);
+    virtual void record_object(CullableObject *object,
+                               const CullTraverser *traverser);
+
+  private:
+    OcclusionDepthBuffer &_buffer;
+    LMatrix4 _projection_mat;
+  };
+
+  DrawMask _occlusion_mask;
+  OcclusionDepthBuffer _buffer;
+  bool _drawn_occluders;
+  bool _dr_incomplete_render;
+
+  static PStatCollector _draw_occlusion_pcollector;
+  static PStatCollector _occlusion_passed_pcollector;
+  static PStatCollector _occlusion_failed_pcollector;
+  static PStatCollector _occlusion_tests_pcollector;
+
+public:
+  static TypeHandle get_class_type() {
+    return _type_handle;
+  }
+  static void init_type() {
+    CullTraverser::init_type();
+    register_type(_type_handle, "SoftOcclusionCullTraverser",
+                  CullTraverser::get_class_type());
+  }
+  virtual TypeHandle get_type() const {
+    return get_class_type();
+  }
+  virtual TypeHandle force_init_type() {init_type(); return get_class_type();}
+
+private:
+  static TypeHandle _type_handle;
+};
+
+#include "softOcclusionCullTraverser.I"
+
+#endif
@@ -0,0 +1,115 @@
+// Filename: test_occlusion_buffer.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "occlusionDepthBuffer.h"
+
+// Draws a square occluder into an OcclusionDepthBuffer and checks
+// which boxes it hides.  Everything is given directly in clip
+// coordinates, so that the box transform is the identity: the
+// occluder covers x and y from -0.5 to 0.5 at a normalized depth of
+// 0, and greater z is farther away.
+
+static int num_failed = 0;
+
+static void
+check_box(const OcclusionDepthBuffer &buffer, const char *name,
+          const LPoint3 &min_point, const LPoint3 &max_point,
+          bool expect_occluded) {
+  bool occluded = buffer.is_box_occluded(min_point, max_point,
+                                         LMatrix4::ident_mat());
+  if (occluded != expect_occluded) {
+    cerr << name << ": " << (occluded ? "occluded" : "visible")
+         << ", expected " << (expect_occluded ? "occluded" : "visible")
+         << "\n";
+    ++num_failed;
+  } else {
+    cerr << name << ": ok\n";
+  }
+}
+
+int
+main(int argc, char *argv[]) {
+  OcclusionDepthBuffer buffer;
+  buffer.set_size(64, 64);
+
+  // Nothing can be occluded before any occluders are drawn.
+  buffer.finish();
+  check_box(buffer, "empty buffer",
+            LPoint3(-0.2f, -0.2f, 0.5f), LPoint3(0.2f, 0.2f, 0.8f), false);
+
+  LVecBase4 a(-0.5f, -0.5f, 0.0f, 1.0f);
+  LVecBase4 b(0.5f, -0.5f, 0.0f, 1.0f);
+  LVecBase4 c(0.5f, 0.5f, 0.0f, 1.0f);
+  LVecBase4 d(-0.5f, 0.5f, 0.0f, 1.0f);
+  buffer.draw_triangle(a, b, c);
+  buffer.draw_triangle(a, c, d);
+  buffer.finish();
+
+  if (buffer.get_num_triangles() != 2) {
+    cerr << "drew " << buffer.get_num_triangles()
+         << " triangles, expected 2\n";
+    ++num_failed;
+  }
+
+  // The occluder covers the middle half of the buffer, and the stored
+  // depth is 1 - z.
+  if (buffer.get_depth(32, 32) != 1.0f) {
+    cerr << "depth at center is " << buffer.get_depth(32, 32)
+         << ", expected 1\n";
+    ++num_failed;
+  }
+  if (buffer.get_depth(4, 4) > 0.0f) {
+    cerr << "depth at corner is " << buffer.get_depth(4, 4)
+         << ", expected empty\n";
+    ++num_failed;
+  }
+
+  check_box(buffer, "box behind",
+            LPoint3(-0.2f, -0.2f, 0.5f), LPoint3(0.2f, 0.2f, 0.8f), true);
+  check_box(buffer, "box partly in front",
+            LPoint3(-0.2f, -0.2f, -0.5f), LPoint3(0.2f, 0.2f, 0.5f), false);
+  check_box(buffer, "box in front",
+            LPoint3(-0.2f, -0.2f, -0.8f), LPoint3(0.2f, 0.2f, -0.5f), false);
+  check_box(buffer, "box on the occluder",
+            LPoint3(-0.2f, -0.2f, 0.0f), LPoint3(0.2f, 0.2f, 0.5f), false);
+  check_box(buffer, "box partly outside",
+            LPoint3(0.3f, -0.2f, 0.5f), LPoint3(0.7f, 0.2f, 0.8f), false);
+  check_box(buffer, "box outside",
+            LPoint3(0.6f, 0.6f, 0.5f), LPoint3(0.9f, 0.9f, 0.8f), false);
+  check_box(buffer, "box off the buffer",
+            LPoint3(1.5f, -0.2f, 0.5f), LPoint3(1.8f, 0.2f, 0.8f), false);
+  check_box(buffer, "box across the near plane",
+            LPoint3(-0.2f, -0.2f, -1.5f), LPoint3(0.2f, 0.2f, 0.8f), false);
+
+  // An occluder crossing the near plane is clipped, and the part
+  // beyond it still occludes.
+  buffer.clear();
+  buffer.draw_triangle(LVecBase4(-0.5f, -0.5f, -2.0f, 1.0f),
+                       LVecBase4(0.5f, -0.5f, -2.0f, 1.0f),
+                       LVecBase4(0.5f, 0.5f, 0.0f, 1.0f));
+  buffer.draw_triangle(LVecBase4(-0.5f, -0.5f, -2.0f, 1.0f),
+                       LVecBase4(0.5f, 0.5f, 0.0f, 1.0f),
+                       LVecBase4(-0.5f, 0.5f, 0.0f, 1.0f));
+  buffer.finish();
+  check_box(buffer, "box behind clipped occluder",
+            LPoint3(-0.2f, 0.1f, 0.5f), LPoint3(0.2f, 0.3f, 0.8f), true);
+  check_box(buffer, "box below clipped occluder",
+            LPoint3(-0.2f, -0.4f, 0.5f), LPoint3(0.2f, -0.3f, 0.8f), false);
+
+  if (num_failed != 0) {
+    cerr << num_failed << " checks failed.\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,141 @@
+// Filename: test_soft_occlusion.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "softOcclusionCullTraverser.h"
+#include "cullHandler.h"
+#include "cullableObject.h"
+#include "sceneSetup.h"
+#include "camera.h"
+#include "perspectiveLens.h"
+#include "cardMaker.h"
+#include "geomNode.h"
+#include "nodePath.h"
+#include "pmap.h"
+#include "pset.h"
+
+// Culls a tiny scene with a SoftOcclusionCullTraverser, and checks
+// which of its cards are drawn.  The camera sits at the origin
+// looking down the Y axis, with a large occluder card 10 units away;
+// one card hides directly behind it, and the others are beside it,
+// in front of it, or only partly behind it.
+
+static const DrawMask camera_mask = DrawMask::bit(0);
+static const DrawMask occlusion_mask = DrawMask::bit(1);
+
+// Records the name of each card that the traverser passes on to be
+// drawn.
+class RecordHandler : public CullHandler {
+public:
+  virtual void record_object(CullableObject *object,
+                             const CullTraverser *traverser) {
+    Names::const_iterator ni = _names.find(object->_geom);
+    if (ni != _names.end()) {
+      _drawn.insert((*ni).second);
+    }
+    delete object;
+  }
+
+  typedef pmap<CPT(Geom), string> Names;
+  Names _names;
+  pset<string> _drawn;
+};
+
+static NodePath
+make_card(RecordHandler &handler, const NodePath &parent, const string &name,
+          PN_stdfloat size, const LPoint3 &pos) {
+  CardMaker maker(name);
+  maker.set_frame(-size, size, -size, size);
+  NodePath card = parent.attach_new_node(maker.generate());
+  card.set_pos(pos);
+
+  GeomNode *gnode = DCAST(GeomNode, card.node());
+  handler._names[gnode->get_geom(0)] = name;
+  return card;
+}
+
+int
+main(int argc, char *argv[]) {
+  RecordHandler handler;
+  NodePath render("render");
+
+  PT(PerspectiveLens) lens = new PerspectiveLens;
+  lens->set_fov(90.0f, 90.0f);
+  lens->set_near_far(1.0f, 100.0f);
+  PT(Camera) camera = new Camera("camera", lens);
+  camera->set_camera_mask(camera_mask);
+  NodePath camera_np = render.attach_new_node(camera);
+
+  // The occluder is only seen by the occlusion pass; the other cards
+  // are only seen by the camera.
+  NodePath occluder = make_card(handler, render, "occluder", 5.0f,
+                                LPoint3(0.0f, 10.0f, 0.0f));
+  occluder.hide(camera_mask);
+
+  NodePath cards = render.attach_new_node("cards");
+  cards.hide(occlusion_mask);
+  make_card(handler, cards, "behind", 1.0f, LPoint3(0.0f, 20.0f, 0.0f));
+  make_card(handler, cards, "beside", 1.0f, LPoint3(15.0f, 20.0f, 0.0f));
+  make_card(handler, cards, "in front", 1.0f, LPoint3(0.0f, 5.0f, 0.0f));
+  make_card(handler, cards, "partly behind", 2.0f, LPoint3(9.0f, 20.0f, 0.0f));
+
+  PT(SceneSetup) scene = new SceneSetup;
+  scene->set_scene_root(render);
+  scene->set_camera_path(camera_np);
+  scene->set_camera_node(camera);
+  scene->set_lens(lens);
+
+  PT(BoundingVolume) frustum = lens->make_bounds();
+
+  PT(SoftOcclusionCullTraverser) trav = new SoftOcclusionCullTraverser;
+  trav->set_buffer_size(64, 64);
+  trav->set_occlusion_mask(occlusion_mask);
+  trav->set_cull_handler(&handler);
+  trav->set_scene(scene, NULL, false);
+  trav->set_view_frustum(DCAST(GeometricBoundingVolume, frustum));
+  trav->traverse(render);
+  trav->end_traverse();
+
+  int num_failed = 0;
+  if (trav->get_num_occluder_triangles() != 2) {
+    cerr << "drew " << trav->get_num_occluder_triangles()
+         << " occluder triangles, expected 2\n";
+    ++num_failed;
+  }
+
+  static const char *const visible[] = {
+    "beside", "in front", "partly behind", NULL
+  };
+  for (int i = 0; visible[i] != NULL; ++i) {
+    if (handler._drawn.count(visible[i]) == 0) {
+      cerr << visible[i] << ": culled, expected drawn\n";
+      ++num_failed;
+    }
+  }
+
+  static const char *const hidden[] = {
+    "behind", "occluder", NULL
+  };
+  for (int i = 0; hidden[i] != NULL; ++i) {
+    if (handler._drawn.count(hidden[i]) != 0) {
+      cerr << hidden[i] << ": drawn, expected culled\n";
+      ++num_failed;
+    }
+  }
+
+  if (num_failed != 0) {
+    cerr << num_failed << " checks failed.\n";
+    return 1;
+  }
+  return 0;
+}
@@ -31,11 +31,13 @@
     colorWriteAttrib.I colorWriteAttrib.h \
     compassEffect.I compassEffect.h \
     config_pgraph.h \
+    cullBatcher.I cullBatcher.h \
     cullBin.I cullBin.h \
     cullBinEnums.h \
     cullBinAttrib.I cullBinAttrib.h \
     cullBinManager.I cullBinManager.h \
     cullFaceAttrib.I cullFaceAttrib.h \
+    cullFragment.I cullFragment.h \
     cullHandler.I cullHandler.h \
     cullPlanes.I cullPlanes.h \
     cullResult.I cullResult.h \
@@ -101,6 +103,8 @@
     showBoundsEffect.I showBoundsEffect.h \
     stateMunger.I stateMunger.h \
     stencilAttrib.I stencilAttrib.h \
+    stripedReMutex.I stripedReMutex.h \
+    stripedReMutexHolder.I stripedReMutexHolder.h \
     texMatrixAttrib.I texMatrixAttrib.h \
     texProjectorEffect.I texProjectorEffect.h \
     textureAttrib.I textureAttrib.h \
@@ -133,10 +137,12 @@
     colorWriteAttrib.cxx \
     compassEffect.cxx \
     config_pgraph.cxx \
+    cullBatcher.cxx \
     cullBin.cxx \
     cullBinAttrib.cxx \
     cullBinManager.cxx \
     cullFaceAttrib.cxx \
+    cullFragment.cxx \
     cullHandler.cxx \
     cullPlanes.cxx \
     cullResult.cxx \
@@ -201,6 +207,8 @@
     showBoundsEffect.cxx \
     stateMunger.cxx \
     stencilAttrib.cxx \
+    stripedReMutex.cxx \
+    stripedReMutexHolder.cxx \
     texMatrixAttrib.cxx \
     texProjectorEffect.cxx \
     textureAttrib.cxx \
@@ -230,11 +238,13 @@
     colorWriteAttrib.I colorWriteAttrib.h \
     compassEffect.I compassEffect.h \
     config_pgraph.h \
+    cullBatcher.I cullBatcher.h \
     cullBin.I cullBin.h \
     cullBinEnums.h \
     cullBinAttrib.I cullBinAttrib.h \
     cullBinManager.I cullBinManager.h \
     cullFaceAttrib.I cullFaceAttrib.h \
+    cullFragment.I cullFragment.h \
     cullHandler.I cullHandler.h \
     cullPlanes.I cullPlanes.h \
     cullResult.I cullResult.h \
@@ -298,6 +308,8 @@
     showBoundsEffect.I showBoundsEffect.h \
     stateMunger.I stateMunger.h \
     stencilAttrib.I stencilAttrib.h \
+    stripedReMutex.I stripedReMutex.h \
+    stripedReMutexHolder.I stripedReMutexHolder.h \
     texMatrixAttrib.I texMatrixAttrib.h \
     texProjectorEffect.I texProjectorEffect.h \
     textureAttrib.I textureAttrib.h \
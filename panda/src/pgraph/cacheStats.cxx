@@ -25,8 +25,8 @@ void CacheStats::
 init() {
 #ifndef NDEBUG
   reset(ClockObject::get_global_clock()->get_real_time());
-  _total_cache_size = 0;
-  _num_states = 0;
+  AtomicAdjust::set(_total_cache_size, 0);
+  AtomicAdjust::set(_num_states, 0);
 
   _cache_report = ConfigVariableBool("cache-report", false);
   _cache_report_interval = ConfigVariableDouble("cache-report-interval", 5.0);
@@ -42,11 +42,11 @@ init() {
 void CacheStats::
 reset(double now) {
 #ifndef NDEBUG
-  _cache_hits = 0;
-  _cache_misses = 0;
-  _cache_adds = 0;
-  _cache_new_adds = 0;
-  _cache_dels = 0;
+  AtomicAdjust::set(_cache_hits, 0);
+  AtomicAdjust::set(_cache_misses, 0);
+  AtomicAdjust::set(_cache_adds, 0);
+  AtomicAdjust::set(_cache_new_adds, 0);
+  AtomicAdjust::set(_cache_dels, 0);
   _last_reset = now;
 #endif  // NDEBUG
 }
@@ -59,12 +59,20 @@ reset(double now) {
 void CacheStats::
 write(ostream &out, const char *name) const {
 #ifndef NDEBUG
-  out << name << " cache: " << _cache_hits << " hits, " 
-      << _cache_misses << " misses\n"
-      << _cache_adds + _cache_new_adds << "(" << _cache_new_adds << ") adds(new), "
-      << _cache_dels << " dels, "
-      << _total_cache_size << " / " << _num_states << " = "
-      << (double)_total_cache_size / (double)_num_states 
+  AtomicAdjust::Integer cache_hits = AtomicAdjust::get(_cache_hits);
+  AtomicAdjust::Integer cache_misses = AtomicAdjust::get(_cache_misses);
+  AtomicAdjust::Integer cache_adds = AtomicAdjust::get(_cache_adds);
+  AtomicAdjust::Integer cache_new_adds = AtomicAdjust::get(_cache_new_adds);
+  AtomicAdjust::Integer cache_dels = AtomicAdjust::get(_cache_dels);
+  AtomicAdjust::Integer total_cache_size = AtomicAdjust::get(_total_cache_size);
+  AtomicAdjust::Integer num_states = AtomicAdjust::get(_num_states);
+
+  out << name << " cache: " << cache_hits << " hits, " 
+      << cache_misses << " misses\n"
+      << cache_adds + cache_new_adds << "(" << cache_new_adds << ") adds(new), "
+      << cache_dels << " dels, "
+      << total_cache_size << " / " << num_states << " = "
+      << (double)total_cache_size / (double)num_states 
       << " average cache size\n";
 #endif  // NDEBUG
 }
@@ -18,12 +18,19 @@
 #include "pandabase.h"
 #include "clockObject.h"
 #include "pnotify.h"
+#include "atomicAdjust.h"
+#include "lightMutex.h"
+#include "lightMutexHolder.h"
 
 ////////////////////////////////////////////////////////////////////
 //       Class : CacheStats
 // Description : This is used to track the utilization of the
 //               TransformState and RenderState caches, for low-level
 //               performance tuning information.
+//
+//               The counters may be updated from several threads at
+//               once, since the caches are locked in stripes, so
+//               they are adjusted atomically.
 ////////////////////////////////////////////////////////////////////
 class EXPCL_PANDA_PGRAPH CacheStats {
 public:
@@ -41,13 +48,16 @@ public:
 
 private:
 #ifndef NDEBUG
-  int _cache_hits;
-  int _cache_misses;
-  int _cache_adds;
-  int _cache_new_adds;
-  int _cache_dels;
-  int _total_cache_size;
-  int _num_states;
+  AtomicAdjust::Integer _cache_hits;
+  AtomicAdjust::Integer _cache_misses;
+  AtomicAdjust::Integer _cache_adds;
+  AtomicAdjust::Integer _cache_new_adds;
+  AtomicAdjust::Integer _cache_dels;
+  AtomicAdjust::Integer _total_cache_size;
+  AtomicAdjust::Integer _num_states;
+
+  // This protects _last_reset, and serializes the reports.
+  LightMutex _report_lock;
   double _last_reset;
 
   bool _cache_report;
@@ -209,6 +209,61 @@ ConfigVariableDouble garbage_collect_states_rate
           "performance if states accumulate faster than they can be "
           "cleaned up."));
 
+ConfigVariableDouble garbage_collect_states_budget
+("garbage-collect-states-budget", 0.0,
+ PRC_DESC("The maximum number of microseconds that each call to "
+          "TransformState::garbage_collect() or "
+          "RenderState::garbage_collect() may spend.  If the time runs "
+          "out, the next call resumes where the previous one left off, "
+          "so that the cost of garbage collection is spread evenly "
+          "across frames rather than arriving in occasional spikes.  "
+          "Set this to 0 to let each call run to completion."));
+
+ConfigVariableInt parallel_cull_min_children
+("parallel-cull-min-children", 4,
+ PRC_DESC("When a DisplayRegion is culled with more than one thread (see "
+          "DisplayRegion::set_cull_num_threads()), the traversal is split "
+          "into separate tasks at each node with at least this many "
+          "children, each child becoming a task of its own.  Smaller "
+          "numbers produce more, smaller tasks."));
+
+ConfigVariableInt animate_vertices_threads
+("animate-vertices-threads", 0,
+ PRC_DESC("Set this greater than 1 to compute the CPU vertex animation "
+          "(skinning and morphs) of all the geometry found during cull as "
+          "a batch, spread across this many threads (including the cull "
+          "thread itself), just before draw.  When this is 0 or 1, each "
+          "GeomVertexData is animated as it is encountered by the cull "
+          "traversal, one at a time.  This is only useful when there are "
+          "many independently animated models in view, such as a crowd "
+          "of Characters."));
+
+ConfigVariableBool cull_batching
+("cull-batching", false,
+ PRC_DESC("Set this true to combine the many instances of a Geom that "
+          "are found during cull with the same state, such as the "
+          "copies of a model placed throughout a scene, into a few "
+          "larger Geoms, whose vertices are transformed into world "
+          "space on the CPU.  This is done only for groups of instances "
+          "that have not moved since the previous frame, and the "
+          "combined Geoms are kept for as long as they do not move.  "
+          "It trades memory for fewer draw calls.  Objects in unsorted, "
+          "back_to_front and fixed bins are never combined, since they "
+          "promise a particular drawing order, and neither are scaled "
+          "instances, whose normals would no longer be normalized."));
+
+ConfigVariableInt cull_batch_min_instances
+("cull-batch-min-instances", 8,
+ PRC_DESC("When cull-batching is true, this is the fewest instances of "
+          "a Geom that are worth combining."));
+
+ConfigVariableInt cull_batch_max_vertices
+("cull-batch-max-vertices", 65535,
+ PRC_DESC("When cull-batching is true, this is the largest number of "
+          "vertices that will be put into one combined Geom.  A group "
+          "with more vertices than this is split into several Geoms.  "
+          "The default keeps the vertex indices to 16 bits."));
+
 ConfigVariableBool transform_cache
 ("transform-cache", true,
  PRC_DESC("Set this true to enable the cache of TransformState objects.  "
@@ -222,6 +277,18 @@ ConfigVariableBool state_cache
           "similar to the TransformState cache controlled via "
           "transform-cache."));
 
+ConfigVariableInt state_cache_stripes
+("state-cache-stripes", 1,
+ PRC_DESC("The number of independent pieces into which the "
+          "TransformState and RenderState caches are divided, each "
+          "protected by its own lock.  Setting this larger than 1 "
+          "reduces lock contention when many threads are creating and "
+          "composing states at once, for instance when using a "
+          "threaded pipeline or task chains with several threads.  "
+          "This has no effect unless garbage-collect-states is also "
+          "true.  It must be set before the first state is created; it "
+          "cannot be changed at runtime."));
+
 ConfigVariableBool uniquify_transforms
 ("uniquify-transforms", true,
  PRC_DESC("Set this true to ensure that equivalent TransformStates "
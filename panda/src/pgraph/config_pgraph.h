@@ -46,8 +46,15 @@ extern ConfigVariableBool paranoid_const;
 extern ConfigVariableBool auto_break_cycles;
 extern EXPCL_PANDA_PGRAPH ConfigVariableBool garbage_collect_states;
 extern ConfigVariableDouble garbage_collect_states_rate;
+extern ConfigVariableDouble garbage_collect_states_budget;
+extern ConfigVariableInt parallel_cull_min_children;
+extern ConfigVariableInt animate_vertices_threads;
+extern ConfigVariableBool cull_batching;
+extern ConfigVariableInt cull_batch_min_instances;
+extern ConfigVariableInt cull_batch_max_vertices;
 extern ConfigVariableBool transform_cache;
 extern ConfigVariableBool state_cache;
+extern ConfigVariableInt state_cache_stripes;
 extern ConfigVariableBool uniquify_transforms;
 extern ConfigVariableBool uniquify_states;
 extern ConfigVariableBool uniquify_attribs;
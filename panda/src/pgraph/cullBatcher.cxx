@@ -0,0 +1,368 @@
+// Filename: cullBatcher.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "cullBatcher.h"
+#include "cullBin.h"
+#include "cullResult.h"
+#include "sceneSetup.h"
+#include "texGenAttrib.h"
+#include "shaderAttrib.h"
+#include "geomPrimitive.h"
+#include "geomVertexArrayData.h"
+#include "config_pgraph.h"
+#include "pStatTimer.h"
+#include <algorithm>
+
+PStatCollector CullBatcher::_batch_pcollector("Cull:Batch");
+PStatCollector CullBatcher::_build_pcollector("Cull:Batch:Build");
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBatcher::Constructor
+//       Access: Public
+//  Description:
+////////////////////////////////////////////////////////////////////
+CullBatcher::
+CullBatcher() :
+  _frame(0),
+  _num_batches(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBatcher::Destructor
+//       Access: Public
+//  Description:
+////////////////////////////////////////////////////////////////////
+CullBatcher::
+~CullBatcher() {
+  // Normally finish_cull() will have emptied this already.
+  Groups::iterator gi;
+  for (gi = _groups.begin(); gi != _groups.end(); ++gi) {
+    Objects::iterator oi;
+    for (oi = (*gi).second.begin(); oi != (*gi).second.end(); ++oi) {
+      delete (*oi);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBatcher::add_object
+//       Access: Public
+//  Description: Offers the indicated object, which has already been
+//               munged, and which is destined for the indicated bin.
+//               If the object might be combined with others, the
+//               CullBatcher takes ownership of it, and returns true;
+//               it will be added to its bin, alone or as part of a
+//               combined Geom, by finish_cull().  Otherwise, returns
+//               false, and the caller should add it to the bin
+//               itself.
+////////////////////////////////////////////////////////////////////
+bool CullBatcher::
+add_object(CullableObject *object, CullBin *bin) {
+  if (!is_batchable(object, bin)) {
+    return false;
+  }
+
+  _groups[GroupKey(object)].push_back(object);
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBatcher::finish_cull
+//       Access: Public
+//  Description: Called by CullResult::finish_cull() before the bins
+//               are finished, this adds all of the objects collected
+//               this frame to their bins, replacing each group of
+//               instances with its combined Geoms where possible.
+////////////////////////////////////////////////////////////////////
+void CullBatcher::
+finish_cull(CullResult *result, SceneSetup *scene_setup,
+            Thread *current_thread) {
+  PStatTimer timer(_batch_pcollector, current_thread);
+
+  ++_frame;
+  _num_batches = 0;
+
+  int min_instances = max((int)cull_batch_min_instances, 2);
+  int max_vertices = cull_batch_max_vertices;
+
+  Groups::iterator gi;
+  for (gi = _groups.begin(); gi != _groups.end(); ++gi) {
+    Objects &objects = (*gi).second;
+    CullableObject *first = objects.front();
+    CullBin *bin = result->get_bin(first->_state->get_bin_index());
+    nassertd(bin != (CullBin *)NULL) continue;
+
+    int num_rows = first->_munged_data->get_num_rows();
+    int per_chunk = (num_rows > 0) ? max_vertices / num_rows : 0;
+
+    bool batched = false;
+    if ((int)objects.size() >= min_instances && per_chunk >= min_instances) {
+      sort(objects.begin(), objects.end(), SortByTransform());
+
+      Entry &entry = _entries[(*gi).first];
+      if (entry._geom == (Geom *)NULL) {
+        entry._geom = first->_geom;
+        entry._munged_data = first->_munged_data;
+        entry._state = first->_state;
+        entry._munger = first->_munger;
+      }
+      entry._frame = _frame;
+
+      if (!same_transforms(entry, objects)) {
+        // Something has changed since last frame.  Remember the new
+        // transforms, and draw the objects individually for now.
+        entry._transforms.clear();
+        entry._transforms.reserve(objects.size());
+        Objects::const_iterator oi;
+        for (oi = objects.begin(); oi != objects.end(); ++oi) {
+          entry._transforms.push_back((*oi)->_net_transform);
+        }
+        entry._chunks.clear();
+
+      } else {
+        if (entry._chunks.empty()) {
+          build_chunks(entry, objects, per_chunk, current_thread);
+        }
+
+        Chunks::const_iterator ci;
+        for (ci = entry._chunks.begin(); ci != entry._chunks.end(); ++ci) {
+          CullableObject *batch =
+            new CullableObject((*ci)._geom, first->_state,
+                               TransformState::make_identity(),
+                               scene_setup->get_world_transform(),
+                               scene_setup);
+          batch->_munger = first->_munger;
+          batch->_munged_data = (*ci)._data;
+          bin->add_object(batch, current_thread);
+          ++_num_batches;
+        }
+        batched = !entry._chunks.empty();
+      }
+    }
+
+    Objects::iterator oi;
+    for (oi = objects.begin(); oi != objects.end(); ++oi) {
+      if (batched) {
+        delete (*oi);
+      } else {
+        bin->add_object(*oi, current_thread);
+      }
+    }
+  }
+  _groups.clear();
+
+  // Forget about any groups we didn't see this frame.
+  Entries::iterator ei = _entries.begin();
+  while (ei != _entries.end()) {
+    if ((*ei).second._frame != _frame) {
+      _entries.erase(ei++);
+    } else {
+      ++ei;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBatcher::is_batchable
+//       Access: Private, Static
+//  Description: Returns true if the indicated object may be combined
+//               with other instances of the same Geom, or false if it
+//               must be drawn by itself.
+////////////////////////////////////////////////////////////////////
+bool CullBatcher::
+is_batchable(const CullableObject *object, CullBin *bin) {
+  switch (bin->get_bin_type()) {
+  case CullBin::BT_state_sorted:
+  case CullBin::BT_front_to_back:
+  case CullBin::BT_radix_state_sorted:
+  case CullBin::BT_radix_front_to_back:
+    break;
+
+  default:
+    // The other bin types promise a particular drawing order, which
+    // a combined Geom would not keep.  This includes unsorted bins,
+    // which draw in scene graph order.
+    return false;
+  }
+
+  if (object->is_fancy() || object->_munged_data == (GeomVertexData *)NULL) {
+    return false;
+  }
+
+  // Animated vertices are different every frame.  We have to check
+  // the Geom's own vertex data, since CPU-animated vertices will
+  // already have been replaced in _munged_data by the animated
+  // result, which has no animation of its own.
+  const GeomVertexData *source_data = object->_geom->get_vertex_data();
+  if (source_data->get_format()->get_animation().get_animation_type() != Geom::AT_none) {
+    return false;
+  }
+
+  // Points may be expanded into sprites in eye space, so their
+  // vertices are not necessarily in the space of their transform.
+  Geom::PrimitiveType primitive_type = object->_geom->get_primitive_type();
+  if (primitive_type != Geom::PT_polygons && primitive_type != Geom::PT_lines) {
+    return false;
+  }
+
+  // Anything that looks at the vertices in model space would see
+  // world space instead.
+  const RenderState *state = object->_state;
+  const TexGenAttrib *tex_gen = DCAST(TexGenAttrib, state->get_attrib(TexGenAttrib::get_class_slot()));
+  if (tex_gen != (TexGenAttrib *)NULL && !tex_gen->is_empty()) {
+    return false;
+  }
+  const ShaderAttrib *shader = DCAST(ShaderAttrib, state->get_attrib(ShaderAttrib::get_class_slot()));
+  if (shader != (ShaderAttrib *)NULL &&
+      (shader->get_shader() != (Shader *)NULL || shader->get_instance_count() > 0)) {
+    return false;
+  }
+
+  // The combined Geom is drawn with an identity transform, so
+  // RescaleNormalAttrib can no longer normalize the normals that
+  // transform_vertices() has scaled.
+  if (!object->_net_transform->has_identity_scale()) {
+    return false;
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBatcher::same_transforms
+//       Access: Private
+//  Description: Returns true if the indicated objects, which have
+//               been sorted with SortByTransform, have the same
+//               transforms recorded in the entry.  Transforms are
+//               compared by value, not only by pointer, since they
+//               are not necessarily unique.
+////////////////////////////////////////////////////////////////////
+bool CullBatcher::
+same_transforms(const Entry &entry, const Objects &objects) const {
+  if (entry._transforms.size() != objects.size()) {
+    return false;
+  }
+  Transforms::const_iterator ti = entry._transforms.begin();
+  Objects::const_iterator oi;
+  for (oi = objects.begin(); oi != objects.end(); ++oi, ++ti) {
+    const TransformState *net_transform = (*oi)->_net_transform;
+    if ((*ti) != net_transform && (*ti)->compare_to(*net_transform) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBatcher::build_chunks
+//       Access: Private
+//  Description: Builds the combined Geoms for the objects of the
+//               indicated entry, with no more than per_chunk objects
+//               in each one.
+////////////////////////////////////////////////////////////////////
+void CullBatcher::
+build_chunks(Entry &entry, const Objects &objects, int per_chunk,
+             Thread *current_thread) {
+  PStatTimer timer(_build_pcollector, current_thread);
+
+  entry._chunks.clear();
+  Objects::const_iterator begin = objects.begin();
+  while (begin != objects.end()) {
+    Objects::const_iterator end = begin + min((int)(objects.end() - begin), per_chunk);
+
+    Chunk chunk;
+    chunk._geom = build_chunk(entry._geom, entry._munged_data, chunk._data,
+                              begin, end, current_thread);
+    if (chunk._geom == (Geom *)NULL) {
+      entry._chunks.clear();
+      return;
+    }
+    entry._chunks.push_back(chunk);
+    begin = end;
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullBatcher::build_chunk
+//       Access: Private, Static
+//  Description: Returns a new Geom that contains a copy of the
+//               indicated Geom for each of the objects in the range,
+//               with its vertices transformed by the object's net
+//               transform.  The new vertex data is also stored in
+//               data.
+////////////////////////////////////////////////////////////////////
+CPT(Geom) CullBatcher::
+build_chunk(const Geom *geom, const GeomVertexData *source,
+            CPT(GeomVertexData) &data,
+            Objects::const_iterator begin, Objects::const_iterator end,
+            Thread *current_thread) {
+  int num_rows = source->get_num_rows();
+  int count = (int)(end - begin);
+
+  PT(GeomVertexData) new_data =
+    new GeomVertexData(source->get_name(), source->get_format(),
+                       Geom::UH_static);
+  if (!new_data->unclean_set_num_rows(num_rows * count)) {
+    return NULL;
+  }
+
+  // The format is the same, so the rows may be copied a whole array
+  // at a time.
+  int num_arrays = source->get_num_arrays();
+  for (int ai = 0; ai < num_arrays; ++ai) {
+    CPT(GeomVertexArrayDataHandle) from =
+      source->get_array(ai)->get_handle(current_thread);
+    PT(GeomVertexArrayDataHandle) to =
+      new_data->modify_array(ai)->modify_handle(current_thread);
+    size_t size = from->get_data_size_bytes();
+    for (int i = 0; i < count; ++i) {
+      to->copy_subdata_from(i * size, size, from, 0, size);
+    }
+  }
+
+  Objects::const_iterator oi;
+  int row = 0;
+  for (oi = begin; oi != end; ++oi, row += num_rows) {
+    const TransformState *net_transform = (*oi)->_net_transform;
+    if (!net_transform->is_identity()) {
+      new_data->transform_vertices(net_transform->get_mat(),
+                                   row, row + num_rows);
+    }
+  }
+
+  PT(Geom) new_geom = new Geom(new_data);
+  int num_primitives = geom->get_num_primitives();
+  for (int pi = 0; pi < num_primitives; ++pi) {
+    CPT(GeomPrimitive) prim = geom->get_primitive(pi);
+    PT(GeomPrimitive) new_prim = prim->make_copy();
+    new_prim->clear_vertices();
+
+    int num_prims = prim->get_num_primitives();
+    for (int i = 0; i < count; ++i) {
+      int offset = i * num_rows;
+      for (int pj = 0; pj < num_prims; ++pj) {
+        int prim_end = prim->get_primitive_end(pj);
+        for (int vi = prim->get_primitive_start(pj); vi < prim_end; ++vi) {
+          new_prim->add_vertex(prim->get_vertex(vi) + offset);
+        }
+        new_prim->close_primitive();
+      }
+    }
+    new_geom->add_primitive(new_prim);
+  }
+
+  data = new_data;
+  return new_geom;
+}
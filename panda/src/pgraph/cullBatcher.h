@@ -0,0 +1,145 @@
+// Filename: cullBatcher.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef CULLBATCHER_H
+#define CULLBATCHER_H
+
+#include "pandabase.h"
+#include "referenceCount.h"
+#include "geom.h"
+#include "geomVertexData.h"
+#include "geomMunger.h"
+#include "renderState.h"
+#include "transformState.h"
+#include "pointerTo.h"
+#include "pvector.h"
+#include "pmap.h"
+#include "pStatCollector.h"
+#include "cullableObject.h"
+
+class CullBin;
+class CullResult;
+class SceneSetup;
+
+////////////////////////////////////////////////////////////////////
+//       Class : CullBatcher
+// Description : This collects the CullableObjects added to a
+//               CullResult that share the same Geom, vertex data and
+//               state, differing only in their transform, such as the
+//               many copies of a single model placed around a scene,
+//               and draws each such group as a single Geom whose
+//               vertices have been transformed on the CPU into world
+//               space.
+//
+//               Building the combined Geom is relatively expensive,
+//               so it is only done when the same group of instances,
+//               with the same transforms, is seen on two consecutive
+//               frames; the result is kept until a frame in which
+//               that group is no longer seen the same.  Groups that
+//               are moving, then, are simply drawn one object at a
+//               time, as they would have been without the batcher.
+//
+//               A CullBatcher is created by a CullResult when
+//               cull-batching is enabled, and is passed along to the
+//               next frame's CullResult by make_next().
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_PGRAPH CullBatcher : public ReferenceCount {
+public:
+  CullBatcher();
+  ~CullBatcher();
+
+  bool add_object(CullableObject *object, CullBin *bin);
+  void finish_cull(CullResult *result, SceneSetup *scene_setup,
+                   Thread *current_thread);
+
+  INLINE int get_num_batches() const;
+
+private:
+  static bool is_batchable(const CullableObject *object, CullBin *bin);
+
+  // The objects in a group have identical values of all of these.
+  // The modified stamps are included so that a Geom or vertex data
+  // that is modified in place starts a new group, rather than reusing
+  // the combined Geoms built from its old contents.
+  class GroupKey {
+  public:
+    INLINE GroupKey(const CullableObject *object);
+    INLINE bool operator < (const GroupKey &other) const;
+
+    const Geom *_geom;
+    const GeomVertexData *_munged_data;
+    const RenderState *_state;
+    GeomMunger *_munger;
+    UpdateSeq _geom_modified;
+    UpdateSeq _data_modified;
+  };
+
+  typedef pvector<CullableObject *> Objects;
+  typedef pmap<GroupKey, Objects> Groups;
+  Groups _groups;
+
+  class SortByTransform {
+  public:
+    INLINE bool operator ()(const CullableObject *a,
+                            const CullableObject *b) const;
+  };
+
+  // A combined Geom, built for a run of the objects in a group.
+  class Chunk {
+  public:
+    CPT(Geom) _geom;
+    CPT(GeomVertexData) _data;
+  };
+  typedef pvector<Chunk> Chunks;
+
+  typedef pvector<CPT(TransformState) > Transforms;
+
+  // This records what we know about a group across frames.  It also
+  // holds a reference to each of the pointers in the GroupKey, so
+  // that they cannot be reused by a different object while we still
+  // have the entry.
+  class Entry {
+  public:
+    CPT(Geom) _geom;
+    CPT(GeomVertexData) _munged_data;
+    CPT(RenderState) _state;
+    PT(GeomMunger) _munger;
+
+    Transforms _transforms;
+    Chunks _chunks;
+    int _frame;
+  };
+  typedef pmap<GroupKey, Entry> Entries;
+  Entries _entries;
+
+  int _frame;
+  int _num_batches;
+
+  bool same_transforms(const Entry &entry, const Objects &objects) const;
+  void build_chunks(Entry &entry, const Objects &objects, int per_chunk,
+                    Thread *current_thread);
+  static CPT(Geom) build_chunk(const Geom *geom,
+                               const GeomVertexData *source,
+                               CPT(GeomVertexData) &data,
+                               Objects::const_iterator begin,
+                               Objects::const_iterator end,
+                               Thread *current_thread);
+
+  static PStatCollector _batch_pcollector;
+  static PStatCollector _build_pcollector;
+};
+
+#include "cullBatcher.I"
+
+#endif
@@ -31,6 +31,9 @@ PUBLISHED:
     BT_back_to_front,
     BT_front_to_back,
     BT_fixed,
+    BT_radix_state_sorted,
+    BT_radix_back_to_front,
+    BT_radix_front_to_back,
   };
 };
 
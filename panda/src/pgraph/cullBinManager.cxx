@@ -263,7 +263,12 @@ setup_initial_bins() {
     ("cull-bin", 
      PRC_DESC("Creates a new cull bin by name, with the specified properties.  "
               "This is a string in three tokens, separated by whitespace: "
-              "'bin_name sort type'."));
+              "'bin_name sort type'.  The type may be unsorted, state_sorted, "
+              "back_to_front, front_to_back, or fixed, or one of "
+              "radix_state_sorted, radix_back_to_front, or "
+              "radix_front_to_back, which sort by precomputed keys and are "
+              "faster for large bins.  A default bin may be redefined this "
+              "way, for instance 'opaque 20 radix_state_sorted'."));
   
   // First, add all of the bins specified in the Configrc file.
   int num_bins = cull_bin.get_num_unique_values();
@@ -344,6 +349,15 @@ parse_bin_type(const string &bin_type) {
   } else if (cmp_nocase_uh(bin_type, "front_to_back") == 0) {
     return BT_front_to_back;
 
+  } else if (cmp_nocase_uh(bin_type, "radix_state_sorted") == 0) {
+    return BT_radix_state_sorted;
+
+  } else if (cmp_nocase_uh(bin_type, "radix_back_to_front") == 0) {
+    return BT_radix_back_to_front;
+
+  } else if (cmp_nocase_uh(bin_type, "radix_front_to_back") == 0) {
+    return BT_radix_front_to_back;
+
   } else {
     return BT_invalid;
   }
@@ -373,6 +387,15 @@ operator << (ostream &out, CullBinManager::BinType bin_type) {
     
   case CullBinManager::BT_fixed:
     return out << "fixed";
+
+  case CullBinManager::BT_radix_state_sorted:
+    return out << "radix_state_sorted";
+
+  case CullBinManager::BT_radix_back_to_front:
+    return out << "radix_back_to_front";
+
+  case CullBinManager::BT_radix_front_to_back:
+    return out << "radix_front_to_back";
   }
 
   return out << "**invalid BinType(" << (int)bin_type << ")**";
@@ -0,0 +1,97 @@
+// Filename: cullFragment.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "cullFragment.h"
+#include "cullableObject.h"
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullFragment::Constructor
+//       Access: Public
+//  Description: 
+////////////////////////////////////////////////////////////////////
+CullFragment::
+CullFragment() :
+  _num_objects(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullFragment::Destructor
+//       Access: Public, Virtual
+//  Description: 
+////////////////////////////////////////////////////////////////////
+CullFragment::
+~CullFragment() {
+  clear();
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullFragment::record_object
+//       Access: Public, Virtual
+//  Description: Saves the object for later replay.  The CullFragment
+//               owns the object until it is replayed.
+////////////////////////////////////////////////////////////////////
+void CullFragment::
+record_object(CullableObject *object, const CullTraverser *) {
+  _entries.push_back(Entry(object, -1));
+  ++_num_objects;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullFragment::replay
+//       Access: Public
+//  Description: Passes all of the recorded objects to the indicated
+//               handler, in the order they were recorded.  Wherever a
+//               placeholder was recorded with record_fragment(), the
+//               corresponding fragment from the list is replayed in
+//               turn.
+//
+//               Ownership of the objects passes to the handler, and
+//               this fragment (and any that were replayed with it)
+//               is left empty.
+////////////////////////////////////////////////////////////////////
+void CullFragment::
+replay(CullHandler *handler, const CullTraverser *traverser,
+       const Fragments &fragments) {
+  Entries::const_iterator ei;
+  for (ei = _entries.begin(); ei != _entries.end(); ++ei) {
+    const Entry &entry = (*ei);
+    if (entry._object != (CullableObject *)NULL) {
+      handler->record_object(entry._object, traverser);
+    } else {
+      nassertd(entry._fragment >= 0 && entry._fragment < (int)fragments.size()) continue;
+      CullFragment *fragment = fragments[entry._fragment];
+      nassertd(fragment != this) continue;
+      fragment->replay(handler, traverser, fragments);
+    }
+  }
+  _entries.clear();
+  _num_objects = 0;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullFragment::clear
+//       Access: Public
+//  Description: Deletes all of the recorded objects without passing
+//               them on.
+////////////////////////////////////////////////////////////////////
+void CullFragment::
+clear() {
+  Entries::const_iterator ei;
+  for (ei = _entries.begin(); ei != _entries.end(); ++ei) {
+    delete (*ei)._object;
+  }
+  _entries.clear();
+  _num_objects = 0;
+}
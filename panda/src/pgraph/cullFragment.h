@@ -0,0 +1,72 @@
+// Filename: cullFragment.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef CULLFRAGMENT_H
+#define CULLFRAGMENT_H
+
+#include "pandabase.h"
+#include "cullHandler.h"
+#include "pvector.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : CullFragment
+// Description : A CullHandler that simply holds on to the objects it
+//               receives, in order, so that they may be passed along
+//               to another CullHandler later.
+//
+//               This is used by the parallel cull traversal: each
+//               piece of the scene graph culled by a separate thread
+//               records into its own CullFragment, and the fragments
+//               are replayed in scene graph order once all of the
+//               threads have finished, so that the final result does
+//               not depend on thread timing.  A fragment may also
+//               contain placeholders for other fragments, which are
+//               replayed in their place.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_PGRAPH CullFragment : public CullHandler {
+public:
+  CullFragment();
+  virtual ~CullFragment();
+
+  virtual void record_object(CullableObject *object, 
+                             const CullTraverser *traverser);
+  INLINE void record_fragment(int index);
+
+  INLINE bool is_empty() const;
+  INLINE int get_num_objects() const;
+
+  typedef pvector<CullFragment *> Fragments;
+  void replay(CullHandler *handler, const CullTraverser *traverser,
+              const Fragments &fragments);
+  void clear();
+
+private:
+  // Each entry is either an object (with _fragment == -1), or a
+  // placeholder for the fragment with the indicated index (with
+  // _object == NULL).
+  class Entry {
+  public:
+    INLINE Entry(CullableObject *object, int fragment);
+
+    CullableObject *_object;
+    int _fragment;
+  };
+  typedef pvector<Entry> Entries;
+  Entries _entries;
+  int _num_objects;
+};
+
+#include "cullFragment.I"
+
+#endif
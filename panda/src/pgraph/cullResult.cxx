@@ -26,9 +26,46 @@
 #include "renderState.h"
 #include "clockObject.h"
 #include "config_pgraph.h"
+#include "workerThreadPool.h"
+#include "pStatTimer.h"
+#include "textureAttrib.h"
+#include "textureResidencyManager.h"
+#include "preparedGraphicsObjects.h"
+#include "graphicsStateGuardianBase.h"
+#include "sceneSetup.h"
+#include "lens.h"
+#include "boundingVolume.h"
+#include "finiteBoundingVolume.h"
+#include "deg_2_rad.h"
+#include "cmath.h"
 
 TypeHandle CullResult::_type_handle;
 
+PStatCollector CullResult::_animate_parallel_pcollector("*:Animate Vertices:Parallel");
+
+// The vertex datas animated by one call to finish_animation(), one
+// per job.
+class CullResultAnimateJobs {
+public:
+  pvector<GeomVertexData *> _vdatas;
+  int _pipeline_stage;
+};
+
+static void
+animate_vertices_job_func(int job_index, Thread *current_thread, void *user_data) {
+  const CullResultAnimateJobs &jobs = *(const CullResultAnimateJobs *)user_data;
+
+  // Read the vertex data as the cull thread would.
+  int pipeline_stage = current_thread->get_pipeline_stage();
+  current_thread->set_pipeline_stage(jobs._pipeline_stage);
+
+  // There's no need to keep the result; the GeomVertexData caches it
+  // for finish_animation() to pick up.
+  jobs._vdatas[job_index]->animate_vertices(true, current_thread);
+
+  current_thread->set_pipeline_stage(pipeline_stage);
+}
+
 // This value is used instead of 1.0 to represent the alpha level of a
 // pixel that is to be considered "opaque" for the purposes of M_dual.
 
@@ -68,6 +105,15 @@ CullResult(GraphicsStateGuardianBase *gsg,
 #ifdef DO_MEMORY_USAGE
   MemoryUsage::update_type(this, get_class_type());
 #endif
+  if (cull_batching) {
+    _batcher = new CullBatcher;
+  }
+  if (_gsg != (GraphicsStateGuardianBase *)NULL) {
+    PreparedGraphicsObjects *pgo = _gsg->get_prepared_objects();
+    if (pgo != (PreparedGraphicsObjects *)NULL) {
+      _residency_manager = pgo->get_texture_residency_manager();
+    }
+  }
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -95,6 +141,11 @@ make_next() const {
     }
   }
 
+  // The batcher keeps its record of the previous frames.
+  if (_batcher != (CullBatcher *)NULL) {
+    new_result->_batcher = _batcher;
+  }
+
   return new_result;
 }
 
@@ -114,11 +165,16 @@ add_object(CullableObject *object, const CullTraverser *traverser) {
 
   bool force = !traverser->get_effective_incomplete_render();
   Thread *current_thread = traverser->get_current_thread();
+  bool defer = (animate_vertices_threads > 1);
 
   // Check to see if there's a special transparency setting.
   const RenderState *state = object->_state;
   nassertv(state != (const RenderState *)NULL);
 
+  if (_residency_manager != (TextureResidencyManager *)NULL) {
+    request_texture_sizes(object, traverser);
+  }
+
   const TransparencyAttrib *trans = DCAST(TransparencyAttrib, state->get_attrib(TransparencyAttrib::get_class_slot()));
   if (trans != (const TransparencyAttrib *)NULL) {
     switch (trans->get_mode()) {
@@ -184,7 +240,10 @@ add_object(CullableObject *object, const CullTraverser *traverser) {
               transparent_part->_state = state->compose(transparent_state);
               if (transparent_part->munge_geom
                   (_gsg, _gsg->get_geom_munger(transparent_part->_state, current_thread),
-                   traverser, force)) {
+                   traverser, force, defer)) {
+                if (defer) {
+                  defer_animation(transparent_part, force);
+                }
                 CullBin *bin = get_bin(transparent_part->_state->get_bin_index());
                 nassertv(bin != (CullBin *)NULL);
 #ifndef NDEBUG
@@ -226,11 +285,19 @@ add_object(CullableObject *object, const CullTraverser *traverser) {
 
   // Munge vertices as needed for the GSG's requirements, and the
   // object's current state.
-  if (object->munge_geom(_gsg, _gsg->get_geom_munger(object->_state, current_thread), traverser, force)) {
+  if (object->munge_geom(_gsg, _gsg->get_geom_munger(object->_state, current_thread), traverser, force, defer)) {
+    if (defer) {
+      defer_animation(object, force);
+    }
     // The object may or may not now be fully resident, but this may
     // not matter, since the GSG may have the necessary buffers
     // already loaded.  We'll let the GSG ultimately decide whether to
     // render it.
+    if (_batcher != (CullBatcher *)NULL &&
+        _batcher->add_object(object, bin)) {
+      // The batcher will add it to the bin in finish_cull().
+      return;
+    }
     bin->add_object(object, current_thread);
   } else {
     delete object;
@@ -248,6 +315,15 @@ add_object(CullableObject *object, const CullTraverser *traverser) {
 ////////////////////////////////////////////////////////////////////
 void CullResult::
 finish_cull(SceneSetup *scene_setup, Thread *current_thread) {
+  // First, compute any vertex animation we put off during the
+  // traversal, before the bins have a chance to look at the objects.
+  finish_animation(current_thread);
+
+  // Then add the objects held by the batcher to their bins.
+  if (_batcher != (CullBatcher *)NULL) {
+    _batcher->finish_cull(this, scene_setup, current_thread);
+  }
+
   CullBinManager *bin_manager = CullBinManager::get_global_ptr();
 
   for (size_t i = 0; i < _bins.size(); ++i) {
@@ -275,6 +351,9 @@ void CullResult::
 draw(Thread *current_thread) {
   bool force = !_gsg->get_effective_incomplete_render();
 
+  // This will normally have been done already by finish_cull().
+  finish_animation(current_thread);
+
   // Ask the bin manager for the correct order to draw all the bins.
   CullBinManager *bin_manager = CullBinManager::get_global_ptr();
   int num_bins = bin_manager->get_num_bins();
@@ -360,6 +439,160 @@ make_new_bin(int bin_index) {
   return bin;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: CullResult::request_texture_sizes
+//       Access: Private
+//  Description: Estimates the size on screen, in pixels, of the
+//               indicated object, from the bounding sphere of its
+//               Geom, and reports it to the TextureResidencyManager
+//               for each of the object's textures, so that it can
+//               decide which mipmap levels of them are needed.
+////////////////////////////////////////////////////////////////////
+void CullResult::
+request_texture_sizes(const CullableObject *object,
+                      const CullTraverser *traverser) {
+  const TextureAttrib *tex_attrib = DCAST(TextureAttrib, object->_state->get_attrib(TextureAttrib::get_class_slot()));
+  if (tex_attrib == (const TextureAttrib *)NULL ||
+      tex_attrib->get_num_on_stages() == 0 ||
+      object->_geom == (const Geom *)NULL ||
+      object->_modelview_transform == (const TransformState *)NULL) {
+    return;
+  }
+
+  SceneSetup *scene = traverser->get_scene();
+  const Lens *lens = scene->get_lens();
+  PN_stdfloat viewport_height = (PN_stdfloat)scene->get_viewport_height();
+
+  CPT(BoundingVolume) bounds = object->_geom->get_bounds(traverser->get_current_thread());
+  if (bounds->is_empty()) {
+    return;
+  }
+
+  // An object we can't measure is assumed to fill the screen.
+  PN_stdfloat pixels = viewport_height;
+  const FiniteBoundingVolume *fbv = bounds->as_finite_bounding_volume();
+  if (fbv != (const FiniteBoundingVolume *)NULL) {
+    LPoint3 min_point = fbv->get_min();
+    LPoint3 max_point = fbv->get_max();
+    PN_stdfloat radius = (max_point - min_point).length() * 0.5f;
+
+    const LMatrix4 &mat = object->_modelview_transform->get_mat();
+    LPoint3 center = ((min_point + max_point) * 0.5f) * mat;
+    PN_stdfloat scale = max(max(mat.get_row3(0).length(),
+                                mat.get_row3(1).length()),
+                            mat.get_row3(2).length());
+    radius *= scale;
+
+    if (lens->is_orthographic()) {
+      PN_stdfloat film_height = lens->get_film_size()[1];
+      if (film_height > 0.0f) {
+        pixels = radius * 2.0f * viewport_height / film_height;
+      }
+    } else {
+      PN_stdfloat distance = center.length();
+      PN_stdfloat fov = lens->get_fov()[1];
+      if (distance > radius && fov > 0.0f) {
+        PN_stdfloat focal = viewport_height * 0.5f / ctan(deg_2_rad(fov * 0.5f));
+        pixels = radius * 2.0f * focal / distance;
+      }
+    }
+  }
+
+  int num_stages = tex_attrib->get_num_on_stages();
+  for (int i = 0; i < num_stages; ++i) {
+    Texture *tex = tex_attrib->get_on_texture(tex_attrib->get_on_stage(i));
+    if (tex != (Texture *)NULL) {
+      _residency_manager->request_size(tex, pixels);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullResult::defer_animation
+//       Access: Private
+//  Description: Records the indicated object, and any decals chained
+//               to it, for finish_animation() if munge_geom() left
+//               its vertex animation undone.
+////////////////////////////////////////////////////////////////////
+void CullResult::
+defer_animation(CullableObject *object, bool force) {
+  while (object != (CullableObject *)NULL) {
+    if (object->has_cpu_animation()) {
+      DeferredObject deferred;
+      deferred._object = object;
+      deferred._force = force;
+      _deferred_animation.push_back(deferred);
+    }
+    object = object->get_next();
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullResult::finish_animation
+//       Access: Private
+//  Description: Computes the vertex animation for all of the objects
+//               recorded by defer_animation().  Each distinct
+//               GeomVertexData whose animation is out of date is
+//               animated by a separate job on a WorkerThreadPool of
+//               animate-vertices-threads threads, which returns when
+//               all of them are done; then each object picks up its
+//               (now cached) animated vertices.
+////////////////////////////////////////////////////////////////////
+void CullResult::
+finish_animation(Thread *current_thread) {
+  if (_deferred_animation.empty()) {
+    return;
+  }
+
+  PStatTimer timer(_animate_parallel_pcollector, current_thread);
+
+  // Several objects may share the same vertex data, as with the
+  // different Geoms of one Character; each need be animated only
+  // once, and it must be animated if any of those objects was culled
+  // with force set.
+  typedef pmap<const GeomVertexData *, bool> VertexDatas;
+  VertexDatas vdatas;
+
+  DeferredObjects::const_iterator oi;
+  for (oi = _deferred_animation.begin(); oi != _deferred_animation.end(); ++oi) {
+    const GeomVertexData *vdata = (*oi)._object->_munged_data;
+    VertexDatas::iterator vi = vdatas.insert(VertexDatas::value_type(vdata, false)).first;
+    (*vi).second = (*vi).second || (*oi)._force;
+  }
+
+  int num_threads = animate_vertices_threads;
+  if (vdatas.size() > 1 && num_threads > 1) {
+    CullResultAnimateJobs jobs;
+    jobs._pipeline_stage = current_thread->get_pipeline_stage();
+
+    VertexDatas::const_iterator vi;
+    for (vi = vdatas.begin(); vi != vdatas.end(); ++vi) {
+      const GeomVertexData *vdata = (*vi).first;
+      if (vdata->is_animation_stale(current_thread) &&
+          ((*vi).second || vdata->request_resident())) {
+        jobs._vdatas.push_back((GeomVertexData *)vdata);
+      }
+    }
+
+    if (jobs._vdatas.size() > 1) {
+      PT(WorkerThreadPool) pool =
+        WorkerThreadPool::get_shared("AnimateVertices", num_threads);
+      pool->run_jobs((int)jobs._vdatas.size(), &animate_vertices_job_func, &jobs);
+    }
+  }
+
+  // Now replace each object's vertex data with the animated result.
+  // This is just a cache lookup for the vertex datas animated above;
+  // anything else is simply animated here.
+  for (oi = _deferred_animation.begin(); oi != _deferred_animation.end(); ++oi) {
+    CullableObject *object = (*oi)._object;
+    object->_munged_data =
+      object->_munged_data->animate_vertices((*oi)._force, current_thread);
+  }
+
+  _deferred_animation.clear();
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: CullResult::get_alpha_state
 //       Access: Private
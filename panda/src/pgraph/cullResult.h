@@ -19,12 +19,14 @@
 #include "cullBin.h"
 #include "renderState.h"
 #include "cullableObject.h"
+#include "cullBatcher.h"
 #include "geomMunger.h"
 #include "referenceCount.h"
 #include "pointerTo.h"
 #include "pvector.h"
 #include "pset.h"
 #include "pmap.h"
+#include "pStatCollector.h"
 
 
 class GraphicsStateGuardianBase;
@@ -32,6 +34,7 @@ class CullTraverser;
 class TransformState;
 class RenderState;
 class SceneSetup;
+class TextureResidencyManager;
 
 ////////////////////////////////////////////////////////////////////
 //       Class : CullResult
@@ -69,6 +72,12 @@ private:
   void check_flash_bin(CPT(RenderState) &state, CullBin *bin);
   void check_flash_transparency(CPT(RenderState) &state, const LColor &color);
 
+  void request_texture_sizes(const CullableObject *object,
+                             const CullTraverser *traverser);
+
+  void defer_animation(CullableObject *object, bool force);
+  void finish_animation(Thread *current_thread);
+
   static CPT(RenderState) get_alpha_state();
   static CPT(RenderState) get_binary_state();
   static CPT(RenderState) get_dual_transparent_state();
@@ -81,6 +90,29 @@ private:
   typedef pvector< PT(CullBin) > Bins;
   Bins _bins;
 
+  // The objects whose CPU vertex animation has been put off until
+  // finish_cull(), when animate-vertices-threads is nonzero, each with
+  // the force flag it was culled with.  The objects themselves are
+  // owned by the bins.
+  class DeferredObject {
+  public:
+    CullableObject *_object;
+    bool _force;
+  };
+  typedef pvector<DeferredObject> DeferredObjects;
+  DeferredObjects _deferred_animation;
+
+  // The objects that might be drawn in combination with others, when
+  // cull-batching is enabled.  This is shared with the CullResults of
+  // following frames.
+  PT(CullBatcher) _batcher;
+
+  // The object that is told how big each texture is drawn, when
+  // texture-streaming is enabled.
+  PT(TextureResidencyManager) _residency_manager;
+
+  static PStatCollector _animate_parallel_pcollector;
+
 public:
   static TypeHandle get_class_type() {
     return _type_handle;
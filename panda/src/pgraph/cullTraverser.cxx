@@ -36,14 +36,72 @@
 #include "geomLinestrips.h"
 #include "geomLines.h"
 #include "geomVertexWriter.h"
+#include "cullFragment.h"
+#include "pStatTimer.h"
 
 PStatCollector CullTraverser::_nodes_pcollector("Nodes");
 PStatCollector CullTraverser::_geom_nodes_pcollector("Nodes:GeomNodes");
 PStatCollector CullTraverser::_geoms_pcollector("Geoms");
 PStatCollector CullTraverser::_geoms_occluded_pcollector("Geoms:Occluded");
+PStatCollector CullTraverser::_parallel_pcollector("Cull:Parallel");
+PStatCollector CullTraverser::_parallel_split_pcollector("Cull:Parallel:Split");
+PStatCollector CullTraverser::_parallel_traverse_pcollector("Cull:Parallel:Traverse");
+PStatCollector CullTraverser::_parallel_merge_pcollector("Cull:Parallel:Merge");
 
 TypeHandle CullTraverser::_type_handle;
 
+////////////////////////////////////////////////////////////////////
+//       Class : CullTraverser::ParallelTask
+// Description : One piece of a parallel traversal: the subtree below
+//               a particular node, along with everything needed to
+//               resume the traversal at that node from another
+//               thread, and the fragment that receives the culled
+//               objects.
+////////////////////////////////////////////////////////////////////
+class CullTraverser::ParallelTask {
+public:
+  ParallelTask(const CullTraverser *trav, const CullTraverserData &data);
+
+  const CullTraverser *_trav;
+
+  // We must store a complete NodePath here, rather than the
+  // WorkingNodePath in the CullTraverserData, since the latter refers
+  // to its parents on the stack of the splitting pass.
+  NodePath _node_path;
+  CPT(TransformState) _net_transform;
+  CPT(RenderState) _state;
+  PT(GeometricBoundingVolume) _view_frustum;
+  CPT(CullPlanes) _cull_planes;
+  DrawMask _draw_mask;
+  int _portal_depth;
+
+  // The pipeline stage of the thread that started the traversal; the
+  // worker threads must read the scene graph at the same stage.
+  int _pipeline_stage;
+
+  CullFragment _fragment;
+  LevelCounts _level_counts;
+};
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullTraverser::ParallelTask::Constructor
+//       Access: Public
+//  Description: 
+////////////////////////////////////////////////////////////////////
+CullTraverser::ParallelTask::
+ParallelTask(const CullTraverser *trav, const CullTraverserData &data) :
+  _trav(trav),
+  _node_path(data._node_path.get_node_path()),
+  _net_transform(data._net_transform),
+  _state(data._state),
+  _view_frustum(data._view_frustum),
+  _cull_planes(data._cull_planes),
+  _draw_mask(data._draw_mask),
+  _portal_depth(data._portal_depth),
+  _pipeline_stage(trav->get_current_thread()->get_pipeline_stage())
+{
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: CullTraverser::Constructor
 //       Access: Published
@@ -52,11 +110,16 @@ TypeHandle CullTraverser::_type_handle;
 CullTraverser::
 CullTraverser() :
   _gsg(NULL),
-  _current_thread(Thread::get_current_thread())
+  _current_thread(Thread::get_current_thread()),
+  _num_threads(1),
+  _parallel_tasks(NULL),
+  _parallel_fragment(NULL),
+  _level_counts(NULL)
 {
   _camera_mask = DrawMask::all_on();
   _has_tag_state_key = false;
   _initial_state = RenderState::make_empty();
+  _clip_plane_cull = clip_plane_cull;
   _cull_handler = (CullHandler *)NULL;
   _portal_clipper = (PortalClipper *)NULL;
   _effective_incomplete_render = true;
@@ -76,11 +139,16 @@ CullTraverser(const CullTraverser &copy) :
   _has_tag_state_key(copy._has_tag_state_key),
   _tag_state_key(copy._tag_state_key),
   _initial_state(copy._initial_state),
+  _clip_plane_cull(copy._clip_plane_cull),
   _depth_offset_decals(copy._depth_offset_decals),
   _view_frustum(copy._view_frustum),
   _cull_handler(copy._cull_handler),
   _portal_clipper(copy._portal_clipper),
-  _effective_incomplete_render(copy._effective_incomplete_render)
+  _effective_incomplete_render(copy._effective_incomplete_render),
+  _num_threads(copy._num_threads),
+  _parallel_tasks(NULL),
+  _parallel_fragment(NULL),
+  _level_counts(NULL)
 {
 }
 
@@ -90,6 +158,10 @@ CullTraverser(const CullTraverser &copy) :
 //  Description: Sets the SceneSetup object that indicates the initial
 //               camera position, etc.  This must be called before
 //               traversal begins.
+//
+//               The gsg may be NULL if the objects are not going to
+//               be drawn, for instance when the CullHandler only
+//               collects them.
 ////////////////////////////////////////////////////////////////////
 void CullTraverser::
 set_scene(SceneSetup *scene_setup, GraphicsStateGuardianBase *gsg,
@@ -98,7 +170,12 @@ set_scene(SceneSetup *scene_setup, GraphicsStateGuardianBase *gsg,
   _gsg = gsg;
 
   _initial_state = scene_setup->get_initial_state();
-  _depth_offset_decals = _gsg->depth_offset_decals() && depth_offset_decals;
+  _depth_offset_decals = false;
+  _effective_incomplete_render = false;
+  if (_gsg != (GraphicsStateGuardianBase *)NULL) {
+    _depth_offset_decals = _gsg->depth_offset_decals() && depth_offset_decals;
+    _effective_incomplete_render = _gsg->get_incomplete_render() && dr_incomplete_render;
+  }
 
   _current_thread = Thread::get_current_thread();
 
@@ -106,8 +183,6 @@ set_scene(SceneSetup *scene_setup, GraphicsStateGuardianBase *gsg,
   _tag_state_key = camera->get_tag_state_key();
   _has_tag_state_key = !_tag_state_key.empty();
   _camera_mask = camera->get_camera_mask();
-
-  _effective_incomplete_render = _gsg->get_incomplete_render() && dr_incomplete_render;
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -166,7 +241,14 @@ traverse(const NodePath &root) {
                            _initial_state, _view_frustum, 
                            _current_thread);
     
-    traverse(data);
+    if (_num_threads > 1 && get_type() == CullTraverser::get_class_type()) {
+      // A derived class may keep state of its own during the
+      // traversal, which we wouldn't know how to share among threads,
+      // so only the base class is parallelized.
+      parallel_traverse(data);
+    } else {
+      traverse(data);
+    }
   }
 }
 
@@ -239,7 +321,7 @@ traverse(CullTraverserData &data) {
 ////////////////////////////////////////////////////////////////////
 void CullTraverser::
 traverse_below(CullTraverserData &data) {
-  _nodes_pcollector.add_level(1);
+  count_nodes(1);
   PandaNodePipelineReader *node_reader = data.node_reader();
   PandaNode *node = data.node();
 
@@ -275,23 +357,164 @@ traverse_below(CullTraverserData &data) {
     PandaNode::Children children = node_reader->get_children();
     node_reader->release();
     int num_children = children.get_num_children();
+
+    // If we are splitting up a parallel traversal, and this node is
+    // wide enough to be worth it, hand off each child to be traversed
+    // separately instead of traversing it now.  A child with a cull
+    // callback or a Fog anywhere below it is traversed here instead,
+    // since those change shared state during cull; it may still be
+    // split further down.
+    bool split = (_parallel_tasks != (ParallelTasks *)NULL &&
+                  num_children >= parallel_cull_min_children);
+
     if (node->has_selective_visibility()) {
       int i = node->get_first_visible_child();
       while (i < num_children) {
         CullTraverserData next_data(data, children.get_child(i));
-        traverse(next_data);
+        if (split && !next_data.node_reader()->has_net_cull_callback()) {
+          add_parallel_task(next_data);
+        } else {
+          traverse(next_data);
+        }
         i = node->get_next_visible_child(i);
       }
       
     } else {
       for (int i = 0; i < num_children; i++) {
         CullTraverserData next_data(data, children.get_child(i));
-        traverse(next_data);
+        if (split && !next_data.node_reader()->has_net_cull_callback()) {
+          add_parallel_task(next_data);
+        } else {
+          traverse(next_data);
+        }
       }
     }
   }
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: CullTraverser::parallel_traverse
+//       Access: Private
+//  Description: Performs the traversal beginning at the indicated
+//               root, dividing the work among _num_threads threads.
+//
+//               This happens in three steps.  First, we traverse the
+//               top of the scene graph normally in this thread, but
+//               whenever we encounter a node with at least
+//               parallel-cull-min-children children, we set each of
+//               its children aside as a separate task instead of
+//               traversing it.  Then the tasks are traversed by the
+//               thread pool, each one into its own CullFragment.
+//               Finally, all of the fragments are passed along to the
+//               real CullHandler in the order in which a serial
+//               traversal would have encountered them.
+//
+//               The worker threads adopt this thread's pipeline stage
+//               for their tasks.  Cull callbacks within the tasks are
+//               run on the worker threads; see set_num_threads().
+////////////////////////////////////////////////////////////////////
+void CullTraverser::
+parallel_traverse(CullTraverserData &data) {
+  PStatTimer timer(_parallel_pcollector, _current_thread);
+
+  PT(WorkerThreadPool) pool =
+    WorkerThreadPool::get_shared("Cull", _num_threads);
+
+  CullHandler *cull_handler = _cull_handler;
+  CullFragment root_fragment;
+  ParallelTasks tasks;
+
+  {
+    PStatTimer timer(_parallel_split_pcollector, _current_thread);
+    _cull_handler = &root_fragment;
+    _parallel_fragment = &root_fragment;
+    _parallel_tasks = &tasks;
+
+    traverse(data);
+
+    _parallel_tasks = NULL;
+    _parallel_fragment = NULL;
+    _cull_handler = cull_handler;
+  }
+
+  {
+    PStatTimer timer(_parallel_traverse_pcollector, _current_thread);
+    pool->run_jobs((int)tasks.size(), &parallel_task_func, &tasks);
+  }
+
+  {
+    PStatTimer timer(_parallel_merge_pcollector, _current_thread);
+    CullFragment::Fragments fragments;
+    fragments.reserve(tasks.size());
+    ParallelTasks::const_iterator ti;
+    for (ti = tasks.begin(); ti != tasks.end(); ++ti) {
+      fragments.push_back(&(*ti)->_fragment);
+    }
+    root_fragment.replay(_cull_handler, this, fragments);
+
+    for (ti = tasks.begin(); ti != tasks.end(); ++ti) {
+      const LevelCounts &counts = (*ti)->_level_counts;
+      count_nodes(counts._nodes);
+      count_geom_nodes(counts._geom_nodes);
+      count_geoms(counts._geoms);
+      delete (*ti);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullTraverser::add_parallel_task
+//       Access: Private
+//  Description: Called during the splitting pass of
+//               parallel_traverse() to set aside the indicated node
+//               (which has not yet been traversed) to be traversed
+//               later by one of the threads.
+////////////////////////////////////////////////////////////////////
+void CullTraverser::
+add_parallel_task(const CullTraverserData &data) {
+  nassertv(_parallel_tasks != (ParallelTasks *)NULL &&
+           _parallel_fragment != (CullFragment *)NULL);
+
+  // Leave a placeholder so the task's objects are replayed at this
+  // point in the sequence.
+  _parallel_fragment->record_fragment((int)_parallel_tasks->size());
+  _parallel_tasks->push_back(new ParallelTask(this, data));
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullTraverser::parallel_task_func
+//       Access: Private, Static
+//  Description: The WorkerThreadPool job function for
+//               parallel_traverse().  Traverses the subtree for the
+//               nth task, using a private copy of the traverser that
+//               records into the task's fragment.
+////////////////////////////////////////////////////////////////////
+void CullTraverser::
+parallel_task_func(int job_index, Thread *current_thread, void *user_data) {
+  ParallelTasks *tasks = (ParallelTasks *)user_data;
+  ParallelTask *task = (*tasks)[job_index];
+
+  // Read the scene graph as the cull thread would.
+  int pipeline_stage = current_thread->get_pipeline_stage();
+  current_thread->set_pipeline_stage(task->_pipeline_stage);
+
+  CullTraverser trav(*task->_trav);
+  trav._current_thread = current_thread;
+  trav._cull_handler = &task->_fragment;
+  trav._level_counts = &task->_level_counts;
+
+  CullTraverserData data(task->_node_path, task->_net_transform,
+                         task->_state, task->_view_frustum,
+                         current_thread);
+  data._cull_planes = task->_cull_planes;
+  data._draw_mask = task->_draw_mask;
+  data._portal_depth = task->_portal_depth;
+
+  trav.traverse(data);
+
+  current_thread->set_pipeline_stage(pipeline_stage);
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: CullTraverser::end_traverse
 //       Access: Published, Virtual
@@ -317,7 +540,7 @@ draw_bounding_volume(const BoundingVolume *vol,
   PT(Geom) bounds_viz = make_bounds_viz(vol);
   
   if (bounds_viz != (Geom *)NULL) {
-    _geoms_pcollector.add_level(2);
+    count_geoms(2);
     CullableObject *outer_viz = 
       new CullableObject(bounds_viz, get_bounds_outer_viz_state(), 
                          net_transform, modelview_transform, get_scene());
@@ -359,7 +582,7 @@ show_bounds(CullTraverserData &data, bool tight) {
     PT(Geom) bounds_viz = make_tight_bounds_viz(node);
 
     if (bounds_viz != (Geom *)NULL) {
-      _geoms_pcollector.add_level(1);
+      count_geoms(1);
       CullableObject *outer_viz = 
         new CullableObject(bounds_viz, get_bounds_outer_viz_state(), 
                            net_transform, modelview_transform,
@@ -703,7 +926,7 @@ start_decal(const CullTraverserData &data) {
   GeomNode *geom_node = DCAST(GeomNode, node);
   GeomNode::Geoms geoms = geom_node->get_geoms();
   int num_geoms = geoms.get_num_geoms();
-  _geoms_pcollector.add_level(num_geoms);
+  count_geoms(num_geoms);
   CPT(TransformState) net_transform = data.get_net_transform(this);
   CPT(TransformState) modelview_transform = data.get_modelview_transform(this);
   CPT(TransformState) internal_transform = _scene_setup->get_cs_transform()->compose(modelview_transform);
@@ -816,7 +1039,7 @@ r_get_decals(CullTraverserData &data, CullableObject *decals) {
       GeomNode *geom_node = DCAST(GeomNode, node);
       GeomNode::Geoms geoms = geom_node->get_geoms();
       int num_geoms = geoms.get_num_geoms();
-      _geoms_pcollector.add_level(num_geoms);
+      count_geoms(num_geoms);
       CPT(TransformState) net_transform = data.get_net_transform(this);
       CPT(TransformState) modelview_transform = data.get_modelview_transform(this);
       CPT(TransformState) internal_transform = _scene_setup->get_cs_transform()->compose(modelview_transform);
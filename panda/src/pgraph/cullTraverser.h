@@ -27,6 +27,8 @@
 #include "drawMask.h"
 #include "typedReferenceCount.h"
 #include "pStatCollector.h"
+#include "workerThreadPool.h"
+#include "pvector.h"
 
 class GraphicsStateGuardian;
 class PandaNode;
@@ -35,6 +37,7 @@ class CullableObject;
 class CullTraverserData;
 class PortalClipper;
 class NodePath;
+class CullFragment;
 
 ////////////////////////////////////////////////////////////////////
 //       Class : CullTraverser
@@ -71,6 +74,9 @@ PUBLISHED:
   INLINE void set_view_frustum(GeometricBoundingVolume *view_frustum);
   INLINE GeometricBoundingVolume *get_view_frustum() const;
 
+  INLINE void set_clip_plane_cull(bool clip_plane_cull);
+  INLINE bool get_clip_plane_cull() const;
+
   INLINE void set_cull_handler(CullHandler *cull_handler);
   INLINE CullHandler *get_cull_handler() const;
 
@@ -79,6 +85,9 @@ PUBLISHED:
 
   INLINE bool get_effective_incomplete_render() const;
 
+  INLINE void set_num_threads(int num_threads);
+  INLINE int get_num_threads() const;
+
   void traverse(const NodePath &root);
   void traverse(CullTraverserData &data);
   virtual void traverse_below(CullTraverserData &data);
@@ -100,6 +109,14 @@ public:
   static PStatCollector _geom_nodes_pcollector;
   static PStatCollector _geoms_pcollector;
   static PStatCollector _geoms_occluded_pcollector;
+  static PStatCollector _parallel_pcollector;
+  static PStatCollector _parallel_split_pcollector;
+  static PStatCollector _parallel_traverse_pcollector;
+  static PStatCollector _parallel_merge_pcollector;
+
+  INLINE void count_nodes(int n) const;
+  INLINE void count_geom_nodes(int n) const;
+  INLINE void count_geoms(int n) const;
 
 private:
   void show_bounds(CullTraverserData &data, bool tight);
@@ -114,6 +131,26 @@ private:
   CullableObject *r_get_decals(CullTraverserData &data,
                                CullableObject *decals);
 
+  class ParallelTask;
+  typedef pvector<ParallelTask *> ParallelTasks;
+
+  // The numbers of nodes and geoms visited by one worker of a
+  // parallel traversal.  PStatCollector levels may only be changed by
+  // one thread at a time, so these are added to the collectors by the
+  // calling thread once the workers have finished.
+  class LevelCounts {
+  public:
+    INLINE LevelCounts();
+    int _nodes;
+    int _geom_nodes;
+    int _geoms;
+  };
+
+  void parallel_traverse(CullTraverserData &data);
+  void add_parallel_task(const CullTraverserData &data);
+  static void parallel_task_func(int job_index, Thread *current_thread,
+                                 void *user_data);
+
   GraphicsStateGuardianBase *_gsg;
   Thread *_current_thread;
   PT(SceneSetup) _scene_setup;
@@ -121,11 +158,23 @@ private:
   bool _has_tag_state_key;
   string _tag_state_key;
   CPT(RenderState) _initial_state;
+  bool _clip_plane_cull;
   bool _depth_offset_decals;
   PT(GeometricBoundingVolume) _view_frustum;
   CullHandler *_cull_handler;
   PortalClipper *_portal_clipper;
   bool _effective_incomplete_render;
+
+  // These are used to divide the traversal among several threads;
+  // see parallel_traverse().  _parallel_tasks is non-NULL only while
+  // the initial, splitting pass of a parallel traversal is underway.
+  int _num_threads;
+  ParallelTasks *_parallel_tasks;
+  CullFragment *_parallel_fragment;
+
+  // This is non-NULL in a worker's copy of the traverser, which counts
+  // into it rather than into the PStatCollectors.
+  LevelCounts *_level_counts;
   
 public:
   static TypeHandle get_class_type() {
@@ -114,7 +114,7 @@ apply_transform_and_state(CullTraverser *trav,
 
   _state = _state->compose(node_state);
 
-  if (clip_plane_cull) {
+  if (trav->get_clip_plane_cull()) {
     _cull_planes = _cull_planes->apply_state(trav, this, 
                                              DCAST(ClipPlaneAttrib, node_state->get_attrib(ClipPlaneAttrib::get_class_slot())),
                                              DCAST(ClipPlaneAttrib, off_clip_planes),
@@ -52,11 +52,19 @@ TypeHandle CullableObject::_type_handle;
 //               false if the vertex data is nonresident.  If force is
 //               true, this will always return true, but it may have
 //               to block while the vertex data is paged in.
+//
+//               If defer_animation is true, any vertex animation that
+//               must be computed on the CPU is left undone, and
+//               _munged_data is left unanimated; the caller is then
+//               responsible for replacing _munged_data with the
+//               result of animate_vertices() before the object is
+//               drawn.  CullResult uses this to animate many objects
+//               in parallel.
 ////////////////////////////////////////////////////////////////////
 bool CullableObject::
 munge_geom(GraphicsStateGuardianBase *gsg,
            GeomMunger *munger, const CullTraverser *traverser,
-           bool force) {
+           bool force, bool defer_animation) {
   nassertr(munger != (GeomMunger *)NULL, false);
   Thread *current_thread = traverser->get_current_thread();
   PStatTimer timer(_munge_geom_pcollector, current_thread);
@@ -154,11 +162,17 @@ munge_geom(GraphicsStateGuardianBase *gsg,
       // has been munged--that is, we couldn't arrange to handle the
       // animation in hardware--then we have to calculate that
       // animation now.
-      CPT(GeomVertexData) animated_vertices = 
-        _munged_data->animate_vertices(force, current_thread);
-      if (animated_vertices != _munged_data) {
-        cpu_animated = true;
-        _munged_data = animated_vertices;
+      if (defer_animation) {
+        // Unless the caller has asked to do it later.
+        cpu_animated = has_cpu_animation();
+
+      } else {
+        CPT(GeomVertexData) animated_vertices = 
+          _munged_data->animate_vertices(force, current_thread);
+        if (animated_vertices != _munged_data) {
+          cpu_animated = true;
+          _munged_data = animated_vertices;
+        }
       }
     }
 
@@ -183,9 +197,9 @@ munge_geom(GraphicsStateGuardianBase *gsg,
     if (_next != (CullableObject *)NULL) {
       if (_next->_state != (RenderState *)NULL) {
         _next->munge_geom(gsg, gsg->get_geom_munger(_next->_state, current_thread),
-                          traverser, force);
+                          traverser, force, defer_animation);
       } else {
-        _next->munge_geom(gsg, munger, traverser, force);
+        _next->munge_geom(gsg, munger, traverser, force, defer_animation);
       }
     }
   }
@@ -66,7 +66,8 @@ public:
 
   bool munge_geom(GraphicsStateGuardianBase *gsg,
                   GeomMunger *munger, const CullTraverser *traverser,
-                  bool force);
+                  bool force, bool defer_animation = false);
+  INLINE bool has_cpu_animation() const;
   INLINE void draw(GraphicsStateGuardianBase *gsg,
                    bool force, Thread *current_thread);
 
@@ -529,7 +529,7 @@ is_renderable() const {
 ////////////////////////////////////////////////////////////////////
 void GeomNode::
 add_for_draw(CullTraverser *trav, CullTraverserData &data) {
-  trav->_geom_nodes_pcollector.add_level(1);
+  trav->count_geom_nodes(1);
 
   if (pgraph_cat.is_spam()) {
     pgraph_cat.spam()
@@ -540,7 +540,7 @@ add_for_draw(CullTraverser *trav, CullTraverserData &data) {
   // Get all the Geoms, with no decalling.
   Geoms geoms = get_geoms(trav->get_current_thread());
   int num_geoms = geoms.get_num_geoms();
-  trav->_geoms_pcollector.add_level(num_geoms);
+  trav->count_geoms(num_geoms);
   CPT(TransformState) net_transform = data.get_net_transform(trav);
   CPT(TransformState) modelview_transform = data.get_modelview_transform(trav);
   CPT(TransformState) internal_transform = trav->get_scene()->get_cs_transform()->compose(modelview_transform);
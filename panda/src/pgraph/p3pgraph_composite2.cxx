@@ -1,7 +1,9 @@
+#include "cullBatcher.cxx"
 #include "cullBin.cxx"
 #include "cullBinAttrib.cxx"
 #include "cullBinManager.cxx"
 #include "cullFaceAttrib.cxx"
+#include "cullFragment.cxx"
 #include "cullHandler.cxx"
 #include "cullPlanes.cxx"
 #include "cullResult.cxx"
@@ -16,6 +16,8 @@
 #include "showBoundsEffect.cxx"
 #include "stateMunger.cxx"
 #include "stencilAttrib.cxx"
+#include "stripedReMutex.cxx"
+#include "stripedReMutexHolder.cxx"
 #include "texMatrixAttrib.cxx"
 #include "texProjectorEffect.cxx"
 #include "textureAttrib.cxx"
@@ -22,6 +22,7 @@
 #include "sceneGraphReducer.h"
 #include "accumulatedAttribs.h"
 #include "clipPlaneAttrib.h"
+#include "fogAttrib.h"
 #include "boundingSphere.h"
 #include "boundingBox.h"
 #include "pStatTimer.h"
@@ -1260,6 +1261,11 @@ set_effect(const RenderEffect *effect) {
     cdata->set_fancy_bit(FB_effects, true);
   }
   CLOSE_ITERATE_CURRENT_AND_UPSTREAM(_cycler);
+
+  // This doesn't change the bounding volume, but bumping the bounds
+  // UpdateSeq tells anyone caching the cull result (such as a
+  // CullCacheNode) that something below it has changed.
+  mark_bounds_stale(current_thread);
   mark_bam_modified();
 }
 
@@ -1278,6 +1284,7 @@ clear_effect(TypeHandle type) {
     cdata->set_fancy_bit(FB_effects, !cdata->_effects->is_empty());
   }
   CLOSE_ITERATE_CURRENT_AND_UPSTREAM(_cycler);
+  mark_bounds_stale(current_thread);
   mark_bam_modified();
 }
 
@@ -1332,6 +1339,7 @@ set_effects(const RenderEffects *effects, Thread *current_thread) {
     cdata->set_fancy_bit(FB_effects, !effects->is_empty());
   }
   CLOSE_ITERATE_CURRENT_AND_UPSTREAM(_cycler);
+  mark_bounds_stale(current_thread);
   mark_bam_modified();
 }
 
@@ -1482,13 +1490,25 @@ void PandaNode::
 set_tag(const string &key, const string &value, Thread *current_thread) {
   // Apply this operation to the current stage as well as to all
   // upstream stages.
+  bool any_changed = false;
   OPEN_ITERATE_CURRENT_AND_UPSTREAM(_cycler, current_thread) {
     CDStageWriter cdata(_cycler, pipeline_stage, current_thread);
-    cdata->_tag_data[key] = value;
-    cdata->set_fancy_bit(FB_tag, true);
+    TagData::iterator ti = cdata->_tag_data.find(key);
+    if (ti == cdata->_tag_data.end() || (*ti).second != value) {
+      cdata->_tag_data[key] = value;
+      cdata->set_fancy_bit(FB_tag, true);
+      any_changed = true;
+    }
   }
   CLOSE_ITERATE_CURRENT_AND_UPSTREAM(_cycler);
-  mark_bam_modified();
+
+  // A tag may select a camera's tag state; let anything that caches
+  // the cull result of this node's ancestors (e.g. CullCacheNode)
+  // know that it has changed.
+  if (any_changed) {
+    mark_bounds_stale(current_thread);
+    mark_bam_modified();
+  }
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -1500,13 +1520,21 @@ set_tag(const string &key, const string &value, Thread *current_thread) {
 ////////////////////////////////////////////////////////////////////
 void PandaNode::
 clear_tag(const string &key, Thread *current_thread) {
+  bool any_changed = false;
   OPEN_ITERATE_CURRENT_AND_UPSTREAM(_cycler, current_thread) {
     CDStageWriter cdata(_cycler, pipeline_stage, current_thread);
-    cdata->_tag_data.erase(key);
-    cdata->set_fancy_bit(FB_tag, !cdata->_tag_data.empty());
+    if (cdata->_tag_data.erase(key) != 0) {
+      cdata->set_fancy_bit(FB_tag, !cdata->_tag_data.empty());
+      any_changed = true;
+    }
   }
   CLOSE_ITERATE_CURRENT_AND_UPSTREAM(_cycler);
-  mark_bam_modified();
+
+  // See set_tag().
+  if (any_changed) {
+    mark_bounds_stale(current_thread);
+    mark_bam_modified();
+  }
 }
 
 #ifdef HAVE_PYTHON
@@ -2686,6 +2714,34 @@ get_nested_vertices(Thread *current_thread) const {
   return cdata->_nested_vertices;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: PandaNode::has_net_cull_callback
+//       Access: Public
+//  Description: Returns true if this node or any of its descendents
+//               (other than stashed nodes) has a cull callback, or
+//               introduces a FogAttrib with a Fog.  Both of these
+//               change something during cull, so CullTraverser keeps
+//               such subtrees on the cull thread rather than handing
+//               them to its worker threads.
+////////////////////////////////////////////////////////////////////
+bool PandaNode::
+has_net_cull_callback(Thread *current_thread) const {
+  int pipeline_stage = current_thread->get_pipeline_stage();
+  CDLockedStageReader cdata(_cycler, pipeline_stage, current_thread);
+  if (cdata->_last_update != cdata->_next_update) {
+    // The cache is stale; it needs to be rebuilt.
+    bool result;
+    {
+      PStatTimer timer(_update_bounds_pcollector);
+      CDStageWriter cdataw = 
+        ((PandaNode *)this)->update_bounds(pipeline_stage, cdata); 
+      result = cdataw->_net_cull_callback;
+    }
+    return result;
+  }
+  return cdata->_net_cull_callback;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: PandaNode::mark_bounds_stale
 //       Access: Published
@@ -3223,6 +3279,7 @@ set_cull_callback() {
     cdata->set_fancy_bit(FB_cull_callback, true);
   }
   CLOSE_ITERATE_CURRENT_AND_UPSTREAM(_cycler);
+  mark_bounds_stale(current_thread);
   mark_bam_modified();
 }
 
@@ -3239,6 +3296,7 @@ disable_cull_callback() {
     cdata->set_fancy_bit(FB_cull_callback, false);
   }
   CLOSE_ITERATE_CURRENT_AND_UPSTREAM(_cycler);
+  mark_bounds_stale(current_thread);
   mark_bam_modified();
 }
 
@@ -4067,6 +4125,12 @@ update_bounds(int pipeline_stage, PandaNode::CDLockedStageReader &cdata) {
 
     int num_vertices = cdata->_internal_vertices;
 
+    bool net_cull_callback = (cdata->_fancy_bits & FB_cull_callback) != 0;
+    const FogAttrib *fog = DCAST(FogAttrib, cdata->_state->get_attrib(FogAttrib::get_class_slot()));
+    if (fog != (const FogAttrib *)NULL && fog->get_fog() != (Fog *)NULL) {
+      net_cull_callback = true;
+    }
+
     // Now that we've got all the data we need from the node, we can
     // release the lock.
     _cycler.release_read_stage(pipeline_stage, cdata.take_pointer());
@@ -4195,6 +4259,7 @@ update_bounds(int pipeline_stage, PandaNode::CDLockedStageReader &cdata) {
           }
         }
         num_vertices += child_cdataw->_nested_vertices;
+        net_cull_callback = net_cull_callback || child_cdataw->_net_cull_callback;
 
       } else {
         // Child is good.
@@ -4247,6 +4312,7 @@ update_bounds(int pipeline_stage, PandaNode::CDLockedStageReader &cdata) {
           }
         }
         num_vertices += child_cdata->_nested_vertices;
+        net_cull_callback = net_cull_callback || child_cdata->_net_cull_callback;
       }
     }
 
@@ -4295,6 +4361,7 @@ update_bounds(int pipeline_stage, PandaNode::CDLockedStageReader &cdata) {
 
         cdataw->_off_clip_planes = off_clip_planes;
         cdataw->_nested_vertices = num_vertices;
+        cdataw->_net_cull_callback = net_cull_callback;
 
         CPT(TransformState) transform = get_transform(current_thread);
         PT(GeometricBoundingVolume) gbv;
@@ -4512,6 +4579,7 @@ CData() :
   _net_collide_mask(CollideMask::all_off()),
   _net_draw_control_mask(DrawMask::all_off()),
   _net_draw_show_mask(DrawMask::all_off()),
+  _net_cull_callback(false),
 
   _down(new PandaNode::Down(PandaNode::get_class_type())),
   _stashed(new PandaNode::Down(PandaNode::get_class_type())),
@@ -4548,6 +4616,7 @@ CData(const PandaNode::CData &copy) :
   _net_draw_show_mask(copy._net_draw_show_mask),
   _off_clip_planes(copy._off_clip_planes),
   _nested_vertices(copy._nested_vertices),
+  _net_cull_callback(copy._net_cull_callback),
   _external_bounds(copy._external_bounds),
   _last_update(copy._last_update),
   _next_update(copy._next_update),
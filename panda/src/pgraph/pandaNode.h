@@ -309,6 +309,7 @@ PUBLISHED:
     FB_cull_callback        = 0x0040,
   };
   INLINE int get_fancy_bits(Thread *current_thread = Thread::get_current_thread()) const;
+  bool has_net_cull_callback(Thread *current_thread = Thread::get_current_thread()) const;
 
 
 PUBLISHED:
@@ -607,6 +608,11 @@ private:
     // nodes.
     int _nested_vertices;
 
+    // True if this node or any node below it has a cull callback, or
+    // introduces a Fog (which is adjusted to the camera during cull).
+    // See has_net_cull_callback().
+    bool _net_cull_callback;
+
     // This is the bounding volume around the _user_bounds, the
     // _internal_bounds, and all of the children's external bounding
     // volumes.
@@ -838,6 +844,7 @@ public:
   INLINE CPT(RenderAttrib) get_off_clip_planes() const;
   INLINE CPT(BoundingVolume) get_bounds() const;
   INLINE int get_nested_vertices() const;
+  INLINE bool has_net_cull_callback() const;
   INLINE bool is_final() const;
   INLINE int get_fancy_bits() const;
 
@@ -32,18 +32,20 @@
 #include "datagramIterator.h"
 #include "indent.h"
 #include "compareTo.h"
-#include "lightReMutexHolder.h"
+#include "stripedReMutexHolder.h"
+#include "trueClock.h"
 #include "lightMutexHolder.h"
 #include "thread.h"
 #include "renderAttribRegistry.h"
 #include "py_panda.h"
   
-LightReMutex *RenderState::_states_lock = NULL;
-RenderState::States *RenderState::_states = NULL;
+StripedReMutex *RenderState::_states_lock = NULL;
+RenderState::StateStripe *RenderState::_stripes = NULL;
+LightMutex *RenderState::_garbage_lock = NULL;
+int RenderState::_garbage_stripe = 0;
 CPT(RenderState) RenderState::_empty_state;
 CPT(RenderState) RenderState::_full_default_state;
 UpdateSeq RenderState::_last_cycle_detect;
-int RenderState::_garbage_index = 0;
 
 PStatCollector RenderState::_cache_update_pcollector("*:State Cache:Update");
 PStatCollector RenderState::_garbage_collect_pcollector("*:State Cache:Garbage Collect");
@@ -51,6 +53,8 @@ PStatCollector RenderState::_state_compose_pcollector("*:State Cache:Compose Sta
 PStatCollector RenderState::_state_invert_pcollector("*:State Cache:Invert State");
 PStatCollector RenderState::_node_counter("RenderStates:On nodes");
 PStatCollector RenderState::_cache_counter("RenderStates:Cached");
+PStatCollector RenderState::_gc_collected_counter("RenderStates:Collected");
+PStatCollector RenderState::_gc_remaining_counter("RenderStates:Collect Pending");
 PStatCollector RenderState::_state_break_cycles_pcollector("*:State Cache:Break Cycles");
 PStatCollector RenderState::_state_validate_pcollector("*:State Cache:Validate");
 
@@ -81,7 +85,7 @@ RenderState() :
     new(&_attributes[i]) Attribute();
   }
 
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     init_states();
   }
   _saved_entry = -1;
@@ -141,7 +145,7 @@ RenderState::
   nassertv(!is_destructing());
   set_destructing();
 
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
 
   // unref() should have cleared these.
   nassertv(_saved_entry == -1);
@@ -413,66 +417,35 @@ compose(const RenderState *other) const {
     return do_compose(other);
   }
 
-  LightReMutexHolder holder(*_states_lock);
-
-  // Is this composition already cached?
-  int index = _composition_cache.find(other);
-  if (index != -1) {
-    Composition &comp = ((RenderState *)this)->_composition_cache.modify_data(index);
-    if (comp._result == (const RenderState *)NULL) {
-      // Well, it wasn't cached already, but we already had an entry
-      // (probably created for the reverse direction), so use the same
-      // entry to store the new result.
-      CPT(RenderState) result = do_compose(other);
-      comp._result = result;
-
-      if (result != (const RenderState *)this) {
-        // See the comments below about the need to up the reference
-        // count only when the result is not the same as this.
-        result->cache_ref();
-      }
+  // Is this composition already cached?  We only need to hold the
+  // stripe that protects our own cache to look it up.
+  CPT(RenderState) result;
+  {
+    StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
+    int index = _composition_cache.find(other);
+    if (index != -1) {
+      const Composition &comp = _composition_cache.get_data(index);
+      result = comp._result;
+    }
+    if (result != (RenderState *)NULL) {
+      _cache_stats.inc_hits();
     }
-    // Here's the cache!
-    _cache_stats.inc_hits();
-    return comp._result;
   }
-  _cache_stats.inc_misses();
-
-  // We need to make a new cache entry, both in this object and in the
-  // other object.  We make both records so the other RenderState
-  // object will know to delete the entry from this object when it
-  // destructs, and vice-versa.
-
-  // The cache entry in this object is the only one that indicates the
-  // result; the other will be NULL for now.
-  CPT(RenderState) result = do_compose(other);
-
-  _cache_stats.add_total_size(1);
-  _cache_stats.inc_adds(_composition_cache.get_size() == 0);
-
-  ((RenderState *)this)->_composition_cache[other]._result = result;
 
-  if (other != this) {
-    _cache_stats.add_total_size(1);
-    _cache_stats.inc_adds(other->_composition_cache.get_size() == 0);
-    ((RenderState *)other)->_composition_cache[this]._result = NULL;
+  if (result != (RenderState *)NULL) {
+    // Success!
+    return result;
   }
 
-  if (result != (const RenderState *)this) {
-    // If the result of compose() is something other than this,
-    // explicitly increment the reference count.  We have to be sure
-    // to decrement it again later, when the composition entry is
-    // removed from the cache.
-    result->cache_ref();
-    
-    // (If the result was just this again, we still store the
-    // result, but we don't increment the reference count, since
-    // that would be a self-referential leak.)
-  }
+  // Not in the cache.  Compute a new result.  It's important that we
+  // don't hold the lock while we do this, or we lose the benefit of
+  // parallelization; and in any case do_compose() may need to grab
+  // other stripes of the lock.
+  result = do_compose(other);
 
-  _cache_stats.maybe_report("RenderState");
-
-  return result;
+  // It's OK to cast away the constness of this pointer, because the
+  // cache is a transparent property of the class.
+  return ((RenderState *)this)->store_compose(other, result);
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -508,63 +481,32 @@ invert_compose(const RenderState *other) const {
     return do_invert_compose(other);
   }
 
-  LightReMutexHolder holder(*_states_lock);
-
-  // Is this composition already cached?
-  int index = _invert_composition_cache.find(other);
-  if (index != -1) {
-    Composition &comp = ((RenderState *)this)->_invert_composition_cache.modify_data(index);
-    if (comp._result == (const RenderState *)NULL) {
-      // Well, it wasn't cached already, but we already had an entry
-      // (probably created for the reverse direction), so use the same
-      // entry to store the new result.
-      CPT(RenderState) result = do_invert_compose(other);
-      comp._result = result;
-
-      if (result != (const RenderState *)this) {
-        // See the comments below about the need to up the reference
-        // count only when the result is not the same as this.
-        result->cache_ref();
-      }
+  CPT(RenderState) result;
+  {
+    StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
+    int index = _invert_composition_cache.find(other);
+    if (index != -1) {
+      const Composition &comp = _invert_composition_cache.get_data(index);
+      result = comp._result;
+    }
+    if (result != (RenderState *)NULL) {
+      _cache_stats.inc_hits();
     }
-    // Here's the cache!
-    _cache_stats.inc_hits();
-    return comp._result;
   }
-  _cache_stats.inc_misses();
 
-  // We need to make a new cache entry, both in this object and in the
-  // other object.  We make both records so the other RenderState
-  // object will know to delete the entry from this object when it
-  // destructs, and vice-versa.
-
-  // The cache entry in this object is the only one that indicates the
-  // result; the other will be NULL for now.
-  CPT(RenderState) result = do_invert_compose(other);
-
-  _cache_stats.add_total_size(1);
-  _cache_stats.inc_adds(_invert_composition_cache.get_size() == 0);
-  ((RenderState *)this)->_invert_composition_cache[other]._result = result;
-
-  if (other != this) {
-    _cache_stats.add_total_size(1);
-    _cache_stats.inc_adds(other->_invert_composition_cache.get_size() == 0);
-    ((RenderState *)other)->_invert_composition_cache[this]._result = NULL;
+  if (result != (RenderState *)NULL) {
+    // Success!
+    return result;
   }
 
-  if (result != (const RenderState *)this) {
-    // If the result of compose() is something other than this,
-    // explicitly increment the reference count.  We have to be sure
-    // to decrement it again later, when the composition entry is
-    // removed from the cache.
-    result->cache_ref();
-    
-    // (If the result was just this again, we still store the
-    // result, but we don't increment the reference count, since
-    // that would be a self-referential leak.)
-  }
+  // Not in the cache.  Compute a new result.  It's important that we
+  // don't hold the lock while we do this, or we lose the benefit of
+  // parallelization.
+  result = do_invert_compose(other);
 
-  return result;
+  // It's OK to cast away the constness of this pointer, because the
+  // cache is a transparent property of the class.
+  return ((RenderState *)this)->store_invert_compose(other, result);
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -705,8 +647,10 @@ unref() const {
   // We always have to grab the lock, since we will definitely need to
   // be holding it if we happen to drop the reference count to 0.
   // Having to grab the lock at every call to unref() is a big
-  // limiting factor on parallelization.
-  LightReMutexHolder holder(*_states_lock);
+  // limiting factor on parallelization.  Since breaking cycles and
+  // removing the cache pointers may touch RenderStates in any stripe,
+  // we need all of them.
+  StripedReMutexHolder holder(*_states_lock);
 
   if (auto_break_cycles && uniquify_states) {
     if (get_cache_ref_count() > 0 &&
@@ -751,7 +695,7 @@ unref() const {
 PyObject *RenderState::
 get_composition_cache() const {
   IMPORT_THIS struct Dtool_PyTypedObject Dtool_RenderState;
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
   size_t cache_size = _composition_cache.get_size();
   PyObject *list = PyList_New(cache_size);
 
@@ -811,7 +755,7 @@ get_composition_cache() const {
 PyObject *RenderState::
 get_invert_composition_cache() const {
   IMPORT_THIS struct Dtool_PyTypedObject Dtool_RenderState;
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
   size_t cache_size = _invert_composition_cache.get_size();
   PyObject *list = PyList_New(cache_size);
 
@@ -954,11 +898,17 @@ get_max_priority() {
 ////////////////////////////////////////////////////////////////////
 int RenderState::
 get_num_states() {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return 0;
   }
-  LightReMutexHolder holder(*_states_lock);
-  return _states->get_num_entries();
+  StripedReMutexHolder holder(*_states_lock);
+
+  int num_states = 0;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    num_states += _stripes[stripe]._states.get_num_entries();
+  }
+  return num_states;
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -981,50 +931,54 @@ get_num_states() {
 ////////////////////////////////////////////////////////////////////
 int RenderState::
 get_num_unused_states() {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return 0;
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
   // First, we need to count the number of times each RenderState
   // object is recorded in the cache.
   typedef pmap<const RenderState *, int> StateCount;
   StateCount state_count;
 
-  int size = _states->get_size();
-  for (int si = 0; si < size; ++si) {
-    if (!_states->has_element(si)) {
-      continue;
-    }
-    const RenderState *state = _states->get_key(si);
-
-    int i;
-    int cache_size = state->_composition_cache.get_size();
-    for (i = 0; i < cache_size; ++i) {
-      if (state->_composition_cache.has_element(i)) {
-        const RenderState *result = state->_composition_cache.get_data(i)._result;
-        if (result != (const RenderState *)NULL && result != state) {
-          // Here's a RenderState that's recorded in the cache.
-          // Count it.
-          pair<StateCount::iterator, bool> ir =
-            state_count.insert(StateCount::value_type(result, 1));
-          if (!ir.second) {
-            // If the above insert operation fails, then it's already in
-            // the cache; increment its value.
-            (*(ir.first)).second++;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    int size = states.get_size();
+    for (int si = 0; si < size; ++si) {
+      if (!states.has_element(si)) {
+        continue;
+      }
+      const RenderState *state = states.get_key(si);
+
+      int i;
+      int cache_size = state->_composition_cache.get_size();
+      for (i = 0; i < cache_size; ++i) {
+        if (state->_composition_cache.has_element(i)) {
+          const RenderState *result = state->_composition_cache.get_data(i)._result;
+          if (result != (const RenderState *)NULL && result != state) {
+            // Here's a RenderState that's recorded in the cache.
+            // Count it.
+            pair<StateCount::iterator, bool> ir =
+              state_count.insert(StateCount::value_type(result, 1));
+            if (!ir.second) {
+              // If the above insert operation fails, then it's already in
+              // the cache; increment its value.
+              (*(ir.first)).second++;
+            }
           }
         }
       }
-    }
-    cache_size = state->_invert_composition_cache.get_size();
-    for (i = 0; i < cache_size; ++i) {
-      if (state->_invert_composition_cache.has_element(i)) {
-        const RenderState *result = state->_invert_composition_cache.get_data(i)._result;
-        if (result != (const RenderState *)NULL && result != state) {
-          pair<StateCount::iterator, bool> ir =
-            state_count.insert(StateCount::value_type(result, 1));
-          if (!ir.second) {
-            (*(ir.first)).second++;
+      cache_size = state->_invert_composition_cache.get_size();
+      for (i = 0; i < cache_size; ++i) {
+        if (state->_invert_composition_cache.has_element(i)) {
+          const RenderState *result = state->_invert_composition_cache.get_data(i)._result;
+          if (result != (const RenderState *)NULL && result != state) {
+            pair<StateCount::iterator, bool> ir =
+              state_count.insert(StateCount::value_type(result, 1));
+            if (!ir.second) {
+              (*(ir.first)).second++;
+            }
           }
         }
       }
@@ -1079,13 +1033,13 @@ get_num_unused_states() {
 ////////////////////////////////////////////////////////////////////
 int RenderState::
 clear_cache() {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return 0;
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
   PStatTimer timer(_cache_update_pcollector);
-  int orig_size = _states->get_num_entries();
+  int orig_size = get_num_states();
 
   // First, we need to copy the entire set of states to a temporary
   // vector, reference-counting each object.  That way we can walk
@@ -1096,13 +1050,17 @@ clear_cache() {
     TempStates temp_states;
     temp_states.reserve(orig_size);
 
-    int size = _states->get_size();
-    for (int si = 0; si < size; ++si) {
-      if (!_states->has_element(si)) {
-        continue;
+    int num_stripes = _states_lock->get_num_stripes();
+    for (int stripe = 0; stripe < num_stripes; ++stripe) {
+      const States &states = _stripes[stripe]._states;
+      int size = states.get_size();
+      for (int si = 0; si < size; ++si) {
+        if (!states.has_element(si)) {
+          continue;
+        }
+        const RenderState *state = states.get_key(si);
+        temp_states.push_back(state);
       }
-      const RenderState *state = _states->get_key(si);
-      temp_states.push_back(state);
     }
 
     // Now it's safe to walk through the list, destroying the cache
@@ -1145,7 +1103,7 @@ clear_cache() {
     // held only within the various objects' caches will go away.
   }
 
-  int new_size = _states->get_num_entries();
+  int new_size = get_num_states();
   return orig_size - new_size;
 }
 
@@ -1159,68 +1117,94 @@ clear_cache() {
 //               this variable is not true, but there is probably no
 //               advantage in that case.
 //
-//               This automatically calls
-//               RenderAttrib::garbage_collect() as well.
+//               The amount of time spent is limited by
+//               garbage-collect-states-budget; see the overload that
+//               accepts an explicit budget.
 ////////////////////////////////////////////////////////////////////
 int RenderState::
 garbage_collect() {
+  return garbage_collect(garbage_collect_states_budget);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: RenderState::garbage_collect
+//       Access: Published, Static
+//  Description: Performs a garbage-collection cycle, spending no
+//               more than approximately max_usec microseconds.  If
+//               the budget runs out before the cycle is complete, the
+//               next call picks up exactly where this one stopped, so
+//               that over several frames the whole cache is still
+//               visited.  If max_usec is 0 or less, the cycle runs to
+//               completion.
+//
+//               Returns the number of RenderStates freed.  This
+//               count, and the number of cache entries still waiting
+//               to be examined in the current cycle, are also
+//               reported to PStats.
+//
+//               RenderAttrib::garbage_collect() is also called from
+//               here, and its time is counted against the budget.
+////////////////////////////////////////////////////////////////////
+int RenderState::
+garbage_collect(double max_usec) {
+  TrueClock *clock = TrueClock::get_global_ptr();
+  double deadline = 0.0;
+  if (max_usec > 0.0) {
+    deadline = clock->get_short_time() + max_usec * 0.000001;
+  }
+
   int num_attribs = RenderAttrib::garbage_collect();
 
-  if (_states == (States *)NULL || !garbage_collect_states) {
+  if (_stripes == (StateStripe *)NULL || !garbage_collect_states) {
     return num_attribs;
   }
-  LightReMutexHolder holder(*_states_lock);
 
   PStatTimer timer(_garbage_collect_pcollector);
-  int orig_size = _states->get_num_entries();
-
-  // How many elements to process this pass?
-  int size = _states->get_size();
-  int num_this_pass = int(size * garbage_collect_states_rate);
-  if (num_this_pass <= 0) {
-    return num_attribs;
+  LightMutexHolder gc_holder(*_garbage_lock);
+
+  // Each stripe is collected independently, so that we don't hold up
+  // threads working in the other stripes while we are scanning this
+  // one.  We begin with the stripe we were working on when we last
+  // ran out of time.
+  int num_collected = 0;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int i = 0; i < num_stripes; ++i) {
+    if (!garbage_collect_stripe(_garbage_stripe, deadline, num_collected)) {
+      // Out of time.
+      break;
+    }
+    _garbage_stripe = (_garbage_stripe + 1) % num_stripes;
   }
-  num_this_pass = min(num_this_pass, size);
-  int stop_at_element = (_garbage_index + num_this_pass) % size;
-  
-  int num_elements = 0;
-  int si = _garbage_index;
-  do {
-    if (_states->has_element(si)) {
-      ++num_elements;
-      RenderState *state = (RenderState *)_states->get_key(si);
-      if (auto_break_cycles && uniquify_states) {
-        if (state->get_cache_ref_count() > 0 &&
-            state->get_ref_count() == state->get_cache_ref_count()) {
-          // If we have removed all the references to this state not in
-          // the cache, leaving only references in the cache, then we
-          // need to check for a cycle involving this RenderState and
-          // break it if it exists.
-          state->detect_and_break_cycles();
-        }
-      }
 
-      if (state->get_ref_count() == 1) {
-        // This state has recently been unreffed to 1 (the one we
-        // added when we stored it in the cache).  Now it's time to
-        // delete it.  This is safe, because we're holding the
-        // _states_lock, so it's not possible for some other thread to
-        // find the state in the cache and ref it while we're doing
-        // this.
-        state->release_new();
-        state->remove_cache_pointers();
-        state->cache_unref();
-        delete state;
-      }
-    }      
+  _gc_collected_counter.set_level(num_collected);
+#ifdef DO_PSTATS
+  if (_gc_remaining_counter.is_active()) {
+    int num_remaining = 0;
+    for (int stripe = 0; stripe < num_stripes; ++stripe) {
+      StripedReMutexHolder holder(*_states_lock, stripe);
+      num_remaining += max(_stripes[stripe]._garbage_remaining, 0);
+    }
+    _gc_remaining_counter.set_level(num_remaining);
+  }
+#endif  // DO_PSTATS
 
-    si = (si + 1) % size;
-  } while (si != stop_at_element);
-  _garbage_index = si;
-  nassertr(_states->validate(), 0);
+  return num_collected + num_attribs;
+}
 
-  int new_size = _states->get_num_entries();
-  return orig_size - new_size + num_attribs;
+////////////////////////////////////////////////////////////////////
+//     Function: RenderState::get_num_stripes
+//       Access: Published, Static
+//  Description: Returns the number of independent pieces into which
+//               the RenderState cache has been divided.  This is
+//               controlled by the state-cache-stripes config
+//               variable.
+////////////////////////////////////////////////////////////////////
+int RenderState::
+get_num_stripes() {
+  if (_stripes == (StateStripe *)NULL) {
+    return 0;
+  }
+  return _states_lock->get_num_stripes();
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -1232,16 +1216,20 @@ garbage_collect() {
 ////////////////////////////////////////////////////////////////////
 void RenderState::
 clear_munger_cache() {
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
-  int size = _states->get_size();
-  for (int si = 0; si < size; ++si) {
-    if (!_states->has_element(si)) {
-      continue;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    int size = states.get_size();
+    for (int si = 0; si < size; ++si) {
+      if (!states.has_element(si)) {
+        continue;
+      }
+      RenderState *state = (RenderState *)(states.get_key(si));
+      state->_mungers.clear();
+      state->_last_mi = state->_mungers.end();
     }
-    RenderState *state = (RenderState *)(_states->get_key(si));
-    state->_mungers.clear();
-    state->_last_mi = state->_mungers.end();
   }
 }
 
@@ -1265,72 +1253,76 @@ clear_munger_cache() {
 ////////////////////////////////////////////////////////////////////
 void RenderState::
 list_cycles(ostream &out) {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return;
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
   typedef pset<const RenderState *> VisitedStates;
   VisitedStates visited;
   CompositionCycleDesc cycle_desc;
 
-  int size = _states->get_size();
-  for (int si = 0; si < size; ++si) {
-    if (!_states->has_element(si)) {
-      continue;
-    }
-    const RenderState *state = _states->get_key(si);
-
-    bool inserted = visited.insert(state).second;
-    if (inserted) {
-      ++_last_cycle_detect;
-      if (r_detect_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
-        // This state begins a cycle.
-        CompositionCycleDesc::reverse_iterator csi;
-
-        out << "\nCycle detected of length " << cycle_desc.size() + 1 << ":\n"
-            << "state " << (void *)state << ":" << state->get_ref_count()
-            << " =\n";
-        state->write(out, 2);
-        for (csi = cycle_desc.rbegin(); csi != cycle_desc.rend(); ++csi) {
-          const CompositionCycleDescEntry &entry = (*csi);
-          if (entry._inverted) {
-            out << "invert composed with ";
-          } else {
-            out << "composed with ";
-          }
-          out << (const void *)entry._obj << ":" << entry._obj->get_ref_count()
-              << " " << *entry._obj << "\n"
-              << "produces " << (const void *)entry._result << ":"
-              << entry._result->get_ref_count() << " =\n";
-          entry._result->write(out, 2);
-          visited.insert(entry._result);
-        }
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    int size = states.get_size();
+    for (int si = 0; si < size; ++si) {
+      if (!states.has_element(si)) {
+        continue;
+      }
+      const RenderState *state = states.get_key(si);
 
-        cycle_desc.clear();
-      } else {
+      bool inserted = visited.insert(state).second;
+      if (inserted) {
         ++_last_cycle_detect;
-        if (r_detect_reverse_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
+        if (r_detect_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
           // This state begins a cycle.
-          CompositionCycleDesc::iterator csi;
-          
-          out << "\nReverse cycle detected of length " << cycle_desc.size() + 1 << ":\n"
-              << "state ";
-          for (csi = cycle_desc.begin(); csi != cycle_desc.end(); ++csi) {
+          CompositionCycleDesc::reverse_iterator csi;
+
+          out << "\nCycle detected of length " << cycle_desc.size() + 1 << ":\n"
+              << "state " << (void *)state << ":" << state->get_ref_count()
+              << " =\n";
+          state->write(out, 2);
+          for (csi = cycle_desc.rbegin(); csi != cycle_desc.rend(); ++csi) {
             const CompositionCycleDescEntry &entry = (*csi);
-            out << (const void *)entry._result << ":"
+            if (entry._inverted) {
+              out << "invert composed with ";
+            } else {
+              out << "composed with ";
+            }
+            out << (const void *)entry._obj << ":" << entry._obj->get_ref_count()
+                << " " << *entry._obj << "\n"
+                << "produces " << (const void *)entry._result << ":"
                 << entry._result->get_ref_count() << " =\n";
             entry._result->write(out, 2);
-            out << (const void *)entry._obj << ":"
-                << entry._obj->get_ref_count() << " =\n";
-            entry._obj->write(out, 2);
             visited.insert(entry._result);
           }
-          out << (void *)state << ":"
-              << state->get_ref_count() << " =\n";
-          state->write(out, 2);
-          
+
           cycle_desc.clear();
+        } else {
+          ++_last_cycle_detect;
+          if (r_detect_reverse_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
+            // This state begins a cycle.
+            CompositionCycleDesc::iterator csi;
+          
+            out << "\nReverse cycle detected of length " << cycle_desc.size() + 1 << ":\n"
+                << "state ";
+            for (csi = cycle_desc.begin(); csi != cycle_desc.end(); ++csi) {
+              const CompositionCycleDescEntry &entry = (*csi);
+              out << (const void *)entry._result << ":"
+                  << entry._result->get_ref_count() << " =\n";
+              entry._result->write(out, 2);
+              out << (const void *)entry._obj << ":"
+                  << entry._obj->get_ref_count() << " =\n";
+              entry._obj->write(out, 2);
+              visited.insert(entry._result);
+            }
+            out << (void *)state << ":"
+                << state->get_ref_count() << " =\n";
+            state->write(out, 2);
+          
+            cycle_desc.clear();
+          }
         }
       }
     }
@@ -1347,21 +1339,25 @@ list_cycles(ostream &out) {
 ////////////////////////////////////////////////////////////////////
 void RenderState::
 list_states(ostream &out) {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     out << "0 states:\n";
     return;
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
-  out << _states->get_num_entries() << " states:\n";
+  out << get_num_states() << " states:\n";
 
-  int size = _states->get_size();
-  for (int si = 0; si < size; ++si) {
-    if (!_states->has_element(si)) {
-      continue;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    int size = states.get_size();
+    for (int si = 0; si < size; ++si) {
+      if (!states.has_element(si)) {
+        continue;
+      }
+      const RenderState *state = states.get_key(si);
+      state->write(out, 2);
     }
-    const RenderState *state = _states->get_key(si);
-    state->write(out, 2);
   }
 }
 
@@ -1377,58 +1373,63 @@ list_states(ostream &out) {
 ////////////////////////////////////////////////////////////////////
 bool RenderState::
 validate_states() {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return true;
   }
 
   PStatTimer timer(_state_validate_pcollector);
 
-  LightReMutexHolder holder(*_states_lock);
-  if (_states->is_empty()) {
-    return true;
-  }
+  StripedReMutexHolder holder(*_states_lock);
 
-  if (!_states->validate()) {
-    pgraph_cat.error()
-      << "RenderState::_states cache is invalid!\n";
-    return false;
-  }    
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    if (states.is_empty()) {
+      continue;
+    }
 
-  int size = _states->get_size();
-  int si = 0;
-  while (si < size && !_states->has_element(si)) {
-    ++si;
-  }
-  nassertr(si < size, false);
-  nassertr(_states->get_key(si)->get_ref_count() >= 0, false);
-  int snext = si;
-  ++snext;
-  while (snext < size && !_states->has_element(snext)) {
-    ++snext;
-  }
-  while (snext < size) {
-    nassertr(_states->get_key(snext)->get_ref_count() >= 0, false);
-    const RenderState *ssi = _states->get_key(si);
-    const RenderState *ssnext = _states->get_key(snext);
-    int c = ssi->compare_to(*ssnext);
-    int ci = ssnext->compare_to(*ssi);
-    if ((ci < 0) != (c > 0) ||
-        (ci > 0) != (c < 0) ||
-        (ci == 0) != (c == 0)) {
+    if (!states.validate()) {
       pgraph_cat.error()
-        << "RenderState::compare_to() not defined properly!\n";
-      pgraph_cat.error(false)
-        << "(a, b): " << c << "\n";
-      pgraph_cat.error(false)
-        << "(b, a): " << ci << "\n";
-      ssi->write(pgraph_cat.error(false), 2);
-      ssnext->write(pgraph_cat.error(false), 2);
+        << "RenderState::_states cache is invalid!\n";
       return false;
+    }    
+
+    int size = states.get_size();
+    int si = 0;
+    while (si < size && !states.has_element(si)) {
+      ++si;
     }
-    si = snext;
+    nassertr(si < size, false);
+    nassertr(states.get_key(si)->get_ref_count() >= 0, false);
+    int snext = si;
     ++snext;
-    while (snext < size && !_states->has_element(snext)) {
+    while (snext < size && !states.has_element(snext)) {
+      ++snext;
+    }
+    while (snext < size) {
+      nassertr(states.get_key(snext)->get_ref_count() >= 0, false);
+      const RenderState *ssi = states.get_key(si);
+      const RenderState *ssnext = states.get_key(snext);
+      int c = ssi->compare_to(*ssnext);
+      int ci = ssnext->compare_to(*ssi);
+      if ((ci < 0) != (c > 0) ||
+          (ci > 0) != (c < 0) ||
+          (ci == 0) != (c == 0)) {
+        pgraph_cat.error()
+          << "RenderState::compare_to() not defined properly!\n";
+        pgraph_cat.error(false)
+          << "(a, b): " << c << "\n";
+        pgraph_cat.error(false)
+          << "(b, a): " << ci << "\n";
+        ssi->write(pgraph_cat.error(false), 2);
+        ssnext->write(pgraph_cat.error(false), 2);
+        return false;
+      }
+      si = snext;
       ++snext;
+      while (snext < size && !states.has_element(snext)) {
+        ++snext;
+      }
     }
   }
 
@@ -1535,7 +1536,7 @@ assign_auto_shader_state() {
   CPT(RenderState) state = do_calc_auto_shader_state();
 
   {
-    LightReMutexHolder holder(*_states_lock);
+    StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
     if (_auto_shader_state == (const RenderState *)NULL) {
       _auto_shader_state = state;
       if (_auto_shader_state != this) {
@@ -1650,20 +1651,24 @@ return_unique(RenderState *state) {
   }
 #endif
 
-  LightReMutexHolder holder(*_states_lock);
+  // Save the state in a local PointerTo so that it will be freed at
+  // the end of this function if no one else uses it.  This must be
+  // declared before the holder below, so that the state is freed
+  // after we have released the lock; the destructor needs to grab
+  // another stripe.
+  CPT(RenderState) pt_state = state;
 
   if (state->_saved_entry != -1) {
-    // This state is already in the cache.
-    //nassertr(_states->find(state) == state->_saved_entry, state);
+    // This state is already in the cache.  Since we are holding a
+    // reference to it, it can't be removed from the cache while we
+    // are looking at it.
     return state;
   }
 
-  // Save the state in a local PointerTo so that it will be freed at
-  // the end of this function if no one else uses it.
-  CPT(RenderState) pt_state = state;
-
   // Ensure each of the individual attrib pointers has been uniquified
-  // before we add the state to the cache.
+  // before we add the state to the cache.  This must be done before
+  // we choose the stripe, since the hash is computed from the attrib
+  // pointers.
   if (!uniquify_attribs && !state->is_empty()) {
     SlotMask mask = state->_filled_slots;
     int slot = mask.get_lowest_on_bit();
@@ -1676,10 +1681,22 @@ return_unique(RenderState *state) {
     }    
   }
 
-  int si = _states->find(state);
+  // We only need to hold the stripe in which an equivalent state
+  // would be found.
+  int stripe = state->get_states_stripe();
+  StripedReMutexHolder holder(*_states_lock, stripe);
+  States &states = _stripes[stripe]._states;
+
+  if (state->_saved_entry != -1) {
+    // Another thread added this state while we weren't holding the
+    // lock.
+    return state;
+  }
+
+  int si = states.find(state);
   if (si != -1) {
     // There's an equivalent state already in the set.  Return it.
-    return _states->get_key(si);
+    return states.get_key(si);
   }
   
   // Not already in the set; add it.
@@ -1689,13 +1706,172 @@ return_unique(RenderState *state) {
     // that it won't be deleted while it's in it.
     state->cache_ref();
   }
-  si = _states->store(state, Empty());
+  si = states.store(state, Empty());
 
   // Save the index and return the input state.
   state->_saved_entry = si;
   return pt_state;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: RenderState::garbage_collect_stripe
+//       Access: Private, Static
+//  Description: Continues the garbage-collection pass over the
+//               indicated stripe of the global table, adding the
+//               number of RenderStates freed to num_collected.
+//               Returns true if the pass over this stripe was
+//               completed, or false if the deadline (a value of
+//               TrueClock::get_short_time(), or 0.0 for none) passed
+//               first; in the latter case, the next call resumes
+//               where this one left off.
+//
+//               This happens in two phases.  First, we scan a
+//               portion of the stripe, holding only that stripe's
+//               lock, looking for states whose only remaining
+//               references are within the cache.  If we find any, we
+//               grab all of the stripes (since freeing a state
+//               modifies the composition cache of other states,
+//               which may live in any stripe) and free them.
+////////////////////////////////////////////////////////////////////
+bool RenderState::
+garbage_collect_stripe(int stripe, double deadline, int &num_collected) {
+  TrueClock *clock = TrueClock::get_global_ptr();
+
+  // We hold a reference to each candidate while we are between the
+  // two phases, so that no other thread can delete it out from under
+  // us.  We also remember where we found it, so we can back up to it
+  // if we run out of time before we get to it.
+  typedef pvector< pair<CPT(RenderState), int> > Candidates;
+  Candidates candidates;
+  int size;
+
+  {
+    StripedReMutexHolder holder(*_states_lock, stripe);
+    StateStripe &data = _stripes[stripe];
+
+    size = data._states.get_size();
+    if (size == 0) {
+      data._garbage_remaining = 0;
+      return true;
+    }
+    if (data._garbage_index >= size) {
+      // The table has been cleared since we were last here.
+      data._garbage_index = 0;
+      data._garbage_remaining = 0;
+    }
+
+    if (data._garbage_remaining <= 0) {
+      // Begin a new pass over this stripe.  How many elements to
+      // process this pass?
+      int num_this_pass = int(size * garbage_collect_states_rate);
+      if (num_this_pass <= 0) {
+        return true;
+      }
+      // If breaking cycles overran the budget of the last pass, the
+      // excess is charged to this one.
+      data._garbage_remaining =
+        min(data._garbage_remaining + num_this_pass, size);
+      if (data._garbage_remaining <= 0) {
+        return true;
+      }
+    }
+
+    int si = data._garbage_index;
+    int num_scanned = 0;
+    while (data._garbage_remaining > 0) {
+      if (data._states.has_element(si)) {
+        const RenderState *state = data._states.get_key(si);
+        if (state->get_ref_count() == state->get_cache_ref_count()) {
+          if (state->get_ref_count() == 1 ||
+              (auto_break_cycles && uniquify_states)) {
+            candidates.push_back(Candidates::value_type(state, si));
+          }
+        }
+      }
+      si = (si + 1) % size;
+      --data._garbage_remaining;
+
+      // Checking the clock isn't free, so we only do it occasionally.
+      ++num_scanned;
+      if (deadline != 0.0 && (num_scanned & 0xff) == 0 &&
+          clock->get_short_time() >= deadline) {
+        break;
+      }
+    }
+    data._garbage_index = si;
+
+    if (candidates.empty()) {
+      return (data._garbage_remaining <= 0);
+    }
+  }
+
+  StripedReMutexHolder holder(*_states_lock);
+  StateStripe &data = _stripes[stripe];
+
+  Candidates::iterator ci;
+  for (ci = candidates.begin(); ci != candidates.end(); ++ci) {
+    if (ci != candidates.begin()) {
+      bool out_of_budget = (data._garbage_remaining < 0);
+      if (out_of_budget ||
+          (deadline != 0.0 && clock->get_short_time() >= deadline)) {
+        // Out of time, or breaking cycles has used up the budget for
+        // this pass.  Back up so that the next call begins with this
+        // candidate; if we are out of time, the candidates we skip are
+        // still part of this pass, but otherwise they go to the next
+        // one.  If the table has been resized in the meantime, the
+        // indices are meaningless, so we just move on; the states we
+        // skip will be picked up next time around.
+        if (data._states.get_size() == size) {
+          int skipped = (data._garbage_index - (*ci).second + size) % size;
+          data._garbage_index = (*ci).second;
+          if (!out_of_budget) {
+            data._garbage_remaining =
+              min(data._garbage_remaining + skipped, size);
+          }
+        }
+        break;
+      }
+    }
+
+    RenderState *state = (RenderState *)(*ci).first.p();
+
+    // Remember that we are holding one additional reference of our
+    // own in the candidates list.
+    if (auto_break_cycles && uniquify_states) {
+      if (state->get_cache_ref_count() > 0 &&
+          state->get_ref_count() == state->get_cache_ref_count() + 1) {
+        // If we have removed all the references to this state not in
+        // the cache, leaving only references in the cache, then we
+        // need to check for a cycle involving this RenderState and
+        // break it if it exists.  Each state visited in the search
+        // counts against the budget for this pass, the same as
+        // scanning one element of the table.
+        data._garbage_remaining -= state->detect_and_break_cycles();
+      }
+    }
+
+    if (state->get_ref_count() == 2) {
+      // This state has recently been unreffed to 1 (the one we added
+      // when we stored it in the cache), plus the one we are holding
+      // here.  Now it's time to delete it.  This is safe, because
+      // we're holding the _states_lock, so it's not possible for some
+      // other thread to find the state in the cache and ref it while
+      // we're doing this.
+      state->release_new();
+      state->remove_cache_pointers();
+      state->cache_unref();
+      ++num_collected;
+    }
+  }
+
+  // The states we released will be deleted when the candidates list
+  // goes out of scope, while we are still holding the lock.
+  candidates.clear();
+  nassertr(data._states.validate(), false);
+
+  return (data._garbage_remaining <= 0);
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: RenderState::do_compose
 //       Access: Private
@@ -1764,6 +1940,154 @@ do_compose(const RenderState *other) const {
   return return_new(new_state);
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: RenderState::store_compose
+//       Access: Private
+//  Description: Stores the result of a composition in the cache.
+//               Returns the stored result (it may be a different
+//               object than the one passed in, due to another thread
+//               having computed the composition first).
+////////////////////////////////////////////////////////////////////
+CPT(RenderState) RenderState::
+store_compose(const RenderState *other, const RenderState *result) {
+  // Identity should have already been screened.
+  nassertr(!is_empty(), other);
+  nassertr(!other->is_empty(), this);
+
+  // We will be modifying the cache of both this object and the other
+  // object, so we need to hold both of their stripes.
+  StripedReMutexHolder holder(*_states_lock, get_cache_stripe(),
+                              other->get_cache_stripe());
+
+  // Is this composition already cached?
+  int index = _composition_cache.find(other);
+  if (index != -1) {
+    Composition &comp = _composition_cache.modify_data(index);
+    if (comp._result == (const RenderState *)NULL) {
+      // Well, it wasn't cached already, but we already had an entry
+      // (probably created for the reverse direction), so use the same
+      // entry to store the new result.
+      comp._result = result;
+
+      if (result != (const RenderState *)this) {
+        // See the comments below about the need to up the reference
+        // count only when the result is not the same as this.
+        result->cache_ref();
+      }
+    }
+    // Here's the cache!
+    _cache_stats.inc_hits();
+    return comp._result;
+  }
+  _cache_stats.inc_misses();
+
+  // We need to make a new cache entry, both in this object and in the
+  // other object.  We make both records so the other RenderState
+  // object will know to delete the entry from this object when it
+  // destructs, and vice-versa.
+
+  // The cache entry in this object is the only one that indicates the
+  // result; the other will be NULL for now.
+  _cache_stats.add_total_size(1);
+  _cache_stats.inc_adds(_composition_cache.get_size() == 0);
+
+  _composition_cache[other]._result = result;
+
+  if (other != this) {
+    _cache_stats.add_total_size(1);
+    _cache_stats.inc_adds(other->_composition_cache.get_size() == 0);
+    ((RenderState *)other)->_composition_cache[this]._result = NULL;
+  }
+
+  if (result != (const RenderState *)this) {
+    // If the result of do_compose() is something other than this,
+    // explicitly increment the reference count.  We have to be sure
+    // to decrement it again later, when the composition entry is
+    // removed from the cache.
+    result->cache_ref();
+    
+    // (If the result was just this again, we still store the
+    // result, but we don't increment the reference count, since
+    // that would be a self-referential leak.)
+  }
+
+  _cache_stats.maybe_report("RenderState");
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: RenderState::store_invert_compose
+//       Access: Private
+//  Description: Stores the result of an invert composition in the
+//               cache.  Returns the stored result (it may be a
+//               different object than the one passed in, due to
+//               another thread having computed the composition
+//               first).
+////////////////////////////////////////////////////////////////////
+CPT(RenderState) RenderState::
+store_invert_compose(const RenderState *other, const RenderState *result) {
+  // Identity should have already been screened.
+  nassertr(!is_empty(), other);
+  nassertr(other != this, make_empty());
+
+  StripedReMutexHolder holder(*_states_lock, get_cache_stripe(),
+                              other->get_cache_stripe());
+
+  // Is this composition already cached?
+  int index = _invert_composition_cache.find(other);
+  if (index != -1) {
+    Composition &comp = _invert_composition_cache.modify_data(index);
+    if (comp._result == (const RenderState *)NULL) {
+      // Well, it wasn't cached already, but we already had an entry
+      // (probably created for the reverse direction), so use the same
+      // entry to store the new result.
+      comp._result = result;
+
+      if (result != (const RenderState *)this) {
+        // See the comments below about the need to up the reference
+        // count only when the result is not the same as this.
+        result->cache_ref();
+      }
+    }
+    // Here's the cache!
+    _cache_stats.inc_hits();
+    return comp._result;
+  }
+  _cache_stats.inc_misses();
+
+  // We need to make a new cache entry, both in this object and in the
+  // other object.  We make both records so the other RenderState
+  // object will know to delete the entry from this object when it
+  // destructs, and vice-versa.
+
+  // The cache entry in this object is the only one that indicates the
+  // result; the other will be NULL for now.
+  _cache_stats.add_total_size(1);
+  _cache_stats.inc_adds(_invert_composition_cache.get_size() == 0);
+  _invert_composition_cache[other]._result = result;
+
+  if (other != this) {
+    _cache_stats.add_total_size(1);
+    _cache_stats.inc_adds(other->_invert_composition_cache.get_size() == 0);
+    ((RenderState *)other)->_invert_composition_cache[this]._result = NULL;
+  }
+
+  if (result != (const RenderState *)this) {
+    // If the result of compose() is something other than this,
+    // explicitly increment the reference count.  We have to be sure
+    // to decrement it again later, when the composition entry is
+    // removed from the cache.
+    result->cache_ref();
+    
+    // (If the result was just this again, we still store the
+    // result, but we don't increment the reference count, since
+    // that would be a self-referential leak.)
+  }
+
+  return result;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: RenderState::do_invert_compose
 //       Access: Private
@@ -1812,14 +2136,17 @@ do_invert_compose(const RenderState *other) const {
 //       Access: Private
 //  Description: Detects whether there is a cycle in the cache that
 //               begins with this state.  If any are detected, breaks
-//               them by removing this state from the cache.
+//               them by removing this state from the cache.  Returns
+//               the number of states that were visited in the search.
 ////////////////////////////////////////////////////////////////////
-void RenderState::
+int RenderState::
 detect_and_break_cycles() {
   PStatTimer timer(_state_break_cycles_pcollector);
+  int num_visited = 0;
       
   ++_last_cycle_detect;
-  if (r_detect_cycles(this, this, 1, _last_cycle_detect, NULL)) {
+  if (r_detect_cycles(this, this, 1, _last_cycle_detect, NULL,
+                      &num_visited)) {
     // Ok, we have a cycle.  This will be a leak unless we break the
     // cycle by freeing the cache on this object.
     if (pgraph_cat.is_debug()) {
@@ -1830,7 +2157,8 @@ detect_and_break_cycles() {
     ((RenderState *)this)->remove_cache_pointers();
   } else {
     ++_last_cycle_detect;
-    if (r_detect_reverse_cycles(this, this, 1, _last_cycle_detect, NULL)) {
+    if (r_detect_reverse_cycles(this, this, 1, _last_cycle_detect, NULL,
+                                &num_visited)) {
       if (pgraph_cat.is_debug()) {
         pgraph_cat.debug()
           << "Breaking cycle involving " << (*this) << "\n";
@@ -1839,6 +2167,8 @@ detect_and_break_cycles() {
       ((RenderState *)this)->remove_cache_pointers();
     }
   }
+
+  return num_visited;
 }
   
 ////////////////////////////////////////////////////////////////////
@@ -1850,13 +2180,15 @@ detect_and_break_cycles() {
 //               part of any cycles.  If a cycle is found and
 //               cycle_desc is not NULL, then cycle_desc is filled in
 //               with the list of the steps of the cycle, in reverse
-//               order.
+//               order.  If num_visited is not NULL, it is incremented
+//               for each state visited.
 ////////////////////////////////////////////////////////////////////
 bool RenderState::
 r_detect_cycles(const RenderState *start_state,
                 const RenderState *current_state,
                 int length, UpdateSeq this_seq,
-                RenderState::CompositionCycleDesc *cycle_desc) {
+                RenderState::CompositionCycleDesc *cycle_desc,
+                int *num_visited) {
   if (current_state->_cycle_detect == this_seq) {
     // We've already seen this state; therefore, we've found a cycle.
 
@@ -1867,6 +2199,9 @@ r_detect_cycles(const RenderState *start_state,
     return (current_state == start_state && length > 2);
   }
   ((RenderState *)current_state)->_cycle_detect = this_seq;
+  if (num_visited != (int *)NULL) {
+    ++(*num_visited);
+  }
     
   int i;
   int cache_size = current_state->_composition_cache.get_size();
@@ -1875,7 +2210,7 @@ r_detect_cycles(const RenderState *start_state,
       const RenderState *result = current_state->_composition_cache.get_data(i)._result;
       if (result != (const RenderState *)NULL) {
         if (r_detect_cycles(start_state, result, length + 1, 
-                            this_seq, cycle_desc)) {
+                            this_seq, cycle_desc, num_visited)) {
           // Cycle detected.
           if (cycle_desc != (CompositionCycleDesc *)NULL) {
             const RenderState *other = current_state->_composition_cache.get_key(i);
@@ -1894,7 +2229,7 @@ r_detect_cycles(const RenderState *start_state,
       const RenderState *result = current_state->_invert_composition_cache.get_data(i)._result;
       if (result != (const RenderState *)NULL) {
         if (r_detect_cycles(start_state, result, length + 1,
-                            this_seq, cycle_desc)) {
+                            this_seq, cycle_desc, num_visited)) {
           // Cycle detected.
           if (cycle_desc != (CompositionCycleDesc *)NULL) {
             const RenderState *other = current_state->_invert_composition_cache.get_key(i);
@@ -1923,7 +2258,8 @@ bool RenderState::
 r_detect_reverse_cycles(const RenderState *start_state,
                         const RenderState *current_state,
                         int length, UpdateSeq this_seq,
-                        RenderState::CompositionCycleDesc *cycle_desc) {
+                        RenderState::CompositionCycleDesc *cycle_desc,
+                        int *num_visited) {
   if (current_state->_cycle_detect == this_seq) {
     // We've already seen this state; therefore, we've found a cycle.
 
@@ -1934,6 +2270,9 @@ r_detect_reverse_cycles(const RenderState *start_state,
     return (current_state == start_state && length > 2);
   }
   ((RenderState *)current_state)->_cycle_detect = this_seq;
+  if (num_visited != (int *)NULL) {
+    ++(*num_visited);
+  }
 
   int i;
   int cache_size = current_state->_composition_cache.get_size();
@@ -1947,7 +2286,7 @@ r_detect_reverse_cycles(const RenderState *start_state,
         const RenderState *result = other->_composition_cache.get_data(oi)._result;
         if (result != (const RenderState *)NULL) {
           if (r_detect_reverse_cycles(start_state, result, length + 1, 
-                                      this_seq, cycle_desc)) {
+                                      this_seq, cycle_desc, num_visited)) {
             // Cycle detected.
             if (cycle_desc != (CompositionCycleDesc *)NULL) {
               const RenderState *other = current_state->_composition_cache.get_key(i);
@@ -1972,7 +2311,7 @@ r_detect_reverse_cycles(const RenderState *start_state,
         const RenderState *result = other->_invert_composition_cache.get_data(oi)._result;
         if (result != (const RenderState *)NULL) {
           if (r_detect_reverse_cycles(start_state, result, length + 1, 
-                                      this_seq, cycle_desc)) {
+                                      this_seq, cycle_desc, num_visited)) {
             // Cycle detected.
             if (cycle_desc != (CompositionCycleDesc *)NULL) {
               const RenderState *other = current_state->_invert_composition_cache.get_key(i);
@@ -2001,12 +2340,14 @@ r_detect_reverse_cycles(const RenderState *start_state,
 ////////////////////////////////////////////////////////////////////
 void RenderState::
 release_new() {
-  nassertv(_states_lock->debug_is_locked());
-
   if (_saved_entry != -1) {
-    //nassertv(_states->find(this) == _saved_entry);
-    _saved_entry = _states->find(this);
-    _states->remove_element(_saved_entry);
+    int stripe = get_states_stripe();
+    nassertv(_states_lock->debug_is_locked(stripe));
+    States &states = _stripes[stripe]._states;
+
+    //nassertv(states.find(this) == _saved_entry);
+    _saved_entry = states.find(this);
+    states.remove_element(_saved_entry);
     _saved_entry = -1;
   }
 }
@@ -2024,7 +2365,7 @@ release_new() {
 ////////////////////////////////////////////////////////////////////
 void RenderState::
 remove_cache_pointers() {
-  nassertv(_states_lock->debug_is_locked());
+  nassertv(_states_lock->debug_is_all_locked());
 
   // First, make sure the _auto_shader_state cache pointer is cleared.
   if (_auto_shader_state != (const RenderState *)NULL) {
@@ -2282,28 +2623,32 @@ update_pstats(int old_referenced_bits, int new_referenced_bits) {
 PyObject *RenderState::
 get_states() {
   IMPORT_THIS struct Dtool_PyTypedObject Dtool_RenderState;
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return PyList_New(0);
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
-  size_t num_states = _states->get_num_entries();
+  size_t num_states = get_num_states();
   PyObject *list = PyList_New(num_states);
   size_t i = 0;
 
-  int size = _states->get_size();
-  for (int si = 0; si < size; ++si) {
-    if (!_states->has_element(si)) {
-      continue;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    int size = states.get_size();
+    for (int si = 0; si < size; ++si) {
+      if (!states.has_element(si)) {
+        continue;
+      }
+      const RenderState *state = states.get_key(si);
+      state->ref();
+      PyObject *a = 
+        DTool_CreatePyInstanceTyped((void *)state, Dtool_RenderState, 
+                                    true, true, state->get_type_index());
+      nassertr(i < num_states, list);
+      PyList_SET_ITEM(list, i, a);
+      ++i;
     }
-    const RenderState *state = _states->get_key(si);
-    state->ref();
-    PyObject *a = 
-      DTool_CreatePyInstanceTyped((void *)state, Dtool_RenderState, 
-                                  true, true, state->get_type_index());
-    nassertr(i < num_states, list);
-    PyList_SET_ITEM(list, i, a);
-    ++i;
   }
   nassertr(i == num_states, list);
   return list;
@@ -2322,14 +2667,21 @@ get_states() {
 ////////////////////////////////////////////////////////////////////
 void RenderState::
 init_states() {
-  _states = new States;
+  // As in TransformState::init_states(), there is no point in more
+  // than one stripe without garbage collection.
+  int num_stripes = 1;
+  if (garbage_collect_states) {
+    num_stripes = max((int)state_cache_stripes, 1);
+  }
+  _stripes = new StateStripe[num_stripes];
 
   // TODO: we should have a global Panda mutex to allow us to safely
   // create _states_lock without a startup race condition.  For the
   // meantime, this is OK because we guarantee that this method is
   // called at static init time, presumably when there is still only
   // one thread in the world.
-  _states_lock = new LightReMutex("RenderState::_states_lock");
+  _states_lock = new StripedReMutex("RenderState", num_stripes);
+  _garbage_lock = new LightMutex("RenderState::_garbage_lock");
   _cache_stats.init();
   nassertv(Thread::get_current_thread() == Thread::get_main_thread());
 }
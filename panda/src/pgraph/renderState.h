@@ -27,7 +27,8 @@
 #include "texMatrixAttrib.h"
 #include "geomMunger.h"
 #include "weakPointerTo.h"
-#include "lightReMutex.h"
+#include "stripedReMutex.h"
+#include "stripedReMutexHolder.h"
 #include "lightMutex.h"
 #include "deletedChain.h"
 #include "simpleHashMap.h"
@@ -143,6 +144,8 @@ PUBLISHED:
   static int clear_cache();
   static void clear_munger_cache();
   static int garbage_collect();
+  static int garbage_collect(double max_usec);
+  static int get_num_stripes();
   static void list_cycles(ostream &out);
   static void list_states(ostream &out);
   static bool validate_states();
@@ -167,6 +170,8 @@ private:
   bool validate_filled_slots() const;
   INLINE bool do_cache_unref() const;
   INLINE bool do_node_unref() const;
+  INLINE int get_cache_stripe() const;
+  INLINE int get_states_stripe() const;
   INLINE void calc_hash();
   void do_calc_hash();
   void assign_auto_shader_state();
@@ -186,17 +191,23 @@ private:
 
   static CPT(RenderState) return_new(RenderState *state);
   static CPT(RenderState) return_unique(RenderState *state);
+  static bool garbage_collect_stripe(int stripe, double deadline,
+                                     int &num_collected);
   CPT(RenderState) do_compose(const RenderState *other) const;
+  CPT(RenderState) store_compose(const RenderState *other, const RenderState *result);
   CPT(RenderState) do_invert_compose(const RenderState *other) const;
-  void detect_and_break_cycles();
+  CPT(RenderState) store_invert_compose(const RenderState *other, const RenderState *result);
+  int detect_and_break_cycles();
   static bool r_detect_cycles(const RenderState *start_state,
                               const RenderState *current_state,
                               int length, UpdateSeq this_seq,
-                              CompositionCycleDesc *cycle_desc);
+                              CompositionCycleDesc *cycle_desc,
+                              int *num_visited = NULL);
   static bool r_detect_reverse_cycles(const RenderState *start_state,
                                       const RenderState *current_state,
                                       int length, UpdateSeq this_seq,
-                                      CompositionCycleDesc *cycle_desc);
+                                      CompositionCycleDesc *cycle_desc,
+                                      int *num_visited = NULL);
 
   void release_new();
   void remove_cache_pointers();
@@ -221,20 +232,45 @@ public:
   CPT(RenderAttrib) _generated_shader;
 
 private:
-  // This mutex protects _states.  It also protects any modification
-  // to the cache, which is encoded in _composition_cache and
-  // _invert_composition_cache.
-  static LightReMutex *_states_lock;
+  // The global table of unique RenderStates is split into
+  // state-cache-stripes independent tables, in the same way as for
+  // TransformState.  Each stripe of this mutex protects the
+  // corresponding table in _stripes, as well as the
+  // _composition_cache, _invert_composition_cache and
+  // _auto_shader_state of every RenderState whose pointer maps to
+  // that stripe.
+  static StripedReMutex *_states_lock;
   class Empty {
   };
   typedef SimpleHashMap<const RenderState *, Empty, indirect_compare_to_hash<const RenderState *> > States;
-  static States *_states;
+  class StateStripe {
+  public:
+    INLINE StateStripe();
+
+    States _states;
+
+    // This keeps track of our current position through the garbage
+    // collection cycle within this stripe, and the number of entries
+    // still to be examined before the current pass is complete.  The
+    // latter goes negative when breaking cycles costs more than the
+    // pass had left; the excess is charged to the next pass.
+    int _garbage_index;
+    int _garbage_remaining;
+  };
+  static StateStripe *_stripes;
+
+  // This serializes calls to garbage_collect(), and protects
+  // _garbage_stripe, the stripe that the next call should resume
+  // with.
+  static LightMutex *_garbage_lock;
+  static int _garbage_stripe;
   static CPT(RenderState) _empty_state;
   static CPT(RenderState) _full_default_state;
 
-  // This iterator records the entry corresponding to this
-  // RenderState object in the above global set.  We keep the index
-  // around so we can remove it when the RenderState destructs.
+  // This records the index of the entry corresponding to this
+  // RenderState object in its stripe of the above global table.  We
+  // keep the index around so we can remove it when the RenderState
+  // destructs.
   int _saved_entry;
 
   // This data structure manages the job of caching the composition of
@@ -274,10 +310,6 @@ private:
   UpdateSeq _cycle_detect;
   static UpdateSeq _last_cycle_detect;
 
-  // This keeps track of our current position through the garbage
-  // collection cycle.
-  static int _garbage_index;
-
   static PStatCollector _cache_update_pcollector;
   static PStatCollector _garbage_collect_pcollector;
   static PStatCollector _state_compose_pcollector;
@@ -287,6 +319,8 @@ private:
 
   static PStatCollector _node_counter;
   static PStatCollector _cache_counter;
+  static PStatCollector _gc_collected_counter;
+  static PStatCollector _gc_remaining_counter;
 
 private:
   // This is the actual data within the RenderState: a set of
@@ -0,0 +1,98 @@
+// Filename: stripedReMutex.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "stripedReMutex.h"
+#include "string_utils.h"
+
+PStatCollector StripedReMutex::_lock_wait_pcollector("*:State Cache:Lock Wait");
+
+////////////////////////////////////////////////////////////////////
+//     Function: StripedReMutex::Constructor
+//       Access: Public
+//  Description: Creates num_stripes independent locks.  The name is
+//               used to label the locks for debugging, and also to
+//               label the PStats collectors that report the time
+//               spent waiting for each one.
+////////////////////////////////////////////////////////////////////
+StripedReMutex::
+StripedReMutex(const string &name, int num_stripes) {
+  _num_stripes = max(num_stripes, 1);
+  _locks = new LightReMutex *[_num_stripes];
+  _wait_pcollectors = new PStatCollector[_num_stripes];
+
+  PStatCollector parent(_lock_wait_pcollector, name);
+  for (int i = 0; i < _num_stripes; ++i) {
+    string stripe_name = name + " " + format_string(i);
+    _locks[i] = new LightReMutex(stripe_name);
+    _wait_pcollectors[i] = PStatCollector(parent, stripe_name);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: StripedReMutex::Destructor
+//       Access: Public
+//  Description:
+////////////////////////////////////////////////////////////////////
+StripedReMutex::
+~StripedReMutex() {
+  for (int i = 0; i < _num_stripes; ++i) {
+    delete _locks[i];
+  }
+  delete[] _locks;
+  delete[] _wait_pcollectors;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: StripedReMutex::acquire_all
+//       Access: Public
+//  Description: Grabs all of the stripes, in order.  This is
+//               necessary for operations that may touch objects in
+//               any stripe, such as walking the entire table or
+//               breaking cycles in the composition cache.
+////////////////////////////////////////////////////////////////////
+void StripedReMutex::
+acquire_all() const {
+  for (int i = 0; i < _num_stripes; ++i) {
+    acquire(i);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: StripedReMutex::release_all
+//       Access: Public
+//  Description: Releases all of the stripes, in the reverse order
+//               that acquire_all() grabbed them.
+////////////////////////////////////////////////////////////////////
+void StripedReMutex::
+release_all() const {
+  for (int i = _num_stripes - 1; i >= 0; --i) {
+    release(i);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: StripedReMutex::debug_is_all_locked
+//       Access: Public
+//  Description: Returns true if the current thread holds all of the
+//               stripes.  See debug_is_locked().
+////////////////////////////////////////////////////////////////////
+bool StripedReMutex::
+debug_is_all_locked() const {
+  for (int i = 0; i < _num_stripes; ++i) {
+    if (!_locks[i]->debug_is_locked()) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,71 @@
+// Filename: stripedReMutex.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef STRIPEDREMUTEX_H
+#define STRIPEDREMUTEX_H
+
+#include "pandabase.h"
+#include "lightReMutex.h"
+#include "pStatCollector.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : StripedReMutex
+// Description : A fixed-size array of LightReMutexes, used to
+//               protect a table that has been split into several
+//               independent stripes (or shards), so that threads
+//               operating on different parts of the table need not
+//               contend for the same lock.  This is used by the
+//               TransformState and RenderState caches.
+//
+//               When more than one stripe must be held at once, the
+//               stripes are always acquired in increasing order, to
+//               avoid deadlock; use StripedReMutexHolder to do this
+//               automatically.
+//
+//               The time spent waiting to acquire each stripe is
+//               reported to PStats under "*:State Cache:Lock Wait".
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_PGRAPH StripedReMutex {
+public:
+  StripedReMutex(const string &name, int num_stripes);
+  ~StripedReMutex();
+
+private:
+  INLINE StripedReMutex(const StripedReMutex &copy);
+  INLINE void operator = (const StripedReMutex &copy);
+
+public:
+  INLINE int get_num_stripes() const;
+  INLINE int get_stripe_for_hash(size_t hash) const;
+  INLINE int get_stripe_for_pointer(const void *ptr) const;
+
+  INLINE void acquire(int n) const;
+  INLINE void release(int n) const;
+  void acquire_all() const;
+  void release_all() const;
+
+  INLINE bool debug_is_locked(int n) const;
+  bool debug_is_all_locked() const;
+
+private:
+  int _num_stripes;
+  LightReMutex **_locks;
+  PStatCollector *_wait_pcollectors;
+
+  static PStatCollector _lock_wait_pcollector;
+};
+
+#include "stripedReMutex.I"
+
+#endif
@@ -0,0 +1,51 @@
+// Filename: stripedReMutexHolder.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef STRIPEDREMUTEXHOLDER_H
+#define STRIPEDREMUTEXHOLDER_H
+
+#include "pandabase.h"
+#include "stripedReMutex.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : StripedReMutexHolder
+// Description : Similar to LightReMutexHolder, but for a
+//               StripedReMutex.  It may hold a single stripe, a pair
+//               of stripes, or all of the stripes at once; in each
+//               case the stripes are acquired in increasing order.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_PGRAPH StripedReMutexHolder {
+public:
+  INLINE StripedReMutexHolder(const StripedReMutex &mutex);
+  INLINE StripedReMutexHolder(const StripedReMutex &mutex, int n);
+  INLINE StripedReMutexHolder(const StripedReMutex &mutex, int a, int b);
+  INLINE ~StripedReMutexHolder();
+private:
+  INLINE StripedReMutexHolder(const StripedReMutexHolder &copy);
+  INLINE void operator = (const StripedReMutexHolder &copy);
+
+private:
+#if defined(HAVE_THREADS) || defined(DEBUG_THREADS)
+  const StripedReMutex *_mutex;
+
+  // If _first is -1, we are holding all of the stripes.  Otherwise,
+  // we are holding _first, and also _second if it is not -1.
+  int _first;
+  int _second;
+#endif
+};
+
+#include "stripedReMutexHolder.I"
+
+#endif
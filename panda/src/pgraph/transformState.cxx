@@ -21,17 +21,19 @@
 #include "compareTo.h"
 #include "pStatTimer.h"
 #include "config_pgraph.h"
-#include "lightReMutexHolder.h"
+#include "stripedReMutexHolder.h"
+#include "trueClock.h"
 #include "lightMutexHolder.h"
 #include "thread.h"
 #include "py_panda.h"
 
-LightReMutex *TransformState::_states_lock = NULL;
-TransformState::States *TransformState::_states = NULL;
+StripedReMutex *TransformState::_states_lock = NULL;
+TransformState::StateStripe *TransformState::_stripes = NULL;
+LightMutex *TransformState::_garbage_lock = NULL;
+int TransformState::_garbage_stripe = 0;
 CPT(TransformState) TransformState::_identity_state;
 CPT(TransformState) TransformState::_invalid_state;
 UpdateSeq TransformState::_last_cycle_detect;
-int TransformState::_garbage_index = 0;
 
 PStatCollector TransformState::_cache_update_pcollector("*:State Cache:Update");
 PStatCollector TransformState::_garbage_collect_pcollector("*:State Cache:Garbage Collect");
@@ -44,6 +46,8 @@ PStatCollector TransformState::_transform_validate_pcollector("*:State Cache:Val
 PStatCollector TransformState::_transform_hash_pcollector("*:State Cache:Calc Hash");
 PStatCollector TransformState::_node_counter("TransformStates:On nodes");
 PStatCollector TransformState::_cache_counter("TransformStates:Cached");
+PStatCollector TransformState::_gc_collected_counter("TransformStates:Collected");
+PStatCollector TransformState::_gc_remaining_counter("TransformStates:Collect Pending");
 
 CacheStats TransformState::_cache_stats;
 
@@ -58,7 +62,7 @@ TypeHandle TransformState::_type_handle;
 ////////////////////////////////////////////////////////////////////
 TransformState::
 TransformState() : _lock("TransformState") {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     init_states();
   }
   _saved_entry = -1;
@@ -105,7 +109,7 @@ TransformState::
     _inv_mat = (LMatrix4 *)NULL;
   }
 
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
 
   // unref() should have cleared these.
   nassertv(_saved_entry == -1);
@@ -605,10 +609,11 @@ compose(const TransformState *other) const {
     return do_compose(other);
   }
 
-  // Is this composition already cached?
+  // Is this composition already cached?  We only need to hold the
+  // stripe that protects our own cache to look it up.
   CPT(TransformState) result;
   {
-    LightReMutexHolder holder(*_states_lock);
+    StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
     int index = _composition_cache.find(other);
     if (index != -1) {
       const Composition &comp = _composition_cache.get_data(index);
@@ -675,11 +680,9 @@ invert_compose(const TransformState *other) const {
     return do_invert_compose(other);
   }
 
-  LightReMutexHolder holder(*_states_lock);
-
   CPT(TransformState) result;
   {
-    LightReMutexHolder holder(*_states_lock);
+    StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
     int index = _invert_composition_cache.find(other);
     if (index != -1) {
       const Composition &comp = _invert_composition_cache.get_data(index);
@@ -730,8 +733,10 @@ unref() const {
   // We always have to grab the lock, since we will definitely need to
   // be holding it if we happen to drop the reference count to 0.
   // Having to grab the lock at every call to unref() is a big
-  // limiting factor on parallelization.
-  LightReMutexHolder holder(*_states_lock);
+  // limiting factor on parallelization.  Since breaking cycles and
+  // removing the cache pointers may touch TransformStates in any
+  // stripe, we need all of them.
+  StripedReMutexHolder holder(*_states_lock);
 
   if (auto_break_cycles && uniquify_transforms) {
     if (get_cache_ref_count() > 0 &&
@@ -767,7 +772,7 @@ unref() const {
 ////////////////////////////////////////////////////////////////////
 bool TransformState::
 validate_composition_cache() const {
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
   int size = _composition_cache.get_size();
   for (int i = 0; i < size; ++i) {
@@ -836,7 +841,7 @@ validate_composition_cache() const {
 PyObject *TransformState::
 get_composition_cache() const {
   IMPORT_THIS struct Dtool_PyTypedObject Dtool_TransformState;
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
 
   size_t num_states = _composition_cache.get_num_entries();
   PyObject *list = PyList_New(num_states);
@@ -900,7 +905,7 @@ get_composition_cache() const {
 PyObject *TransformState::
 get_invert_composition_cache() const {
   IMPORT_THIS struct Dtool_PyTypedObject Dtool_TransformState;
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock, get_cache_stripe());
 
   size_t num_states = _invert_composition_cache.get_num_entries();
   PyObject *list = PyList_New(num_states);
@@ -1071,11 +1076,17 @@ write_composition_cache(ostream &out, int indent_level) const {
 ////////////////////////////////////////////////////////////////////
 int TransformState::
 get_num_states() {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return 0;
   }
-  LightReMutexHolder holder(*_states_lock);
-  return _states->get_num_entries();
+  StripedReMutexHolder holder(*_states_lock);
+
+  int num_states = 0;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    num_states += _stripes[stripe]._states.get_num_entries();
+  }
+  return num_states;
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -1098,10 +1109,10 @@ get_num_states() {
 ////////////////////////////////////////////////////////////////////
 int TransformState::
 get_num_unused_states() {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return 0;
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
   // First, we need to count the number of times each TransformState
   // object is recorded in the cache.  We could just trust
@@ -1109,40 +1120,44 @@ get_num_unused_states() {
   typedef pmap<const TransformState *, int> StateCount;
   StateCount state_count;
 
-  int size = _states->get_size();
-  for (int si = 0; si < size; ++si) {
-    if (!_states->has_element(si)) {
-      continue;
-    }
-    const TransformState *state = _states->get_key(si);
-
-    int i;
-    int cache_size = state->_composition_cache.get_size();
-    for (i = 0; i < cache_size; ++i) {
-      if (state->_composition_cache.has_element(i)) {
-        const TransformState *result = state->_composition_cache.get_data(i)._result;
-        if (result != (const TransformState *)NULL && result != state) {
-          // Here's a TransformState that's recorded in the cache.
-          // Count it.
-          pair<StateCount::iterator, bool> ir =
-            state_count.insert(StateCount::value_type(result, 1));
-          if (!ir.second) {
-            // If the above insert operation fails, then it's already in
-            // the cache; increment its value.
-            (*(ir.first)).second++;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    int size = states.get_size();
+    for (int si = 0; si < size; ++si) {
+      if (!states.has_element(si)) {
+        continue;
+      }
+      const TransformState *state = states.get_key(si);
+
+      int i;
+      int cache_size = state->_composition_cache.get_size();
+      for (i = 0; i < cache_size; ++i) {
+        if (state->_composition_cache.has_element(i)) {
+          const TransformState *result = state->_composition_cache.get_data(i)._result;
+          if (result != (const TransformState *)NULL && result != state) {
+            // Here's a TransformState that's recorded in the cache.
+            // Count it.
+            pair<StateCount::iterator, bool> ir =
+              state_count.insert(StateCount::value_type(result, 1));
+            if (!ir.second) {
+              // If the above insert operation fails, then it's already in
+              // the cache; increment its value.
+              (*(ir.first)).second++;
+            }
           }
         }
       }
-    }
-    cache_size = state->_invert_composition_cache.get_size();
-    for (i = 0; i < cache_size; ++i) {
-      if (state->_invert_composition_cache.has_element(i)) {
-        const TransformState *result = state->_invert_composition_cache.get_data(i)._result;
-        if (result != (const TransformState *)NULL && result != state) {
-          pair<StateCount::iterator, bool> ir =
-            state_count.insert(StateCount::value_type(result, 1));
-          if (!ir.second) {
-            (*(ir.first)).second++;
+      cache_size = state->_invert_composition_cache.get_size();
+      for (i = 0; i < cache_size; ++i) {
+        if (state->_invert_composition_cache.has_element(i)) {
+          const TransformState *result = state->_invert_composition_cache.get_data(i)._result;
+          if (result != (const TransformState *)NULL && result != state) {
+            pair<StateCount::iterator, bool> ir =
+              state_count.insert(StateCount::value_type(result, 1));
+            if (!ir.second) {
+              (*(ir.first)).second++;
+            }
           }
         }
       }
@@ -1197,13 +1212,13 @@ get_num_unused_states() {
 ////////////////////////////////////////////////////////////////////
 int TransformState::
 clear_cache() {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return 0;
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
   PStatTimer timer(_cache_update_pcollector);
-  int orig_size = _states->get_num_entries();
+  int orig_size = get_num_states();
 
   // First, we need to copy the entire set of states to a temporary
   // vector, reference-counting each object.  That way we can walk
@@ -1214,13 +1229,17 @@ clear_cache() {
     TempStates temp_states;
     temp_states.reserve(orig_size);
 
-    int size = _states->get_size();
-    for (int si = 0; si < size; ++si) {
-      if (!_states->has_element(si)) {
-        continue;
+    int num_stripes = _states_lock->get_num_stripes();
+    for (int stripe = 0; stripe < num_stripes; ++stripe) {
+      const States &states = _stripes[stripe]._states;
+      int size = states.get_size();
+      for (int si = 0; si < size; ++si) {
+        if (!states.has_element(si)) {
+          continue;
+        }
+        const TransformState *state = states.get_key(si);
+        temp_states.push_back(state);
       }
-      const TransformState *state = _states->get_key(si);
-      temp_states.push_back(state);
     }
 
     // Now it's safe to walk through the list, destroying the cache
@@ -1263,7 +1282,7 @@ clear_cache() {
     // held only within the various objects' caches will go away.
   }
 
-  int new_size = _states->get_num_entries();
+  int new_size = get_num_states();
   return orig_size - new_size;
 }
 
@@ -1276,64 +1295,90 @@ clear_cache() {
 //               appropriately.  It does no harm to call it even if
 //               this variable is not true, but there is probably no
 //               advantage in that case.
+//
+//               The amount of time spent is limited by
+//               garbage-collect-states-budget; see the overload that
+//               accepts an explicit budget.
 ////////////////////////////////////////////////////////////////////
 int TransformState::
 garbage_collect() {
-  if (_states == (States *)NULL || !garbage_collect_states) {
+  return garbage_collect(garbage_collect_states_budget);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TransformState::garbage_collect
+//       Access: Published, Static
+//  Description: Performs a garbage-collection cycle, spending no
+//               more than approximately max_usec microseconds.  If
+//               the budget runs out before the cycle is complete, the
+//               next call picks up exactly where this one stopped, so
+//               that over several frames the whole cache is still
+//               visited.  If max_usec is 0 or less, the cycle runs to
+//               completion.
+//
+//               Returns the number of TransformStates freed.  This
+//               count, and the number of cache entries still waiting
+//               to be examined in the current cycle, are also
+//               reported to PStats.
+////////////////////////////////////////////////////////////////////
+int TransformState::
+garbage_collect(double max_usec) {
+  TrueClock *clock = TrueClock::get_global_ptr();
+  double deadline = 0.0;
+  if (max_usec > 0.0) {
+    deadline = clock->get_short_time() + max_usec * 0.000001;
+  }
+
+  if (_stripes == (StateStripe *)NULL || !garbage_collect_states) {
     return 0;
   }
-  LightReMutexHolder holder(*_states_lock);
 
   PStatTimer timer(_garbage_collect_pcollector);
-  int orig_size = _states->get_num_entries();
+  LightMutexHolder gc_holder(*_garbage_lock);
 
-  // How many elements to process this pass?
-  int size = _states->get_size();
-  int num_this_pass = int(size * garbage_collect_states_rate);
-  if (num_this_pass <= 0) {
-    return 0;
+  // Each stripe is collected independently, so that we don't hold up
+  // threads working in the other stripes while we are scanning this
+  // one.  We begin with the stripe we were working on when we last
+  // ran out of time.
+  int num_collected = 0;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int i = 0; i < num_stripes; ++i) {
+    if (!garbage_collect_stripe(_garbage_stripe, deadline, num_collected)) {
+      // Out of time.
+      break;
+    }
+    _garbage_stripe = (_garbage_stripe + 1) % num_stripes;
   }
-  num_this_pass = min(num_this_pass, size);
-  int stop_at_element = (_garbage_index + num_this_pass) % size;
-  
-  int num_elements = 0;
-  int si = _garbage_index;
-  do {
-    if (_states->has_element(si)) {
-      ++num_elements;
-      TransformState *state = (TransformState *)_states->get_key(si);
-      if (auto_break_cycles && uniquify_transforms) {
-        if (state->get_cache_ref_count() > 0 &&
-            state->get_ref_count() == state->get_cache_ref_count()) {
-          // If we have removed all the references to this state not in
-          // the cache, leaving only references in the cache, then we
-          // need to check for a cycle involving this TransformState and
-          // break it if it exists.
-          state->detect_and_break_cycles();
-        }
-      }
 
-      if (state->get_ref_count() == 1) {
-        // This state has recently been unreffed to 1 (the one we
-        // added when we stored it in the cache).  Now it's time to
-        // delete it.  This is safe, because we're holding the
-        // _states_lock, so it's not possible for some other thread to
-        // find the state in the cache and ref it while we're doing
-        // this.
-        state->release_new();
-        state->remove_cache_pointers();
-        state->cache_unref();
-        delete state;
-      }
-    }      
-    
-    si = (si + 1) % size;
-  } while (si != stop_at_element);
-  _garbage_index = si;
-  nassertr(_states->validate(), 0);
+  _gc_collected_counter.set_level(num_collected);
+#ifdef DO_PSTATS
+  if (_gc_remaining_counter.is_active()) {
+    int num_remaining = 0;
+    for (int stripe = 0; stripe < num_stripes; ++stripe) {
+      StripedReMutexHolder holder(*_states_lock, stripe);
+      num_remaining += max(_stripes[stripe]._garbage_remaining, 0);
+    }
+    _gc_remaining_counter.set_level(num_remaining);
+  }
+#endif  // DO_PSTATS
 
-  int new_size = _states->get_num_entries();
-  return orig_size - new_size;
+  return num_collected;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TransformState::get_num_stripes
+//       Access: Published, Static
+//  Description: Returns the number of independent pieces into which
+//               the TransformState cache has been divided.  This is
+//               controlled by the state-cache-stripes config
+//               variable.
+////////////////////////////////////////////////////////////////////
+int TransformState::
+get_num_stripes() {
+  if (_stripes == (StateStripe *)NULL) {
+    return 0;
+  }
+  return _states_lock->get_num_stripes();
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -1356,72 +1401,76 @@ garbage_collect() {
 ////////////////////////////////////////////////////////////////////
 void TransformState::
 list_cycles(ostream &out) {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return;
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
   typedef pset<const TransformState *> VisitedStates;
   VisitedStates visited;
   CompositionCycleDesc cycle_desc;
 
-  int size = _states->get_size();
-  for (int si = 0; si < size; ++si) {
-    if (!_states->has_element(si)) {
-      continue;
-    }
-    const TransformState *state = _states->get_key(si);
-
-    bool inserted = visited.insert(state).second;
-    if (inserted) {
-      ++_last_cycle_detect;
-      if (r_detect_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
-        // This state begins a cycle.
-        CompositionCycleDesc::reverse_iterator csi;
-
-        out << "\nCycle detected of length " << cycle_desc.size() + 1 << ":\n"
-            << "state " << (void *)state << ":" << state->get_ref_count()
-            << " =\n";
-        state->write(out, 2);
-        for (csi = cycle_desc.rbegin(); csi != cycle_desc.rend(); ++csi) {
-          const CompositionCycleDescEntry &entry = (*csi);
-          if (entry._inverted) {
-            out << "invert composed with ";
-          } else {
-            out << "composed with ";
-          }
-          out << (const void *)entry._obj << ":" << entry._obj->get_ref_count()
-              << " " << *entry._obj << "\n"
-              << "produces " << (const void *)entry._result << ":"
-              << entry._result->get_ref_count() << " =\n";
-          entry._result->write(out, 2);
-          visited.insert(entry._result);
-        }
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    int size = states.get_size();
+    for (int si = 0; si < size; ++si) {
+      if (!states.has_element(si)) {
+        continue;
+      }
+      const TransformState *state = states.get_key(si);
 
-        cycle_desc.clear();
-      } else {
+      bool inserted = visited.insert(state).second;
+      if (inserted) {
         ++_last_cycle_detect;
-        if (r_detect_reverse_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
+        if (r_detect_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
           // This state begins a cycle.
-          CompositionCycleDesc::iterator csi;
-          
-          out << "\nReverse cycle detected of length " << cycle_desc.size() + 1 << ":\n"
-              << "state ";
-          for (csi = cycle_desc.begin(); csi != cycle_desc.end(); ++csi) {
+          CompositionCycleDesc::reverse_iterator csi;
+
+          out << "\nCycle detected of length " << cycle_desc.size() + 1 << ":\n"
+              << "state " << (void *)state << ":" << state->get_ref_count()
+              << " =\n";
+          state->write(out, 2);
+          for (csi = cycle_desc.rbegin(); csi != cycle_desc.rend(); ++csi) {
             const CompositionCycleDescEntry &entry = (*csi);
-            out << (const void *)entry._result << ":"
+            if (entry._inverted) {
+              out << "invert composed with ";
+            } else {
+              out << "composed with ";
+            }
+            out << (const void *)entry._obj << ":" << entry._obj->get_ref_count()
+                << " " << *entry._obj << "\n"
+                << "produces " << (const void *)entry._result << ":"
                 << entry._result->get_ref_count() << " =\n";
             entry._result->write(out, 2);
-            out << (const void *)entry._obj << ":"
-                << entry._obj->get_ref_count() << " =\n";
-            entry._obj->write(out, 2);
             visited.insert(entry._result);
           }
-          out << (void *)state << ":"
-              << state->get_ref_count() << " =\n";
-          state->write(out, 2);
-          
+
           cycle_desc.clear();
+        } else {
+          ++_last_cycle_detect;
+          if (r_detect_reverse_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
+            // This state begins a cycle.
+            CompositionCycleDesc::iterator csi;
+          
+            out << "\nReverse cycle detected of length " << cycle_desc.size() + 1 << ":\n"
+                << "state ";
+            for (csi = cycle_desc.begin(); csi != cycle_desc.end(); ++csi) {
+              const CompositionCycleDescEntry &entry = (*csi);
+              out << (const void *)entry._result << ":"
+                  << entry._result->get_ref_count() << " =\n";
+              entry._result->write(out, 2);
+              out << (const void *)entry._obj << ":"
+                  << entry._obj->get_ref_count() << " =\n";
+              entry._obj->write(out, 2);
+              visited.insert(entry._result);
+            }
+            out << (void *)state << ":"
+                << state->get_ref_count() << " =\n";
+            state->write(out, 2);
+          
+            cycle_desc.clear();
+          }
         }
       }
     }
@@ -1438,21 +1487,25 @@ list_cycles(ostream &out) {
 ////////////////////////////////////////////////////////////////////
 void TransformState::
 list_states(ostream &out) {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     out << "0 states:\n";
     return;
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
-  out << _states->get_num_entries() << " states:\n";
+  out << get_num_states() << " states:\n";
 
-  int size = _states->get_size();
-  for (int si = 0; si < size; ++si) {
-    if (!_states->has_element(si)) {
-      continue;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    int size = states.get_size();
+    for (int si = 0; si < size; ++si) {
+      if (!states.has_element(si)) {
+        continue;
+      }
+      const TransformState *state = states.get_key(si);
+      state->write(out, 2);
     }
-    const TransformState *state = _states->get_key(si);
-    state->write(out, 2);
   }
 }
 
@@ -1468,61 +1521,66 @@ list_states(ostream &out) {
 ////////////////////////////////////////////////////////////////////
 bool TransformState::
 validate_states() {
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return true;
   }
 
   PStatTimer timer(_transform_validate_pcollector);
 
-  LightReMutexHolder holder(*_states_lock);
-  if (_states->is_empty()) {
-    return true;
-  }
-
-  if (!_states->validate()) {
-    pgraph_cat.error()
-      << "TransformState::_states cache is invalid!\n";
-    return false;
-  }    
+  StripedReMutexHolder holder(*_states_lock);
 
-  int size = _states->get_size();
-  int si = 0;
-  while (si < size && !_states->has_element(si)) {
-    ++si;
-  }
-  nassertr(si < size, false);
-  nassertr(_states->get_key(si)->get_ref_count() >= 0, false);
-  int snext = si;
-  ++snext;
-  while (snext < size && !_states->has_element(snext)) {
-    ++snext;
-  }
-  while (snext < size) {
-    nassertr(_states->get_key(snext)->get_ref_count() >= 0, false);
-    const TransformState *ssi = _states->get_key(si);
-    if (!ssi->validate_composition_cache()) {
-      return false;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    if (states.is_empty()) {
+      continue;
     }
-    const TransformState *ssnext = _states->get_key(snext);
-    int c = ssi->compare_to(*ssnext);
-    int ci = ssnext->compare_to(*ssi);
-    if ((ci < 0) != (c > 0) ||
-        (ci > 0) != (c < 0) ||
-        (ci == 0) != (c == 0)) {
+
+    if (!states.validate()) {
       pgraph_cat.error()
-        << "TransformState::compare_to() not defined properly!\n";
-      pgraph_cat.error(false)
-        << "(a, b): " << c << "\n";
-      pgraph_cat.error(false)
-        << "(b, a): " << ci << "\n";
-      ssi->write(pgraph_cat.error(false), 2);
-      ssnext->write(pgraph_cat.error(false), 2);
+        << "TransformState::_states cache is invalid!\n";
       return false;
+    }    
+
+    int size = states.get_size();
+    int si = 0;
+    while (si < size && !states.has_element(si)) {
+      ++si;
     }
-    si = snext;
+    nassertr(si < size, false);
+    nassertr(states.get_key(si)->get_ref_count() >= 0, false);
+    int snext = si;
     ++snext;
-    while (snext < size && !_states->has_element(snext)) {
+    while (snext < size && !states.has_element(snext)) {
+      ++snext;
+    }
+    while (snext < size) {
+      nassertr(states.get_key(snext)->get_ref_count() >= 0, false);
+      const TransformState *ssi = states.get_key(si);
+      if (!ssi->validate_composition_cache()) {
+        return false;
+      }
+      const TransformState *ssnext = states.get_key(snext);
+      int c = ssi->compare_to(*ssnext);
+      int ci = ssnext->compare_to(*ssi);
+      if ((ci < 0) != (c > 0) ||
+          (ci > 0) != (c < 0) ||
+          (ci == 0) != (c == 0)) {
+        pgraph_cat.error()
+          << "TransformState::compare_to() not defined properly!\n";
+        pgraph_cat.error(false)
+          << "(a, b): " << c << "\n";
+        pgraph_cat.error(false)
+          << "(b, a): " << ci << "\n";
+        ssi->write(pgraph_cat.error(false), 2);
+        ssnext->write(pgraph_cat.error(false), 2);
+        return false;
+      }
+      si = snext;
       ++snext;
+      while (snext < size && !states.has_element(snext)) {
+        ++snext;
+      }
     }
   }
 
@@ -1540,28 +1598,32 @@ validate_states() {
 PyObject *TransformState::
 get_states() {
   IMPORT_THIS struct Dtool_PyTypedObject Dtool_TransformState;
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return PyList_New(0);
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
-  size_t num_states = _states->get_num_entries();
+  size_t num_states = get_num_states();
   PyObject *list = PyList_New(num_states);
   size_t i = 0;
 
-  int size = _states->get_size();
-  for (int si = 0; si < size; ++si) {
-    if (!_states->has_element(si)) {
-      continue;
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    int size = states.get_size();
+    for (int si = 0; si < size; ++si) {
+      if (!states.has_element(si)) {
+        continue;
+      }
+      const TransformState *state = states.get_key(si);
+      state->ref();
+      PyObject *a = 
+        DTool_CreatePyInstanceTyped((void *)state, Dtool_TransformState, 
+                                    true, true, state->get_type_index());
+      nassertr(i < num_states, list);
+      PyList_SET_ITEM(list, i, a);
+      ++i;
     }
-    const TransformState *state = _states->get_key(si);
-    state->ref();
-    PyObject *a = 
-      DTool_CreatePyInstanceTyped((void *)state, Dtool_TransformState, 
-                                  true, true, state->get_type_index());
-    nassertr(i < num_states, list);
-    PyList_SET_ITEM(list, i, a);
-    ++i;
   }
   nassertr(i == num_states, list);
   return list;
@@ -1579,25 +1641,29 @@ get_states() {
 PyObject *TransformState::
 get_unused_states() {
   IMPORT_THIS struct Dtool_PyTypedObject Dtool_TransformState;
-  if (_states == (States *)NULL) {
+  if (_stripes == (StateStripe *)NULL) {
     return PyList_New(0);
   }
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock);
 
   PyObject *list = PyList_New(0);
-  int size = _states->get_size();
-  for (int si = 0; si < size; ++si) {
-    if (!_states->has_element(si)) {
-      continue;
-    }
-    const TransformState *state = _states->get_key(si);
-    if (state->get_cache_ref_count() == state->get_ref_count()) {
-      state->ref();
-      PyObject *a = 
-        DTool_CreatePyInstanceTyped((void *)state, Dtool_TransformState, 
-                                    true, true, state->get_type_index());
-      PyList_Append(list, a);
-      Py_DECREF(a);
+  int num_stripes = _states_lock->get_num_stripes();
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    const States &states = _stripes[stripe]._states;
+    int size = states.get_size();
+    for (int si = 0; si < size; ++si) {
+      if (!states.has_element(si)) {
+        continue;
+      }
+      const TransformState *state = states.get_key(si);
+      if (state->get_cache_ref_count() == state->get_ref_count()) {
+        state->ref();
+        PyObject *a = 
+          DTool_CreatePyInstanceTyped((void *)state, Dtool_TransformState, 
+                                      true, true, state->get_type_index());
+        PyList_Append(list, a);
+        Py_DECREF(a);
+      }
     }
   }
   return list;
@@ -1616,14 +1682,23 @@ get_unused_states() {
 ////////////////////////////////////////////////////////////////////
 void TransformState::
 init_states() {
-  _states = new States;
+  // The number of stripes is fixed from here on; it can't be changed
+  // once there are states in the table.  Without garbage collection,
+  // every unref() has to hold all of the stripes anyway, so there is
+  // no point in having more than one.
+  int num_stripes = 1;
+  if (garbage_collect_states) {
+    num_stripes = max((int)state_cache_stripes, 1);
+  }
+  _stripes = new StateStripe[num_stripes];
 
   // TODO: we should have a global Panda mutex to allow us to safely
   // create _states_lock without a startup race condition.  For the
   // meantime, this is OK because we guarantee that this method is
   // called at static init time, presumably when there is still only
   // one thread in the world.
-  _states_lock = new LightReMutex("TransformState::_states_lock");
+  _states_lock = new StripedReMutex("TransformState", num_stripes);
+  _garbage_lock = new LightMutex("TransformState::_garbage_lock");
   _cache_stats.init();
   nassertv(Thread::get_current_thread() == Thread::get_main_thread());
 }
@@ -1676,22 +1751,29 @@ return_unique(TransformState *state) {
 
   PStatTimer timer(_transform_new_pcollector);
 
-  LightReMutexHolder holder(*_states_lock);
+  // Save the state in a local PointerTo so that it will be freed at
+  // the end of this function if no one else uses it.  This must be
+  // declared before the holder below, so that the state is freed
+  // after we have released the lock; the destructor needs to grab
+  // another stripe.
+  CPT(TransformState) pt_state = state;
+
+  // We only need to hold the stripe in which an equivalent state
+  // would be found.
+  int stripe = state->get_states_stripe();
+  StripedReMutexHolder holder(*_states_lock, stripe);
+  States &states = _stripes[stripe]._states;
 
   if (state->_saved_entry != -1) {
     // This state is already in the cache.
-    //nassertr(_states->find(state) == state->_saved_entry, state);
+    //nassertr(states.find(state) == state->_saved_entry, state);
     return state;
   }
 
-  // Save the state in a local PointerTo so that it will be freed at
-  // the end of this function if no one else uses it.
-  CPT(TransformState) pt_state = state;
-
-  int si = _states->find(state);
+  int si = states.find(state);
   if (si != -1) {
     // There's an equivalent state already in the set.  Return it.
-    return _states->get_key(si);
+    return states.get_key(si);
   }
 
   // Not already in the set; add it.
@@ -1701,13 +1783,172 @@ return_unique(TransformState *state) {
     // that it won't be deleted while it's in it.
     state->cache_ref();
   }
-  si = _states->store(state, Empty());
+  si = states.store(state, Empty());
 
   // Save the index and return the input state.
   state->_saved_entry = si;
   return pt_state;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: TransformState::garbage_collect_stripe
+//       Access: Private, Static
+//  Description: Continues the garbage-collection pass over the
+//               indicated stripe of the global table, adding the
+//               number of TransformStates freed to num_collected.
+//               Returns true if the pass over this stripe was
+//               completed, or false if the deadline (a value of
+//               TrueClock::get_short_time(), or 0.0 for none) passed
+//               first; in the latter case, the next call resumes
+//               where this one left off.
+//
+//               This happens in two phases.  First, we scan a
+//               portion of the stripe, holding only that stripe's
+//               lock, looking for states whose only remaining
+//               references are within the cache.  If we find any, we
+//               grab all of the stripes (since freeing a state
+//               modifies the composition cache of other states,
+//               which may live in any stripe) and free them.
+////////////////////////////////////////////////////////////////////
+bool TransformState::
+garbage_collect_stripe(int stripe, double deadline, int &num_collected) {
+  TrueClock *clock = TrueClock::get_global_ptr();
+
+  // We hold a reference to each candidate while we are between the
+  // two phases, so that no other thread can delete it out from under
+  // us.  We also remember where we found it, so we can back up to it
+  // if we run out of time before we get to it.
+  typedef pvector< pair<CPT(TransformState), int> > Candidates;
+  Candidates candidates;
+  int size;
+
+  {
+    StripedReMutexHolder holder(*_states_lock, stripe);
+    StateStripe &data = _stripes[stripe];
+
+    size = data._states.get_size();
+    if (size == 0) {
+      data._garbage_remaining = 0;
+      return true;
+    }
+    if (data._garbage_index >= size) {
+      // The table has been cleared since we were last here.
+      data._garbage_index = 0;
+      data._garbage_remaining = 0;
+    }
+
+    if (data._garbage_remaining <= 0) {
+      // Begin a new pass over this stripe.  How many elements to
+      // process this pass?
+      int num_this_pass = int(size * garbage_collect_states_rate);
+      if (num_this_pass <= 0) {
+        return true;
+      }
+      // If breaking cycles overran the budget of the last pass, the
+      // excess is charged to this one.
+      data._garbage_remaining =
+        min(data._garbage_remaining + num_this_pass, size);
+      if (data._garbage_remaining <= 0) {
+        return true;
+      }
+    }
+
+    int si = data._garbage_index;
+    int num_scanned = 0;
+    while (data._garbage_remaining > 0) {
+      if (data._states.has_element(si)) {
+        const TransformState *state = data._states.get_key(si);
+        if (state->get_ref_count() == state->get_cache_ref_count()) {
+          if (state->get_ref_count() == 1 ||
+              (auto_break_cycles && uniquify_transforms)) {
+            candidates.push_back(Candidates::value_type(state, si));
+          }
+        }
+      }
+      si = (si + 1) % size;
+      --data._garbage_remaining;
+
+      // Checking the clock isn't free, so we only do it occasionally.
+      ++num_scanned;
+      if (deadline != 0.0 && (num_scanned & 0xff) == 0 &&
+          clock->get_short_time() >= deadline) {
+        break;
+      }
+    }
+    data._garbage_index = si;
+
+    if (candidates.empty()) {
+      return (data._garbage_remaining <= 0);
+    }
+  }
+
+  StripedReMutexHolder holder(*_states_lock);
+  StateStripe &data = _stripes[stripe];
+
+  Candidates::iterator ci;
+  for (ci = candidates.begin(); ci != candidates.end(); ++ci) {
+    if (ci != candidates.begin()) {
+      bool out_of_budget = (data._garbage_remaining < 0);
+      if (out_of_budget ||
+          (deadline != 0.0 && clock->get_short_time() >= deadline)) {
+        // Out of time, or breaking cycles has used up the budget for
+        // this pass.  Back up so that the next call begins with this
+        // candidate; if we are out of time, the candidates we skip are
+        // still part of this pass, but otherwise they go to the next
+        // one.  If the table has been resized in the meantime, the
+        // indices are meaningless, so we just move on; the states we
+        // skip will be picked up next time around.
+        if (data._states.get_size() == size) {
+          int skipped = (data._garbage_index - (*ci).second + size) % size;
+          data._garbage_index = (*ci).second;
+          if (!out_of_budget) {
+            data._garbage_remaining =
+              min(data._garbage_remaining + skipped, size);
+          }
+        }
+        break;
+      }
+    }
+
+    TransformState *state = (TransformState *)(*ci).first.p();
+
+    // Remember that we are holding one additional reference of our
+    // own in the candidates list.
+    if (auto_break_cycles && uniquify_transforms) {
+      if (state->get_cache_ref_count() > 0 &&
+          state->get_ref_count() == state->get_cache_ref_count() + 1) {
+        // If we have removed all the references to this state not in
+        // the cache, leaving only references in the cache, then we
+        // need to check for a cycle involving this TransformState and
+        // break it if it exists.  Each state visited in the search
+        // counts against the budget for this pass, the same as
+        // scanning one element of the table.
+        data._garbage_remaining -= state->detect_and_break_cycles();
+      }
+    }
+
+    if (state->get_ref_count() == 2) {
+      // This state has recently been unreffed to 1 (the one we added
+      // when we stored it in the cache), plus the one we are holding
+      // here.  Now it's time to delete it.  This is safe, because
+      // we're holding the _states_lock, so it's not possible for some
+      // other thread to find the state in the cache and ref it while
+      // we're doing this.
+      state->release_new();
+      state->remove_cache_pointers();
+      state->cache_unref();
+      ++num_collected;
+    }
+  }
+
+  // The states we released will be deleted when the candidates list
+  // goes out of scope, while we are still holding the lock.
+  candidates.clear();
+  nassertr(data._states.validate(), false);
+
+  return (data._garbage_remaining <= 0);
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: TransformState::do_compose
 //       Access: Private
@@ -1808,7 +2049,10 @@ store_compose(const TransformState *other, const TransformState *result) {
   nassertr(!is_invalid(), this);
   nassertr(!other->is_invalid(), other);
 
-  LightReMutexHolder holder(*_states_lock);
+  // We will be modifying the cache of both this object and the other
+  // object, so we need to hold both of their stripes.
+  StripedReMutexHolder holder(*_states_lock, get_cache_stripe(),
+                              other->get_cache_stripe());
 
   // Is this composition already cached?
   int index = _composition_cache.find(other);
@@ -1886,7 +2130,8 @@ store_invert_compose(const TransformState *other, const TransformState *result)
 
   nassertr(other != this, make_identity());
 
-  LightReMutexHolder holder(*_states_lock);
+  StripedReMutexHolder holder(*_states_lock, get_cache_stripe(),
+                              other->get_cache_stripe());
 
   // Is this composition already cached?
   int index = _invert_composition_cache.find(other);
@@ -2077,14 +2322,17 @@ do_invert_compose(const TransformState *other) const {
 //       Access: Private
 //  Description: Detects whether there is a cycle in the cache that
 //               begins with this state.  If any are detected, breaks
-//               them by removing this state from the cache.
+//               them by removing this state from the cache.  Returns
+//               the number of states that were visited in the search.
 ////////////////////////////////////////////////////////////////////
-void TransformState::
+int TransformState::
 detect_and_break_cycles() {
   PStatTimer timer(_transform_break_cycles_pcollector);
+  int num_visited = 0;
   
   ++_last_cycle_detect;
-  if (r_detect_cycles(this, this, 1, _last_cycle_detect, NULL)) {
+  if (r_detect_cycles(this, this, 1, _last_cycle_detect, NULL,
+                      &num_visited)) {
     // Ok, we have a cycle.  This will be a leak unless we break the
     // cycle by freeing the cache on this object.
     if (pgraph_cat.is_debug()) {
@@ -2095,7 +2343,8 @@ detect_and_break_cycles() {
     remove_cache_pointers();
   } else {
     ++_last_cycle_detect;
-    if (r_detect_reverse_cycles(this, this, 1, _last_cycle_detect, NULL)) {
+    if (r_detect_reverse_cycles(this, this, 1, _last_cycle_detect, NULL,
+                                &num_visited)) {
       if (pgraph_cat.is_debug()) {
         pgraph_cat.debug()
           << "Breaking cycle involving " << (*this) << "\n";
@@ -2104,6 +2353,8 @@ detect_and_break_cycles() {
       remove_cache_pointers();
     }
   }
+
+  return num_visited;
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -2121,7 +2372,8 @@ bool TransformState::
 r_detect_cycles(const TransformState *start_state,
                 const TransformState *current_state,
                 int length, UpdateSeq this_seq,
-                TransformState::CompositionCycleDesc *cycle_desc) {
+                TransformState::CompositionCycleDesc *cycle_desc,
+                int *num_visited) {
   if (current_state->_cycle_detect == this_seq) {
     // We've already seen this state; therefore, we've found a cycle.
 
@@ -2132,6 +2384,9 @@ r_detect_cycles(const TransformState *start_state,
     return (current_state == start_state && length > 2);
   }
   ((TransformState *)current_state)->_cycle_detect = this_seq;
+  if (num_visited != (int *)NULL) {
+    ++(*num_visited);
+  }
 
   int i;
   int cache_size = current_state->_composition_cache.get_size();
@@ -2140,7 +2395,7 @@ r_detect_cycles(const TransformState *start_state,
       const TransformState *result = current_state->_composition_cache.get_data(i)._result;
       if (result != (const TransformState *)NULL) {
         if (r_detect_cycles(start_state, result, length + 1, 
-                            this_seq, cycle_desc)) {
+                            this_seq, cycle_desc, num_visited)) {
           // Cycle detected.
           if (cycle_desc != (CompositionCycleDesc *)NULL) {
             const TransformState *other = current_state->_composition_cache.get_key(i);
@@ -2159,7 +2414,7 @@ r_detect_cycles(const TransformState *start_state,
       const TransformState *result = current_state->_invert_composition_cache.get_data(i)._result;
       if (result != (const TransformState *)NULL) {
         if (r_detect_cycles(start_state, result, length + 1,
-                            this_seq, cycle_desc)) {
+                            this_seq, cycle_desc, num_visited)) {
           // Cycle detected.
           if (cycle_desc != (CompositionCycleDesc *)NULL) {
             const TransformState *other = current_state->_invert_composition_cache.get_key(i);
@@ -2188,7 +2443,8 @@ bool TransformState::
 r_detect_reverse_cycles(const TransformState *start_state,
                         const TransformState *current_state,
                         int length, UpdateSeq this_seq,
-                        TransformState::CompositionCycleDesc *cycle_desc) {
+                        TransformState::CompositionCycleDesc *cycle_desc,
+                        int *num_visited) {
   if (current_state->_cycle_detect == this_seq) {
     // We've already seen this state; therefore, we've found a cycle.
 
@@ -2199,6 +2455,9 @@ r_detect_reverse_cycles(const TransformState *start_state,
     return (current_state == start_state && length > 2);
   }
   ((TransformState *)current_state)->_cycle_detect = this_seq;
+  if (num_visited != (int *)NULL) {
+    ++(*num_visited);
+  }
 
   int i;
   int cache_size = current_state->_composition_cache.get_size();
@@ -2212,7 +2471,7 @@ r_detect_reverse_cycles(const TransformState *start_state,
         const TransformState *result = other->_composition_cache.get_data(oi)._result;
         if (result != (const TransformState *)NULL) {
           if (r_detect_reverse_cycles(start_state, result, length + 1, 
-                                      this_seq, cycle_desc)) {
+                                      this_seq, cycle_desc, num_visited)) {
             // Cycle detected.
             if (cycle_desc != (CompositionCycleDesc *)NULL) {
               const TransformState *other = current_state->_composition_cache.get_key(i);
@@ -2237,7 +2496,7 @@ r_detect_reverse_cycles(const TransformState *start_state,
         const TransformState *result = other->_invert_composition_cache.get_data(oi)._result;
         if (result != (const TransformState *)NULL) {
           if (r_detect_reverse_cycles(start_state, result, length + 1, 
-                                      this_seq, cycle_desc)) {
+                                      this_seq, cycle_desc, num_visited)) {
             // Cycle detected.
             if (cycle_desc != (CompositionCycleDesc *)NULL) {
               const TransformState *other = current_state->_invert_composition_cache.get_key(i);
@@ -2267,12 +2526,14 @@ r_detect_reverse_cycles(const TransformState *start_state,
 ////////////////////////////////////////////////////////////////////
 void TransformState::
 release_new() {
-  nassertv(_states_lock->debug_is_locked());
-   
   if (_saved_entry != -1) {
-    //nassertv(_states->find(this) == _saved_entry);
-    _saved_entry = _states->find(this);
-    _states->remove_element(_saved_entry);
+    int stripe = get_states_stripe();
+    nassertv(_states_lock->debug_is_locked(stripe));
+    States &states = _stripes[stripe]._states;
+
+    //nassertv(states.find(this) == _saved_entry);
+    _saved_entry = states.find(this);
+    states.remove_element(_saved_entry);
     _saved_entry = -1;
   }
 }
@@ -2290,7 +2551,7 @@ release_new() {
 ////////////////////////////////////////////////////////////////////
 void TransformState::
 remove_cache_pointers() {
-  nassertv(_states_lock->debug_is_locked());
+  nassertv(_states_lock->debug_is_all_locked());
    
   // Fortunately, since we added CompositionCache records in pairs, we
   // know exactly the set of TransformState objects that have us in their
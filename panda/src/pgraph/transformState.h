@@ -24,8 +24,8 @@
 #include "updateSeq.h"
 #include "pStatCollector.h"
 #include "geomEnums.h"
-#include "lightReMutex.h"
-#include "lightReMutexHolder.h"
+#include "stripedReMutex.h"
+#include "stripedReMutexHolder.h"
 #include "lightMutex.h"
 #include "lightMutexHolder.h"
 #include "config_pgraph.h"
@@ -203,6 +203,8 @@ PUBLISHED:
   static int get_num_unused_states();
   static int clear_cache();
   static int garbage_collect();
+  static int garbage_collect(double max_usec);
+  static int get_num_stripes();
   static void list_cycles(ostream &out);
   static void list_states(ostream &out);
   static bool validate_states();
@@ -220,6 +222,8 @@ public:
 private:
   INLINE bool do_cache_unref() const;
   INLINE bool do_node_unref() const;
+  INLINE int get_cache_stripe() const;
+  INLINE int get_states_stripe() const;
 
   class CompositionCycleDescEntry {
   public:
@@ -235,39 +239,70 @@ private:
 
   static CPT(TransformState) return_new(TransformState *state);
   static CPT(TransformState) return_unique(TransformState *state);
+  static bool garbage_collect_stripe(int stripe, double deadline,
+                                     int &num_collected);
 
   CPT(TransformState) do_compose(const TransformState *other) const;
   CPT(TransformState) store_compose(const TransformState *other, const TransformState *result);
   CPT(TransformState) do_invert_compose(const TransformState *other) const;
   CPT(TransformState) store_invert_compose(const TransformState *other, const TransformState *result);
-  void detect_and_break_cycles();
+  int detect_and_break_cycles();
   static bool r_detect_cycles(const TransformState *start_state,
                               const TransformState *current_state,
                               int length, UpdateSeq this_seq,
-                              CompositionCycleDesc *cycle_desc);
+                              CompositionCycleDesc *cycle_desc,
+                              int *num_visited = NULL);
   static bool r_detect_reverse_cycles(const TransformState *start_state,
                                       const TransformState *current_state,
                                       int length, UpdateSeq this_seq,
-                                      CompositionCycleDesc *cycle_desc);
+                                      CompositionCycleDesc *cycle_desc,
+                              int *num_visited = NULL);
 
   void release_new();
   void remove_cache_pointers();
 
 private:
-  // This mutex protects _states.  It also protects any modification
-  // to the cache, which is encoded in _composition_cache and
-  // _invert_composition_cache.
-  static LightReMutex *_states_lock;
+  // The global table of unique TransformStates is split into
+  // state-cache-stripes independent tables.  Each stripe of this
+  // mutex protects the corresponding table in _stripes, chosen by the
+  // hash of the TransformState (see get_states_stripe()).  The same
+  // stripe also protects the _composition_cache and
+  // _invert_composition_cache of every TransformState whose pointer
+  // maps to that stripe (see get_cache_stripe()).  Operations that
+  // touch the cache of more than two TransformStates must hold all of
+  // the stripes.
+  static StripedReMutex *_states_lock;
   class Empty {
   };
   typedef SimpleHashMap<const TransformState *, Empty, indirect_compare_to_hash<const TransformState *> > States;
-  static States *_states;
+  class StateStripe {
+  public:
+    INLINE StateStripe();
+
+    States _states;
+
+    // This keeps track of our current position through the garbage
+    // collection cycle within this stripe, and the number of entries
+    // still to be examined before the current pass is complete.  The
+    // latter goes negative when breaking cycles costs more than the
+    // pass had left; the excess is charged to the next pass.
+    int _garbage_index;
+    int _garbage_remaining;
+  };
+  static StateStripe *_stripes;
+
+  // This serializes calls to garbage_collect(), and protects
+  // _garbage_stripe, the stripe that the next call should resume
+  // with.
+  static LightMutex *_garbage_lock;
+  static int _garbage_stripe;
   static CPT(TransformState) _identity_state;
   static CPT(TransformState) _invalid_state;
 
-  // This iterator records the entry corresponding to this
-  // TransformState object in the above global set.  We keep the index
-  // around so we can remove it when the TransformState destructs.
+  // This records the index of the entry corresponding to this
+  // TransformState object in its stripe of the above global table.
+  // We keep the index around so we can remove it when the
+  // TransformState destructs.
   int _saved_entry;
 
   // This data structure manages the job of caching the composition of
@@ -298,10 +333,6 @@ private:
   UpdateSeq _cycle_detect;
   static UpdateSeq _last_cycle_detect;
 
-  // This keeps track of our current position through the garbage
-  // collection cycle.
-  static int _garbage_index;
-
   static PStatCollector _cache_update_pcollector;
   static PStatCollector _garbage_collect_pcollector;
   static PStatCollector _transform_compose_pcollector;
@@ -314,6 +345,8 @@ private:
 
   static PStatCollector _node_counter;
   static PStatCollector _cache_counter;
+  static PStatCollector _gc_collected_counter;
+  static PStatCollector _gc_remaining_counter;
 
 private:
   // This is the actual data within the TransformState.
@@ -15,6 +15,7 @@
     ambientLight.h ambientLight.I \
     callbackNode.h callbackNode.I \
     config_pgraphnodes.h \
+    cullCacheNode.h cullCacheNode.I \
     directionalLight.h directionalLight.I \
     fadeLodNode.I fadeLodNode.h fadeLodNodeData.h \
     lightLensNode.h lightLensNode.I \
@@ -34,6 +35,7 @@
     ambientLight.cxx \
     callbackNode.cxx \
     config_pgraphnodes.cxx \
+    cullCacheNode.cxx \
     directionalLight.cxx \
     fadeLodNode.cxx fadeLodNodeData.cxx \
     lightLensNode.cxx \
@@ -53,6 +55,7 @@
     ambientLight.h ambientLight.I \
     callbackNode.h callbackNode.I \
     config_pgraphnodes.h \
+    cullCacheNode.h cullCacheNode.I \
     directionalLight.h directionalLight.I \
     fadeLodNode.I fadeLodNode.h fadeLodNodeData.h \
     lightLensNode.h lightLensNode.I \
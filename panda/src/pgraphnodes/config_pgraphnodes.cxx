@@ -17,6 +17,7 @@
 #include "ambientLight.h"
 #include "callbackData.h"
 #include "callbackNode.h"
+#include "cullCacheNode.h"
 #include "callbackObject.h"
 #include "directionalLight.h"
 #include "fadeLodNode.h"
@@ -58,6 +59,12 @@ ConfigVariableDouble parallax_mapping_scale
           "how much influence the height values have on the texture "
           "coordinates."));
 
+ConfigVariableBool cull_cache
+("cull-cache", true,
+ PRC_DESC("Set this false to disable the recording and replaying of cull "
+          "results by CullCacheNode, so that its subgraph is traversed "
+          "normally every frame.  This is mainly useful for debugging."));
+
 ////////////////////////////////////////////////////////////////////
 //     Function: init_libpgraphnodes
 //  Description: Initializes the library.  This must be called at
@@ -78,6 +85,7 @@ init_libpgraphnodes() {
   CallbackData::init_type();
   CallbackNode::init_type();
   CallbackObject::init_type();
+  CullCacheNode::init_type();
   DirectionalLight::init_type();
   FadeLODNode::init_type();
   FadeLODNodeData::init_type();
@@ -95,6 +103,7 @@ init_libpgraphnodes() {
 
   AmbientLight::register_with_read_factory();
   CallbackNode::register_with_read_factory();
+  CullCacheNode::register_with_read_factory();
   DirectionalLight::register_with_read_factory();
   FadeLODNode::register_with_read_factory();
   LightNode::register_with_read_factory();
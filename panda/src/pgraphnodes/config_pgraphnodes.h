@@ -19,6 +19,7 @@
 #include "lodNodeType.h"
 #include "configVariableEnum.h"
 #include "configVariableDouble.h"
+#include "configVariableBool.h"
 
 class DSearchPath;
 
@@ -28,6 +29,7 @@ NotifyCategoryDecl(pgraphnodes, EXPCL_PANDA_PGRAPHNODES, EXPTP_PANDA_PGRAPHNODES
 extern ConfigVariableEnum<LODNodeType> default_lod_type;
 extern ConfigVariableInt parallax_mapping_samples;
 extern ConfigVariableDouble parallax_mapping_scale;
+extern ConfigVariableBool cull_cache;
 
 extern EXPCL_PANDA_PGRAPHNODES void init_libpgraphnodes();
 
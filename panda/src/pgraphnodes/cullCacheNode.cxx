@@ -0,0 +1,546 @@
+// Filename: cullCacheNode.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "cullCacheNode.h"
+#include "config_pgraphnodes.h"
+#include "cullTraverser.h"
+#include "cullTraverserData.h"
+#include "cullableObject.h"
+#include "cullPlanes.h"
+#include "sceneSetup.h"
+#include "geomNode.h"
+#include "fogAttrib.h"
+#include "clipPlaneAttrib.h"
+#include "occluderEffect.h"
+#include "lightMutexHolder.h"
+#include "pStatTimer.h"
+#include "bamReader.h"
+#include "bamWriter.h"
+#include "datagram.h"
+#include "datagramIterator.h"
+
+#include <math.h>
+
+TypeHandle CullCacheNode::_type_handle;
+
+PStatCollector CullCacheNode::_record_pcollector("Cull:Cache:Record");
+PStatCollector CullCacheNode::_replay_pcollector("Cull:Cache:Replay");
+
+// The number of different cameras (or GSGs) for which a CullCacheNode
+// keeps a recorded result at once.
+static const size_t max_cache_entries = 4;
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::Constructor
+//       Access: Published
+//  Description:
+////////////////////////////////////////////////////////////////////
+CullCacheNode::
+CullCacheNode(const string &name) :
+  PandaNode(name),
+  _cell_size(0.0f),
+  _next_evict(0)
+{
+  set_cull_callback();
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::Copy Constructor
+//       Access: Protected
+//  Description: The copy does not share the recorded results.
+////////////////////////////////////////////////////////////////////
+CullCacheNode::
+CullCacheNode(const CullCacheNode &copy) :
+  PandaNode(copy),
+  _cell_size(copy._cell_size),
+  _next_evict(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::clear_cache
+//       Access: Published
+//  Description: Discards the recorded results, so that the subgraph
+//               is traversed again the next time it is seen.  This
+//               is not normally necessary, since changes to the
+//               subgraph are detected automatically.
+////////////////////////////////////////////////////////////////////
+void CullCacheNode::
+clear_cache() {
+  LightMutexHolder holder(_lock);
+  _entries.clear();
+  _next_evict = 0;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::make_copy
+//       Access: Public, Virtual
+//  Description: Returns a newly-allocated Node that is a shallow copy
+//               of this one.  It will be a different Node pointer,
+//               but its internal data may or may not be shared with
+//               that of the original Node.
+////////////////////////////////////////////////////////////////////
+PandaNode *CullCacheNode::
+make_copy() const {
+  return new CullCacheNode(*this);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::safe_to_combine
+//       Access: Public, Virtual
+//  Description: Returns true if it is generally safe to combine this
+//               particular kind of PandaNode with other kinds of
+//               PandaNodes of compatible type, adding children or
+//               whatever.  For instance, an LODNode should not be
+//               combined with any other PandaNode, because its set of
+//               children is meaningful.
+////////////////////////////////////////////////////////////////////
+bool CullCacheNode::
+safe_to_combine() const {
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::cull_callback
+//       Access: Public, Virtual
+//  Description: This function will be called during the cull
+//               traversal to perform any additional operations that
+//               should be performed at cull time.  This may include
+//               additional manipulation of render state or additional
+//               visible/invisible decisions, or any other arbitrary
+//               operation.
+//
+//               Note that this function will *not* be called unless
+//               set_cull_callback() is called in the constructor of
+//               the derived class.  It is necessary to call
+//               set_cull_callback() to indicated that we require
+//               cull_callback() to be called.
+//
+//               By the time this function is called, the node has
+//               already passed the bounding-volume test for the
+//               viewing frustum, and the node's transform and state
+//               have already been applied to the indicated
+//               CullTraverserData object.
+//
+//               The return value is true if this node should be
+//               visible, or false if it should be culled.
+////////////////////////////////////////////////////////////////////
+bool CullCacheNode::
+cull_callback(CullTraverser *trav, CullTraverserData &data) {
+  if (!cull_cache) {
+    return true;
+  }
+
+  Thread *current_thread = trav->get_current_thread();
+  UpdateSeq bounds_seq;
+  get_bounds(bounds_seq, current_thread);
+
+  int cell[3] = { 0, 0, 0 };
+  if (_cell_size > 0.0f) {
+    get_cell(cell, trav, data);
+  }
+
+  LightMutexHolder holder(_lock);
+  Entry *entry = find_entry(trav);
+
+  bool valid = (entry->_valid &&
+                entry->_tag_state_key == trav->get_tag_state_key() &&
+                entry->_bounds_seq == bounds_seq &&
+                entry->_net_transform == data._net_transform &&
+                entry->_draw_mask == data._draw_mask &&
+                entry->_camera_mask == trav->get_camera_mask());
+  if (valid && entry->_camera_dependent) {
+    if (_cell_size <= 0.0f) {
+      // We already know this subgraph can't be cached.
+      return true;
+    }
+    valid = (entry->_cell[0] == cell[0] &&
+             entry->_cell[1] == cell[1] &&
+             entry->_cell[2] == cell[2]);
+  }
+
+  if (!valid) {
+    entry->_valid = true;
+    entry->_tag_state_key = trav->get_tag_state_key();
+    entry->_bounds_seq = bounds_seq;
+    entry->_net_transform = data._net_transform;
+    entry->_draw_mask = data._draw_mask;
+    entry->_camera_mask = trav->get_camera_mask();
+    entry->_cell[0] = cell[0];
+    entry->_cell[1] = cell[1];
+    entry->_cell[2] = cell[2];
+    entry->_pieces.clear();
+    entry->_objects.clear();
+
+    entry->_camera_dependent = false;
+    PandaNode::Children children = get_children(current_thread);
+    int num_children = children.get_num_children();
+    for (int i = 0; i < num_children && !entry->_camera_dependent; ++i) {
+      entry->_camera_dependent =
+        r_is_camera_dependent(children.get_child(i), trav);
+    }
+
+    if (entry->_camera_dependent && _cell_size <= 0.0f) {
+      return true;
+    }
+    record(entry, trav, data);
+  }
+
+  replay(entry, trav, data);
+
+  // The recorded objects stand in for the subgraph.
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::output
+//       Access: Public, Virtual
+//  Description:
+////////////////////////////////////////////////////////////////////
+void CullCacheNode::
+output(ostream &out) const {
+  PandaNode::output(out);
+  if (_cell_size > 0.0f) {
+    out << " cell " << _cell_size;
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::find_entry
+//       Access: Private
+//  Description: Returns the Entry for the traverser's camera and GSG,
+//               making a new one, or reusing the oldest, if there is
+//               none.  Assumes the lock is held.
+////////////////////////////////////////////////////////////////////
+CullCacheNode::Entry *CullCacheNode::
+find_entry(CullTraverser *trav) {
+  const void *camera = trav->get_scene()->get_camera_node();
+  const void *gsg = trav->get_gsg();
+
+  Entries::iterator ei;
+  for (ei = _entries.begin(); ei != _entries.end(); ++ei) {
+    if ((*ei)._camera == camera && (*ei)._gsg == gsg) {
+      return &(*ei);
+    }
+  }
+
+  Entry *entry;
+  if (_entries.size() < max_cache_entries) {
+    _entries.push_back(Entry());
+    entry = &_entries.back();
+  } else {
+    entry = &_entries[_next_evict];
+    _next_evict = (_next_evict + 1) % (int)max_cache_entries;
+  }
+  entry->_camera = camera;
+  entry->_gsg = gsg;
+  entry->_tag_state_key = string();
+  entry->_valid = false;
+  entry->_camera_dependent = false;
+  entry->_pieces.clear();
+  entry->_objects.clear();
+  return entry;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::record
+//       Access: Private
+//  Description: Traverses the subgraph and stores the objects it
+//               produces in the indicated Entry.  Assumes the lock
+//               is held.
+////////////////////////////////////////////////////////////////////
+void CullCacheNode::
+record(Entry *entry, CullTraverser *trav, CullTraverserData &data) {
+  PStatTimer timer(_record_pcollector, trav->get_current_thread());
+
+  Recorder recorder(entry, data._net_transform);
+  CullTraverser rec_trav(*trav);
+  rec_trav.set_cull_handler(&recorder);
+  rec_trav.set_view_frustum(NULL);
+
+  // Visit the whole subgraph, not just what is in view now or in
+  // front of the clip planes now, and record the states relative to
+  // this node's, so that the result holds wherever the camera and the
+  // clip planes go and whatever state is inherited from above.
+  rec_trav.set_clip_plane_cull(false);
+  CullTraverserData rec_data(data);
+  rec_data._state = RenderState::make_empty();
+  rec_data._view_frustum = NULL;
+  rec_data._cull_planes = CullPlanes::make_empty();
+  rec_trav.traverse_below(rec_data);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::replay
+//       Access: Private
+//  Description: Passes the objects recorded in the indicated Entry to
+//               the traverser's CullHandler, as if they had been
+//               found by traversing the subgraph.  Assumes the lock
+//               is held.
+////////////////////////////////////////////////////////////////////
+void CullCacheNode::
+replay(Entry *entry, CullTraverser *trav, CullTraverserData &data) const {
+  Thread *current_thread = trav->get_current_thread();
+  PStatTimer timer(_replay_pcollector, current_thread);
+
+  CullHandler *handler = trav->get_cull_handler();
+  const TransformState *world_transform = trav->get_world_transform();
+  const TransformState *cs_transform = trav->get_scene()->get_cs_transform();
+
+  // The clip planes turned on within the subgraph weren't culled
+  // against when it was recorded, so we cull against them here, where
+  // they are now.  Each object's state is final, so none of its
+  // planes can be turned off further down.
+  bool clip_plane_cull = trav->get_clip_plane_cull();
+  CPT(RenderAttrib) no_off_planes = ClipPlaneAttrib::make();
+
+  Objects::iterator oi;
+  for (oi = entry->_objects.begin(); oi != entry->_objects.end(); ++oi) {
+    Object &obj = (*oi);
+    const Piece &base = entry->_pieces[obj._first_piece];
+    if (base._geom->get_modified(current_thread) != obj._geom_modified ||
+        base._geom->get_vertex_data(current_thread)->get_modified(current_thread) != obj._data_modified) {
+      // The vertices may have been edited in place, without the Geom
+      // (let alone its GeomNode) hearing about it.
+      base._geom->mark_bounds_stale();
+      obj.compute_bounds(base, current_thread);
+    }
+
+    if (data._view_frustum != (GeometricBoundingVolume *)NULL &&
+        data._view_frustum->contains(obj._bounds) == BoundingVolume::IF_no_intersection) {
+      continue;
+    }
+
+    CullableObject *first = NULL;
+    CullableObject *last = NULL;
+    for (int i = 0; i < obj._num_pieces; ++i) {
+      const Piece &piece = entry->_pieces[obj._first_piece + i];
+      CPT(RenderState) state = data._state->compose(piece._state);
+      if (i == 0) {
+        CPT(CullPlanes) planes = data._cull_planes;
+        const RenderAttrib *clip_attrib =
+          piece._state->get_attrib(ClipPlaneAttrib::get_class_slot());
+        if (clip_plane_cull && clip_attrib != (RenderAttrib *)NULL) {
+          planes = planes->apply_state(trav, &data,
+                                       DCAST(ClipPlaneAttrib, clip_attrib),
+                                       DCAST(ClipPlaneAttrib, no_off_planes),
+                                       NULL);
+        }
+        if (!planes->is_empty()) {
+          int result;
+          planes->do_cull(result, state, obj._bounds);
+          if (result == BoundingVolume::IF_no_intersection) {
+            break;
+          }
+        }
+      }
+
+      CPT(TransformState) modelview_transform =
+        world_transform->compose(piece._net_transform);
+      CullableObject *object =
+        new CullableObject(piece._geom, state, piece._net_transform,
+                           modelview_transform,
+                           cs_transform->compose(modelview_transform));
+      if (first == (CullableObject *)NULL) {
+        first = object;
+      } else {
+        last->set_next(object);
+      }
+      last = object;
+    }
+
+    if (first != (CullableObject *)NULL) {
+      handler->record_object(first, trav);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::r_is_camera_dependent
+//       Access: Private, Static
+//  Description: Returns true if the cull result of the indicated
+//               node, or anything below it, may depend on the camera
+//               or on the time.
+////////////////////////////////////////////////////////////////////
+bool CullCacheNode::
+r_is_camera_dependent(PandaNode *node, CullTraverser *trav) {
+  Thread *current_thread = trav->get_current_thread();
+  int fancy_bits = node->get_fancy_bits(current_thread);
+  if ((fancy_bits & PandaNode::FB_cull_callback) != 0 ||
+      node->has_selective_visibility()) {
+    return true;
+  }
+  if ((fancy_bits & PandaNode::FB_tag) != 0 && trav->has_tag_state_key() &&
+      node->has_tag(trav->get_tag_state_key(), current_thread)) {
+    // The camera's tag states may be changed at any time.
+    return true;
+  }
+  if ((fancy_bits & PandaNode::FB_effects) != 0) {
+    // An occluder is projected from the camera.
+    const RenderEffects *effects = node->get_effects(current_thread);
+    if (effects->has_cull_callback() || effects->has_adjust_transform() ||
+        effects->get_effect(OccluderEffect::get_class_type()) != (RenderEffect *)NULL) {
+      return true;
+    }
+  }
+  if ((fancy_bits & PandaNode::FB_state) != 0) {
+    // A FogAttrib is adjusted to the camera as it is encountered.
+    const RenderState *state = node->get_state(current_thread);
+    if (state->has_cull_callback() ||
+        state->get_attrib(FogAttrib::get_class_slot()) != (RenderAttrib *)NULL) {
+      return true;
+    }
+  }
+  if (node->is_geom_node()) {
+    GeomNode::Geoms geoms = DCAST(GeomNode, node)->get_geoms(current_thread);
+    int num_geoms = geoms.get_num_geoms();
+    for (int i = 0; i < num_geoms; ++i) {
+      if (geoms.get_geom_state(i)->has_cull_callback()) {
+        return true;
+      }
+    }
+  }
+
+  PandaNode::Children children = node->get_children(current_thread);
+  int num_children = children.get_num_children();
+  for (int i = 0; i < num_children; ++i) {
+    if (r_is_camera_dependent(children.get_child(i), trav)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::get_cell
+//       Access: Private
+//  Description: Computes the cell that contains the camera, in the
+//               coordinate space of this node.
+////////////////////////////////////////////////////////////////////
+void CullCacheNode::
+get_cell(int cell[3], CullTraverser *trav, CullTraverserData &data) const {
+  CPT(TransformState) camera_transform =
+    data._net_transform->invert_compose(trav->get_camera_transform());
+  LPoint3 pos = camera_transform->get_pos();
+  for (int i = 0; i < 3; ++i) {
+    double c = floor((double)pos[i] / (double)_cell_size);
+    cell[i] = (int)max(min(c, 1.0e9), -1.0e9);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::Recorder::record_object
+//       Access: Public, Virtual
+//  Description: Stores the object in the Entry, and deletes it.
+////////////////////////////////////////////////////////////////////
+void CullCacheNode::Recorder::
+record_object(CullableObject *object, const CullTraverser *traverser) {
+  Object obj;
+  obj._first_piece = (int)_entry->_pieces.size();
+  obj._num_pieces = 0;
+  for (CullableObject *p = object; p != (CullableObject *)NULL; p = p->get_next()) {
+    Piece piece;
+    piece._geom = p->_geom;
+    piece._state = p->_state;
+    piece._net_transform = p->_net_transform;
+    _entry->_pieces.push_back(piece);
+    ++obj._num_pieces;
+  }
+
+  // Decals lie on their base, so the base's bounding volume serves
+  // for all of them.
+  obj._transform = _net_transform->invert_compose(object->_net_transform);
+  obj.compute_bounds(_entry->_pieces[obj._first_piece],
+                     traverser->get_current_thread());
+  _entry->_objects.push_back(obj);
+
+  delete object;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::Object::compute_bounds
+//       Access: Public
+//  Description: Computes the bounding volume of the indicated Piece,
+//               in the coordinate space of the CullCacheNode, and
+//               notes the versions of its Geom and vertex data.
+////////////////////////////////////////////////////////////////////
+void CullCacheNode::Object::
+compute_bounds(const Piece &piece, Thread *current_thread) {
+  _geom_modified = piece._geom->get_modified(current_thread);
+  _data_modified =
+    piece._geom->get_vertex_data(current_thread)->get_modified(current_thread);
+
+  CPT(BoundingVolume) geom_volume = piece._geom->get_bounds(current_thread);
+  _bounds = DCAST(GeometricBoundingVolume, geom_volume->make_copy());
+  if (!_transform->is_identity()) {
+    _bounds->xform(_transform->get_mat());
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::register_with_read_factory
+//       Access: Public, Static
+//  Description: Tells the BamReader how to create objects of type
+//               CullCacheNode.
+////////////////////////////////////////////////////////////////////
+void CullCacheNode::
+register_with_read_factory() {
+  BamReader::get_factory()->register_factory(get_class_type(), make_from_bam);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::write_datagram
+//       Access: Public, Virtual
+//  Description: Writes the contents of this object to the datagram
+//               for shipping out to a Bam file.
+////////////////////////////////////////////////////////////////////
+void CullCacheNode::
+write_datagram(BamWriter *manager, Datagram &dg) {
+  PandaNode::write_datagram(manager, dg);
+  dg.add_stdfloat(_cell_size);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::make_from_bam
+//       Access: Protected, Static
+//  Description: This function is called by the BamReader's factory
+//               when a new object of type CullCacheNode is
+//               encountered in the Bam file.  It should create the
+//               CullCacheNode and extract its information from the
+//               file.
+////////////////////////////////////////////////////////////////////
+TypedWritable *CullCacheNode::
+make_from_bam(const FactoryParams &params) {
+  CullCacheNode *node = new CullCacheNode("");
+  DatagramIterator scan;
+  BamReader *manager;
+
+  parse_params(params, scan, manager);
+  node->fillin(scan, manager);
+
+  return node;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: CullCacheNode::fillin
+//       Access: Protected
+//  Description: This internal function is called by make_from_bam to
+//               read in all of the relevant data from the BamFile for
+//               the new CullCacheNode.
+////////////////////////////////////////////////////////////////////
+void CullCacheNode::
+fillin(DatagramIterator &scan, BamReader *manager) {
+  PandaNode::fillin(scan, manager);
+  _cell_size = scan.get_stdfloat();
+}
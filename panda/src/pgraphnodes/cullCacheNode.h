@@ -0,0 +1,188 @@
+// Filename: cullCacheNode.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef CULLCACHENODE_H
+#define CULLCACHENODE_H
+
+#include "pandabase.h"
+#include "pandaNode.h"
+#include "cullHandler.h"
+#include "geom.h"
+#include "renderState.h"
+#include "transformState.h"
+#include "geometricBoundingVolume.h"
+#include "updateSeq.h"
+#include "drawMask.h"
+#include "lightMutex.h"
+#include "pvector.h"
+#include "pStatCollector.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : CullCacheNode
+// Description : A node that remembers the result of culling its
+//               subgraph, and hands the same Geoms on to the cull
+//               handler in later frames without traversing the
+//               subgraph again.  This is intended for large static
+//               parts of a scene, like the blocks of a city, whose
+//               cull traversal is costly but never changes.
+//
+//               The subgraph is traversed again whenever any node
+//               within it changes (as reported by its bounds
+//               UpdateSeq), or when this node moves or is seen
+//               through a different draw mask or camera tag state
+//               key.  In the meantime, the remembered Geoms are
+//               still culled individually against the view frustum
+//               and the clip planes in effect for them, and are
+//               binned and munged afresh each frame, so the camera
+//               and the clip planes may move freely.  A Geom whose
+//               vertices are modified in place has its bounding
+//               volume recomputed.
+//
+//               Some nodes give different results depending on the
+//               camera or the frame time: LODNodes, billboards,
+//               SequenceNodes, Characters, nodes tagged with the
+//               camera's tag state key, and anything else with a
+//               cull callback.  A subgraph containing any of these is
+//               normally not cached at all.  If a cell size is set,
+//               though, it is cached anyway, and traversed again
+//               each time the camera crosses into a new cell of that
+//               size; within a cell, such nodes are frozen as they
+//               were when the camera entered it.
+////////////////////////////////////////////////////////////////////
+class EXPCL_PANDA_PGRAPHNODES CullCacheNode : public PandaNode {
+PUBLISHED:
+  CullCacheNode(const string &name);
+
+  INLINE void set_cell_size(PN_stdfloat cell_size);
+  INLINE PN_stdfloat get_cell_size() const;
+
+  void clear_cache();
+
+protected:
+  CullCacheNode(const CullCacheNode &copy);
+
+public:
+  virtual PandaNode *make_copy() const;
+  virtual bool safe_to_combine() const;
+  virtual bool cull_callback(CullTraverser *trav, CullTraverserData &data);
+
+  virtual void output(ostream &out) const;
+
+private:
+  class Entry;
+
+  Entry *find_entry(CullTraverser *trav);
+  void record(Entry *entry, CullTraverser *trav, CullTraverserData &data);
+  void replay(Entry *entry, CullTraverser *trav,
+              CullTraverserData &data) const;
+  static bool r_is_camera_dependent(PandaNode *node, CullTraverser *trav);
+  void get_cell(int cell[3], CullTraverser *trav,
+                CullTraverserData &data) const;
+
+  // One Geom recorded from the subgraph, and its state and net
+  // transform.  The state is relative to that of this node.
+  class Piece {
+  public:
+    CPT(Geom) _geom;
+    CPT(RenderState) _state;
+    CPT(TransformState) _net_transform;
+  };
+  typedef pvector<Piece> Pieces;
+
+  // One CullableObject recorded from the subgraph.  This is usually a
+  // single Piece, but a decal base is followed by its decals.  The
+  // bounding volume is that of the first Piece, in the coordinate
+  // space of this node; it is recomputed if that Piece's Geom or
+  // vertex data is modified.
+  class Object {
+  public:
+    void compute_bounds(const Piece &piece, Thread *current_thread);
+
+    PT(GeometricBoundingVolume) _bounds;
+    CPT(TransformState) _transform;
+    UpdateSeq _geom_modified;
+    UpdateSeq _data_modified;
+    int _first_piece;
+    int _num_pieces;
+  };
+  typedef pvector<Object> Objects;
+
+  // The recorded result for one camera and GSG.
+  class Entry {
+  public:
+    const void *_camera;
+    const void *_gsg;
+    string _tag_state_key;
+    bool _valid;
+    bool _camera_dependent;
+    UpdateSeq _bounds_seq;
+    CPT(TransformState) _net_transform;
+    DrawMask _draw_mask;
+    DrawMask _camera_mask;
+    int _cell[3];
+    Pieces _pieces;
+    Objects _objects;
+  };
+  typedef pvector<Entry> Entries;
+
+  // This receives the CullableObjects during record().
+  class Recorder : public CullHandler {
+  public:
+    INLINE Recorder(Entry *entry, const TransformState *net_transform);
+    virtual void record_object(CullableObject *object,
+                               const CullTraverser *traverser);
+
+  private:
+    Entry *_entry;
+    CPT(TransformState) _net_transform;
+  };
+
+  PN_stdfloat _cell_size;
+
+  LightMutex _lock;
+  Entries _entries;
+  int _next_evict;
+
+  static PStatCollector _record_pcollector;
+  static PStatCollector _replay_pcollector;
+
+public:
+  static void register_with_read_factory();
+  virtual void write_datagram(BamWriter *manager, Datagram &dg);
+
+protected:
+  static TypedWritable *make_from_bam(const FactoryParams &params);
+  void fillin(DatagramIterator &scan, BamReader *manager);
+
+public:
+  static TypeHandle get_class_type() {
+    return _type_handle;
+  }
+  static void init_type() {
+    PandaNode::init_type();
+    register_type(_type_handle, "CullCacheNode",
+                  PandaNode::get_class_type());
+  }
+  virtual TypeHandle get_type() const {
+    return get_class_type();
+  }
+  virtual TypeHandle force_init_type() {init_type(); return get_class_type();}
+
+private:
+  static TypeHandle _type_handle;
+};
+
+#include "cullCacheNode.I"
+
+#endif
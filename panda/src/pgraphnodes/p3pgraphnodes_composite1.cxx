@@ -1,6 +1,7 @@
 #include "ambientLight.cxx"
 #include "callbackNode.cxx"
 #include "config_pgraphnodes.cxx"
+#include "cullCacheNode.cxx"
 #include "directionalLight.cxx"
 #include "fadeLodNode.cxx"
 #include "fadeLodNodeData.cxx"
@@ -47,3 +47,13 @@
 
 #end lib_target
 
+#begin test_bin_target
+  #define TARGET test_pnmimage_filter
+  #define LOCAL_LIBS \
+    p3pnmimage p3event p3express
+
+  #define SOURCES \
+    test_pnmimage_filter.cxx
+
+#end test_bin_target
+
@@ -36,6 +36,14 @@ ConfigVariableBool pfm_reverse_dimensions
           "backwards, in the form height width instead of width height, "
           "on input.  Does not affect output, which is always written width height."));
 
+ConfigVariableInt pnmimage_process_threads
+("pnmimage-process-threads", 0,
+ PRC_DESC("Set this greater than 1 to divide the work of filtering, "
+          "resizing, and compositing large PNMImages among this many "
+          "threads, including the thread that asks for it.  The threads "
+          "are shared by all images, so only one image is processed this "
+          "way at a time."));
+
 ////////////////////////////////////////////////////////////////////
 //     Function: init_libpnmimage
 //  Description: Initializes the library.  This must be called at
@@ -24,6 +24,7 @@ NotifyCategoryDecl(pnmimage, EXPCL_PANDA_PNMIMAGE, EXPTP_PANDA_PNMIMAGE);
 
 extern ConfigVariableBool pfm_force_littleendian;
 extern ConfigVariableBool pfm_reverse_dimensions;
+extern EXPCL_PANDA_PNMIMAGE ConfigVariableInt pnmimage_process_threads;
 
 extern EXPCL_PANDA_PNMIMAGE void init_libpnmimage();
 
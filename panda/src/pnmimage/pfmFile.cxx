@@ -24,6 +24,31 @@
 #include "pnmWriter.h"
 #include "string_utils.h"
 #include "look_at.h"
+#include "thread.h"
+
+// The parameters of one of the sub-image operations, which process
+// the rows ymin .. ymax-1 of the destination table, columns xmin ..
+// xmax-1, from the corresponding rows and columns of the source table
+// beginning at (xfrom, yfrom).  Unlike the PNMImage equivalents,
+// these operate directly on the floating-point values, without
+// clamping them to any range.
+class PfmSubImageRows {
+public:
+  PN_float32 *_dest;
+  const PN_float32 *_source;
+  int _dest_x_size, _dest_channels;
+  int _source_x_size, _source_channels;
+  int _xmin, _ymin, _xmax;
+  int _xfrom, _yfrom;
+  PN_float32 _pixel_scale;
+
+  INLINE PN_float32 *dest_row(int r) const;
+  INLINE const PN_float32 *source_row(int r) const;
+
+  static void blend_rows(int begin_row, int end_row, void *user_data);
+  static void add_rows(int begin_row, int end_row, void *user_data);
+  static void mult_rows(int begin_row, int end_row, void *user_data);
+};
 
 ////////////////////////////////////////////////////////////////////
 //     Function: PfmFile::Constructor
@@ -1572,6 +1597,20 @@ copy_sub_image(const PfmFile &copy, int xto, int yto,
   setup_sub_image(copy, xto, yto, xfrom, yfrom, x_size, y_size,
                   xmin, ymin, xmax, ymax);
 
+  if (&copy != this && copy._num_channels == _num_channels) {
+    // The tables have the same layout, so each row of the region is a
+    // single block of memory.
+    if (xmin < xmax) {
+      size_t row_size = (size_t)(xmax - xmin) * _num_channels;
+      for (int y = ymin; y < ymax; y++) {
+        memcpy(&_table[((size_t)y * _x_size + xmin) * _num_channels],
+               &copy._table[((size_t)(y - ymin + yfrom) * copy._x_size + xfrom) * _num_channels],
+               row_size * sizeof(PN_float32));
+      }
+    }
+    return;
+  }
+
   int x, y;
   switch (_num_channels) {
   case 1:
@@ -1616,6 +1655,85 @@ copy_sub_image(const PfmFile &copy, int xto, int yto,
   } 
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: PfmFile::blend_sub_image
+//       Access: Published
+//  Description: Behaves like copy_sub_image(), except the fourth
+//               channel of the copy, if it has four channels, is used
+//               as an alpha value to blend the copy into the
+//               destination image, instead of overwriting pixels
+//               unconditionally.  This is the same arithmetic as
+//               PNMImage::blend_sub_image(), except that the values
+//               are not clamped to the range 0 .. 1.
+//
+//               If pixel_scale is not 1.0, it specifies an amount to
+//               scale each alpha value of the source image before
+//               applying it to the target image.
+//
+//               If pixel_scale is 1.0 and the copy has no alpha
+//               channel, this degenerates into copy_sub_image().
+////////////////////////////////////////////////////////////////////
+void PfmFile::
+blend_sub_image(const PfmFile &copy, int xto, int yto,
+                int xfrom, int yfrom, int x_size, int y_size,
+                PN_float32 pixel_scale) {
+  if (copy.get_num_channels() != 4 && pixel_scale == 1.0f) {
+    copy_sub_image(copy, xto, yto, xfrom, yfrom, x_size, y_size);
+    return;
+  }
+
+  int xmin, ymin, xmax, ymax;
+  setup_sub_image(copy, xto, yto, xfrom, yfrom, x_size, y_size,
+                  xmin, ymin, xmax, ymax);
+
+  process_sub_image(copy, xmin, ymin, xmax, ymax, xfrom, yfrom,
+                    pixel_scale, &PfmSubImageRows::blend_rows);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PfmFile::add_sub_image
+//       Access: Published
+//  Description: Behaves like copy_sub_image(), except the copy pixels
+//               are added to the pixels of the destination, after
+//               scaling by the specified pixel_scale.  Unlike
+//               blend_sub_image(), the alpha channel is not treated
+//               specially.  Only the channels that both images have
+//               are affected.
+////////////////////////////////////////////////////////////////////
+void PfmFile::
+add_sub_image(const PfmFile &copy, int xto, int yto,
+              int xfrom, int yfrom, int x_size, int y_size,
+              PN_float32 pixel_scale) {
+  int xmin, ymin, xmax, ymax;
+  setup_sub_image(copy, xto, yto, xfrom, yfrom, x_size, y_size,
+                  xmin, ymin, xmax, ymax);
+
+  process_sub_image(copy, xmin, ymin, xmax, ymax, xfrom, yfrom,
+                    pixel_scale, &PfmSubImageRows::add_rows);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PfmFile::mult_sub_image
+//       Access: Published
+//  Description: Behaves like copy_sub_image(), except the copy pixels
+//               are multiplied to the pixels of the destination, after
+//               scaling by the specified pixel_scale.  Unlike
+//               blend_sub_image(), the alpha channel is not treated
+//               specially.  Only the channels that both images have
+//               are affected.
+////////////////////////////////////////////////////////////////////
+void PfmFile::
+mult_sub_image(const PfmFile &copy, int xto, int yto,
+               int xfrom, int yfrom, int x_size, int y_size,
+               PN_float32 pixel_scale) {
+  int xmin, ymin, xmax, ymax;
+  setup_sub_image(copy, xto, yto, xfrom, yfrom, x_size, y_size,
+                  xmin, ymin, xmax, ymax);
+
+  process_sub_image(copy, xmin, ymin, xmax, ymax, xfrom, yfrom,
+                    pixel_scale, &PfmSubImageRows::mult_rows);
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: PfmFile::output
 //       Access: Published
@@ -1627,6 +1745,199 @@ output(ostream &out) const {
       << _num_channels << " channels.";
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: PfmFile::process_sub_image
+//       Access: Private
+//  Description: The implementation of blend_sub_image(),
+//               add_sub_image() and mult_sub_image(), after the
+//               region has been clipped by setup_sub_image(): calls
+//               the indicated PfmSubImageRows function on the rows of
+//               the region, dividing them among threads when the
+//               source is not this image itself.
+////////////////////////////////////////////////////////////////////
+void PfmFile::
+process_sub_image(const PfmFile &copy, int xmin, int ymin, int xmax, int ymax,
+                  int xfrom, int yfrom, PN_float32 pixel_scale,
+                  RowsFunc *func) {
+  if (xmin >= xmax || ymin >= ymax) {
+    return;
+  }
+
+  PfmSubImageRows rows;
+  rows._dest = &_table[0];
+  rows._source = &copy._table[0];
+  rows._dest_x_size = _x_size;
+  rows._dest_channels = _num_channels;
+  rows._source_x_size = copy._x_size;
+  rows._source_channels = copy._num_channels;
+  rows._xmin = xmin;
+  rows._ymin = ymin;
+  rows._xmax = xmax;
+  rows._xfrom = xfrom;
+  rows._yfrom = yfrom;
+  rows._pixel_scale = pixel_scale;
+
+  if (&copy == this) {
+    // The rows may overlap; process them in order.
+    (*func)(0, ymax - ymin, &rows);
+  } else {
+    PNMImage::process_rows(ymax - ymin, func, &rows);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PfmSubImageRows::dest_row
+//       Access: Public
+//  Description: Returns the first value of the region in the
+//               indicated row (counting from ymin) of the destination.
+////////////////////////////////////////////////////////////////////
+INLINE PN_float32 *PfmSubImageRows::
+dest_row(int r) const {
+  return _dest + ((size_t)(_ymin + r) * _dest_x_size + _xmin) * _dest_channels;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PfmSubImageRows::source_row
+//       Access: Public
+//  Description: Returns the first value of the region in the
+//               indicated row (counting from yfrom) of the source.
+////////////////////////////////////////////////////////////////////
+INLINE const PN_float32 *PfmSubImageRows::
+source_row(int r) const {
+  return _source + ((size_t)(_yfrom + r) * _source_x_size + _xfrom) * _source_channels;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PfmSubImageRows::blend_rows
+//       Access: Public, Static
+//  Description: The row function for blend_sub_image().  The first
+//               three channels (or as many as both images have) are
+//               color; the fourth channel, if present, is alpha.
+////////////////////////////////////////////////////////////////////
+void PfmSubImageRows::
+blend_rows(int begin_row, int end_row, void *user_data) {
+  const PfmSubImageRows &rows = *(const PfmSubImageRows *)user_data;
+  int dest_channels = rows._dest_channels;
+  int source_channels = rows._source_channels;
+  bool dest_alpha = (dest_channels == 4);
+  bool source_alpha = (source_channels == 4);
+  int num_colors = min(min(dest_channels, source_channels), 3);
+  PN_float32 pixel_scale = rows._pixel_scale;
+  int width = rows._xmax - rows._xmin;
+
+  for (int ri = begin_row; ri < end_row; ri++) {
+    PN_float32 *to = rows.dest_row(ri);
+    const PN_float32 *from = rows.source_row(ri);
+
+    for (int x = 0; x < width; x++, to += dest_channels, from += source_channels) {
+      PN_float32 alpha = source_alpha ? from[3] * pixel_scale : pixel_scale;
+      if (!(alpha > 0.0f)) {
+        continue;
+      }
+
+      if (alpha >= 1.0f) {
+        // Completely replace the previous color.
+        for (int c = 0; c < num_colors; ++c) {
+          to[c] = from[c];
+        }
+        if (dest_alpha) {
+          to[3] = 1.0f;
+        }
+        continue;
+      }
+
+      PN_float32 prev_alpha = dest_alpha ? to[3] : 1.0f;
+      if (prev_alpha == 0.0f) {
+        // Nothing there previously; replace with this new color.
+        for (int c = 0; c < num_colors; ++c) {
+          to[c] = from[c];
+        }
+        to[3] = alpha;
+
+      } else {
+        // Blend the color with the previous color.
+        for (int c = 0; c < num_colors; ++c) {
+          to[c] = from[c] + (1.0f - alpha) * (to[c] - from[c]);
+        }
+        if (dest_alpha) {
+          to[3] = prev_alpha + alpha * (1.0f - prev_alpha);
+        }
+      }
+    }
+    Thread::consider_yield();
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PfmSubImageRows::add_rows
+//       Access: Public, Static
+//  Description: The row function for add_sub_image().
+////////////////////////////////////////////////////////////////////
+void PfmSubImageRows::
+add_rows(int begin_row, int end_row, void *user_data) {
+  const PfmSubImageRows &rows = *(const PfmSubImageRows *)user_data;
+  int dest_channels = rows._dest_channels;
+  int source_channels = rows._source_channels;
+  int num_channels = min(dest_channels, source_channels);
+  PN_float32 pixel_scale = rows._pixel_scale;
+  int width = rows._xmax - rows._xmin;
+
+  for (int ri = begin_row; ri < end_row; ri++) {
+    PN_float32 *to = rows.dest_row(ri);
+    const PN_float32 *from = rows.source_row(ri);
+
+    if (dest_channels == source_channels) {
+      // The common case: the row is one run of values.
+      int count = width * num_channels;
+      for (int i = 0; i < count; i++) {
+        to[i] += from[i] * pixel_scale;
+      }
+    } else {
+      for (int x = 0; x < width; x++, to += dest_channels, from += source_channels) {
+        for (int c = 0; c < num_channels; ++c) {
+          to[c] += from[c] * pixel_scale;
+        }
+      }
+    }
+    Thread::consider_yield();
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PfmSubImageRows::mult_rows
+//       Access: Public, Static
+//  Description: The row function for mult_sub_image().
+////////////////////////////////////////////////////////////////////
+void PfmSubImageRows::
+mult_rows(int begin_row, int end_row, void *user_data) {
+  const PfmSubImageRows &rows = *(const PfmSubImageRows *)user_data;
+  int dest_channels = rows._dest_channels;
+  int source_channels = rows._source_channels;
+  int num_channels = min(dest_channels, source_channels);
+  PN_float32 pixel_scale = rows._pixel_scale;
+  int width = rows._xmax - rows._xmin;
+
+  for (int ri = begin_row; ri < end_row; ri++) {
+    PN_float32 *to = rows.dest_row(ri);
+    const PN_float32 *from = rows.source_row(ri);
+
+    if (dest_channels == source_channels) {
+      // The common case: the row is one run of values.
+      int count = width * num_channels;
+      for (int i = 0; i < count; i++) {
+        to[i] *= from[i] * pixel_scale;
+      }
+    } else {
+      for (int x = 0; x < width; x++, to += dest_channels, from += source_channels) {
+        for (int c = 0; c < num_channels; ++c) {
+          to[c] *= from[c] * pixel_scale;
+        }
+      }
+    }
+    Thread::consider_yield();
+  }
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: PfmFile::box_filter_region
 //       Access: Private
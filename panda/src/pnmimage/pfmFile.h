@@ -121,6 +121,18 @@ PUBLISHED:
   void copy_sub_image(const PfmFile &copy, int xto, int yto,
                       int xfrom = 0, int yfrom = 0,
                       int x_size = -1, int y_size = -1);
+  void blend_sub_image(const PfmFile &copy, int xto, int yto,
+                       int xfrom = 0, int yfrom = 0,
+                       int x_size = -1, int y_size = -1,
+                       PN_float32 pixel_scale = 1.0);
+  void add_sub_image(const PfmFile &copy, int xto, int yto,
+                     int xfrom = 0, int yfrom = 0,
+                     int x_size = -1, int y_size = -1,
+                     PN_float32 pixel_scale = 1.0);
+  void mult_sub_image(const PfmFile &copy, int xto, int yto,
+                      int xfrom = 0, int yfrom = 0,
+                      int x_size = -1, int y_size = -1,
+                      PN_float32 pixel_scale = 1.0);
 
   void output(ostream &out) const;
 
@@ -133,6 +145,12 @@ private:
                               int &xfrom, int &yfrom, int &x_size, int &y_size,
                               int &xmin, int &ymin, int &xmax, int &ymax);
 
+  typedef void RowsFunc(int begin_row, int end_row, void *user_data);
+  void process_sub_image(const PfmFile &copy,
+                         int xmin, int ymin, int xmax, int ymax,
+                         int xfrom, int yfrom, PN_float32 pixel_scale,
+                         RowsFunc *func);
+
   void box_filter_region(PN_float32 &result,
                          PN_float32 x0, PN_float32 y0, PN_float32 x1, PN_float32 y1) const;
   void box_filter_region(LPoint3f &result,
@@ -24,76 +24,95 @@ FUNCTION_NAME(IMAGETYPE &dest, const IMAGETYPE &source,
     return;
   }
 
-  // First, set up a 2-d column-major matrix of StoreTypes, big enough to hold
-  // the image xelvals scaled in the A direction only.  This will hold the
-  // adjusted xel data from our first pass.
-
-  typedef StoreType *StoreTypeP;
-  StoreType **matrix = (StoreType **)PANDA_MALLOC_ARRAY(dest.ASIZE() * sizeof(StoreType *));
-
-  int a, b;
-
-  for (a=0; a<dest.ASIZE(); a++) {
-    matrix[a] = (StoreType *)PANDA_MALLOC_ARRAY(source.BSIZE() * sizeof(StoreType));
-  }
-
-  // First, scale the image in the A direction.
-  double scale;
-  StoreType *temp_source, *temp_dest;
-
-  scale = (double)dest.ASIZE() / (double)source.ASIZE();
-  temp_source = (StoreType *)PANDA_MALLOC_ARRAY(source.ASIZE() * sizeof(StoreType));
-  temp_dest = (StoreType *)PANDA_MALLOC_ARRAY(dest.ASIZE() * sizeof(StoreType));
+  // Each pass filters a number of independent rows (or columns), which
+  // are divided among threads by PNMImage::process_rows().
+  class Pass {
+  public:
+    IMAGETYPE *_dest;
+    const IMAGETYPE *_source;
+    int _channel;
+    const FilterKernel *_kernel;
+    StoreType *_matrix;
+
+    // Scales rows begin .. end-1 of the source in the A direction, and
+    // stores the results in the matrix.
+    static void
+    filter_a(int begin, int end, void *user_data) {
+      const Pass &pass = *(const Pass *)user_data;
+      const IMAGETYPE &source = *pass._source;
+      int source_a_size = source.ASIZE();
+      int dest_a_size = pass._dest->ASIZE();
+      int b_size = source.BSIZE();
+
+      StoreType *temp_source = (StoreType *)PANDA_MALLOC_ARRAY(source_a_size * sizeof(StoreType));
+      StoreType *temp_dest = (StoreType *)PANDA_MALLOC_ARRAY(dest_a_size * sizeof(StoreType));
+
+      for (int b = begin; b < end; b++) {
+        for (int a = 0; a < source_a_size; a++) {
+          temp_source[a] = (StoreType)(source_max * source.GETVAL(a, b, pass._channel));
+        }
+
+        pass._kernel->apply(temp_dest, temp_source);
+
+        for (int a = 0; a < dest_a_size; a++) {
+          pass._matrix[a * b_size + b] = temp_dest[a];
+        }
+        Thread::consider_yield();
+      }
+
+      PANDA_FREE_ARRAY(temp_source);
+      PANDA_FREE_ARRAY(temp_dest);
+    }
 
-  WorkType *filter;
-  double filter_width;
+    // Scales columns begin .. end-1 of the matrix in the B direction,
+    // and stores the results in the destination image.
+    static void
+    filter_b(int begin, int end, void *user_data) {
+      const Pass &pass = *(const Pass *)user_data;
+      IMAGETYPE &dest = *pass._dest;
+      int dest_b_size = dest.BSIZE();
+      int b_size = pass._source->BSIZE();
 
-  make_filter(scale, width, filter, filter_width);
+      StoreType *temp_dest = (StoreType *)PANDA_MALLOC_ARRAY(dest_b_size * sizeof(StoreType));
 
-  for (b = 0; b < source.BSIZE(); b++) {
-    for (a = 0; a < source.ASIZE(); a++) {
-      temp_source[a] = (StoreType)(source_max * source.GETVAL(a, b, channel));
-    }
+      for (int a = begin; a < end; a++) {
+        pass._kernel->apply(temp_dest, pass._matrix + a * b_size);
 
-    filter_row(temp_dest, dest.ASIZE(),
-               temp_source, source.ASIZE(),
-               scale,
-               filter, filter_width);
+        for (int b = 0; b < dest_b_size; b++) {
+          dest.SETVAL(a, b, pass._channel, (double)temp_dest[b]/(double)source_max);
+        }
+        Thread::consider_yield();
+      }
 
-    for (a = 0; a < dest.ASIZE(); a++) {
-      matrix[a][b] = temp_dest[a];
+      PANDA_FREE_ARRAY(temp_dest);
     }
-  }
-
-  PANDA_FREE_ARRAY(temp_source);
-  PANDA_FREE_ARRAY(temp_dest);
-  PANDA_FREE_ARRAY(filter);
-
-  // Now, scale the image in the B direction.
-  scale = (double)dest.BSIZE() / (double)source.BSIZE();
-  temp_dest = (StoreType *)PANDA_MALLOC_ARRAY(dest.BSIZE() * sizeof(StoreType));
+  };
 
-  make_filter(scale, width, filter, filter_width);
+  // First, set up a 2-d column-major matrix of StoreTypes, big enough to hold
+  // the image xelvals scaled in the A direction only.  This will hold the
+  // adjusted xel data from our first pass.
+  StoreType *matrix = (StoreType *)PANDA_MALLOC_ARRAY((size_t)dest.ASIZE() * (size_t)source.BSIZE() * sizeof(StoreType));
 
-  for (a = 0; a < dest.ASIZE(); a++) {
-    filter_row(temp_dest, dest.BSIZE(),
-               matrix[a], source.BSIZE(),
-               scale,
-               filter, filter_width);
+  Pass pass;
+  pass._dest = &dest;
+  pass._source = &source;
+  pass._channel = channel;
+  pass._matrix = matrix;
 
-    for (b = 0; b < dest.BSIZE(); b++) {
-      dest.SETVAL(a, b, channel, (double)temp_dest[b]/(double)source_max);
-    }
+  // First, scale the image in the A direction.
+  {
+    FilterKernel kernel(dest.ASIZE(), source.ASIZE(), width, make_filter);
+    pass._kernel = &kernel;
+    PNMImage::process_rows(source.BSIZE(), &Pass::filter_a, &pass);
   }
 
-  PANDA_FREE_ARRAY(temp_dest);
-  PANDA_FREE_ARRAY(filter);
-
-  // Now, clean up our temp matrix and go home!
-
-  for (a = 0; a < dest.ASIZE(); a++) {
-    PANDA_FREE_ARRAY(matrix[a]);
+  // Now, scale the image in the B direction.  Since the whole source
+  // image has been read by now, the destination may be the same image.
+  {
+    FilterKernel kernel(dest.BSIZE(), source.BSIZE(), width, make_filter);
+    pass._kernel = &kernel;
+    PNMImage::process_rows(dest.ASIZE(), &Pass::filter_b, &pass);
   }
+
   PANDA_FREE_ARRAY(matrix);
 }
-
@@ -95,77 +95,18 @@ static const WorkType filter_max = 255;
 
 
 
-// filter_row() filters a single row by convolving with a one-dimensional
-// kernel filter.  The kernel is defined by an array of weights in filter[],
-// where the ith element of filter corresponds to abs(d * scale), if scale>1.0,
-// and abs(d), if scale<=1.0, where d is the offset from the center and varies
+// filter_sparse_row() filters a single row by convolving with a
+// one-dimensional kernel filter, taking into account an array of weight
+// values per element, to support scaling a sparse array (as in a PfmFile).
+// The kernel is defined by an array of weights in filter[], where the ith
+// element of filter corresponds to abs(d * scale), if scale>1.0, and
+// abs(d), if scale<=1.0, where d is the offset from the center and varies
 // from -filter_width to filter_width.
 
 // Note that filter_width is not necessarily the length of the array; it is
 // the radius of interest of the filter function.  The array may need to be
 // larger (by a factor of scale), to adequately cover all the values.
 
-static void
-filter_row(StoreType dest[], int dest_len,
-           const StoreType source[], int source_len,
-           double scale,                    //  == dest_len / source_len
-           const WorkType filter[],
-           double filter_width) {
-  // If we are expanding the row (scale>1.0), we need to look at a fractional
-  // granularity.  Hence, we scale our filter index by scale.  If we are
-  // compressing (scale<1.0), we don't need to fiddle with the filter index, so
-  // we leave it at one.
-  double iscale = max(scale, 1.0);
-
-  // Similarly, if we are expanding the row, we want to start the new row at
-  // the far left edge of the original pixel, not in the center.  So we will
-  // have a non-zero offset.
-  int offset = (int)cfloor(iscale*0.5);
-
-  for (int dest_x = 0; dest_x < dest_len; dest_x++) {
-    double center = (dest_x - offset) / scale;
-
-    // left and right are the starting and ending ranges of the radius of
-    // interest of the filter function.  We need to apply the filter to each
-    // value in this range.
-    int left = max((int)cfloor(center - filter_width), 0);
-    int right = min((int)cceil(center + filter_width), source_len-1);
-
-    // right_center is the point just to the right of the center.  This
-    // allows us to flip the sign of the offset when we cross the center point.
-    int right_center = (int)cceil(center);
-
-    WorkType net_weight = 0;
-    WorkType net_value = 0;
-
-    int index, source_x;
-
-    // This loop is broken into two pieces--the left of center and the right
-    // of center--so we don't have to incur the overhead of calling fabs()
-    // each time through the loop.
-    for (source_x = left; source_x < right_center; source_x++) {
-      index = (int)(iscale * (center - source_x));
-      net_value += filter[index] * source[source_x];
-      net_weight += filter[index];
-    }
-
-    for (; source_x <= right; source_x++) {
-      index = (int)(iscale * (source_x - center));
-      net_value += filter[index] * source[source_x];
-      net_weight += filter[index];
-    }
-
-    if (net_weight > 0) {
-      dest[dest_x] = (StoreType)(net_value / net_weight);
-    } else {
-      dest[dest_x] = 0;
-    }
-  }
-  Thread::consider_yield();
-}
-
-// As above, but we also accept an array of weight values per
-// element, to support scaling a sparse array (as in a PfmFile).
 static void
 filter_sparse_row(StoreType dest[], StoreType dest_weight[], int dest_len,
                   const StoreType source[], const StoreType source_weight[], int source_len,
@@ -306,6 +247,152 @@ gaussian_filter_impl(double scale, double width,
 }
 
 
+// The fully-specified images are filtered with a FilterKernel, which
+// works out once, for each element of the destination row, the range of
+// source elements that contribute to it and the filter weight of each, so
+// that filtering each row is nothing more than a series of dot products.
+// The weights are the same as those that would be looked up in the filter
+// array described above, and they are summed in the same order.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+// The SSE2 dot product assumes that WorkType and StoreType are both
+// double, as they are above.
+#define PNM_FILTER_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+class FilterKernel {
+public:
+  FilterKernel(int dest_len, int source_len,
+               double width, FilterFunction *make_filter);
+
+  void apply(StoreType dest[], const StoreType source[]) const;
+
+private:
+  static WorkType dot_product(const WorkType weights[],
+                              const StoreType source[], int count);
+
+  // The source elements source[_first] .. source[_first + _count - 1]
+  // contribute to a destination element, with the weights
+  // _weights[_start] .. _weights[_start + _count - 1].
+  class Entry {
+  public:
+    int _first;
+    int _count;
+    size_t _start;
+    WorkType _net_weight;
+  };
+  typedef pvector<Entry> Entries;
+  Entries _entries;
+  pvector<WorkType> _weights;
+};
+
+FilterKernel::
+FilterKernel(int dest_len, int source_len,
+             double width, FilterFunction *make_filter) {
+  double scale = (double)dest_len / (double)source_len;
+
+  WorkType *filter;
+  double filter_width;
+  make_filter(scale, width, filter, filter_width);
+
+  // If we are expanding the row (scale>1.0), we need to look at a fractional
+  // granularity.  Hence, we scale our filter index by scale.  If we are
+  // compressing (scale<1.0), we don't need to fiddle with the filter index, so
+  // we leave it at one.
+  double iscale = max(scale, 1.0);
+
+  // Similarly, if we are expanding the row, we want to start the new row at
+  // the far left edge of the original pixel, not in the center.  So we will
+  // have a non-zero offset.
+  int offset = (int)cfloor(iscale*0.5);
+
+  _entries.reserve(dest_len);
+  for (int dest_x = 0; dest_x < dest_len; dest_x++) {
+    double center = (dest_x - offset) / scale;
+
+    // left and right are the starting and ending ranges of the radius of
+    // interest of the filter function.  We need to apply the filter to each
+    // value in this range.
+    int left = max((int)cfloor(center - filter_width), 0);
+    int right = min((int)cceil(center + filter_width), source_len-1);
+
+    // right_center is the point just to the right of the center.  This
+    // allows us to flip the sign of the offset when we cross the center point.
+    int right_center = (int)cceil(center);
+
+    Entry entry;
+    entry._first = left;
+    entry._start = _weights.size();
+    entry._net_weight = 0;
+
+    int index, source_x;
+    for (source_x = left; source_x < right_center; source_x++) {
+      index = (int)(iscale * (center - source_x));
+      _weights.push_back(filter[index]);
+      entry._net_weight += filter[index];
+    }
+
+    for (; source_x <= right; source_x++) {
+      index = (int)(iscale * (source_x - center));
+      _weights.push_back(filter[index]);
+      entry._net_weight += filter[index];
+    }
+
+    entry._count = (int)(_weights.size() - entry._start);
+    _entries.push_back(entry);
+  }
+
+  PANDA_FREE_ARRAY(filter);
+}
+
+// Returns the sum of weights[i] * source[i] for the count elements.
+INLINE WorkType FilterKernel::
+dot_product(const WorkType weights[], const StoreType source[], int count) {
+#ifdef PNM_FILTER_HAVE_SSE2
+  // Two products at a time.  This sums the terms in a slightly different
+  // order than the scalar loop, which may change the last bit or so of the
+  // result.
+  __m128d sum = _mm_setzero_pd();
+  int i = 0;
+  for (; i + 2 <= count; i += 2) {
+    sum = _mm_add_pd(sum, _mm_mul_pd(_mm_loadu_pd(weights + i),
+                                     _mm_loadu_pd(source + i)));
+  }
+  double pair[2];
+  _mm_storeu_pd(pair, sum);
+  WorkType net_value = pair[0] + pair[1];
+  for (; i < count; i++) {
+    net_value += weights[i] * source[i];
+  }
+  return net_value;
+
+#else
+  WorkType net_value = 0;
+  for (int i = 0; i < count; i++) {
+    net_value += weights[i] * source[i];
+  }
+  return net_value;
+#endif
+}
+
+// Filters a single row of source_len elements into dest_len elements.
+void FilterKernel::
+apply(StoreType dest[], const StoreType source[]) const {
+  int dest_len = (int)_entries.size();
+  for (int dest_x = 0; dest_x < dest_len; dest_x++) {
+    const Entry &entry = _entries[dest_x];
+    if (entry._net_weight > 0) {
+      WorkType net_value = dot_product(&_weights[entry._start],
+                                       source + entry._first, entry._count);
+      dest[dest_x] = (StoreType)(net_value / entry._net_weight);
+    } else {
+      dest[dest_x] = 0;
+    }
+  }
+}
+
+
 // We have a function, defined in pnm-image-filter-core.cxx, that will scale
 // an image in both X and Y directions for a particular channel, by setting
 // up the temporary matrix appropriately and calling the above functions.
@@ -782,47 +869,67 @@ box_filter_region(const PNMImage &image,
 ////////////////////////////////////////////////////////////////////
 void PNMImage::
 quick_filter_from(const PNMImage &from, int xborder, int yborder) {
-  int from_xs = from.get_x_size();
-  int from_ys = from.get_y_size();
-
-  int to_xs = get_x_size() - xborder;
-  int to_ys = get_y_size() - yborder;
-
-  int to_xoff = xborder / 2;
-  int to_yoff = yborder / 2;
-
-  double from_x0, from_x1, from_y0, from_y1;
-  int to_x, to_y;
-
-  double x_scale = (double)from_xs / (double)to_xs;
-  double y_scale = (double)from_ys / (double)to_ys;
-
-  from_y0 = max(0, -to_yoff) * y_scale;
-  for (to_y = max(0, -to_yoff);
-       to_y < min(to_ys, get_y_size()-to_yoff);
-       to_y++) {
-    from_y1 = (to_y+1) * y_scale;
-
-    from_x0 = max(0, -to_xoff) * x_scale;
-    for (to_x = max(0, -to_xoff);
-         to_x < min(to_xs, get_x_size()-to_xoff);
-         to_x++) {
-      from_x1 = (to_x+1) * x_scale;
-
-      // Now the box from (from_x0, from_y0) - (from_x1, from_y1)
-      // but not including (from_x1, from_y1) maps to the pixel (to_x, to_y).
-      xelval alpha_result;
-      box_filter_region(from,
-                        from_x0, from_y0, from_x1, from_y1,
-                        (*this)[to_yoff + to_y][to_xoff + to_x],
-                        alpha_result);
-      if (has_alpha()) {
-        set_alpha_val(to_xoff+to_x, to_yoff+to_y, alpha_result);
+  // The rows of the result are independent of each other, and may be
+  // divided among threads.
+  class Rows {
+  public:
+    PNMImage *_to;
+    const PNMImage *_from;
+    int _to_xs, _to_ys;
+    int _to_xoff, _to_yoff;
+    double _x_scale, _y_scale;
+
+    static void
+    filter_rows(int begin, int end, void *user_data) {
+      const Rows &rows = *(const Rows *)user_data;
+      PNMImage &to = *rows._to;
+      int to_xoff = rows._to_xoff;
+      int to_yoff = rows._to_yoff;
+      int to_x_begin = max(0, -to_xoff);
+      int to_x_end = min(rows._to_xs, to.get_x_size()-to_xoff);
+      int to_y_begin = max(0, -to_yoff);
+
+      for (int to_y = to_y_begin + begin; to_y < to_y_begin + end; to_y++) {
+        double from_y0 = to_y * rows._y_scale;
+        double from_y1 = (to_y+1) * rows._y_scale;
+
+        double from_x0 = to_x_begin * rows._x_scale;
+        for (int to_x = to_x_begin; to_x < to_x_end; to_x++) {
+          double from_x1 = (to_x+1) * rows._x_scale;
+
+          // Now the box from (from_x0, from_y0) - (from_x1, from_y1)
+          // but not including (from_x1, from_y1) maps to the pixel (to_x, to_y).
+          xelval alpha_result;
+          box_filter_region(*rows._from,
+                            from_x0, from_y0, from_x1, from_y1,
+                            to[to_yoff + to_y][to_xoff + to_x],
+                            alpha_result);
+          if (to.has_alpha()) {
+            to.set_alpha_val(to_xoff+to_x, to_yoff+to_y, alpha_result);
+          }
+
+          from_x0 = from_x1;
+        }
+        Thread::consider_yield();
       }
-
-      from_x0 = from_x1;
     }
-    from_y0 = from_y1;
-    Thread::consider_yield();
+  };
+
+  Rows rows;
+  rows._to = this;
+  rows._from = &from;
+  rows._to_xs = get_x_size() - xborder;
+  rows._to_ys = get_y_size() - yborder;
+  rows._to_xoff = xborder / 2;
+  rows._to_yoff = yborder / 2;
+  rows._x_scale = (double)from.get_x_size() / (double)rows._to_xs;
+  rows._y_scale = (double)from.get_y_size() / (double)rows._to_ys;
+
+  int to_y_begin = max(0, -rows._to_yoff);
+  int to_y_end = min(rows._to_ys, get_y_size()-rows._to_yoff);
+  if (&from == this) {
+    Rows::filter_rows(0, to_y_end - to_y_begin, &rows);
+  } else {
+    process_rows(to_y_end - to_y_begin, &Rows::filter_rows, &rows);
   }
 }
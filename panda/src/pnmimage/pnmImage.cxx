@@ -22,6 +22,48 @@
 #include "stackedPerlinNoise2.h"
 #include <algorithm>
 
+PNMImage::RunJobsFunc *PNMImage::_run_jobs_func = (RunJobsFunc *)0L;
+
+// The work passed to process_rows(), divided into jobs of a few rows
+// each.
+class PNMImageRowsJobs {
+public:
+  PNMImage::RowsFunc *_func;
+  void *_user_data;
+  int _num_rows;
+  int _rows_per_job;
+};
+
+static void
+pnmimage_rows_job_func(int job_index, Thread *current_thread, void *user_data) {
+  const PNMImageRowsJobs &jobs = *(const PNMImageRowsJobs *)user_data;
+  int begin_row = job_index * jobs._rows_per_job;
+  int end_row = min(begin_row + jobs._rows_per_job, jobs._num_rows);
+  (*jobs._func)(begin_row, end_row, jobs._user_data);
+}
+
+// The parameters of one of the sub-image operations, which process the
+// rows ymin .. ymax-1 of the destination image, columns xmin .. xmax-1,
+// from the corresponding rows and columns of the source image beginning
+// at (xfrom, yfrom).
+class PNMSubImageRows {
+public:
+  PNMImage *_dest;
+  const PNMImage *_source;
+  int _xmin, _ymin, _xmax;
+  int _xfrom, _yfrom;
+  double _pixel_scale;
+
+  INLINE xel *dest_row(int r) const;
+  INLINE xelval *dest_alpha_row(int r) const;
+  INLINE const xel *source_row(int r) const;
+  INLINE const xelval *source_alpha_row(int r) const;
+
+  static void blend_rows(int begin_row, int end_row, void *user_data);
+  static void add_rows(int begin_row, int end_row, void *user_data);
+  static void mult_rows(int begin_row, int end_row, void *user_data);
+};
+
 ////////////////////////////////////////////////////////////////////
 //     Function: PNMImage::Constructor
 //       Access: Published
@@ -869,6 +911,57 @@ set_alpha_array(xelval *alpha) {
   _alpha = alpha;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: PNMImage::process_rows
+//       Access: Public, Static
+//  Description: Calls func(begin_row, end_row, user_data) for
+//               consecutive ranges of rows covering 0 .. num_rows-1.
+//               If pnmimage-process-threads is greater than 1, and
+//               a thread pool has been installed with
+//               set_run_jobs_func(), the ranges are divided among
+//               that many threads, so func
+//               must not write to anything that is shared by
+//               different rows; in any case, all of the rows have been
+//               processed when this returns.
+////////////////////////////////////////////////////////////////////
+void PNMImage::
+process_rows(int num_rows, RowsFunc *func, void *user_data) {
+  if (num_rows <= 0) {
+    return;
+  }
+
+  int num_threads = pnmimage_process_threads;
+  if (num_threads <= 1 || num_rows <= 1 ||
+      _run_jobs_func == (RunJobsFunc *)NULL) {
+    (*func)(0, num_rows, user_data);
+    return;
+  }
+
+  // Give each thread several jobs, so that the load balances itself
+  // if some rows take longer than others.
+  PNMImageRowsJobs jobs;
+  jobs._func = func;
+  jobs._user_data = user_data;
+  jobs._num_rows = num_rows;
+  jobs._rows_per_job = max(num_rows / (num_threads * 4), 1);
+  int num_jobs = (num_rows + jobs._rows_per_job - 1) / jobs._rows_per_job;
+  (*_run_jobs_func)(num_threads, num_jobs, &pnmimage_rows_job_func, &jobs);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PNMImage::set_run_jobs_func
+//       Access: Public, Static
+//  Description: This is used by the gobj module to hook in a
+//               function that runs a batch of process_rows() jobs on
+//               a shared WorkerThreadPool, so that pnmimage need not
+//               depend on the thread pool itself.  Until it is set,
+//               process_rows() runs serially.
+////////////////////////////////////////////////////////////////////
+void PNMImage::
+set_run_jobs_func(RunJobsFunc *func) {
+  _run_jobs_func = func;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: PNMImage::copy_sub_image
 //       Access: Published
@@ -951,22 +1044,8 @@ blend_sub_image(const PNMImage &copy, int xto, int yto,
   setup_sub_image(copy, xto, yto, xfrom, yfrom, x_size, y_size,
                   xmin, ymin, xmax, ymax);
 
-  int x, y;
-  if (copy.has_alpha()) {
-    for (y = ymin; y < ymax; y++) {
-      for (x = xmin; x < xmax; x++) {
-        blend(x, y, copy.get_xel(x - xmin + xfrom, y - ymin + yfrom),
-              copy.get_alpha(x - xmin + xfrom, y - ymin + yfrom) * pixel_scale);
-      }
-    }
-  } else {
-    for (y = ymin; y < ymax; y++) {
-      for (x = xmin; x < xmax; x++) {
-        blend(x, y, copy.get_xel(x - xmin + xfrom, y - ymin + yfrom),
-              pixel_scale);
-      }
-    }
-  }
+  process_sub_image(copy, xmin, ymin, xmax, ymax, xfrom, yfrom,
+                    pixel_scale, &PNMSubImageRows::blend_rows);
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -986,25 +1065,8 @@ add_sub_image(const PNMImage &copy, int xto, int yto,
   setup_sub_image(copy, xto, yto, xfrom, yfrom, x_size, y_size,
                   xmin, ymin, xmax, ymax);
 
-  int x, y;
-  if (has_alpha() && copy.has_alpha()) {
-    for (y = ymin; y < ymax; y++) {
-      for (x = xmin; x < xmax; x++) {
-        set_alpha(x, y, get_alpha(x, y) + copy.get_alpha(x, y) * pixel_scale);
-      }
-    }
-  }
-
-  for (y = ymin; y < ymax; y++) {
-    for (x = xmin; x < xmax; x++) {
-      LRGBColord rgb1 = get_xel(x, y);
-      LRGBColord rgb2 = copy.get_xel(x, y);
-      set_xel(x, y, 
-              rgb1[0] + rgb2[0] * pixel_scale,
-              rgb1[1] + rgb2[1] * pixel_scale,
-              rgb1[2] + rgb2[2] * pixel_scale);
-    }
-  }
+  process_sub_image(copy, xmin, ymin, xmax, ymax, xfrom, yfrom,
+                    pixel_scale, &PNMSubImageRows::add_rows);
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -1024,24 +1086,228 @@ mult_sub_image(const PNMImage &copy, int xto, int yto,
   setup_sub_image(copy, xto, yto, xfrom, yfrom, x_size, y_size,
                   xmin, ymin, xmax, ymax);
 
-  int x, y;
-  if (has_alpha() && copy.has_alpha()) {
-    for (y = ymin; y < ymax; y++) {
-      for (x = xmin; x < xmax; x++) {
-        set_alpha(x, y, get_alpha(x, y) * copy.get_alpha(x, y) * pixel_scale);
+  process_sub_image(copy, xmin, ymin, xmax, ymax, xfrom, yfrom,
+                    pixel_scale, &PNMSubImageRows::mult_rows);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PNMImage::process_sub_image
+//       Access: Private
+//  Description: The implementation of blend_sub_image(),
+//               add_sub_image() and mult_sub_image(), after the
+//               region has been clipped by setup_sub_image(): calls
+//               the indicated PNMSubImageRows function on the rows of
+//               the region, dividing them among threads when the
+//               source is not this image itself.
+////////////////////////////////////////////////////////////////////
+void PNMImage::
+process_sub_image(const PNMImage &copy, int xmin, int ymin, int xmax, int ymax,
+                  int xfrom, int yfrom, double pixel_scale, RowsFunc *func) {
+  if (xmin >= xmax || ymin >= ymax) {
+    return;
+  }
+
+  PNMSubImageRows rows;
+  rows._dest = this;
+  rows._source = &copy;
+  rows._xmin = xmin;
+  rows._ymin = ymin;
+  rows._xmax = xmax;
+  rows._xfrom = xfrom;
+  rows._yfrom = yfrom;
+  rows._pixel_scale = pixel_scale;
+
+  if (&copy == this) {
+    // The rows may overlap; process them in order, as we always have.
+    (*func)(0, ymax - ymin, &rows);
+  } else {
+    process_rows(ymax - ymin, func, &rows);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PNMSubImageRows::dest_row
+//       Access: Public
+//  Description: Returns the first pixel of the region in the
+//               indicated row (counting from ymin) of the destination.
+////////////////////////////////////////////////////////////////////
+INLINE xel *PNMSubImageRows::
+dest_row(int r) const {
+  return _dest->get_array() + (size_t)(_ymin + r) * _dest->get_x_size() + _xmin;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PNMSubImageRows::dest_alpha_row
+//       Access: Public
+//  Description: As dest_row(), for the alpha channel.
+////////////////////////////////////////////////////////////////////
+INLINE xelval *PNMSubImageRows::
+dest_alpha_row(int r) const {
+  return _dest->get_alpha_array() + (size_t)(_ymin + r) * _dest->get_x_size() + _xmin;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PNMSubImageRows::source_row
+//       Access: Public
+//  Description: Returns the first pixel of the region in the
+//               indicated row (counting from yfrom) of the source.
+////////////////////////////////////////////////////////////////////
+INLINE const xel *PNMSubImageRows::
+source_row(int r) const {
+  return _source->get_array() + (size_t)(_yfrom + r) * _source->get_x_size() + _xfrom;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PNMSubImageRows::source_alpha_row
+//       Access: Public
+//  Description: As source_row(), for the alpha channel.
+////////////////////////////////////////////////////////////////////
+INLINE const xelval *PNMSubImageRows::
+source_alpha_row(int r) const {
+  return _source->get_alpha_array() + (size_t)(_yfrom + r) * _source->get_x_size() + _xfrom;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PNMSubImageRows::blend_rows
+//       Access: Public, Static
+//  Description: The row function for blend_sub_image().  This
+//               performs the same arithmetic as PNMImage::blend(),
+//               one row at a time.
+////////////////////////////////////////////////////////////////////
+void PNMSubImageRows::
+blend_rows(int begin_row, int end_row, void *user_data) {
+  const PNMSubImageRows &rows = *(const PNMSubImageRows *)user_data;
+  PNMImage &dest = *rows._dest;
+  const PNMImage &source = *rows._source;
+  bool dest_alpha = dest.has_alpha();
+  bool source_alpha = source.has_alpha();
+  double pixel_scale = rows._pixel_scale;
+  int width = rows._xmax - rows._xmin;
+
+  for (int ri = begin_row; ri < end_row; ri++) {
+    xel *to = rows.dest_row(ri);
+    xelval *to_alpha = dest_alpha ? rows.dest_alpha_row(ri) : NULL;
+    const xel *from = rows.source_row(ri);
+    const xelval *from_alpha = source_alpha ? rows.source_alpha_row(ri) : NULL;
+
+    for (int x = 0; x < width; x++) {
+      double alpha = source_alpha ?
+        source.from_val(from_alpha[x]) * pixel_scale : pixel_scale;
+      if (!(alpha > 0.0)) {
+        continue;
       }
+
+      double r = source.from_val(PPM_GETR(from[x]));
+      double g = source.from_val(PPM_GETG(from[x]));
+      double b = source.from_val(PPM_GETB(from[x]));
+
+      if (alpha >= 1.0) {
+        // Completely replace the previous color.
+        if (dest_alpha) {
+          to_alpha[x] = dest.to_val(1.0);
+        }
+
+      } else {
+        double prev_alpha = dest_alpha ? dest.from_val(to_alpha[x]) : 1.0;
+        if (prev_alpha == 0.0) {
+          // Nothing there previously; replace with this new color.
+          to_alpha[x] = dest.to_val(alpha);
+
+        } else {
+          // Blend the color with the previous color.
+          r = r + (1.0 - alpha) * (dest.from_val(PPM_GETR(to[x])) - r);
+          g = g + (1.0 - alpha) * (dest.from_val(PPM_GETG(to[x])) - g);
+          b = b + (1.0 - alpha) * (dest.from_val(PPM_GETB(to[x])) - b);
+          alpha = prev_alpha + alpha * (1.0 - prev_alpha);
+
+          if (dest_alpha) {
+            to_alpha[x] = dest.to_val(alpha);
+          }
+        }
+      }
+      PPM_ASSIGN(to[x], dest.to_val(r), dest.to_val(g), dest.to_val(b));
     }
+    Thread::consider_yield();
   }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PNMSubImageRows::add_rows
+//       Access: Public, Static
+//  Description: The row function for add_sub_image().
+////////////////////////////////////////////////////////////////////
+void PNMSubImageRows::
+add_rows(int begin_row, int end_row, void *user_data) {
+  const PNMSubImageRows &rows = *(const PNMSubImageRows *)user_data;
+  PNMImage &dest = *rows._dest;
+  const PNMImage &source = *rows._source;
+  bool both_alpha = dest.has_alpha() && source.has_alpha();
+  double pixel_scale = rows._pixel_scale;
+  int width = rows._xmax - rows._xmin;
+
+  for (int ri = begin_row; ri < end_row; ri++) {
+    xel *to = rows.dest_row(ri);
+    const xel *from = rows.source_row(ri);
+
+    if (both_alpha) {
+      xelval *to_alpha = rows.dest_alpha_row(ri);
+      const xelval *from_alpha = rows.source_alpha_row(ri);
+      for (int x = 0; x < width; x++) {
+        to_alpha[x] = dest.to_val(dest.from_val(to_alpha[x]) +
+                                  source.from_val(from_alpha[x]) * pixel_scale);
+      }
+    }
+
+    for (int x = 0; x < width; x++) {
+      PPM_ASSIGN(to[x],
+                 dest.to_val(dest.from_val(PPM_GETR(to[x])) +
+                             source.from_val(PPM_GETR(from[x])) * pixel_scale),
+                 dest.to_val(dest.from_val(PPM_GETG(to[x])) +
+                             source.from_val(PPM_GETG(from[x])) * pixel_scale),
+                 dest.to_val(dest.from_val(PPM_GETB(to[x])) +
+                             source.from_val(PPM_GETB(from[x])) * pixel_scale));
+    }
+    Thread::consider_yield();
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: PNMSubImageRows::mult_rows
+//       Access: Public, Static
+//  Description: The row function for mult_sub_image().
+////////////////////////////////////////////////////////////////////
+void PNMSubImageRows::
+mult_rows(int begin_row, int end_row, void *user_data) {
+  const PNMSubImageRows &rows = *(const PNMSubImageRows *)user_data;
+  PNMImage &dest = *rows._dest;
+  const PNMImage &source = *rows._source;
+  bool both_alpha = dest.has_alpha() && source.has_alpha();
+  double pixel_scale = rows._pixel_scale;
+  int width = rows._xmax - rows._xmin;
+
+  for (int ri = begin_row; ri < end_row; ri++) {
+    xel *to = rows.dest_row(ri);
+    const xel *from = rows.source_row(ri);
+
+    if (both_alpha) {
+      xelval *to_alpha = rows.dest_alpha_row(ri);
+      const xelval *from_alpha = rows.source_alpha_row(ri);
+      for (int x = 0; x < width; x++) {
+        to_alpha[x] = dest.to_val(dest.from_val(to_alpha[x]) *
+                                  source.from_val(from_alpha[x]) * pixel_scale);
+      }
+    }
 
-  for (y = ymin; y < ymax; y++) {
-    for (x = xmin; x < xmax; x++) {
-      LRGBColord rgb1 = get_xel(x, y);
-      LRGBColord rgb2 = copy.get_xel(x, y);
-      set_xel(x, y, 
-              rgb1[0] * rgb2[0] * pixel_scale,
-              rgb1[1] * rgb2[1] * pixel_scale,
-              rgb1[2] * rgb2[2] * pixel_scale);
+    for (int x = 0; x < width; x++) {
+      PPM_ASSIGN(to[x],
+                 dest.to_val(dest.from_val(PPM_GETR(to[x])) *
+                             source.from_val(PPM_GETR(from[x])) * pixel_scale),
+                 dest.to_val(dest.from_val(PPM_GETG(to[x])) *
+                             source.from_val(PPM_GETG(from[x])) * pixel_scale),
+                 dest.to_val(dest.from_val(PPM_GETB(to[x])) *
+                             source.from_val(PPM_GETB(from[x])) * pixel_scale));
     }
+    Thread::consider_yield();
   }
 }
 
@@ -24,6 +24,7 @@
 
 class PNMReader;
 class PNMWriter;
+class Thread;
 class PNMFileType;
 class StackedPerlinNoise2;
 
@@ -276,7 +277,19 @@ public:
   void set_array(xel *array);
   void set_alpha_array(xelval *alpha);
 
+  // Divides work on a number of independent rows among the threads
+  // specified by pnmimage-process-threads.
+  typedef void RowsFunc(int begin_row, int end_row, void *user_data);
+  static void process_rows(int num_rows, RowsFunc *func, void *user_data);
+
+  typedef void JobFunc(int job_index, Thread *current_thread, void *user_data);
+  typedef void RunJobsFunc(int num_threads, int num_jobs,
+                           JobFunc *func, void *user_data);
+  static void set_run_jobs_func(RunJobsFunc *func);
+
 private:
+  static RunJobsFunc *_run_jobs_func;
+
   INLINE void allocate_array();
   INLINE void allocate_alpha();
 
@@ -286,6 +299,10 @@ private:
   INLINE void setup_sub_image(const PNMImage &copy, int &xto, int &yto,
                               int &xfrom, int &yfrom, int &x_size, int &y_size,
                               int &xmin, int &ymin, int &xmax, int &ymax);
+  void process_sub_image(const PNMImage &copy,
+                         int xmin, int ymin, int xmax, int ymax,
+                         int xfrom, int yfrom, double pixel_scale,
+                         RowsFunc *func);
 
   INLINE static void compute_spot_pixel(LColord &c, double d2,
                                         double min_radius, double max_radius,
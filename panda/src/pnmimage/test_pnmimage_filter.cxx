@@ -0,0 +1,261 @@
+// Filename: test_pnmimage_filter.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "pnmImage.h"
+#include "config_pnmimage.h"
+#include "trueClock.h"
+#include "workerThreadPool.h"
+
+// A benchmark of the PNMImage filtering, resizing and compositing
+// operations on a 4K RGBA image.  Each operation is timed with
+// pnmimage-process-threads 1 and with the number of threads given on
+// the command line (default 4), and the results of the two are
+// compared.  The compositing operations are also compared with the
+// original per-pixel implementations, below; all results must agree
+// within one unit of the maxval.
+
+static const int image_size = 4096;
+
+// This test doesn't link with gobj, which normally installs the thread
+// pool used by process_rows(), so it installs its own.
+static void
+run_jobs(int num_threads, int num_jobs,
+         PNMImage::JobFunc *func, void *user_data) {
+  PT(WorkerThreadPool) pool =
+    WorkerThreadPool::get_shared("PNMImageProcess", num_threads);
+  pool->run_jobs(num_jobs, func, user_data);
+}
+
+static PNMImage
+make_image(int size, int seed) {
+  srand(seed);
+  PNMImage image(size, size, 4, 255);
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      // Smooth gradients with some noise, and a range of alpha values
+      // including fully transparent and fully opaque.
+      image.set_xel_val(x, y,
+                        (x + rand() % 16) & 0xff,
+                        (y + rand() % 16) & 0xff,
+                        ((x ^ y) + rand() % 16) & 0xff);
+      int alpha = ((x + y) / 8) % 320 - 32;
+      image.set_alpha_val(x, y, max(min(alpha, 255), 0));
+    }
+  }
+  return image;
+}
+
+static int
+compare_images(const PNMImage &a, const PNMImage &b) {
+  if (a.get_x_size() != b.get_x_size() || a.get_y_size() != b.get_y_size()) {
+    return 0x10000;
+  }
+  int max_diff = 0;
+  for (int y = 0; y < a.get_y_size(); ++y) {
+    for (int x = 0; x < a.get_x_size(); ++x) {
+      max_diff = max(max_diff, abs((int)a.get_red_val(x, y) - (int)b.get_red_val(x, y)));
+      max_diff = max(max_diff, abs((int)a.get_green_val(x, y) - (int)b.get_green_val(x, y)));
+      max_diff = max(max_diff, abs((int)a.get_blue_val(x, y) - (int)b.get_blue_val(x, y)));
+      if (a.has_alpha() && b.has_alpha()) {
+        max_diff = max(max_diff, abs((int)a.get_alpha_val(x, y) - (int)b.get_alpha_val(x, y)));
+      }
+    }
+  }
+  return max_diff;
+}
+
+// The original implementations of the compositing operations, one
+// pixel at a time through the public interface.
+static void
+reference_blend(PNMImage &dest, const PNMImage &copy, double pixel_scale) {
+  for (int y = 0; y < dest.get_y_size(); ++y) {
+    for (int x = 0; x < dest.get_x_size(); ++x) {
+      dest.blend(x, y, copy.get_xel(x, y), copy.get_alpha(x, y) * pixel_scale);
+    }
+  }
+}
+
+static void
+reference_add(PNMImage &dest, const PNMImage &copy, double pixel_scale) {
+  for (int y = 0; y < dest.get_y_size(); ++y) {
+    for (int x = 0; x < dest.get_x_size(); ++x) {
+      dest.set_alpha(x, y, dest.get_alpha(x, y) + copy.get_alpha(x, y) * pixel_scale);
+      LRGBColord rgb1 = dest.get_xel(x, y);
+      LRGBColord rgb2 = copy.get_xel(x, y);
+      dest.set_xel(x, y,
+                   rgb1[0] + rgb2[0] * pixel_scale,
+                   rgb1[1] + rgb2[1] * pixel_scale,
+                   rgb1[2] + rgb2[2] * pixel_scale);
+    }
+  }
+}
+
+static void
+reference_mult(PNMImage &dest, const PNMImage &copy, double pixel_scale) {
+  for (int y = 0; y < dest.get_y_size(); ++y) {
+    for (int x = 0; x < dest.get_x_size(); ++x) {
+      dest.set_alpha(x, y, dest.get_alpha(x, y) * copy.get_alpha(x, y) * pixel_scale);
+      LRGBColord rgb1 = dest.get_xel(x, y);
+      LRGBColord rgb2 = copy.get_xel(x, y);
+      dest.set_xel(x, y,
+                   rgb1[0] * rgb2[0] * pixel_scale,
+                   rgb1[1] * rgb2[1] * pixel_scale,
+                   rgb1[2] * rgb2[2] * pixel_scale);
+    }
+  }
+}
+
+enum Operation {
+  O_box_filter,
+  O_gaussian_filter,
+  O_quick_filter,
+  O_blend_sub_image,
+  O_add_sub_image,
+  O_mult_sub_image,
+};
+
+static const char *
+get_operation_name(Operation op) {
+  switch (op) {
+  case O_box_filter: return "box_filter_from";
+  case O_gaussian_filter: return "gaussian_filter_from";
+  case O_quick_filter: return "quick_filter_from";
+  case O_blend_sub_image: return "blend_sub_image";
+  case O_add_sub_image: return "add_sub_image";
+  case O_mult_sub_image: return "mult_sub_image";
+  }
+  return "unknown";
+}
+
+static bool
+is_compositing(Operation op) {
+  return op == O_blend_sub_image || op == O_add_sub_image || op == O_mult_sub_image;
+}
+
+// Performs the operation on dest, and returns the elapsed time.
+static double
+run_operation(Operation op, PNMImage &dest, const PNMImage &a,
+              const PNMImage &b, bool reference) {
+  TrueClock *clock = TrueClock::get_global_ptr();
+  double start = clock->get_short_time();
+
+  switch (op) {
+  case O_box_filter:
+    dest.box_filter_from(1.0, a);
+    break;
+
+  case O_gaussian_filter:
+    dest.gaussian_filter_from(1.5, a);
+    break;
+
+  case O_quick_filter:
+    dest.quick_filter_from(a);
+    break;
+
+  case O_blend_sub_image:
+    if (reference) {
+      reference_blend(dest, b, 0.75);
+    } else {
+      dest.blend_sub_image(b, 0, 0, 0, 0, -1, -1, 0.75);
+    }
+    break;
+
+  case O_add_sub_image:
+    if (reference) {
+      reference_add(dest, b, 0.5);
+    } else {
+      dest.add_sub_image(b, 0, 0, 0, 0, -1, -1, 0.5);
+    }
+    break;
+
+  case O_mult_sub_image:
+    if (reference) {
+      reference_mult(dest, b, 1.0);
+    } else {
+      dest.mult_sub_image(b, 0, 0, 0, 0, -1, -1, 1.0);
+    }
+    break;
+  }
+
+  return clock->get_short_time() - start;
+}
+
+int
+main(int argc, char *argv[]) {
+  int num_threads = 4;
+  if (argc > 1) {
+    num_threads = max(atoi(argv[1]), 2);
+  }
+  PNMImage::set_run_jobs_func(&run_jobs);
+
+  PNMImage a = make_image(image_size, 1);
+  PNMImage b = make_image(image_size, 2);
+  nout << image_size << " x " << image_size << " RGBA, "
+       << num_threads << " threads\n";
+
+  static const Operation ops[] = {
+    O_box_filter,
+    O_gaussian_filter,
+    O_quick_filter,
+    O_blend_sub_image,
+    O_add_sub_image,
+    O_mult_sub_image,
+  };
+  static const int num_ops = sizeof(ops) / sizeof(ops[0]);
+
+  bool all_ok = true;
+  for (int oi = 0; oi < num_ops; ++oi) {
+    Operation op = ops[oi];
+
+    // The filters resize the image to half size; the compositing
+    // operations apply b onto a copy of a.
+    PNMImage single, multi;
+    if (is_compositing(op)) {
+      single = a;
+      multi = a;
+    } else {
+      single = PNMImage(image_size / 2, image_size / 2, 4, 255);
+      multi = PNMImage(image_size / 2, image_size / 2, 4, 255);
+    }
+
+    pnmimage_process_threads.set_value(1);
+    double single_time = run_operation(op, single, a, b, false);
+    pnmimage_process_threads.set_value(num_threads);
+    double multi_time = run_operation(op, multi, a, b, false);
+
+    nout << "  " << get_operation_name(op) << ": "
+         << single_time * 1000.0 << " ms, "
+         << multi_time * 1000.0 << " ms threaded ("
+         << single_time / multi_time << "x)";
+
+    int diff = compare_images(single, multi);
+    if (is_compositing(op)) {
+      PNMImage reference = a;
+      double reference_time = run_operation(op, reference, a, b, true);
+      nout << ", " << reference_time * 1000.0 << " ms per-pixel";
+      diff = max(diff, compare_images(reference, single));
+    }
+
+    if (diff > 1) {
+      nout << " MISMATCH (" << diff << ")";
+      all_ok = false;
+    }
+    nout << "\n";
+  }
+
+  pnmimage_process_threads.clear_local_value();
+  PNMImage::set_run_jobs_func(NULL);
+  thread_pool = NULL;
+  return all_ok ? 0 : 1;
+}
@@ -50,6 +50,7 @@ BamReader(DatagramGenerator *source)
   _pta_id = -1;
   _long_object_id = false;
   _long_pta_id = false;
+  _read_error = false;
 }
 
 
@@ -477,6 +478,16 @@ resolve() {
     }
   }
 
+  if (_read_error) {
+    // Some object was unable to read its data; whatever we return
+    // would be incomplete.  The error belongs to this pass only; the
+    // objects read after it get a fresh start.
+    _read_error = false;
+    bam_cat.error()
+      << "Errors reading objects from " << get_filename() << "\n";
+    return false;
+  }
+
   return all_completed;
 }
 
@@ -889,6 +900,22 @@ register_finalize(TypedWritable *whom) {
   _finalize_list.insert(whom);
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: BamReader::report_read_error
+//       Access: Public
+//  Description: May be called by an object reading itself from the
+//               Bam file to indicate that its data could not be read,
+//               for instance because auxiliary file data is missing
+//               or unreadable.  The object should still leave itself
+//               in a valid state, but the next call to resolve() will
+//               return false, so that the file as a whole fails to
+//               load rather than quietly returning incomplete data.
+////////////////////////////////////////////////////////////////////
+void BamReader::
+report_read_error() {
+  _read_error = true;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: BamReader::register_change_this
 //       Access: Public
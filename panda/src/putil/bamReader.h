@@ -181,6 +181,8 @@ public:
 
   void register_finalize(TypedWritable *whom);
 
+  void report_read_error();
+
   typedef TypedWritable *(*ChangeThisFunc)(TypedWritable *object, BamReader *manager);
   typedef PT(TypedWritableReferenceCount) (*ChangeThisRefFunc)(TypedWritableReferenceCount *object, BamReader *manager);
   void register_change_this(ChangeThisFunc func, TypedWritable *whom);
@@ -305,6 +307,10 @@ private:
   typedef phash_set<TypedWritable *, pointer_hash> Finalize;
   Finalize _finalize_list;
 
+  // Set by report_read_error(), and cleared again by the resolve()
+  // that reports it.
+  bool _read_error;
+
   // These are used by get_pta() and register_pta() to unify multiple
   // references to the same PointerToArray.
   typedef phash_map<int, void *, int_hash> PTAMap;
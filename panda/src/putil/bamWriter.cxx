@@ -389,6 +389,59 @@ write_file_data(SubfileInfo &result, const SubfileInfo &source) {
   // out in the same order and queued up in the BamReader.
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: BamWriter::write_file_data
+//       Access: Public
+//  Description: Writes a block of auxiliary file data from the
+//               indicated memory, beginning on a multiple of
+//               bam-file-data-alignment bytes within the file, so
+//               that the reader may map it directly into memory.
+//               This must be balanced by a matching call to
+//               read_file_data() on restore.
+//
+//               This is only possible when writing to an actual
+//               file.  If the target is some other kind of stream,
+//               nothing is written, and false is returned; the
+//               caller should then write the data into its own
+//               datagram instead.
+////////////////////////////////////////////////////////////////////
+bool BamWriter::
+write_file_data(const unsigned char *data, size_t size) {
+  if (_target->get_file() == (FileReference *)NULL) {
+    return false;
+  }
+  streamoff pos = _target->get_file_pos();
+  if (pos <= 0) {
+    // A compressed stream, for instance, can't report a meaningful
+    // position.
+    return false;
+  }
+
+  // We write the same singleton BOC_file_data datagram as above, but
+  // pad it so that the data of the following datagram is aligned.
+  // Each datagram is preceded by its 32-bit length.
+  size_t alignment = (size_t)max((int)bam_file_data_alignment, 1);
+  size_t data_start = (size_t)pos + 4 + 1 + 4;
+  size_t padding = (alignment - data_start % alignment) % alignment;
+
+  Datagram dg;
+  dg.add_uint8(BOC_file_data);
+  dg.pad_bytes(padding);
+  if (!_target->put_datagram(dg)) {
+    util_cat.error()
+      << "Unable to write data to output.\n";
+    return false;
+  }
+
+  if (!_target->put_datagram(Datagram(data, size))) {
+    util_cat.error()
+      << "Unable to write file data to output.\n";
+    return false;
+  }
+
+  return true;
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: BamWriter::write_cdata
 //       Access: Public
@@ -78,6 +78,14 @@ ConfigVariableEnum<BamEnums::BamTextureMode> bam_texture_mode
  PRC_DESC("Set this to specify how textures should be written into Bam files."
           "See the panda source or documentation for available options."));
 
+ConfigVariableInt bam_file_data_alignment
+("bam-file-data-alignment", 4096,
+ PRC_DESC("The byte alignment, within the bam file, of blocks of raw data "
+          "that objects write outside of the object stream so that they "
+          "may be mapped directly into memory when the file is read, "
+          "such as large vertex arrays.  This should be a multiple of the "
+          "operating system's page size."));
+
 
 
 ConfigureFn(config_util) {
@@ -215,11 +215,16 @@ save_datagram(SubfileInfo &info) {
   }
 
   // If this stream is file-based, we can just point the SubfileInfo
-  // directly into this file.
+  // directly into this file.  That isn't possible if the stream can't
+  // report its position, as when it is being decompressed.
   if (_file != (FileReference *)NULL) {
-    info = SubfileInfo(_file, _in->tellg(), num_bytes);
-    _in->seekg(num_bytes, ios::cur);
-    return true;
+    streampos pos = _in->tellg();
+    if (pos != (streampos)-1) {
+      info = SubfileInfo(_file, pos, num_bytes);
+      _in->seekg(num_bytes, ios::cur);
+      return true;
+    }
+    _in->clear();
   }
 
   // Otherwise, we have to dump the data into a temporary file.
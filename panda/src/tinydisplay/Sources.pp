@@ -13,7 +13,7 @@
 #begin lib_target
   #define TARGET p3tinydisplay
   #define LOCAL_LIBS \
-    p3gsgbase p3gobj p3display \
+    p3gsgbase p3gobj p3display p3event \
     p3putil p3linmath p3mathutil p3pnmimage p3windisplay p3x11display
 
   #define COMBINED_SOURCES $[TARGET]_composite1.cxx $[TARGET]_composite2.cxx
@@ -26,6 +26,7 @@
     tinyGraphicsBuffer.h tinyGraphicsBuffer.I \
     tinyGraphicsStateGuardian.h tinyGraphicsStateGuardian.I \
     tinyTextureContext.I tinyTextureContext.h \
+    tinyTileRasterizer.I tinyTileRasterizer.h \
     tinyWinGraphicsPipe.I tinyWinGraphicsPipe.h \
     tinyWinGraphicsWindow.h tinyWinGraphicsWindow.I \
     tinyXGraphicsPipe.I tinyXGraphicsPipe.h \
@@ -36,11 +37,14 @@
     $[if $[and $[IS_OSX],$[HAVE_CARBON]],tinyOsxGraphicsWindow.mm,] \
     zbuffer.h zfeatures.h zgl.h \
     zline.h zmath.h \
+    zsimd.h zsimd_avx2.h zsimd_span.h zsimd_sse2.h \
     ztriangle_1.cxx ztriangle_2.cxx \
     ztriangle_3.cxx ztriangle_4.cxx \
+    ztriangle_avx2.cxx ztriangle_sse2.cxx \
     ztriangle.h ztriangle_two.h \
     ztriangle_code_1.h ztriangle_code_2.h \
     ztriangle_code_3.h ztriangle_code_4.h \
+    ztriangle_code_avx2.h ztriangle_code_sse2.h \
     ztriangle_table.h ztriangle_table.cxx \
     store_pixel.h store_pixel_code.h store_pixel_table.h
 
@@ -63,6 +67,7 @@
     tinySDLGraphicsPipe.cxx \
     tinySDLGraphicsWindow.cxx \
     tinyTextureContext.cxx \
+    tinyTileRasterizer.cxx \
     tinyWinGraphicsPipe.cxx \
     tinyWinGraphicsWindow.cxx \
     tinyXGraphicsPipe.cxx \
@@ -71,7 +76,19 @@
     zbuffer.cxx \
     zdither.cxx \
     zline.cxx \
-    zmath.cxx
+    zmath.cxx \
+    zsimd.cxx
 
 #end lib_target
 
+
+#begin test_bin_target
+  #define TARGET test_ztriangle
+  #define LOCAL_LIBS \
+    p3tinydisplay p3putil
+
+  #define SOURCES \
+    test_ztriangle.cxx
+
+#end test_bin_target
+
@@ -1,4 +1,5 @@
 #include "zgl.h"
+#include "tinyTileRasterizer.h"
 #include <limits.h>
 
 /* fill triangle profile */
@@ -404,6 +405,11 @@ void gl_draw_triangle_fill(GLContext *c,
   }
 #endif
 
+  if (c->tile_rasterizer != NULL) {
+    c->tile_rasterizer->add_triangle(&p0->zp,&p1->zp,&p2->zp);
+    return;
+  }
+
   (*c->zb_fill_tri)(c->zb,&p0->zp,&p1->zp,&p2->zp);
 }
 
@@ -74,6 +74,37 @@ ConfigVariableBool td_perspective_textures
             "textures on the tinydisplay software renderer, for a small "
             "performance gain."));
 
+ConfigVariableInt td_tile_threads
+  ("td-tile-threads", 0,
+   PRC_DESC("Set this to a number greater than 1 to have the tinydisplay "
+            "software renderer sort its triangles into bands of rows of "
+            "the frame buffer, and fill the bands in parallel on this "
+            "many threads.  The result is identical to the "
+            "single-threaded renderer.  Lines and points are still drawn "
+            "on the draw thread."));
+
+ConfigVariableInt td_tile_size
+  ("td-tile-size", 64,
+   PRC_DESC("The number of rows of the frame buffer in each band filled "
+            "by a single thread, when td-tile-threads is in effect.  This "
+            "is rounded up to a multiple of 8."));
+
+ConfigVariableBool td_hiz
+  ("td-hiz", true,
+   PRC_DESC("Set this true to have the tinydisplay software renderer "
+            "keep a coarse, per-tile record of the depth buffer, and use "
+            "it to skip triangles and spans that are entirely hidden "
+            "behind what has already been drawn, without visiting their "
+            "pixels.  This never changes the result."));
+
+ConfigVariableString td_simd
+  ("td-simd", "auto",
+   PRC_DESC("Selects the vectorized triangle fillers used by the tinydisplay "
+            "software renderer: \"sse2\" or \"avx2\", or \"none\" to use "
+            "only the scalar fillers.  The default, \"auto\", chooses the "
+            "fastest set the CPU supports.  The vectorized fillers produce "
+            "exactly the same pixels as the scalar ones."));
+
 ////////////////////////////////////////////////////////////////////
 //     Function: init_libtinydisplay
 //  Description: Initializes the library.  This must be called at
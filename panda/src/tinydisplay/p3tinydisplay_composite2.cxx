@@ -9,6 +9,7 @@
 #include "tinySDLGraphicsPipe.cxx"
 #include "tinySDLGraphicsWindow.cxx"
 #include "tinyTextureContext.cxx"
+#include "tinyTileRasterizer.cxx"
 #include "tinyWinGraphicsPipe.cxx"
 #include "tinyWinGraphicsWindow.cxx"
 #include "tinyXGraphicsPipe.cxx"
@@ -18,3 +19,4 @@
 #include "zdither.cxx"
 #include "zline.cxx"
 #include "zmath.cxx"
+#include "zsimd.cxx"
@@ -133,3 +133,159 @@ void gl_shade_vertex(GLContext *c,GLVertex *v)
   v->color.v[3]=A;
 }
 
+
+/* Does the work of gl_shade_vertex() for count vertices at once, count
+   being no more than GL_VERTEX_BATCH_SIZE.  Rather than running
+   through all of the lights for each vertex, each light is applied to
+   all of the vertices in turn, so that the per-light decisions are
+   made once per batch and the inner loops run over arrays of vertex
+   components.  The arithmetic for each vertex is the same as
+   gl_shade_vertex().
+
+   If color_material includes GL_COLOR_MATERIAL_AMBIENT or
+   GL_COLOR_MATERIAL_DIFFUSE, the material's ambient or diffuse color
+   is taken from each vertex's color instead. */
+void gl_shade_vertex_batch(GLContext *c,GLVertex **vertices,int count,
+                           int color_material)
+{
+  PN_stdfloat R[GL_VERTEX_BATCH_SIZE],G[GL_VERTEX_BATCH_SIZE];
+  PN_stdfloat B[GL_VERTEX_BATCH_SIZE],A[GL_VERTEX_BATCH_SIZE];
+  PN_stdfloat ex[GL_VERTEX_BATCH_SIZE],ey[GL_VERTEX_BATCH_SIZE],ez[GL_VERTEX_BATCH_SIZE];
+  PN_stdfloat nx[GL_VERTEX_BATCH_SIZE],ny[GL_VERTEX_BATCH_SIZE],nz[GL_VERTEX_BATCH_SIZE];
+  const V4 *ambient[GL_VERTEX_BATCH_SIZE],*diffuse[GL_VERTEX_BATCH_SIZE];
+  GLMaterial *m;
+  GLLight *l;
+  GLSpecBuf *specbuf = NULL;
+  int twoside = c->light_model_two_side;
+  int k;
+
+  m=&c->materials[0];
+
+  for(k=0;k<count;k++) {
+    GLVertex *v=vertices[k];
+    ex[k]=v->ec.v[0];
+    ey[k]=v->ec.v[1];
+    ez[k]=v->ec.v[2];
+    nx[k]=v->normal.v[0];
+    ny[k]=v->normal.v[1];
+    nz[k]=v->normal.v[2];
+    ambient[k]=(color_material & GL_COLOR_MATERIAL_AMBIENT) ? &v->color : &m->ambient;
+    diffuse[k]=(color_material & GL_COLOR_MATERIAL_DIFFUSE) ? &v->color : &m->diffuse;
+
+    R[k]=m->emission.v[0]+ambient[k]->v[0]*c->ambient_light_model.v[0];
+    G[k]=m->emission.v[1]+ambient[k]->v[1]*c->ambient_light_model.v[1];
+    B[k]=m->emission.v[2]+ambient[k]->v[2]*c->ambient_light_model.v[2];
+    A[k]=clampf(diffuse[k]->v[3],0,1);
+  }
+
+  for(l=c->first_light;l!=NULL;l=l->next) {
+    int at_infinity = (l->position.v[3] == 0);
+    int spot = (l->spot_cutoff != 180);
+
+    for(k=0;k<count;k++) {
+      PN_stdfloat lR,lB,lG;
+      PN_stdfloat dist,tmp,att,dot,dot_spot,dot_spec;
+      V3 d,s;
+
+      /* ambient */
+      lR=l->ambient.v[0] * ambient[k]->v[0];
+      lG=l->ambient.v[1] * ambient[k]->v[1];
+      lB=l->ambient.v[2] * ambient[k]->v[2];
+
+      if (at_infinity) {
+        /* light at infinity */
+        d.v[0]=l->position.v[0];
+        d.v[1]=l->position.v[1];
+        d.v[2]=l->position.v[2];
+        att=1;
+      } else {
+        /* distance attenuation */
+        d.v[0]=l->position.v[0]-ex[k];
+        d.v[1]=l->position.v[1]-ey[k];
+        d.v[2]=l->position.v[2]-ez[k];
+        dist = sqrtf(d.v[0]*d.v[0]+d.v[1]*d.v[1]+d.v[2]*d.v[2]);
+        if (dist>1E-3) {
+          tmp=1/dist;
+          d.v[0]*=tmp;
+          d.v[1]*=tmp;
+          d.v[2]*=tmp;
+        }
+        att=1.0f/(l->attenuation[0]+dist*(l->attenuation[1]+
+                                          dist*l->attenuation[2]));
+      }
+      dot=d.v[0]*nx[k]+d.v[1]*ny[k]+d.v[2]*nz[k];
+      if (twoside && dot < 0) dot = -dot;
+      if (dot>0) {
+        /* diffuse light */
+        lR+=dot * l->diffuse.v[0] * diffuse[k]->v[0];
+        lG+=dot * l->diffuse.v[1] * diffuse[k]->v[1];
+        lB+=dot * l->diffuse.v[2] * diffuse[k]->v[2];
+
+        /* spot light */
+        if (spot) {
+          dot_spot=-(d.v[0]*l->norm_spot_direction.v[0]+
+                     d.v[1]*l->norm_spot_direction.v[1]+
+                     d.v[2]*l->norm_spot_direction.v[2]);
+          if (twoside && dot_spot < 0) dot_spot = -dot_spot;
+          if (dot_spot < l->cos_spot_cutoff) {
+            /* no contribution */
+            continue;
+          } else {
+            if (l->spot_exponent > 0) {
+              att=att*pow(dot_spot,l->spot_exponent);
+            }
+          }
+        }
+
+        /* specular light */
+        if (c->local_light_model) {
+          V3 vcoord;
+          vcoord.v[0]=ex[k];
+          vcoord.v[1]=ey[k];
+          vcoord.v[2]=ez[k];
+          gl_V3_Norm(&vcoord);
+          s.v[0]=d.v[0]-vcoord.v[0];
+          s.v[1]=d.v[1]-vcoord.v[0];
+          s.v[2]=d.v[2]-vcoord.v[0];
+        } else {
+          s.v[0]=d.v[0];
+          s.v[1]=d.v[1];
+          s.v[2]=d.v[2]+1.0f;
+        }
+        dot_spec=nx[k]*s.v[0]+ny[k]*s.v[1]+nz[k]*s.v[2];
+        if (twoside && dot_spec < 0) dot_spec = -dot_spec;
+        if (dot_spec>0) {
+          int idx;
+          tmp=sqrt(s.v[0]*s.v[0]+s.v[1]*s.v[1]+s.v[2]*s.v[2]);
+          if (tmp > 1E-3) {
+            dot_spec=dot_spec / tmp;
+          }
+
+          /* The specular buffer depends only on the material, so we
+             only need to look it up once for the batch. */
+          if (specbuf == NULL) {
+            specbuf = specbuf_get_buffer(c, m->shininess_i, m->shininess);
+          }
+          idx = (int)(dot_spec*SPECULAR_BUFFER_SIZE);
+          if (idx > SPECULAR_BUFFER_SIZE) idx = SPECULAR_BUFFER_SIZE;
+          dot_spec = specbuf->buf[idx];
+          lR+=dot_spec * l->specular.v[0] * m->specular.v[0];
+          lG+=dot_spec * l->specular.v[1] * m->specular.v[1];
+          lB+=dot_spec * l->specular.v[2] * m->specular.v[2];
+        }
+      }
+
+      R[k]+=att * lR;
+      G[k]+=att * lG;
+      B[k]+=att * lB;
+    }
+  }
+
+  for(k=0;k<count;k++) {
+    GLVertex *v=vertices[k];
+    v->color.v[0]=clampf(R[k],0,1);
+    v->color.v[1]=clampf(G[k],0,1);
+    v->color.v[2]=clampf(B[k],0,1);
+    v->color.v[3]=A[k];
+  }
+}
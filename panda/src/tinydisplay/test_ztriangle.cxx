@@ -0,0 +1,350 @@
+// Filename: test_ztriangle.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "pandabase.h"
+#include "zbuffer.h"
+#include "zsimd.h"
+#include "ztriangle_table.h"
+#include "trueClock.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A check and benchmark of the vectorized triangle fillers.  The same
+// random triangles are drawn with each filler of fill_tri_funcs and
+// with the corresponding filler of each vectorized table that the CPU
+// supports, over the same random frame buffer, and the resulting
+// pixels and depth values must be identical.
+//
+// It also checks that the coarse depth buffer changes nothing: each
+// filler draws a scene of near triangles followed by far ones with
+// and without it, and the results must be identical.
+
+typedef ZB_fillTriangleFunc FillTriFuncs[2][4][3][2][3][3][5];
+
+static const int xsize = 256;
+static const int ysize = 256;
+static const int tex_bits = 6;
+static const int num_triangles = 64;
+static const double min_test_time = 0.5;
+
+static PIXEL tex_pixmap[1 << (tex_bits * 2)];
+static ZTextureLevel tex_levels[MAX_MIPMAP_LEVELS];
+
+static unsigned int
+urand() {
+  return ((unsigned int)rand() << 16) ^ (unsigned int)rand();
+}
+
+static PIXEL
+lookup_texture(ZTextureDef *texture_def, int s, int t,
+               unsigned int level, unsigned int level_dx) {
+  return ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level);
+}
+
+static void
+store_pixel(ZBuffer *zb, PIXEL &result, int r, int g, int b, int a) {
+  result = RGBA_TO_PIXEL(r ^ zb->blend_r, g, b, a);
+}
+
+static void
+init_zbuffer(ZBuffer &zb, PIXEL *pbuf, ZPOINT *zbuf) {
+  memset(&zb, 0, sizeof(zb));
+  zb.xsize = xsize;
+  zb.ysize = ysize;
+  zb.linesize = xsize * PSZB;
+  zb.mode = ZB_MODE_RGBA;
+  zb.pbuf = pbuf;
+  zb.zbuf = zbuf;
+  zb.reference_alpha = 0x8000;
+  zb.blend_r = 0x1234;
+  zb.store_pix_func = store_pixel;
+  zb.clip_ymin = 0;
+  zb.clip_ymax = ysize;
+  zb.count_pixels = 0;
+
+  for (int i = 0; i < MAX_TEXTURE_STAGES; ++i) {
+    ZTextureDef &def = zb.current_textures[i];
+    def.levels = tex_levels;
+    def.tex_minfilter_func = lookup_texture;
+    def.tex_magfilter_func = lookup_texture;
+    def.s_max = 1 << (tex_bits + ZB_POINT_ST_FRAC_BITS);
+    def.t_max = 1 << (tex_bits + ZB_POINT_ST_FRAC_BITS);
+  }
+}
+
+static void
+init_hiz(ZBuffer &zb) {
+  zb.hiz_xsize = (xsize + ZB_HIZ_SIZE - 1) >> ZB_HIZ_BITS;
+  zb.hiz_ysize = (ysize + ZB_HIZ_SIZE - 1) >> ZB_HIZ_BITS;
+  zb.hiz_chunks = new ZPOINT[zb.hiz_xsize * ysize];
+  zb.hiz_tiles = new ZPOINT[zb.hiz_xsize * zb.hiz_ysize];
+  zb.hiz_test = 1;
+}
+
+static void
+clear_hiz(ZBuffer &zb) {
+  memset(zb.hiz_chunks, 0, zb.hiz_xsize * ysize * sizeof(ZPOINT));
+  memset(zb.hiz_tiles, 0, zb.hiz_xsize * zb.hiz_ysize * sizeof(ZPOINT));
+}
+
+static void
+make_triangles(ZBufferPoint *points) {
+  for (int i = 0; i < num_triangles * 3; ++i) {
+    ZBufferPoint &p = points[i];
+    memset(&p, 0, sizeof(p));
+    p.x = rand() % xsize;
+    p.y = rand() % ysize;
+    p.z = urand() & ((1 << (ZB_Z_BITS + ZB_POINT_Z_FRAC_BITS)) - 1);
+    p.s = urand() & ((1 << (tex_bits + ZB_POINT_ST_FRAC_BITS + 2)) - 1);
+    p.t = urand() & ((1 << (tex_bits + ZB_POINT_ST_FRAC_BITS + 2)) - 1);
+    p.r = urand() & 0xffff;
+    p.g = urand() & 0xffff;
+    p.b = urand() & 0xffff;
+    p.a = urand() & 0xffff;
+    p.sz = p.s;
+    p.tz = p.t;
+  }
+}
+
+static void
+draw_triangles(ZB_fillTriangleFunc func, ZBuffer &zb,
+               const ZBufferPoint *points) {
+  for (int i = 0; i < num_triangles; ++i) {
+    // The fillers may modify the points, so draw copies.
+    ZBufferPoint p[3];
+    memcpy(p, points + i * 3, sizeof(p));
+    (*func)(&zb, &p[0], &p[1], &p[2]);
+  }
+}
+
+// Compares every filler of the indicated table that differs from the
+// scalar one.  Returns the number of fillers that produced different
+// results.
+static int
+check_table(const char *name, const FillTriFuncs &table) {
+  PIXEL *pbuf_init = new PIXEL[xsize * ysize];
+  ZPOINT *zbuf_init = new ZPOINT[xsize * ysize];
+  PIXEL *pbuf_a = new PIXEL[xsize * ysize];
+  ZPOINT *zbuf_a = new ZPOINT[xsize * ysize];
+  PIXEL *pbuf_b = new PIXEL[xsize * ysize];
+  ZPOINT *zbuf_b = new ZPOINT[xsize * ysize];
+  ZBufferPoint points[num_triangles * 3];
+
+  for (int i = 0; i < xsize * ysize; ++i) {
+    pbuf_init[i] = urand();
+    zbuf_init[i] = urand() & ((1 << ZB_Z_BITS) - 1);
+  }
+  make_triangles(points);
+
+  ZBuffer zb_a, zb_b;
+  init_zbuffer(zb_a, pbuf_a, zbuf_a);
+  init_zbuffer(zb_b, pbuf_b, zbuf_b);
+
+  const ZB_fillTriangleFunc *scalar = &fill_tri_funcs[0][0][0][0][0][0][0];
+  const ZB_fillTriangleFunc *vector = &table[0][0][0][0][0][0][0];
+  int num_funcs = sizeof(FillTriFuncs) / sizeof(ZB_fillTriangleFunc);
+
+  int num_checked = 0;
+  int num_failed = 0;
+  double scalar_time = 0.0;
+  double vector_time = 0.0;
+  TrueClock *clock = TrueClock::get_global_ptr();
+
+  for (int fi = 0; fi < num_funcs; ++fi) {
+    if (vector[fi] == scalar[fi]) {
+      continue;
+    }
+    ++num_checked;
+
+    memcpy(pbuf_a, pbuf_init, xsize * ysize * sizeof(PIXEL));
+    memcpy(zbuf_a, zbuf_init, xsize * ysize * sizeof(ZPOINT));
+    memcpy(pbuf_b, pbuf_init, xsize * ysize * sizeof(PIXEL));
+    memcpy(zbuf_b, zbuf_init, xsize * ysize * sizeof(ZPOINT));
+
+    double start = clock->get_short_time();
+    draw_triangles(scalar[fi], zb_a, points);
+    double mid = clock->get_short_time();
+    draw_triangles(vector[fi], zb_b, points);
+    double end = clock->get_short_time();
+    scalar_time += mid - start;
+    vector_time += end - mid;
+
+    if (memcmp(pbuf_a, pbuf_b, xsize * ysize * sizeof(PIXEL)) != 0 ||
+        memcmp(zbuf_a, zbuf_b, xsize * ysize * sizeof(ZPOINT)) != 0) {
+      printf("%s: filler %d differs from the scalar filler.\n", name, fi);
+      ++num_failed;
+    }
+  }
+
+  // Time the common case, z-tested smooth-shaded textured triangles,
+  // over and over.
+  ZB_fillTriangleFunc scalar_func = fill_tri_funcs[1][0][0][1][0][2][1];
+  ZB_fillTriangleFunc vector_func = table[1][0][0][1][0][2][1];
+  double scalar_bench = 0.0, vector_bench = 0.0;
+  int iterations = 0;
+  while (scalar_bench + vector_bench < min_test_time) {
+    memcpy(zbuf_a, zbuf_init, xsize * ysize * sizeof(ZPOINT));
+    memcpy(zbuf_b, zbuf_init, xsize * ysize * sizeof(ZPOINT));
+    double start = clock->get_short_time();
+    draw_triangles(scalar_func, zb_a, points);
+    double mid = clock->get_short_time();
+    draw_triangles(vector_func, zb_b, points);
+    double end = clock->get_short_time();
+    scalar_bench += mid - start;
+    vector_bench += end - mid;
+    ++iterations;
+  }
+
+  printf("%s: %d fillers checked, %d failed; %.3f s vs. %.3f s scalar.\n",
+         name, num_checked, num_failed, vector_time, scalar_time);
+  printf("%s: smooth textured, %d iterations: %.3f ms vs. %.3f ms scalar.\n",
+         name, iterations, vector_bench * 1000.0 / iterations,
+         scalar_bench * 1000.0 / iterations);
+
+  delete[] pbuf_init;
+  delete[] zbuf_init;
+  delete[] pbuf_a;
+  delete[] zbuf_a;
+  delete[] pbuf_b;
+  delete[] zbuf_b;
+  return num_failed;
+}
+
+// Draws the same scene with each filler of the table, with and
+// without the coarse depth buffer, optionally a band of rows at a
+// time as the tile rasterizer does.  Returns the number of fillers
+// that produced different results.
+static int
+check_hiz(const char *name, const FillTriFuncs &table, int band) {
+  PIXEL *pbuf_init = new PIXEL[xsize * ysize];
+  PIXEL *pbuf_a = new PIXEL[xsize * ysize];
+  ZPOINT *zbuf_a = new ZPOINT[xsize * ysize];
+  PIXEL *pbuf_b = new PIXEL[xsize * ysize];
+  ZPOINT *zbuf_b = new ZPOINT[xsize * ysize];
+  ZBufferPoint points[num_triangles * 3];
+
+  for (int i = 0; i < xsize * ysize; ++i) {
+    pbuf_init[i] = urand();
+  }
+
+  // The first half of the triangles are large and near; the rest are
+  // mostly hidden behind them.
+  make_triangles(points);
+  for (int i = 0; i < num_triangles * 3; ++i) {
+    ZBufferPoint &p = points[i];
+    if (i < num_triangles * 3 / 2) {
+      p.x = (i % 3 == 0) ? 0 : xsize - 1;
+      p.y = (i % 3 == 2) ? ysize - 1 : rand() % 16;
+      if (i % 6 >= 3) {
+        p.y = ysize - 1 - p.y;
+      }
+      p.z |= 1 << (ZB_Z_BITS + ZB_POINT_Z_FRAC_BITS - 1);
+    } else {
+      p.z &= (1 << (ZB_Z_BITS + ZB_POINT_Z_FRAC_BITS - 1)) - 1;
+    }
+  }
+
+  ZBuffer zb_a, zb_b;
+  init_zbuffer(zb_a, pbuf_a, zbuf_a);
+  init_zbuffer(zb_b, pbuf_b, zbuf_b);
+  init_hiz(zb_b);
+
+  const ZB_fillTriangleFunc *funcs = &table[0][0][0][0][0][0][0];
+  int num_funcs = sizeof(FillTriFuncs) / sizeof(ZB_fillTriangleFunc);
+
+  int num_failed = 0;
+  int num_rejected = 0;
+  for (int fi = 0; fi < num_funcs; ++fi) {
+    memcpy(pbuf_a, pbuf_init, xsize * ysize * sizeof(PIXEL));
+    memset(zbuf_a, 0, xsize * ysize * sizeof(ZPOINT));
+    memcpy(pbuf_b, pbuf_init, xsize * ysize * sizeof(PIXEL));
+    memset(zbuf_b, 0, xsize * ysize * sizeof(ZPOINT));
+    clear_hiz(zb_b);
+    zb_b.hiz_rejected_pixels = 0;
+
+    draw_triangles(funcs[fi], zb_a, points);
+    for (int ymin = 0; ymin < ysize; ymin += band) {
+      zb_b.clip_ymin = ymin;
+      zb_b.clip_ymax = ymin + band;
+      draw_triangles(funcs[fi], zb_b, points);
+    }
+    num_rejected += zb_b.hiz_rejected_pixels;
+
+    if (memcmp(pbuf_a, pbuf_b, xsize * ysize * sizeof(PIXEL)) != 0 ||
+        memcmp(zbuf_a, zbuf_b, xsize * ysize * sizeof(ZPOINT)) != 0) {
+      printf("%s hiz, band %d: filler %d differs.\n", name, band, fi);
+      ++num_failed;
+    }
+  }
+
+  printf("%s hiz, band %d: %d fillers checked, %d failed; %d pixels rejected.\n",
+         name, band, num_funcs, num_failed, num_rejected);
+  if (num_rejected == 0) {
+    printf("%s hiz, band %d: nothing was rejected.\n", name, band);
+    ++num_failed;
+  }
+
+  delete[] zb_b.hiz_chunks;
+  delete[] zb_b.hiz_tiles;
+  delete[] pbuf_init;
+  delete[] pbuf_a;
+  delete[] zbuf_a;
+  delete[] pbuf_b;
+  delete[] zbuf_b;
+  return num_failed;
+}
+
+int
+main(int argc, char *argv[]) {
+  srand(1);
+
+  for (int i = 0; i < (1 << (tex_bits * 2)); ++i) {
+    tex_pixmap[i] = urand();
+  }
+  for (int level = 0; level < MAX_MIPMAP_LEVELS; ++level) {
+    // Every level shares the same pixels, which is enough to tell
+    // whether the right texel was fetched.
+    ZTextureLevel &tl = tex_levels[level];
+    tl.pixmap = tex_pixmap;
+    tl.s_mask = ((1 << tex_bits) - 1) << ZB_POINT_ST_FRAC_BITS;
+    tl.s_shift = ZB_POINT_ST_FRAC_BITS;
+    tl.t_mask = ((1 << tex_bits) - 1) << ZB_POINT_ST_FRAC_BITS;
+    tl.t_shift = ZB_POINT_ST_FRAC_BITS - tex_bits;
+  }
+
+  int num_failed = 0;
+  num_failed += check_hiz("scalar", fill_tri_funcs, ysize);
+  num_failed += check_hiz("scalar", fill_tri_funcs, 2 * ZB_HIZ_SIZE);
+
+#ifdef ZSIMD_HAVE_SSE2
+  if (zsimd_is_supported(ZSIMD_SSE2)) {
+    num_failed += check_table("sse2", fill_tri_funcs_sse2);
+  } else {
+    printf("sse2: not supported on this machine.\n");
+  }
+#endif
+
+#ifdef ZSIMD_HAVE_AVX2
+  if (zsimd_is_supported(ZSIMD_AVX2)) {
+    num_failed += check_table("avx2", fill_tri_funcs_avx2);
+    num_failed += check_hiz("avx2", fill_tri_funcs_avx2, ysize);
+  } else {
+    printf("avx2: not supported on this machine.\n");
+  }
+#endif
+
+  return (num_failed == 0) ? 0 : 1;
+}
@@ -55,6 +55,8 @@ PStatCollector TinyGraphicsStateGuardian::_pixel_count_flat_perspective_pcollect
 PStatCollector TinyGraphicsStateGuardian::_pixel_count_smooth_perspective_pcollector("Pixels:Smooth perspective");
 PStatCollector TinyGraphicsStateGuardian::_pixel_count_smooth_multitex2_pcollector("Pixels:Smooth multitex 2");
 PStatCollector TinyGraphicsStateGuardian::_pixel_count_smooth_multitex3_pcollector("Pixels:Smooth multitex 3");
+PStatCollector TinyGraphicsStateGuardian::_hiz_rejected_pixels_pcollector("Hi-Z rejected pixels");
+PStatCollector TinyGraphicsStateGuardian::_hiz_rejected_triangles_pcollector("Hi-Z rejected triangles");
 
 ////////////////////////////////////////////////////////////////////
 //     Function: TinyGraphicsStateGuardian::Constructor
@@ -69,8 +71,13 @@ TinyGraphicsStateGuardian(GraphicsEngine *engine, GraphicsPipe *pipe,
   _current_frame_buffer = NULL;
   _aux_frame_buffer = NULL;
   _c = NULL;
+  _tile_rasterizer = NULL;
+  _fill_tri_funcs = &fill_tri_funcs;
   _vertices = NULL;
   _vertices_size = 0;
+  _vertex_rows = NULL;
+  _vertex_used = NULL;
+  _num_vertex_rows = 0;
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -80,6 +87,10 @@ TinyGraphicsStateGuardian(GraphicsEngine *engine, GraphicsPipe *pipe,
 ////////////////////////////////////////////////////////////////////
 TinyGraphicsStateGuardian::
 ~TinyGraphicsStateGuardian() {
+  if (_tile_rasterizer != (TinyTileRasterizer *)NULL) {
+    delete _tile_rasterizer;
+    _tile_rasterizer = NULL;
+  }
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -117,6 +128,45 @@ reset() {
   _c->draw_triangle_front = gl_draw_triangle_fill;
   _c->draw_triangle_back = gl_draw_triangle_fill;
 
+  if (td_tile_threads > 1) {
+    _tile_rasterizer = new TinyTileRasterizer(td_tile_threads, td_tile_size);
+  }
+
+  // Choose the triangle fillers, vectorized for the CPU if we can.
+  ZSimdLevel simd_level = zsimd_get_best_level();
+  string simd = td_simd;
+  if (simd == "none") {
+    simd_level = ZSIMD_NONE;
+  } else if (simd == "sse2") {
+    simd_level = ZSIMD_SSE2;
+  } else if (simd == "avx2") {
+    simd_level = ZSIMD_AVX2;
+  } else if (simd != "auto") {
+    tinydisplay_cat.warning()
+      << "Invalid td-simd value: " << simd << "\n";
+  }
+  if (!zsimd_is_supported(simd_level)) {
+    tinydisplay_cat.warning()
+      << "td-simd " << simd << " is not supported on this machine.\n";
+    simd_level = zsimd_get_best_level();
+  }
+
+  _fill_tri_funcs = &fill_tri_funcs;
+  switch (simd_level) {
+#ifdef ZSIMD_HAVE_SSE2
+  case ZSIMD_SSE2:
+    _fill_tri_funcs = &fill_tri_funcs_sse2;
+    break;
+#endif
+#ifdef ZSIMD_HAVE_AVX2
+  case ZSIMD_AVX2:
+    _fill_tri_funcs = &fill_tri_funcs_avx2;
+    break;
+#endif
+  default:
+    break;
+  }
+
   _supported_geom_rendering =
     Geom::GR_point | 
     Geom::GR_indexed_other |
@@ -151,6 +201,11 @@ reset() {
 ////////////////////////////////////////////////////////////////////
 void TinyGraphicsStateGuardian::
 free_pointers() {
+  if (_tile_rasterizer != (TinyTileRasterizer *)NULL) {
+    delete _tile_rasterizer;
+    _tile_rasterizer = NULL;
+  }
+
   if (_aux_frame_buffer != (ZBuffer *)NULL) {
     ZB_close(_aux_frame_buffer);
     _aux_frame_buffer = NULL;
@@ -160,6 +215,14 @@ free_pointers() {
     PANDA_FREE_ARRAY(_vertices);
     _vertices = NULL;
   }
+  if (_vertex_rows != (int *)NULL) {
+    PANDA_FREE_ARRAY(_vertex_rows);
+    _vertex_rows = NULL;
+  }
+  if (_vertex_used != (unsigned char *)NULL) {
+    PANDA_FREE_ARRAY(_vertex_used);
+    _vertex_used = NULL;
+  }
   _vertices_size = 0;
 }
 
@@ -227,6 +290,7 @@ clear(DrawableRegion *clearable) {
     return;
   }
   
+  flush_tiles();
   set_state_and_transform(RenderState::make_empty(), _internal_transform);
 
   bool clear_color = false;
@@ -264,6 +328,7 @@ clear(DrawableRegion *clearable) {
 void TinyGraphicsStateGuardian::
 prepare_display_region(DisplayRegionPipelineReader *dr) {
   nassertv(dr != (DisplayRegionPipelineReader *)NULL);
+  flush_tiles();
   GraphicsStateGuardian::prepare_display_region(dr);
 
   int xmin, ymin, xsize, ysize;
@@ -398,6 +463,8 @@ begin_frame(Thread *current_thread) {
   _pixel_count_smooth_perspective_pcollector.clear_level();
   _pixel_count_smooth_multitex2_pcollector.clear_level();
   _pixel_count_smooth_multitex3_pcollector.clear_level();
+  _hiz_rejected_pixels_pcollector.clear_level();
+  _hiz_rejected_triangles_pcollector.clear_level();
 #endif
 
   return true;
@@ -434,6 +501,8 @@ begin_scene() {
 ////////////////////////////////////////////////////////////////////
 void TinyGraphicsStateGuardian::
 end_scene() {
+  flush_tiles();
+
   if (_c->zb == _aux_frame_buffer) {
     // Copy the aux frame buffer into the main scene now, zooming it
     // up to the appropriate size.
@@ -467,6 +536,7 @@ end_scene() {
 ////////////////////////////////////////////////////////////////////
 void TinyGraphicsStateGuardian::
 end_frame(Thread *current_thread) {
+  flush_tiles();
   GraphicsStateGuardian::end_frame(current_thread);
 
 #ifndef NDEBUG
@@ -501,6 +571,15 @@ end_frame(Thread *current_thread) {
   _pixel_count_smooth_perspective_pcollector.flush_level();
   _pixel_count_smooth_multitex2_pcollector.flush_level();
   _pixel_count_smooth_multitex3_pcollector.flush_level();
+
+  if (_tile_rasterizer != (TinyTileRasterizer *)NULL) {
+    int triangles, pixels;
+    _tile_rasterizer->take_hiz_rejected(triangles, pixels);
+    _hiz_rejected_triangles_pcollector.add_level(triangles);
+    _hiz_rejected_pixels_pcollector.add_level(pixels);
+  }
+  _hiz_rejected_triangles_pcollector.flush_level();
+  _hiz_rejected_pixels_pcollector.flush_level();
 #endif  // DO_PSTATS
 }
 
@@ -607,9 +686,24 @@ begin_draw_primitives(const GeomPipelineReader *geom_reader,
     if (_vertices != (GLVertex *)NULL) {
       PANDA_FREE_ARRAY(_vertices);
     }
+    if (_vertex_rows != (int *)NULL) {
+      PANDA_FREE_ARRAY(_vertex_rows);
+    }
+    if (_vertex_used != (unsigned char *)NULL) {
+      PANDA_FREE_ARRAY(_vertex_used);
+    }
     _vertices = (GLVertex *)PANDA_MALLOC_ARRAY(_vertices_size * sizeof(GLVertex));
+    _vertex_rows = (int *)PANDA_MALLOC_ARRAY(_vertices_size * sizeof(int));
+    _vertex_used = (unsigned char *)PANDA_MALLOC_ARRAY(_vertices_size);
   }
 
+  // The _vertices table serves as a post-transform cache keyed by
+  // vertex index: each row is transformed once, however many
+  // primitives share it.  If the primitives are indexed and use only
+  // part of the range, transform just the rows they reference.
+  bool sparse = collect_used_vertices(geom_reader, num_used_vertices, force);
+  int num_rows = sparse ? _num_vertex_rows : num_used_vertices;
+
   GeomVertexReader  rcolor, rnormal;
 
   // We now support up to 3-stage multitexturing.
@@ -733,8 +827,31 @@ begin_draw_primitives(const GeomPipelineReader *geom_reader,
 
   bool lighting_enabled = (needs_normal && _c->lighting_enabled);
 
-  for (i = 0; i < num_used_vertices; ++i) {
-    GLVertex *v = &_vertices[i];
+  // Gather the vertices into batches, which are transformed and lit
+  // together.
+  GLVertex *batch[GL_VERTEX_BATCH_SIZE];
+  int batch_size = 0;
+  int next_row = _min_vertex;
+
+  for (i = 0; i < num_rows; ++i) {
+    int row = sparse ? _vertex_rows[i] : _min_vertex + i;
+    if (row != next_row) {
+      // Skip ahead to the next referenced row.
+      rvertex.set_row_unsafe(row);
+      if (needs_color) {
+        rcolor.set_row_unsafe(row);
+      }
+      if (needs_normal) {
+        rnormal.set_row_unsafe(row);
+      }
+      for (int si = 0; si < max_stage_index; ++si) {
+        tcdata[si]._r1.set_row_unsafe(row);
+        tcdata[si]._r2.set_row_unsafe(row);
+      }
+    }
+    next_row = row + 1;
+
+    GLVertex *v = &_vertices[row - _min_vertex];
     const LVecBase4 &d = rvertex.get_data4();
     
     v->coord.v[0] = d[0];
@@ -755,40 +872,29 @@ begin_draw_primitives(const GeomPipelineReader *geom_reader,
       _c->current_color.v[1] = d[1] * s[1];
       _c->current_color.v[2] = d[2] * s[2];
       _c->current_color.v[3] = d[3] * s[3];
-      
-      if (_color_material_flags) {
-        if (_color_material_flags & CMF_ambient) {
-          _c->materials[0].ambient = _c->current_color;
-          _c->materials[1].ambient = _c->current_color;
-        }
-        if (_color_material_flags & CMF_diffuse) {
-          _c->materials[0].diffuse = _c->current_color;
-          _c->materials[1].diffuse = _c->current_color;
-        }
-      }
     }
 
     v->color = _c->current_color;
 
     if (lighting_enabled) {
+      // The object-space normal; gl_vertex_transform_batch() replaces
+      // it with the eye-space normal.
       const LVecBase3 &d = rnormal.get_data3();
-      _c->current_normal.v[0] = d[0];
-      _c->current_normal.v[1] = d[1];
-      _c->current_normal.v[2] = d[2];
-      _c->current_normal.v[3] = 0.0f;
-
-      gl_vertex_transform(_c, v);
-      gl_shade_vertex(_c, v);
-
-    } else {
-      gl_vertex_transform(_c, v);
-    }
-
-    if (v->clip_code == 0) {
-      gl_transform_to_viewport(_c, v);
+      v->normal.v[0] = d[0];
+      v->normal.v[1] = d[1];
+      v->normal.v[2] = d[2];
     }
 
     v->edge_flag = 1;
+
+    batch[batch_size++] = v;
+    if (batch_size == GL_VERTEX_BATCH_SIZE) {
+      process_vertex_batch(batch, batch_size, lighting_enabled, needs_color);
+      batch_size = 0;
+    }
+  }
+  if (batch_size != 0) {
+    process_vertex_batch(batch, batch_size, lighting_enabled, needs_color);
   }
 
   // Set up the appropriate function callback for filling triangles,
@@ -924,7 +1030,22 @@ begin_draw_primitives(const GeomPipelineReader *geom_reader,
     }
   }
 
-  _c->zb_fill_tri = fill_tri_funcs[depth_write_state][color_write_state][alpha_test_state][depth_test_state][texfilter_state][shade_model_state][texturing_state];
+  _c->zb->hiz_test = td_hiz;
+  _c->zb_fill_tri = (*_fill_tri_funcs)[depth_write_state][color_write_state][alpha_test_state][depth_test_state][texfilter_state][shade_model_state][texturing_state];
+
+  _c->tile_rasterizer = NULL;
+  if (_tile_rasterizer != (TinyTileRasterizer *)NULL) {
+    if (_c->draw_triangle_front == gl_draw_triangle_fill &&
+        _c->draw_triangle_back == gl_draw_triangle_fill) {
+      _tile_rasterizer->begin_batch(_c->zb, _c->zb_fill_tri);
+      _c->tile_rasterizer = _tile_rasterizer;
+    } else {
+      // Wireframe and point modes draw straight into the frame
+      // buffer, so the filled triangles before them must be finished
+      // first.
+      _tile_rasterizer->flush();
+    }
+  }
 
 #ifdef DO_PSTATS
   pixel_count_white_untextured = 0;
@@ -943,6 +1064,124 @@ begin_draw_primitives(const GeomPipelineReader *geom_reader,
   return true;
 }
 
+////////////////////////////////////////////////////////////////////
+//     Function: TinyGraphicsStateGuardian::collect_used_vertices
+//       Access: Private
+//  Description: Called by begin_draw_primitives() to decide whether
+//               to transform only the vertices the primitives
+//               actually reference.  If all of the primitives are
+//               indexed, and they have fewer indices in total than
+//               there are rows in [_min_vertex, _max_vertex], fills
+//               _vertex_rows with the distinct referenced rows, in
+//               increasing order, and returns true.  Otherwise,
+//               returns false, and every row in the range should be
+//               transformed.
+////////////////////////////////////////////////////////////////////
+bool TinyGraphicsStateGuardian::
+collect_used_vertices(const GeomPipelineReader *geom_reader,
+                      int num_used_vertices, bool force) {
+  Thread *current_thread = geom_reader->get_current_thread();
+  int num_prims = geom_reader->get_num_primitives();
+  int num_indices = 0;
+  int pi;
+  for (pi = 0; pi < num_prims; ++pi) {
+    CPT(GeomPrimitive) prim = geom_reader->get_primitive(pi);
+    if (!prim->is_indexed()) {
+      return false;
+    }
+    num_indices += prim->get_num_vertices();
+  }
+  if (num_indices >= num_used_vertices) {
+    // Most likely every row is used anyway.
+    return false;
+  }
+
+  memset(_vertex_used, 0, num_used_vertices);
+  for (pi = 0; pi < num_prims; ++pi) {
+    CPT(GeomPrimitive) prim = geom_reader->get_primitive(pi);
+    GeomPrimitivePipelineReader reader(prim, current_thread);
+    int num_vertices = reader.get_num_vertices();
+    const unsigned char *pointer = reader.get_read_pointer(force);
+    if (pointer == NULL) {
+      return false;
+    }
+
+    switch (reader.get_index_type()) {
+    case Geom::NT_uint8:
+      {
+        const PN_uint8 *index = (const PN_uint8 *)pointer;
+        for (int i = 0; i < num_vertices; ++i) {
+          _vertex_used[index[i] - _min_vertex] = 1;
+        }
+      }
+      break;
+
+    case Geom::NT_uint16:
+      {
+        const PN_uint16 *index = (const PN_uint16 *)pointer;
+        for (int i = 0; i < num_vertices; ++i) {
+          _vertex_used[index[i] - _min_vertex] = 1;
+        }
+      }
+      break;
+
+    case Geom::NT_uint32:
+      {
+        const PN_uint32 *index = (const PN_uint32 *)pointer;
+        for (int i = 0; i < num_vertices; ++i) {
+          _vertex_used[index[i] - _min_vertex] = 1;
+        }
+      }
+      break;
+
+    default:
+      return false;
+    }
+  }
+
+  _num_vertex_rows = 0;
+  for (int vi = 0; vi < num_used_vertices; ++vi) {
+    if (_vertex_used[vi]) {
+      _vertex_rows[_num_vertex_rows++] = _min_vertex + vi;
+    }
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TinyGraphicsStateGuardian::process_vertex_batch
+//       Access: Private
+//  Description: Transforms, lights, and projects to the viewport a
+//               batch of up to GL_VERTEX_BATCH_SIZE vertices that
+//               begin_draw_primitives() has filled in.
+////////////////////////////////////////////////////////////////////
+void TinyGraphicsStateGuardian::
+process_vertex_batch(GLVertex **batch, int count,
+                     bool lighting_enabled, bool needs_color) {
+  gl_vertex_transform_batch(_c, batch, count, lighting_enabled);
+
+  if (lighting_enabled) {
+    // With per-vertex colors, the color material modes take the
+    // material colors from each vertex.
+    int color_material = 0;
+    if (needs_color) {
+      if (_color_material_flags & CMF_ambient) {
+        color_material |= GL_COLOR_MATERIAL_AMBIENT;
+      }
+      if (_color_material_flags & CMF_diffuse) {
+        color_material |= GL_COLOR_MATERIAL_DIFFUSE;
+      }
+    }
+    gl_shade_vertex_batch(_c, batch, count, color_material);
+  }
+
+  for (int k = 0; k < count; ++k) {
+    if (batch[k]->clip_code == 0) {
+      gl_transform_to_viewport(_c, batch[k]);
+    }
+  }
+}
+
 ////////////////////////////////////////////////////////////////////
 //     Function: TinyGraphicsStateGuardian::draw_triangles
 //       Access: Public, Virtual
@@ -1177,6 +1416,8 @@ draw_lines(const GeomPrimitivePipelineReader *reader, bool force) {
   }
 #endif  // NDEBUG
 
+  flush_tiles();
+
   int num_vertices = reader->get_num_vertices();
   _vertices_other_pcollector.add_level(num_vertices);
 
@@ -1254,6 +1495,8 @@ draw_points(const GeomPrimitivePipelineReader *reader, bool force) {
   }
 #endif  // NDEBUG
 
+  flush_tiles();
+
   int num_vertices = reader->get_num_vertices();
   _vertices_other_pcollector.add_level(num_vertices);
 
@@ -1335,7 +1578,14 @@ end_draw_primitives() {
   _pixel_count_smooth_perspective_pcollector.add_level(pixel_count_smooth_perspective);
   _pixel_count_smooth_multitex2_pcollector.add_level(pixel_count_smooth_multitex2);
   _pixel_count_smooth_multitex3_pcollector.add_level(pixel_count_smooth_multitex3);
+
+  // These are counted in the ZBuffer itself; the tile rasterizer
+  // counts the triangles it draws separately, at end_frame().
+  _hiz_rejected_triangles_pcollector.add_level(_c->zb->hiz_rejected_triangles);
+  _hiz_rejected_pixels_pcollector.add_level(_c->zb->hiz_rejected_pixels);
 #endif  // DO_PSTATS
+  _c->zb->hiz_rejected_triangles = 0;
+  _c->zb->hiz_rejected_pixels = 0;
 
   GraphicsStateGuardian::end_draw_primitives();
 }
@@ -1353,6 +1603,8 @@ bool TinyGraphicsStateGuardian::
 framebuffer_copy_to_texture(Texture *tex, int z, const DisplayRegion *dr,
                             const RenderBuffer &rb) {
   nassertr(tex != NULL && dr != NULL, false);
+
+  flush_tiles();
   
   int xo, yo, w, h;
   dr->get_region_pixels_i(xo, yo, w, h);
@@ -1404,6 +1656,8 @@ bool TinyGraphicsStateGuardian::
 framebuffer_copy_to_ram(Texture *tex, int z, const DisplayRegion *dr,
                         const RenderBuffer &rb) {
   nassertr(tex != NULL && dr != NULL, false);
+
+  flush_tiles();
   
   int xo, yo, w, h;
   dr->get_region_pixels_i(xo, yo, w, h);
@@ -1735,6 +1989,8 @@ update_texture(TextureContext *tc, bool force, int stage_index) {
 ////////////////////////////////////////////////////////////////////
 void TinyGraphicsStateGuardian::
 release_texture(TextureContext *tc) {
+  flush_tiles();
+
   TinyTextureContext *gtc = DCAST(TinyTextureContext, tc);
 
   _texturing_state = 0;  // just in case
@@ -2451,6 +2707,9 @@ apply_texture(TextureContext *tc) {
 ////////////////////////////////////////////////////////////////////
 bool TinyGraphicsStateGuardian::
 upload_texture(TinyTextureContext *gtc, bool force) {
+  // The queued triangles may still be reading the old image.
+  flush_tiles();
+
   Texture *tex = gtc->get_texture();
 
   if (_effective_incomplete_render && !force) {
@@ -2579,6 +2838,8 @@ upload_texture(TinyTextureContext *gtc, bool force) {
 ////////////////////////////////////////////////////////////////////
 bool TinyGraphicsStateGuardian::
 upload_simple_texture(TinyTextureContext *gtc) {
+  flush_tiles();
+
   PStatTimer timer(_load_texture_pcollector);
   Texture *tex = gtc->get_texture();
   nassertr(tex != (Texture *)NULL, false);
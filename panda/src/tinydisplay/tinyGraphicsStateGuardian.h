@@ -24,6 +24,7 @@
 #include "zbuffer.h"
 #include "zgl.h"
 #include "geomVertexReader.h"
+#include "tinyTileRasterizer.h"
 
 class TinyTextureContext;
 
@@ -134,7 +135,13 @@ private:
   static ZB_lookupTextureFunc get_tex_filter_func(Texture::FilterType filter);
   static ZB_texWrapFunc get_tex_wrap_func(Texture::WrapMode wrap_mode);
 
+  bool collect_used_vertices(const GeomPipelineReader *geom_reader,
+                             int num_used_vertices, bool force);
+  void process_vertex_batch(GLVertex **batch, int count,
+                            bool lighting_enabled, bool needs_color);
+
   INLINE void clear_light_state();
+  INLINE void flush_tiles();
 
   // Methods used to generate texture coordinates.
   class TexCoordData {
@@ -160,6 +167,14 @@ private:
 
   GLContext *_c;
 
+  // Allocated by reset() when td-tile-threads is in effect.
+  TinyTileRasterizer *_tile_rasterizer;
+
+  // The table of triangle fillers chosen by reset() according to
+  // td-simd: fill_tri_funcs, or one of its vectorized variants.
+  typedef ZB_fillTriangleFunc FillTriFuncs[2][4][3][2][3][3][5];
+  const FillTriFuncs *_fill_tri_funcs;
+
   enum ColorMaterialFlags {
     CMF_ambient   = 0x001,
     CMF_diffuse   = 0x002,
@@ -185,6 +200,14 @@ private:
   GLVertex *_vertices;
   int _vertices_size;
 
+  // When the indexed primitives reference only a few of the vertices
+  // in [_min_vertex, _max_vertex], these list the rows that are
+  // actually referenced, so that only those are transformed.  Both
+  // are allocated at _vertices_size.
+  int *_vertex_rows;
+  unsigned char *_vertex_used;
+  int _num_vertex_rows;
+
   static PStatCollector _vertices_immediate_pcollector;
   static PStatCollector _draw_transform_pcollector;
   static PStatCollector _pixel_count_white_untextured_pcollector;
@@ -198,6 +221,8 @@ private:
   static PStatCollector _pixel_count_smooth_perspective_pcollector;
   static PStatCollector _pixel_count_smooth_multitex2_pcollector;
   static PStatCollector _pixel_count_smooth_multitex3_pcollector;
+  static PStatCollector _hiz_rejected_pixels_pcollector;
+  static PStatCollector _hiz_rejected_triangles_pcollector;
 
 public:
   static TypeHandle get_class_type() {
@@ -0,0 +1,261 @@
+// Filename: tinyTileRasterizer.cxx
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#include "tinyTileRasterizer.h"
+#include "pStatTimer.h"
+
+#include <string.h>
+
+PStatCollector TinyTileRasterizer::_flush_pcollector("Draw:Tiles");
+
+////////////////////////////////////////////////////////////////////
+//     Function: TinyTileRasterizer::Constructor
+//       Access: Public
+//  Description: Creates a rasterizer that fills its tiles with
+//               num_threads threads, counting the thread that calls
+//               flush().  Each tile is tile_size rows high,
+//               rounded up to a multiple of ZB_HIZ_SIZE.  The threads
+//               are shared with all other rasterizers that ask for
+//               the same number.
+////////////////////////////////////////////////////////////////////
+TinyTileRasterizer::
+TinyTileRasterizer(int num_threads, int tile_size) :
+  _tile_size((max(tile_size, 1) + ZB_HIZ_SIZE - 1) & ~(ZB_HIZ_SIZE - 1)),
+  _hiz_rejected_triangles(0),
+  _hiz_rejected_pixels(0)
+{
+  if (num_threads > 1) {
+    _thread_pool = WorkerThreadPool::get_shared("TinyTiles", num_threads);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TinyTileRasterizer::Destructor
+//       Access: Public
+//  Description: Any triangles still waiting are discarded; the caller
+//               should flush() first if it wants them drawn.
+////////////////////////////////////////////////////////////////////
+TinyTileRasterizer::
+~TinyTileRasterizer() {
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TinyTileRasterizer::begin_batch
+//       Access: Public
+//  Description: Records the ZBuffer state and filler function that
+//               apply to the triangles added from now on, until the
+//               next call to begin_batch().  The ZBuffer is copied,
+//               so the caller is free to change its state afterwards;
+//               but the frame buffer memory and the texture images it
+//               points to must not change until the next flush().
+////////////////////////////////////////////////////////////////////
+void TinyTileRasterizer::
+begin_batch(const ZBuffer *zb, ZB_fillTriangleFunc fill_tri) {
+  Batch batch;
+  memcpy(&batch._zb, zb, sizeof(ZBuffer));
+  batch._fill_tri = fill_tri;
+
+  // The triangles are counted in add_triangle(), with an empty range
+  // of rows, so that nothing is drawn.
+  batch._zb.clip_ymin = 0;
+  batch._zb.clip_ymax = 0;
+
+  if (!_batches.empty()) {
+    const Batch &last = _batches.back();
+    if (last._fill_tri == fill_tri &&
+        memcmp(&last._zb, &batch._zb, sizeof(ZBuffer)) == 0) {
+      // Nothing has changed since the last batch.
+      return;
+    }
+    if (_triangles.empty() ||
+        _triangles.back()._batch != (int)_batches.size() - 1) {
+      // No triangles were added with the last batch; replace it.
+      _batches.pop_back();
+    }
+  }
+  _batches.push_back(batch);
+
+  int num_tiles = (zb->ysize + _tile_size - 1) / _tile_size;
+  if ((int)_tiles.size() < num_tiles) {
+    _tiles.resize(num_tiles);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TinyTileRasterizer::add_triangle
+//       Access: Public
+//  Description: Queues up a triangle to be filled at the next
+//               flush(), using the state given to the most recent
+//               begin_batch().
+////////////////////////////////////////////////////////////////////
+void TinyTileRasterizer::
+add_triangle(const ZBufferPoint *p0, const ZBufferPoint *p1,
+             const ZBufferPoint *p2) {
+  nassertv(!_batches.empty());
+  int batch_index = (int)_batches.size() - 1;
+  Batch &batch = _batches[batch_index];
+
+  int triangle_index = (int)_triangles.size();
+  _triangles.push_back(Triangle());
+  Triangle &tri = _triangles.back();
+  tri._p[0] = *p0;
+  tri._p[1] = *p1;
+  tri._p[2] = *p2;
+  tri._batch = batch_index;
+
+#ifdef DO_PSTATS
+  // Let the filler add the triangle to the pixel counts, here on the
+  // calling thread.  The empty row range stops it from drawing.
+  {
+    ZBufferPoint q0 = *p0, q1 = *p1, q2 = *p2;
+    (*batch._fill_tri)(&batch._zb, &q0, &q1, &q2);
+  }
+#endif  // DO_PSTATS
+
+  int ymin = min(min(p0->y, p1->y), p2->y);
+  int ymax = max(max(p0->y, p1->y), p2->y);
+  int num_tiles = (batch._zb.ysize + _tile_size - 1) / _tile_size;
+  int first_tile = max(ymin, 0) / _tile_size;
+  int last_tile = min(ymax / _tile_size, num_tiles - 1);
+  for (int tile = first_tile; tile <= last_tile; ++tile) {
+    TriangleIndices &indices = _tiles[tile];
+    if (indices.empty()) {
+      _active_tiles.push_back(tile);
+    }
+    indices.push_back(triangle_index);
+  }
+
+  if ((int)_triangles.size() >= max_triangles) {
+    flush();
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TinyTileRasterizer::flush
+//       Access: Public
+//  Description: Fills all of the triangles queued so far, and
+//               returns when they are all drawn.  The state of the
+//               current batch is retained for any triangles added
+//               afterwards.
+////////////////////////////////////////////////////////////////////
+void TinyTileRasterizer::
+flush() {
+  if (_triangles.empty()) {
+    return;
+  }
+
+  {
+    PStatTimer timer(_flush_pcollector);
+    int num_jobs = (int)_active_tiles.size();
+    if (_thread_pool != (WorkerThreadPool *)NULL) {
+      _thread_pool->run_jobs(num_jobs, &tile_job_func, this);
+    } else {
+      for (int i = 0; i < num_jobs; ++i) {
+        draw_tile(_active_tiles[i]);
+      }
+    }
+  }
+
+  pvector<int>::const_iterator ti;
+  for (ti = _active_tiles.begin(); ti != _active_tiles.end(); ++ti) {
+    _tiles[*ti].clear();
+  }
+  _active_tiles.clear();
+  _triangles.clear();
+
+  if (_batches.size() > 1) {
+    _batches.erase(_batches.begin(), _batches.end() - 1);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TinyTileRasterizer::take_hiz_rejected
+//       Access: Public
+//  Description: Returns the number of triangles and pixels that the
+//               coarse depth test has rejected in the tiles drawn
+//               since the last call, and resets the counts.  A
+//               triangle is counted only if it is rejected in the
+//               first tile it touches.
+////////////////////////////////////////////////////////////////////
+void TinyTileRasterizer::
+take_hiz_rejected(int &triangles, int &pixels) {
+  triangles = (int)AtomicAdjust::set(_hiz_rejected_triangles, 0);
+  pixels = (int)AtomicAdjust::set(_hiz_rejected_pixels, 0);
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TinyTileRasterizer::draw_tile
+//       Access: Private
+//  Description: Fills the part of each queued triangle that falls
+//               within the indicated tile.  This may be called on any
+//               thread; no two threads draw the same tile.
+////////////////////////////////////////////////////////////////////
+void TinyTileRasterizer::
+draw_tile(int tile) {
+  const TriangleIndices &indices = _tiles[tile];
+  int ymin = tile * _tile_size;
+  int ymax = ymin + _tile_size;
+
+  ZBuffer zb;
+  ZB_fillTriangleFunc fill_tri = NULL;
+  int batch_index = -1;
+  int hiz_rejected_triangles = 0;
+  int hiz_rejected_pixels = 0;
+
+  TriangleIndices::const_iterator ii;
+  for (ii = indices.begin(); ii != indices.end(); ++ii) {
+    const Triangle &tri = _triangles[*ii];
+    if (tri._batch != batch_index) {
+      if (batch_index >= 0) {
+        hiz_rejected_triangles += zb.hiz_rejected_triangles;
+        hiz_rejected_pixels += zb.hiz_rejected_pixels;
+      }
+      batch_index = tri._batch;
+      const Batch &batch = _batches[batch_index];
+      memcpy(&zb, &batch._zb, sizeof(ZBuffer));
+      zb.clip_ymin = ymin;
+      zb.clip_ymax = min(ymax, zb.ysize);
+      zb.count_pixels = 0;
+      zb.hiz_rejected_triangles = 0;
+      zb.hiz_rejected_pixels = 0;
+      fill_tri = batch._fill_tri;
+    }
+
+    // The fillers write into the points, so each tile works on its
+    // own copy.
+    ZBufferPoint p0 = tri._p[0];
+    ZBufferPoint p1 = tri._p[1];
+    ZBufferPoint p2 = tri._p[2];
+    (*fill_tri)(&zb, &p0, &p1, &p2);
+  }
+
+  if (batch_index >= 0) {
+    hiz_rejected_triangles += zb.hiz_rejected_triangles;
+    hiz_rejected_pixels += zb.hiz_rejected_pixels;
+    AtomicAdjust::add(_hiz_rejected_triangles, hiz_rejected_triangles);
+    AtomicAdjust::add(_hiz_rejected_pixels, hiz_rejected_pixels);
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//     Function: TinyTileRasterizer::tile_job_func
+//       Access: Private, Static
+//  Description: The WorkerThreadPool job function for flush();
+//               user_data is the TinyTileRasterizer.
+////////////////////////////////////////////////////////////////////
+void TinyTileRasterizer::
+tile_job_func(int job_index, Thread *current_thread, void *user_data) {
+  TinyTileRasterizer *self = (TinyTileRasterizer *)user_data;
+  self->draw_tile(self->_active_tiles[job_index]);
+}
@@ -0,0 +1,113 @@
+// Filename: tinyTileRasterizer.h
+// Created by:  agent (16Oct26)
+//
+////////////////////////////////////////////////////////////////////
+//
+// PANDA 3D SOFTWARE
+// Copyright (c) Carnegie Mellon University.  All rights reserved.
+//
+// All use of this software is subject to the terms of the revised BSD
+// license.  You should have received a copy of this license along
+// with this source code in a file named "LICENSE."
+//
+////////////////////////////////////////////////////////////////////
+
+#ifndef TINYTILERASTERIZER_H
+#define TINYTILERASTERIZER_H
+
+#include "pandabase.h"
+#include "zbuffer.h"
+#include "workerThreadPool.h"
+#include "pvector.h"
+#include "pStatCollector.h"
+#include "atomicAdjust.h"
+
+////////////////////////////////////////////////////////////////////
+//       Class : TinyTileRasterizer
+// Description : Collects the screen-space triangles issued by the
+//               TinyGraphicsStateGuardian, instead of filling them
+//               immediately, and sorts them into tiles: bands of
+//               rows of the ZBuffer.  When flush() is called, the
+//               tiles are filled in parallel on a WorkerThreadPool.
+//
+//               Each tile draws the triangles that touch it in the
+//               order they were issued, with the same filler
+//               function and ZBuffer state that was current at the
+//               time, limited to its own rows.  Since the fillers
+//               step each triangle from its top row regardless of
+//               which rows are being written, every pixel receives
+//               exactly the same values it would have had without
+//               the tiling.
+//
+//               Tiles span the full width of the buffer: the
+//               perspective-correct fillers accumulate floating-point
+//               values across each row, so a triangle cannot be
+//               entered partway along a row without changing the
+//               result.  Their height is a multiple of the
+//               coarse depth buffer's tile size, so that each thread
+//               keeps its own part of that up to date.
+////////////////////////////////////////////////////////////////////
+class EXPCL_TINYDISPLAY TinyTileRasterizer {
+public:
+  TinyTileRasterizer(int num_threads, int tile_size);
+  ~TinyTileRasterizer();
+
+  INLINE int get_num_threads() const;
+  INLINE int get_tile_size() const;
+  INLINE bool is_empty() const;
+
+  void begin_batch(const ZBuffer *zb, ZB_fillTriangleFunc fill_tri);
+  void add_triangle(const ZBufferPoint *p0, const ZBufferPoint *p1,
+                    const ZBufferPoint *p2);
+  void flush();
+
+  void take_hiz_rejected(int &triangles, int &pixels);
+
+private:
+  void draw_tile(int tile);
+  static void tile_job_func(int job_index, Thread *current_thread,
+                            void *user_data);
+
+  // The ZBuffer state and filler function in effect for a series of
+  // triangles.
+  class Batch {
+  public:
+    ZBuffer _zb;
+    ZB_fillTriangleFunc _fill_tri;
+  };
+  typedef pvector<Batch> Batches;
+
+  class Triangle {
+  public:
+    ZBufferPoint _p[3];
+    int _batch;
+  };
+  typedef pvector<Triangle> Triangles;
+
+  // The indices of the triangles that touch each tile, in order.
+  typedef pvector<int> TriangleIndices;
+  typedef pvector<TriangleIndices> Tiles;
+
+  // We flush automatically after this many triangles, to keep a
+  // bound on the memory used.
+  enum { max_triangles = 16384 };
+
+  int _tile_size;
+  Batches _batches;
+  Triangles _triangles;
+  Tiles _tiles;
+  pvector<int> _active_tiles;
+
+  // The triangles and pixels rejected by the coarse depth test, as
+  // counted by the ZBuffer copies in draw_tile().
+  AtomicAdjust::Integer _hiz_rejected_triangles;
+  AtomicAdjust::Integer _hiz_rejected_pixels;
+
+  PT(WorkerThreadPool) _thread_pool;
+
+  static PStatCollector _flush_pcollector;
+};
+
+#include "tinyTileRasterizer.I"
+
+#endif
@@ -1,6 +1,12 @@
 #include "zgl.h"
+#include "zsimd.h"
 #include "string.h"
 
+#if defined(ZSIMD_HAVE_SSE2) && !defined(STDFLOAT_DOUBLE)
+#include <emmintrin.h>
+#define GL_VERTEX_SSE2
+#endif
+
 void gl_eval_viewport(GLContext * c) {
   GLViewport *v = &c->viewport;
   GLScissor *s = &c->scissor;
@@ -82,3 +88,136 @@ gl_vertex_transform(GLContext * c, GLVertex * v) {
 
   v->clip_code = gl_clipcode(v->pc.v[0], v->pc.v[1], v->pc.v[2], v->pc.v[3]);
 }
+
+/* The vertices of a batch, one array per component. */
+typedef struct GLVertexSoA {
+  PN_stdfloat v[4][GL_VERTEX_BATCH_SIZE];
+} GLVertexSoA;
+
+/* out = m * in for the first count vertices of in.  If in_w is 0, the
+   w component of in is taken to be 1; if out_w is 0, the w component
+   of out is simply m[15], which is valid when the last row of m is
+   (0, 0, 0, m[15]).  Each component is summed in the same order as
+   gl_vertex_transform(), so the results are identical. */
+static void gl_M4_MulSoA(GLVertexSoA *out, const M4 *m, const GLVertexSoA *in,
+                         int count, int in_w, int out_w)
+{
+  const PN_stdfloat *mm = &m->m[0][0];
+  int num_rows = out_w ? 4 : 3;
+  int i, k;
+
+#ifdef GL_VERTEX_SSE2
+  /* The batch arrays are padded to a multiple of 4, so the last group
+     may run past count. */
+  for (k = 0; k < count; k += 4) {
+    __m128 x = _mm_loadu_ps(&in->v[0][k]);
+    __m128 y = _mm_loadu_ps(&in->v[1][k]);
+    __m128 z = _mm_loadu_ps(&in->v[2][k]);
+    __m128 w = _mm_loadu_ps(&in->v[3][k]);
+    for (i = 0; i < num_rows; ++i) {
+      const PN_stdfloat *row = mm + i * 4;
+      __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(row[0])),
+                                       _mm_mul_ps(y, _mm_set1_ps(row[1]))),
+                            _mm_mul_ps(z, _mm_set1_ps(row[2])));
+      if (in_w) {
+        r = _mm_add_ps(r, _mm_mul_ps(w, _mm_set1_ps(row[3])));
+      } else {
+        r = _mm_add_ps(r, _mm_set1_ps(row[3]));
+      }
+      _mm_storeu_ps(&out->v[i][k], r);
+    }
+  }
+#else
+  for (i = 0; i < num_rows; ++i) {
+    const PN_stdfloat *row = mm + i * 4;
+    if (in_w) {
+      for (k = 0; k < count; ++k) {
+        out->v[i][k] = (in->v[0][k] * row[0] + in->v[1][k] * row[1] +
+                        in->v[2][k] * row[2] + in->v[3][k] * row[3]);
+      }
+    } else {
+      for (k = 0; k < count; ++k) {
+        out->v[i][k] = (in->v[0][k] * row[0] + in->v[1][k] * row[1] +
+                        in->v[2][k] * row[2] + row[3]);
+      }
+    }
+  }
+#endif
+
+  if (!out_w) {
+    for (k = 0; k < count; ++k) {
+      out->v[3][k] = mm[15];
+    }
+  }
+}
+
+/* Does the work of gl_vertex_transform() for count vertices at once,
+   count being no more than GL_VERTEX_BATCH_SIZE.  The vertices are
+   transformed as four-wide groups, component by component, and then
+   written back to each GLVertex.  If need_normals is set (which should
+   be only if lighting is enabled), each vertex's object-space normal
+   must be in v->normal, rather than in c->current_normal; it is
+   replaced with the eye-space normal. */
+void gl_vertex_transform_batch(GLContext *c, GLVertex **vertices, int count,
+                               int need_normals)
+{
+  GLVertexSoA coord, ec, pc;
+  int i, k;
+
+  for (k = 0; k < count; ++k) {
+    GLVertex *v = vertices[k];
+    coord.v[0][k] = v->coord.v[0];
+    coord.v[1][k] = v->coord.v[1];
+    coord.v[2][k] = v->coord.v[2];
+    coord.v[3][k] = v->coord.v[3];
+  }
+  /* Pad the last group with zeroes, so we don't compute on garbage. */
+  for (; (k & 3) != 0; ++k) {
+    for (i = 0; i < 4; ++i) {
+      coord.v[i][k] = 0.0f;
+    }
+  }
+
+  if (c->lighting_enabled) {
+    /* eye coordinates needed for lighting */
+    gl_M4_MulSoA(&ec, &c->matrix_model_view, &coord, count, 0, 1);
+    gl_M4_MulSoA(&pc, &c->matrix_projection, &ec, count, 1, 1);
+
+    for (k = 0; k < count; ++k) {
+      GLVertex *v = vertices[k];
+      v->ec.v[0] = ec.v[0][k];
+      v->ec.v[1] = ec.v[1][k];
+      v->ec.v[2] = ec.v[2][k];
+      v->ec.v[3] = ec.v[3][k];
+    }
+
+    if (need_normals) {
+      const PN_stdfloat *m = &c->matrix_model_view_inv.m[0][0];
+      for (k = 0; k < count; ++k) {
+        GLVertex *v = vertices[k];
+        V3 n = v->normal;
+        v->normal.v[0] = (n.v[0] * m[0] + n.v[1] * m[1] + n.v[2] * m[2]) * c->normal_scale;
+        v->normal.v[1] = (n.v[0] * m[4] + n.v[1] * m[5] + n.v[2] * m[6]) * c->normal_scale;
+        v->normal.v[2] = (n.v[0] * m[8] + n.v[1] * m[9] + n.v[2] * m[10]) * c->normal_scale;
+
+        if (c->normalize_enabled) {
+          gl_V3_Norm(&v->normal);
+        }
+      }
+    }
+  } else {
+    /* no eye coordinates needed, no normal */
+    /* NOTE: W = 1 is assumed */
+    gl_M4_MulSoA(&pc, &c->matrix_model_projection, &coord, count, 0,
+                 !c->matrix_model_projection_no_w_transform);
+  }
+
+  for (k = 0; k < count; ++k) {
+    GLVertex *v = vertices[k];
+    v->pc.v[0] = pc.v[0][k];
+    v->pc.v[1] = pc.v[1][k];
+    v->pc.v[2] = pc.v[2][k];
+    v->pc.v[3] = pc.v[3][k];
+    v->clip_code = gl_clipcode(v->pc.v[0], v->pc.v[1], v->pc.v[2], v->pc.v[3]);
+  }
+}
@@ -24,6 +24,48 @@ int pixel_count_smooth_multitex2;
 int pixel_count_smooth_multitex3;
 #endif  // DO_PSTATS
 
+static void
+ZB_hiz_free(ZBuffer *zb) {
+  if (zb->hiz_chunks != NULL) {
+    gl_free(zb->hiz_chunks);
+    zb->hiz_chunks = NULL;
+  }
+  if (zb->hiz_tiles != NULL) {
+    gl_free(zb->hiz_tiles);
+    zb->hiz_tiles = NULL;
+  }
+}
+
+/* Allocates the coarse depth buffer to match the size of the ZBuffer,
+   and resets it to match a cleared depth buffer. */
+static void
+ZB_hiz_alloc(ZBuffer *zb) {
+  ZB_hiz_free(zb);
+  zb->hiz_xsize = (zb->xsize + ZB_HIZ_SIZE - 1) >> ZB_HIZ_BITS;
+  zb->hiz_ysize = (zb->ysize + ZB_HIZ_SIZE - 1) >> ZB_HIZ_BITS;
+  zb->hiz_chunks = (ZPOINT *)gl_zalloc(zb->hiz_xsize * zb->ysize * sizeof(ZPOINT));
+  zb->hiz_tiles = (ZPOINT *)gl_zalloc(zb->hiz_xsize * zb->hiz_ysize * sizeof(ZPOINT));
+}
+
+/* Resets the coarse depth buffer over the indicated rectangle, after
+   the depth values there have been cleared or otherwise replaced. */
+static void
+ZB_hiz_clear(ZBuffer *zb, int xmin, int ymin, int xsize, int ysize) {
+  int c0, c1, y, ty;
+
+  if (zb->hiz_chunks == NULL || xsize <= 0 || ysize <= 0) {
+    return;
+  }
+  c0 = xmin >> ZB_HIZ_BITS;
+  c1 = (xmin + xsize - 1) >> ZB_HIZ_BITS;
+  for (y = ymin; y < ymin + ysize; ++y) {
+    memset(zb->hiz_chunks + y * zb->hiz_xsize + c0, 0, (c1 - c0 + 1) * sizeof(ZPOINT));
+  }
+  for (ty = ymin >> ZB_HIZ_BITS; ty <= (ymin + ysize - 1) >> ZB_HIZ_BITS; ++ty) {
+    memset(zb->hiz_tiles + ty * zb->hiz_xsize + c0, 0, (c1 - c0 + 1) * sizeof(ZPOINT));
+  }
+}
+
 ZBuffer *
 ZB_open(int xsize, int ysize, int mode,
         int nb_colors,
@@ -45,6 +87,9 @@ ZB_open(int xsize, int ysize, int mode,
   zb->ysize = ysize;
   zb->mode = mode;
   zb->linesize = (xsize * PSZB + 3) & ~3;
+  zb->clip_ymin = 0;
+  zb->clip_ymax = ysize;
+  zb->count_pixels = 1;
 
   switch (mode) {
 #ifdef TGL_FEATURE_8_BITS
@@ -83,6 +128,8 @@ ZB_open(int xsize, int ysize, int mode,
     zb->pbuf = (PIXEL *)frame_buffer;
   }
 
+  ZB_hiz_alloc(zb);
+
   return zb;
  error:
   gl_free(zb);
@@ -100,6 +147,7 @@ ZB_close(ZBuffer * zb) {
     gl_free(zb->pbuf);
 
   gl_free(zb->zbuf);
+  ZB_hiz_free(zb);
   gl_free(zb);
 }
 
@@ -113,6 +161,8 @@ ZB_resize(ZBuffer * zb, void *frame_buffer, int xsize, int ysize) {
   zb->xsize = xsize;
   zb->ysize = ysize;
   zb->linesize = (xsize * PSZB + 3) & ~3;
+  zb->clip_ymin = 0;
+  zb->clip_ymax = ysize;
 
   size = zb->xsize * zb->ysize * sizeof(ZPOINT);
   gl_free(zb->zbuf);
@@ -128,6 +178,8 @@ ZB_resize(ZBuffer * zb, void *frame_buffer, int xsize, int ysize) {
     zb->pbuf = (PIXEL *)frame_buffer;
     zb->frame_buffer_allocated = 0;
   }
+
+  ZB_hiz_alloc(zb);
 }
 
 static void 
@@ -282,6 +334,8 @@ void ZB_zoomFrameBuffer(ZBuffer *dest, int dest_xmin, int dest_ymin, int dest_xs
                         const ZBuffer *source, int source_xmin, int source_ymin, int source_xsize, int source_ysize) {
   int tyinc = dest->linesize / PSZB;
   int fyinc = source->linesize / PSZB;
+
+  ZB_hiz_clear(dest, dest_xmin, dest_ymin, dest_xsize, dest_ysize);
   
   int fyt = 0;
   for (int ty = 0; ty < dest_ysize; ++ty) {
@@ -392,6 +446,7 @@ ZB_clear(ZBuffer * zb, int clear_z, ZPOINT z,
   
   if (clear_z) {
     memset(zb->zbuf, 0, zb->xsize * zb->ysize * sizeof(ZPOINT));
+    ZB_hiz_clear(zb, 0, 0, zb->xsize, zb->ysize);
   }
   if (clear_color) {
     color = RGBA_TO_PIXEL(r, g, b, a);
@@ -423,6 +478,7 @@ ZB_clear_viewport(ZBuffer * zb, int clear_z, ZPOINT z,
       memset(zz, 0, xsize * sizeof(ZPOINT));
       zz += zb->xsize;
     }
+    ZB_hiz_clear(zb, xmin, ymin, xsize, ysize);
   }
   if (clear_color) {
     color = RGBA_TO_PIXEL(r, g, b, a);
@@ -12,6 +12,12 @@ typedef unsigned int ZPOINT;
 #define ZB_Z_BITS 20
 #define ZB_POINT_Z_FRAC_BITS 10  // These must add to < 32.
 
+/* The coarse depth buffer divides the frame buffer into square tiles
+   of 1 << ZB_HIZ_BITS pixels on a side, and each row of a tile into a
+   chunk of the same width. */
+#define ZB_HIZ_BITS 3
+#define ZB_HIZ_SIZE (1 << ZB_HIZ_BITS)
+
 /* The number of fractional bits below the S and T texture coords.
    The more we have, the more precise the texel calculation will be
    when we zoom into small details of a texture; but the greater
@@ -150,6 +156,39 @@ struct ZBuffer {
   int reference_alpha;
   int blend_r, blend_g, blend_b, blend_a;
   ZB_storePixelFunc store_pix_func;
+
+  /* The range of rows the triangle fillers may write to.  This is
+     normally the whole buffer; the tile rasterizer narrows it to one
+     band of rows on each of its copies. */
+  int clip_ymin, clip_ymax;
+
+  /* Nonzero if the triangle fillers should add to the pixel_count_*
+     statistics.  The tile rasterizer clears this on the copies it
+     hands to its worker threads, and counts each triangle once on the
+     calling thread instead. */
+  int count_pixels;
+
+  /* The coarse depth buffer.  hiz_chunks holds, for each row, a lower
+     bound on the depth values in each chunk of ZB_HIZ_SIZE pixels of
+     the row, and hiz_tiles a lower bound on the depth values in each
+     ZB_HIZ_SIZE x ZB_HIZ_SIZE tile.  Since a pixel passes the depth
+     test only if it is greater than what is stored, a triangle or span
+     whose depth values are all no greater than these bounds can be
+     skipped without visiting its pixels.  The bounds are raised by
+     spans that are drawn over whole chunks, lowered by anything that
+     may decrease the depth values, and reset by clearing. */
+  ZPOINT *hiz_chunks;
+  ZPOINT *hiz_tiles;
+  int hiz_xsize, hiz_ysize;  /* the number of tiles across and down */
+
+  /* Nonzero if the triangle fillers should use the above to reject
+     triangles and spans.  They keep it up to date either way. */
+  int hiz_test;
+
+  /* The number of triangles and pixels rejected by the coarse depth
+     test, since the caller last reset these. */
+  int hiz_rejected_triangles;
+  int hiz_rejected_pixels;
 };
 
 struct ZBufferPoint {
@@ -166,6 +205,201 @@ struct ZBufferPoint {
   PN_stdfloat szb,tzb; 
 };
 
+/* The coarse depth buffer operations used by the triangle fillers. */
+
+/* Computes the range of depth values (without the fractional bits)
+   written along a span of n + 1 pixels, starting at z and stepping by
+   dzdx.  Returns 0 if the values might have wrapped around, in which
+   case nothing is known about them. */
+static inline int
+ZB_hiz_span_range(int z, int dzdx, int n, ZPOINT *zmin, ZPOINT *zmax) {
+  PN_int64 z0 = z;
+  PN_int64 z1 = z0 + (PN_int64)dzdx * n;
+  if (z0 < 0 || z1 < 0 || z0 > 0x7fffffff || z1 > 0x7fffffff) {
+    return 0;
+  }
+  if (z0 > z1) {
+    PN_int64 t = z0;
+    z0 = z1;
+    z1 = t;
+  }
+  *zmin = (ZPOINT)(z0 >> ZB_POINT_Z_FRAC_BITS);
+  *zmax = (ZPOINT)(z1 >> ZB_POINT_Z_FRAC_BITS);
+  return 1;
+}
+
+/* Recomputes the tiles containing chunks c0 through c1 of row y. */
+static inline void
+ZB_hiz_update_tiles(ZBuffer *zb, int y, int c0, int c1) {
+  int y0 = y & ~(ZB_HIZ_SIZE - 1);
+  int y1 = y0 + ZB_HIZ_SIZE;
+  if (y1 > zb->ysize) {
+    y1 = zb->ysize;
+  }
+  ZPOINT *tile = zb->hiz_tiles + (y >> ZB_HIZ_BITS) * zb->hiz_xsize;
+  for (int c = c0; c <= c1; ++c) {
+    const ZPOINT *chunk = zb->hiz_chunks + y0 * zb->hiz_xsize + c;
+    ZPOINT zmin = *chunk;
+    for (int cy = y0 + 1; cy < y1; ++cy) {
+      chunk += zb->hiz_xsize;
+      if (*chunk < zmin) {
+        zmin = *chunk;
+      }
+    }
+    tile[c] = zmin;
+  }
+}
+
+/* Returns nonzero if none of the n + 1 pixels of the span at (x, y)
+   can pass a less-than depth test, as determined by the coarse depth
+   buffer, and counts them as rejected. */
+static inline int
+ZB_hiz_reject_span(ZBuffer *zb, int y, int x, int n, int z, int dzdx) {
+  ZPOINT zmin, zmax;
+  if (n < 0 || !ZB_hiz_span_range(z, dzdx, n, &zmin, &zmax)) {
+    return 0;
+  }
+  const ZPOINT *chunk = zb->hiz_chunks + y * zb->hiz_xsize;
+  int c1 = (x + n) >> ZB_HIZ_BITS;
+  for (int c = x >> ZB_HIZ_BITS; c <= c1; ++c) {
+    if (zmax > chunk[c]) {
+      return 0;
+    }
+  }
+  zb->hiz_rejected_pixels += n + 1;
+  return 1;
+}
+
+/* Updates the coarse depth buffer after the span at (x, y) has been
+   drawn with a less-than depth test and no alpha test, so that every
+   pixel of it now holds at least the span's depth value.  This raises
+   the bounds of the chunks the span covers entirely. */
+static inline void
+ZB_hiz_raise_span(ZBuffer *zb, int y, int x, int n, int z, int dzdx) {
+  ZPOINT zmin, zmax;
+  int c0 = (x + ZB_HIZ_SIZE - 1) >> ZB_HIZ_BITS;
+  int c1 = ((x + n + 1) >> ZB_HIZ_BITS) - 1;
+  if (c0 > c1 || !ZB_hiz_span_range(z, dzdx, n, &zmin, &zmax)) {
+    return;
+  }
+  ZPOINT *chunk = zb->hiz_chunks + y * zb->hiz_xsize;
+  int changed = 0;
+  for (int c = c0; c <= c1; ++c) {
+    PN_int64 z0 = z + (PN_int64)dzdx * ((c << ZB_HIZ_BITS) - x);
+    PN_int64 z1 = z0 + (PN_int64)dzdx * (ZB_HIZ_SIZE - 1);
+    ZPOINT zc = (ZPOINT)(((z0 < z1) ? z0 : z1) >> ZB_POINT_Z_FRAC_BITS);
+    if (zc > chunk[c]) {
+      chunk[c] = zc;
+      changed = 1;
+    }
+  }
+  if (changed) {
+    ZB_hiz_update_tiles(zb, y, c0, c1);
+  }
+}
+
+/* Updates the coarse depth buffer after the span at (x, y) has been
+   drawn without a depth test, which may have decreased the depth
+   values anywhere along it. */
+static inline void
+ZB_hiz_lower_span(ZBuffer *zb, int y, int x, int n, int z, int dzdx) {
+  ZPOINT zmin, zmax;
+  if (n < 0) {
+    return;
+  }
+  if (!ZB_hiz_span_range(z, dzdx, n, &zmin, &zmax)) {
+    zmin = 0;
+  }
+  ZPOINT *chunk = zb->hiz_chunks + y * zb->hiz_xsize;
+  ZPOINT *tile = zb->hiz_tiles + (y >> ZB_HIZ_BITS) * zb->hiz_xsize;
+  int c1 = (x + n) >> ZB_HIZ_BITS;
+  for (int c = x >> ZB_HIZ_BITS; c <= c1; ++c) {
+    if (zmin < chunk[c]) {
+      chunk[c] = zmin;
+      if (zmin < tile[c]) {
+        tile[c] = zmin;
+      }
+    }
+  }
+}
+
+/* Extends [*zlo, *zhi] to include the depth values the fillers
+   compute over the rectangle (xmin, ymin) - (xmax, ymax) when stepping
+   from the vertex p by dzdx and dzdy. */
+static inline void
+ZB_hiz_extend_range(const ZBufferPoint *p, int dzdx, int dzdy,
+                    int xmin, int ymin, int xmax, int ymax,
+                    PN_int64 *zlo, PN_int64 *zhi) {
+  PN_int64 x0 = (PN_int64)dzdx * (xmin - p->x);
+  PN_int64 x1 = (PN_int64)dzdx * (xmax - p->x);
+  PN_int64 y0 = (PN_int64)dzdy * (ymin - p->y);
+  PN_int64 y1 = (PN_int64)dzdy * (ymax - p->y);
+  PN_int64 lo = p->z + ((x0 < x1) ? x0 : x1) + ((y0 < y1) ? y0 : y1);
+  PN_int64 hi = p->z + ((x0 > x1) ? x0 : x1) + ((y0 > y1) ? y0 : y1);
+  if (lo < *zlo) {
+    *zlo = lo;
+  }
+  if (hi > *zhi) {
+    *zhi = hi;
+  }
+}
+
+/* Returns nonzero if no pixel of the triangle p0, p1, p2 (sorted by
+   increasing y) can pass a less-than depth test within the rows the
+   fillers may write to, as determined by the coarse depth buffer, and
+   counts it as rejected.  The fillers step the depth value from p0,
+   or from p1 in the lower part, by exactly dzdx and dzdy per pixel, so
+   its range over the triangle's bounding box is known exactly; the box
+   is widened a little for the rounding of the edge stepping. */
+static inline int
+ZB_hiz_reject_triangle(ZBuffer *zb, const ZBufferPoint *p0,
+                       const ZBufferPoint *p1, const ZBufferPoint *p2,
+                       int dzdx, int dzdy) {
+  int ymin = (p0->y > zb->clip_ymin) ? p0->y : zb->clip_ymin;
+  int ymax = (p2->y < zb->clip_ymax - 1) ? p2->y : zb->clip_ymax - 1;
+  if (ymin > ymax) {
+    return 0;
+  }
+
+  int xmin = p0->x, xmax = p0->x;
+  if (p1->x < xmin) xmin = p1->x;
+  if (p1->x > xmax) xmax = p1->x;
+  if (p2->x < xmin) xmin = p2->x;
+  if (p2->x > xmax) xmax = p2->x;
+  xmin -= 2;
+  xmax += 2;
+
+  PN_int64 zlo = p0->z, zhi = p0->z;
+  ZB_hiz_extend_range(p0, dzdx, dzdy, xmin, ymin, xmax, ymax, &zlo, &zhi);
+  ZB_hiz_extend_range(p1, dzdx, dzdy, xmin, ymin, xmax, ymax, &zlo, &zhi);
+  if (zlo < 0 || zhi > 0x7fffffff) {
+    return 0;
+  }
+  ZPOINT zmax = (ZPOINT)(zhi >> ZB_POINT_Z_FRAC_BITS);
+
+  if (xmin < 0) xmin = 0;
+  if (xmax >= zb->xsize) xmax = zb->xsize - 1;
+  int tx0 = xmin >> ZB_HIZ_BITS;
+  int tx1 = xmax >> ZB_HIZ_BITS;
+  int ty1 = ymax >> ZB_HIZ_BITS;
+  for (int ty = ymin >> ZB_HIZ_BITS; ty <= ty1; ++ty) {
+    const ZPOINT *tile = zb->hiz_tiles + ty * zb->hiz_xsize;
+    for (int tx = tx0; tx <= tx1; ++tx) {
+      if (zmax > tile[tx]) {
+        return 0;
+      }
+    }
+  }
+
+  /* The tile rasterizer draws a triangle once for each band of rows
+     it touches; count it only in the band that holds its first row. */
+  if (ymin == p0->y || ymin == 0) {
+    zb->hiz_rejected_triangles++;
+    zb->hiz_rejected_pixels += abs(p0->x * (p1->y - p2->y) + p1->x * (p2->y - p0->y) + p2->x * (p0->y - p1->y)) / 2;
+  }
+  return 1;
+}
+
 /* zbuffer.c */
 
 #ifdef DO_PSTATS
@@ -32,6 +32,13 @@
 #define MAX_DISPLAY_LISTS 1024
 #define OP_BUFFER_MAX_SIZE 512
 
+/* # of vertices transformed and lit together by the batch functions */
+#define GL_VERTEX_BATCH_SIZE 64
+
+/* color_material flags for gl_shade_vertex_batch() */
+#define GL_COLOR_MATERIAL_AMBIENT 0x1
+#define GL_COLOR_MATERIAL_DIFFUSE 0x2
+
 #define TGL_OFFSET_FILL    0x1
 #define TGL_OFFSET_LINE    0x2
 #define TGL_OFFSET_POINT   0x4
@@ -130,6 +137,7 @@ typedef struct GLTexture {
 } GLTexture;
 
 struct GLContext;
+class TinyTileRasterizer;
 
 typedef void (*gl_draw_triangle_func)(struct GLContext *c,
                                       GLVertex *p0,GLVertex *p1,GLVertex *p2);
@@ -178,6 +186,10 @@ typedef struct GLContext {
   gl_draw_triangle_func draw_triangle_front,draw_triangle_back;
   ZB_fillTriangleFunc zb_fill_tri;
 
+  /* if not NULL, filled triangles are handed to the tile rasterizer
+     instead of being drawn immediately */
+  TinyTileRasterizer *tile_rasterizer;
+
   /* current vertex state */
   V4 current_color;
   V4 current_normal;
@@ -215,10 +227,14 @@ void gl_draw_triangle_fill(GLContext *c,
 /* light.c */
 void gl_enable_disable_light(GLContext *c,int light,int v);
 void gl_shade_vertex(GLContext *c,GLVertex *v);
+void gl_shade_vertex_batch(GLContext *c,GLVertex **vertices,int count,
+                           int color_material);
 
 /* vertex.c */
 void gl_eval_viewport(GLContext *c);
 void gl_vertex_transform(GLContext * c, GLVertex * v);
+void gl_vertex_transform_batch(GLContext *c, GLVertex **vertices, int count,
+                               int need_normals);
 
 /* image_util.c */
 void gl_convertRGB_to_5R6G5B(unsigned short *pixmap,unsigned char *rgb,
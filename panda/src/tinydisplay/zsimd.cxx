@@ -0,0 +1,44 @@
+/* Runtime detection of the instruction sets used by the vectorized
+   triangle fillers; see zsimd.h. */
+
+#include <stdlib.h>
+#include "zsimd.h"
+#include "cpuFeatures.h"
+
+/* Returns true if the triangle fillers for the indicated level have
+   been compiled in and may be used on this machine. */
+int zsimd_is_supported(ZSimdLevel level)
+{
+  switch (level) {
+  case ZSIMD_NONE:
+    return 1;
+
+  case ZSIMD_SSE2:
+#ifdef ZSIMD_HAVE_SSE2
+    return 1;
+#else
+    return 0;
+#endif
+
+  case ZSIMD_AVX2:
+#ifdef ZSIMD_HAVE_AVX2
+    return CPUFeatures::has_avx2();
+#else
+    return 0;
+#endif
+  }
+
+  return 0;
+}
+
+/* Returns the fastest level supported on this machine. */
+ZSimdLevel zsimd_get_best_level()
+{
+  if (zsimd_is_supported(ZSIMD_AVX2)) {
+    return ZSIMD_AVX2;
+  }
+  if (zsimd_is_supported(ZSIMD_SSE2)) {
+    return ZSIMD_SSE2;
+  }
+  return ZSIMD_NONE;
+}
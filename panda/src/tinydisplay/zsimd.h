@@ -0,0 +1,41 @@
+#ifndef _tgl_zsimd_h_
+#define _tgl_zsimd_h_
+
+/*
+ * Vectorized triangle fillers.
+ *
+ * ztriangle.py generates, besides the scalar fillers, an SSE2 and an
+ * AVX2 version of the fillers that scan out with the generic draw
+ * line loop (the untextured and the affine textured ones).  These
+ * fill 4 or 8 pixels of each span at a time, using the operations in
+ * zsimd_sse2.h or zsimd_avx2.h, and produce exactly the same pixels
+ * as the scalar code.  The remaining fillers are shared with the
+ * scalar table.
+ *
+ * The AVX2 fillers are compiled regardless of the compiler's target
+ * options, and only chosen if the CPU turns out to support AVX2.
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ZSIMD_HAVE_SSE2 1
+#endif
+
+#if defined(ZSIMD_HAVE_SSE2) && \
+  ((defined(__GNUC__) && !defined(__clang__) && \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) || \
+   (defined(__clang__) && __clang_major__ >= 9) || \
+   (defined(_MSC_VER) && _MSC_VER >= 1700))
+#define ZSIMD_HAVE_AVX2 1
+#endif
+
+/* The sets of triangle fillers that may be chosen. */
+enum ZSimdLevel {
+  ZSIMD_NONE,
+  ZSIMD_SSE2,
+  ZSIMD_AVX2,
+};
+
+int zsimd_is_supported(ZSimdLevel level);
+ZSimdLevel zsimd_get_best_level();
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef _tgl_zsimd_avx2_h_
+#define _tgl_zsimd_avx2_h_
+
+/*
+ * The vector operations used by the AVX2 triangle fillers, which fill
+ * 8 pixels at a time.  This is included only by ztriangle_avx2.cxx,
+ * after all of its other headers, since everything that follows it in
+ * the file is compiled for AVX2; see zsimd.h.
+ */
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC target("avx2")
+#elif defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#define ZSIMD_CLANG_ATTRIBUTE_PUSHED
+#endif
+
+#include <immintrin.h>
+
+#define ZSIMD_WIDTH 8
+
+typedef __m256i zvec;
+
+static inline zvec zv_set1(unsigned int x) {
+  return _mm256_set1_epi32((int)x);
+}
+
+/* Returns x, x + dx, x + 2 * dx, ... with the same wraparound as the
+   scalar code's repeated additions. */
+static inline zvec zv_ramp(unsigned int x, int dx) {
+  zvec steps = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm256_add_epi32(_mm256_set1_epi32((int)x),
+                          _mm256_mullo_epi32(steps, _mm256_set1_epi32(dx)));
+}
+
+static inline zvec zv_ones() {
+  return _mm256_set1_epi32(-1);
+}
+
+static inline zvec zv_loadu(const void *p) {
+  return _mm256_loadu_si256((const __m256i *)p);
+}
+
+static inline void zv_storeu(void *p, zvec v) {
+  _mm256_storeu_si256((__m256i *)p, v);
+}
+
+static inline zvec zv_add(zvec a, zvec b) {
+  return _mm256_add_epi32(a, b);
+}
+
+static inline zvec zv_sub(zvec a, zvec b) {
+  return _mm256_sub_epi32(a, b);
+}
+
+static inline zvec zv_and(zvec a, zvec b) {
+  return _mm256_and_si256(a, b);
+}
+
+static inline zvec zv_or(zvec a, zvec b) {
+  return _mm256_or_si256(a, b);
+}
+
+/* Returns a where mask is set, b elsewhere. */
+static inline zvec zv_select(zvec mask, zvec a, zvec b) {
+  return _mm256_blendv_epi8(b, a, mask);
+}
+
+#define zv_slli(v, n) _mm256_slli_epi32((v), (n))
+#define zv_srli(v, n) _mm256_srli_epi32((v), (n))
+#define zv_srai(v, n) _mm256_srai_epi32((v), (n))
+
+static inline zvec zv_srl(zvec v, unsigned int n) {
+  return _mm256_srl_epi32(v, _mm_cvtsi32_si128((int)n));
+}
+
+/* The low 32 bits of each product, as the scalar unsigned multiply
+   gives. */
+static inline zvec zv_mullo(zvec a, zvec b) {
+  return _mm256_mullo_epi32(a, b);
+}
+
+static inline zvec zv_cmplt_s(zvec a, zvec b) {
+  return _mm256_cmpgt_epi32(b, a);
+}
+
+static inline zvec zv_cmpgt_s(zvec a, zvec b) {
+  return _mm256_cmpgt_epi32(a, b);
+}
+
+static inline zvec zv_cmplt_u(zvec a, zvec b) {
+  zvec bias = _mm256_set1_epi32((int)0x80000000);
+  return _mm256_cmpgt_epi32(_mm256_xor_si256(b, bias), _mm256_xor_si256(a, bias));
+}
+
+static inline int zv_any(zvec mask) {
+  return !_mm256_testz_si256(mask, mask);
+}
+
+static inline zvec zv_gather(const PIXEL *base, zvec index) {
+  return _mm256_i32gather_epi32((const int *)base, index, 4);
+}
+
+#include "zsimd_span.h"
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef _tgl_zsimd_span_h_
+#define _tgl_zsimd_span_h_
+
+/*
+ * Vector forms of the pixel operations in zbuffer.h, built on the
+ * zv_* operations of zsimd_sse2.h or zsimd_avx2.h.  Each one computes
+ * exactly what its scalar counterpart does, lane by lane, including
+ * the 32-bit wraparound.
+ */
+
+/* RGBA_TO_PIXEL */
+static inline zvec zv_rgba_to_pixel(zvec r, zvec g, zvec b, zvec a) {
+  return zv_or(zv_or(zv_and(zv_slli(a, 16), zv_set1(0xff000000)),
+                     zv_and(zv_slli(r, 8), zv_set1(0xff0000))),
+               zv_or(zv_and(g, zv_set1(0xff00)),
+                     zv_srli(b, 8)));
+}
+
+/* PIXEL_R, PIXEL_G, PIXEL_B, PIXEL_A */
+static inline zvec zv_pixel_r(zvec p) {
+  return zv_srli(zv_and(p, zv_set1(0xff0000)), 8);
+}
+
+static inline zvec zv_pixel_g(zvec p) {
+  return zv_and(p, zv_set1(0xff00));
+}
+
+static inline zvec zv_pixel_b(zvec p) {
+  return zv_slli(zv_and(p, zv_set1(0x00ff)), 8);
+}
+
+static inline zvec zv_pixel_a(zvec p) {
+  return zv_srli(zv_and(p, zv_set1(0xff000000)), 16);
+}
+
+/* PCOMPONENT_MULT */
+static inline zvec zv_pcomponent_mult(zvec c1, zvec c2) {
+  return zv_srli(zv_mullo(c1, c2), 16);
+}
+
+/* PALPHA_MULT */
+static inline zvec zv_palpha_mult(zvec c1, zvec c2) {
+  return zv_srai(zv_mullo(zv_srai(c1, 2), c2), 14);
+}
+
+/* PCOMPONENT_BLEND */
+static inline zvec zv_pcomponent_blend(zvec c1, zvec c2, zvec a2) {
+  return zv_srli(zv_add(zv_mullo(c1, zv_sub(zv_set1(0xffff), a2)),
+                        zv_mullo(c2, a2)), 16);
+}
+
+/* PIXEL_BLEND_RGB */
+static inline zvec zv_pixel_blend_rgb(zvec rgb, zvec r, zvec g, zvec b, zvec a) {
+  return zv_rgba_to_pixel(zv_pcomponent_blend(zv_pixel_r(rgb), r, a),
+                          zv_pcomponent_blend(zv_pixel_g(rgb), g, a),
+                          zv_pcomponent_blend(zv_pixel_b(rgb), b, a),
+                          a);
+}
+
+/* ZB_TEXEL and ZB_LOOKUP_TEXTURE_NEAREST, for one mipmap level. */
+static inline zvec zv_lookup_texel(const ZTextureLevel *level, zvec s, zvec t) {
+  zvec index = zv_or(zv_srl(zv_and(t, zv_set1(level->t_mask)), level->t_shift),
+                     zv_srl(zv_and(s, zv_set1(level->s_mask)), level->s_shift));
+  return zv_gather(level->pixmap, index);
+}
+
+/* The general texture lookup, through the filter functions, one
+   pixel at a time. */
+static inline zvec zv_lookup_texture_general(ZTextureDef *texture_def, zvec s, zvec t,
+                                             unsigned int level, unsigned int level_dx) {
+  unsigned int sa[ZSIMD_WIDTH], ta[ZSIMD_WIDTH], result[ZSIMD_WIDTH];
+  zv_storeu(sa, s);
+  zv_storeu(ta, t);
+  ZB_lookupTextureFunc func = (level == 0) ? texture_def->tex_magfilter_func : texture_def->tex_minfilter_func;
+  for (int i = 0; i < ZSIMD_WIDTH; ++i) {
+    result[i] = (*func)(texture_def, sa[i], ta[i], level, level_dx);
+  }
+  return zv_loadu(result);
+}
+
+/* STORE_PIX for the general blending modes: calls the ZBuffer's
+   store_pix_func for each pixel selected by mask. */
+static inline void zv_store_pix_general(ZBuffer *zb, PIXEL *pp, zvec mask,
+                                        zvec r, zvec g, zvec b, zvec a) {
+  int ma[ZSIMD_WIDTH], ra[ZSIMD_WIDTH], ga[ZSIMD_WIDTH], ba[ZSIMD_WIDTH], aa[ZSIMD_WIDTH];
+  zv_storeu(ma, mask);
+  zv_storeu(ra, r);
+  zv_storeu(ga, g);
+  zv_storeu(ba, b);
+  zv_storeu(aa, a);
+  for (int i = 0; i < ZSIMD_WIDTH; ++i) {
+    if (ma[i]) {
+      zb->store_pix_func(zb, pp[i], ra[i], ga[i], ba[i], aa[i]);
+    }
+  }
+}
+
+#endif
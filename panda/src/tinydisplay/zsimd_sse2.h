@@ -0,0 +1,103 @@
+#ifndef _tgl_zsimd_sse2_h_
+#define _tgl_zsimd_sse2_h_
+
+/*
+ * The vector operations used by the SSE2 triangle fillers, which fill
+ * 4 pixels at a time.  This is included only by ztriangle_sse2.cxx;
+ * see zsimd.h.
+ */
+
+#include <emmintrin.h>
+
+#define ZSIMD_WIDTH 4
+
+typedef __m128i zvec;
+
+static inline zvec zv_set1(unsigned int x) {
+  return _mm_set1_epi32((int)x);
+}
+
+/* Returns x, x + dx, x + 2 * dx, ... with the same wraparound as the
+   scalar code's repeated additions. */
+static inline zvec zv_ramp(unsigned int x, int dx) {
+  unsigned int d = (unsigned int)dx;
+  return _mm_setr_epi32((int)x, (int)(x + d), (int)(x + 2 * d), (int)(x + 3 * d));
+}
+
+static inline zvec zv_ones() {
+  return _mm_set1_epi32(-1);
+}
+
+static inline zvec zv_loadu(const void *p) {
+  return _mm_loadu_si128((const __m128i *)p);
+}
+
+static inline void zv_storeu(void *p, zvec v) {
+  _mm_storeu_si128((__m128i *)p, v);
+}
+
+static inline zvec zv_add(zvec a, zvec b) {
+  return _mm_add_epi32(a, b);
+}
+
+static inline zvec zv_sub(zvec a, zvec b) {
+  return _mm_sub_epi32(a, b);
+}
+
+static inline zvec zv_and(zvec a, zvec b) {
+  return _mm_and_si128(a, b);
+}
+
+static inline zvec zv_or(zvec a, zvec b) {
+  return _mm_or_si128(a, b);
+}
+
+/* Returns a where mask is set, b elsewhere. */
+static inline zvec zv_select(zvec mask, zvec a, zvec b) {
+  return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+#define zv_slli(v, n) _mm_slli_epi32((v), (n))
+#define zv_srli(v, n) _mm_srli_epi32((v), (n))
+#define zv_srai(v, n) _mm_srai_epi32((v), (n))
+
+static inline zvec zv_srl(zvec v, unsigned int n) {
+  return _mm_srl_epi32(v, _mm_cvtsi32_si128((int)n));
+}
+
+/* The low 32 bits of each product, as the scalar unsigned multiply
+   gives. */
+static inline zvec zv_mullo(zvec a, zvec b) {
+  zvec even = _mm_mul_epu32(a, b);
+  zvec odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+static inline zvec zv_cmplt_s(zvec a, zvec b) {
+  return _mm_cmplt_epi32(a, b);
+}
+
+static inline zvec zv_cmpgt_s(zvec a, zvec b) {
+  return _mm_cmpgt_epi32(a, b);
+}
+
+static inline zvec zv_cmplt_u(zvec a, zvec b) {
+  zvec bias = _mm_set1_epi32((int)0x80000000);
+  return _mm_cmplt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+}
+
+static inline int zv_any(zvec mask) {
+  return _mm_movemask_epi8(mask) != 0;
+}
+
+static inline zvec zv_gather(const PIXEL *base, zvec index) {
+  unsigned int i[ZSIMD_WIDTH];
+  zv_storeu(i, index);
+  return _mm_setr_epi32((int)base[i[0]], (int)base[i[1]],
+                        (int)base[i[2]], (int)base[i[3]]);
+}
+
+#include "zsimd_span.h"
+
+#endif
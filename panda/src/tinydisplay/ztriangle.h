@@ -10,6 +10,7 @@
   int part, update_left, update_right;
 
   int nb_lines, dx1, dy1, tmp, dx2, dy2;
+  int line_y;
 
   int error, derror;
   int x1, dxdy_min, dxdy_max;
@@ -53,7 +54,9 @@
 
   EARLY_OUT();
 
-  COUNT_PIXELS(PIXEL_COUNT, p0, p1, p2);
+  if (zb->count_pixels) {
+    COUNT_PIXELS(PIXEL_COUNT, p0, p1, p2);
+  }
 
   /* we sort the vertex with increasing y */
   if (p1->y < p0->y) {
@@ -72,6 +75,12 @@
     p2 = t;
   }
 
+  /* skip the triangle if it lies entirely outside the rows we may
+     write to */
+  if (p2->y < zb->clip_ymin || p0->y >= zb->clip_ymax) {
+    return;
+  }
+
   /* we compute dXdx and dXdy for all interpolated values */
   
   fdx1 = (PN_stdfloat) (p1->x - p0->x);
@@ -95,6 +104,13 @@
   d2 = (PN_stdfloat) (p2->z - p0->z);
   dzdx = (int) (fdy2 * d1 - fdy1 * d2);
   dzdy = (int) (fdx1 * d2 - fdx2 * d1);
+
+#if Z_TEST
+  if (zb->hiz_test && zb->hiz_tiles != NULL &&
+      ZB_hiz_reject_triangle(zb, p0, p1, p2, dzdx, dzdy)) {
+    return;
+  }
+#endif
 #endif
 
 #ifdef INTERP_RGB
@@ -213,6 +229,7 @@
 
   pp1 = (PIXEL *) ((char *) zb->pbuf + zb->linesize * p0->y);
   pz1 = zb->zbuf + p0->y * zb->xsize;
+  line_y = p0->y;
 
   DRAW_INIT();
 
@@ -341,6 +358,19 @@
 
     while (nb_lines>0) {
       nb_lines--;
+      if (line_y >= zb->clip_ymax) {
+        /* the rest of the triangle is below the rows we may write to */
+        return;
+      }
+      /* The edges are always stepped from the top of the triangle, so
+         that the values on each line come out exactly the same no
+         matter which rows are being drawn. */
+      if (line_y >= zb->clip_ymin
+#if defined(INTERP_Z) && Z_TEST
+          && !(zb->hiz_test && zb->hiz_chunks != NULL &&
+               ZB_hiz_reject_span(zb, line_y, x1, (x2 >> 16) - x1, z1, dzdx))
+#endif
+          ) {
 #ifndef DRAW_LINE
       /* generic draw line */
       {
@@ -393,6 +423,16 @@
 #ifdef INTERP_STZB
         szb=szb1;
         tzb=tzb1;
+#endif
+#if defined(ZSIMD_WIDTH) && defined(PUT_PIXELS_SIMD)
+        while (n>=ZSIMD_WIDTH-1) {
+          PUT_PIXELS_SIMD();
+#ifdef INTERP_Z
+          pz+=ZSIMD_WIDTH;
+#endif
+          pp=(PIXEL *)((char *)pp + ZSIMD_WIDTH * PSZB);
+          n-=ZSIMD_WIDTH;
+        }
 #endif
         while (n>=3) {
           PUT_PIXEL(0);
@@ -417,6 +457,18 @@
 #else
       DRAW_LINE();
 #endif
+
+#if defined(INTERP_Z) && Z_WRITE
+      /* keep the coarse depth buffer up to date */
+      if (zb->hiz_chunks != NULL) {
+#if Z_TEST && !A_TEST
+        ZB_hiz_raise_span(zb, line_y, x1, (x2 >> 16) - x1, z1, dzdx);
+#elif !Z_TEST
+        ZB_hiz_lower_span(zb, line_y, x1, (x2 >> 16) - x1, z1, dzdx);
+#endif
+      }
+#endif
+      }
       
       /* left edge */
       error+=derror;
@@ -483,6 +535,7 @@
       /* screen coordinates */
       pp1=(PIXEL *)((char *)pp1 + zb->linesize);
       pz1+=zb->xsize;
+      line_y++;
     }
   }
 }
@@ -499,4 +552,5 @@
 #undef DRAW_INIT
 #undef DRAW_LINE  
 #undef PUT_PIXEL
+#undef PUT_PIXELS_SIMD
 #undef PIXEL_COUNT
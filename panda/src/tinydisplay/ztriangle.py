@@ -53,10 +53,22 @@ for i in range(len(ExtraOptions[0])):
 
 FullOptions = Options + ExtraOptions
 
+# We also generate a vectorized version of some of the functions for
+# each of these instruction sets, in ztriangle_code_<isa>.h and
+# ztriangle_<isa>.cxx, and a table of function pointers for each,
+# fill_tri_funcs_<isa>.  The vector operations are defined in
+# zsimd_<isa>.h.
+SimdVariants = [ 'sse2', 'avx2' ]
+
+# Only these texturing modes have a vectorized version; the others
+# draw with DRAW_LINE, and their entries in the vectorized tables
+# refer to the scalar functions.
+SimdTexturing = [ 'untextured', 'textured' ]
+
 CodeTable = {
     # depth write
-    'zon' : '#define STORE_Z(zpix, z) (zpix) = (z)',
-    'zoff' : '#define STORE_Z(zpix, z)',
+    'zon' : '#define STORE_Z(zpix, z) (zpix) = (z)\n#define Z_WRITE 1',
+    'zoff' : '#define STORE_Z(zpix, z)\n#define Z_WRITE 0',
 
     # color write
     'cstore' : '#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)',
@@ -65,13 +77,13 @@ CodeTable = {
     'coff' : '#define STORE_PIX(pix, rgb, r, g, b, a)',
 
     # alpha test
-    'anone' : '#define ACMP(zb, a) 1',
-    'aless' : '#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)',
-    'amore' : '#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)',
+    'anone' : '#define ACMP(zb, a) 1\n#define A_TEST 0',
+    'aless' : '#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)\n#define A_TEST 1',
+    'amore' : '#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)\n#define A_TEST 1',
 
     # depth test
-    'znone' : '#define ZCMP(zpix, z) 1',
-    'zless' : '#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))',
+    'znone' : '#define ZCMP(zpix, z) 1\n#define Z_TEST 0',
+    'zless' : '#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))\n#define Z_TEST 1',
 
     # texture filters
     'tnearest' : '#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)\n#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)',
@@ -79,6 +91,34 @@ CodeTable = {
     'tgeneral' : '#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)\n#define INTERP_MIPMAP\n#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))',
 }
 
+# The vector form of each of the above, used in the vectorized
+# functions to process several pixels at once.
+SimdCodeTable = {
+    # depth write
+    'zon' : '#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))',
+    'zoff' : '#define STORE_Z_V(pz, mask, z)',
+
+    # color write
+    'cstore' : '#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))',
+    'cblend' : '#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }',
+    'cgeneral' : '#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)',
+    'coff' : '#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)',
+
+    # alpha test
+    'anone' : '#define ACMP_V(zb, a) zv_ones()',
+    'aless' : '#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))',
+    'amore' : '#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))',
+
+    # depth test
+    'znone' : '#define ZCMP_V(zpix, z) zv_ones()',
+    'zless' : '#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)',
+
+    # texture filters
+    'tnearest' : '#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)',
+    'tmipmap' : '#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)',
+    'tgeneral' : '#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)',
+}
+
 ZTriangleStub = """
 /* This file is generated code--do not edit.  See ztriangle.py. */
 #include <stdlib.h>
@@ -92,6 +132,28 @@ ZTriangleStub = """
 #include "ztriangle_table.h"
 #include "ztriangle_code_%s.h"
 """
+ZTriangleSimdStub = """
+/* This file is generated code--do not edit.  See ztriangle.py. */
+#include <stdlib.h>
+#include <stdio.h>
+#include "pandabase.h"
+#include "zbuffer.h"
+#include "zsimd.h"
+
+/* The vectorized versions of the functions in ztriangle_*.cxx.  These
+   are compiled for %(isa)s whatever the compiler's target options, so
+   nothing else may be included after zsimd_%(isa)s.h. */
+
+#ifdef ZSIMD_HAVE_%(ISA)s
+#include "zsimd_%(isa)s.h"
+#include "ztriangle_code_%(isa)s.h"
+#endif
+
+#ifdef ZSIMD_CLANG_ATTRIBUTE_PUSHED
+#pragma clang attribute pop
+#endif
+"""
+
 ops = [0] * len(Options)
 
 class DoneException:
@@ -132,6 +194,16 @@ def getFname(ops):
     fname = 'FB_triangle_%s' % ('_'.join(keywordList))
     return fname
 
+def isSimdOps(fops):
+    # Returns true if the indicated full ops vector has a vectorized
+    # version.
+    return FullOptions[-1][fops[-1]] in SimdTexturing
+
+def getSimdFname(isa, ops):
+    # Returns the name of the vectorized function corresponding to
+    # the indicated ops vector.
+    return getFname(ops).replace('FB_triangle_', 'FB_triangle_%s_' % (isa), 1)
+
 def getFref(ops):
     # Returns a string that evaluates to a pointer reference to the
     # indicated function.
@@ -211,6 +283,49 @@ except DoneException:
 assert count == OptionsCount
 closeCode()
 
+# Now generate the vectorized code, for each instruction set, into its
+# own ztriangle_code_<isa>.h and ztriangle_<isa>.cxx.
+simdFnameDict = {}
+for isa in SimdVariants:
+    code = open('ztriangle_code_%s.h' % (isa), 'wb')
+    print >> code, '/* This file is generated code--do not edit.  See ztriangle.py. */'
+    print >> code, ''
+
+    zt = open('ztriangle_%s.cxx' % (isa), 'wb')
+    print >> zt, ZTriangleSimdStub % { 'isa' : isa, 'ISA' : isa.upper() }
+
+    fnameList = []
+    ops = [0] * len(Options)
+    try:
+        while True:
+            for i in range(len(ops)):
+                keyword = Options[i][ops[i]]
+                print >> code, CodeTable[keyword]
+                print >> code, SimdCodeTable[keyword]
+
+            fname = getSimdFname(isa, ops)
+            print >> code, '#define FNAME(name) %s_ ## name' % (fname)
+            print >> code, '#include "ztriangle_two.h"'
+            print >> code, ''
+
+            for eops in ExtraOptionsMat:
+                fops = ops + eops
+                if isSimdOps(fops):
+                    fname = getSimdFname(isa, fops)
+                    simdFnameDict[fname] = len(fnameList)
+                    fnameList.append(fname)
+
+            incrementOptions(ops)
+    except DoneException:
+        pass
+
+    print >> code, ''
+    print >> code, 'ZB_fillTriangleFunc ztriangle_code_%s[%s] = {' % (isa, len(fnameList))
+    for fname in fnameList:
+        print >> code, '  %s,' % (fname)
+    print >> code, '};'
+    code.close()
+
 # Now, generate the table of function pointers.
 
 # The external reference for the table containing the above function
@@ -218,6 +333,8 @@ closeCode()
 table_decl = open('ztriangle_table.h', 'wb')
 print >> table_decl, '/* This file is generated code--do not edit.  See ztriangle.py. */'
 print >> table_decl, ''
+print >> table_decl, '#include "zsimd.h"'
+print >> table_decl, ''
 
 # The actual table definition gets written here.
 table_def = open('ztriangle_table.cxx', 'wb')
@@ -232,7 +349,16 @@ for i in range(NumSegments):
     print >> table_def, 'extern ZB_fillTriangleFunc ztriangle_code_%s[];' % (i + 1)
 print >> table_def, ''
 
-def writeTableEntry(ops):
+def getTableFref(ops, isa):
+    # Returns the reference to write to the table for the indicated
+    # ops vector: the vectorized function for isa if there is one, or
+    # the scalar function otherwise.
+    if isa and isSimdOps(ops):
+        i = simdFnameDict[getSimdFname(isa, ops)]
+        return 'ztriangle_code_%s[%s]' % (isa, i)
+    return getFref(ops)
+
+def writeTableEntry(ops, isa = None):
     indent = '  ' * (len(ops) + 1)
     i = len(ops)
     numOps = len(FullOptions[i])
@@ -240,17 +366,17 @@ def writeTableEntry(ops):
     if i + 1 == len(FullOptions):
         # The last level: write out the actual function names.
         for j in range(numOps - 1):
-            print >> table_def, indent + getFref(ops + [j]) + ','
-        print >> table_def, indent + getFref(ops + [numOps - 1])
+            print >> table_def, indent + getTableFref(ops + [j], isa) + ','
+        print >> table_def, indent + getTableFref(ops + [numOps - 1], isa)
 
     else:
         # Intermediate levels: write out a nested reference.
         for j in range(numOps - 1):
             print >> table_def, indent + '{'
-            writeTableEntry(ops + [j])
+            writeTableEntry(ops + [j], isa)
             print >> table_def, indent + '},'
         print >> table_def, indent + '{'
-        writeTableEntry(ops + [numOps - 1])
+        writeTableEntry(ops + [numOps - 1], isa)
         print >> table_def, indent + '}'
 
 arraySizeList = []
@@ -264,6 +390,21 @@ print >> table_decl, 'extern const ZB_fillTriangleFunc fill_tri_funcs%s;' % (arr
 writeTableEntry([])
 print >> table_def, '};'
 
+for isa in SimdVariants:
+    print >> table_def, ''
+    print >> table_def, '#ifdef ZSIMD_HAVE_%s' % (isa.upper())
+    print >> table_def, 'extern ZB_fillTriangleFunc ztriangle_code_%s[];' % (isa)
+    print >> table_def, ''
+    print >> table_def, 'const ZB_fillTriangleFunc fill_tri_funcs_%s%s = {' % (isa, arraySize)
+    writeTableEntry([], isa)
+    print >> table_def, '};'
+    print >> table_def, '#endif'
+
+    print >> table_decl, ''
+    print >> table_decl, '#ifdef ZSIMD_HAVE_%s' % (isa.upper())
+    print >> table_decl, 'extern const ZB_fillTriangleFunc fill_tri_funcs_%s%s;' % (isa, arraySize)
+    print >> table_decl, '#endif'
+
 
         
         
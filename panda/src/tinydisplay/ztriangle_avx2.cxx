@@ -0,0 +1,21 @@
+
+/* This file is generated code--do not edit.  See ztriangle.py. */
+#include <stdlib.h>
+#include <stdio.h>
+#include "pandabase.h"
+#include "zbuffer.h"
+#include "zsimd.h"
+
+/* The vectorized versions of the functions in ztriangle_*.cxx.  These
+   are compiled for avx2 whatever the compiler's target options, so
+   nothing else may be included after zsimd_avx2.h. */
+
+#ifdef ZSIMD_HAVE_AVX2
+#include "zsimd_avx2.h"
+#include "ztriangle_code_avx2.h"
+#endif
+
+#ifdef ZSIMD_CLANG_ATTRIBUTE_PUSHED
+#pragma clang attribute pop
+#endif
+
@@ -0,0 +1,3413 @@
+/* This file is generated code--do not edit.  See ztriangle.py. */
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_anone_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_anone_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_anone_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_anone_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_anone_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_anone_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_aless_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_aless_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_aless_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_aless_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_aless_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_aless_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_amore_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_amore_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_amore_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_amore_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_amore_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cstore_amore_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_anone_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_anone_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_anone_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_anone_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_anone_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_anone_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_aless_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_aless_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_aless_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_aless_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_aless_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_aless_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_amore_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_amore_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_amore_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_amore_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_amore_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cblend_amore_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_anone_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_anone_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_anone_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_anone_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_anone_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_anone_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_aless_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_aless_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_aless_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_aless_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_aless_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_aless_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_amore_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_amore_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_amore_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_amore_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_amore_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_cgeneral_amore_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_anone_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_anone_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_coff_anone_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_anone_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_anone_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_coff_anone_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_aless_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_aless_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_coff_aless_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_aless_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_aless_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_coff_aless_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_amore_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_amore_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_coff_amore_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_amore_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zon_coff_amore_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z) (zpix) = (z)
+#define Z_WRITE 1
+#define STORE_Z_V(pz, mask, z) zv_storeu(pz, zv_select(mask, z, zv_loadu(pz)))
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zon_coff_amore_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_anone_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_anone_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_anone_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_anone_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_anone_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_anone_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_aless_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_aless_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_aless_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_aless_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_aless_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_aless_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_amore_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_amore_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_amore_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_amore_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_amore_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = (rgb)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_storeu(pp, zv_select(mask, rgb, zv_loadu(pp)))
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cstore_amore_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_anone_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_anone_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_anone_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_anone_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_anone_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_anone_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_aless_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_aless_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_aless_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_aless_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_aless_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_aless_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_amore_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_amore_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_amore_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_amore_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_amore_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) (pix) = PIXEL_BLEND_RGB(pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) { zvec old_ = zv_loadu(pp); zv_storeu(pp, zv_select(mask, zv_pixel_blend_rgb(old_, r, g, b, a), old_)); }
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cblend_amore_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_anone_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_anone_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_anone_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_anone_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_anone_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_anone_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_aless_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_aless_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_aless_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_aless_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_aless_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_aless_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_amore_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_amore_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_amore_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_amore_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_amore_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a) zb->store_pix_func(zb, pix, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a) zv_store_pix_general(zb, pp, mask, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_cgeneral_amore_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_anone_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_anone_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_anone_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_anone_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_anone_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) 1
+#define A_TEST 0
+#define ACMP_V(zb, a) zv_ones()
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_anone_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_aless_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_aless_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_aless_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_aless_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_aless_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) < (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmplt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_aless_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_amore_znone_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_amore_znone_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) 1
+#define Z_TEST 0
+#define ZCMP_V(zpix, z) zv_ones()
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_amore_znone_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_NEAREST(texture_def, s, t)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[0], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_amore_zless_tnearest_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ZB_LOOKUP_TEXTURE_MIPMAP_NEAREST(texture_def, s, t, level)
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texel(&(texture_def)->levels[(level)], s, t)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_amore_zless_tmipmap_ ## name
+#include "ztriangle_two.h"
+
+#define STORE_Z(zpix, z)
+#define Z_WRITE 0
+#define STORE_Z_V(pz, mask, z)
+#define STORE_PIX(pix, rgb, r, g, b, a)
+#define STORE_PIX_V(pp, mask, rgb, r, g, b, a)
+#define ACMP(zb, a) (((int)(a)) > (zb)->reference_alpha)
+#define A_TEST 1
+#define ACMP_V(zb, a) zv_cmpgt_s(a, zv_set1((zb)->reference_alpha))
+#define ZCMP(zpix, z) ((ZPOINT)(zpix) < (ZPOINT)(z))
+#define Z_TEST 1
+#define ZCMP_V(zpix, z) zv_cmplt_u(zpix, z)
+#define CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx) DO_CALC_MIPMAP_LEVEL(mipmap_level, mipmap_dx, dsdx, dtdx)
+#define INTERP_MIPMAP
+#define ZB_LOOKUP_TEXTURE(texture_def, s, t, level, level_dx) ((level == 0) ? (texture_def)->tex_magfilter_func(texture_def, s, t, level, level_dx) : (texture_def)->tex_minfilter_func(texture_def, s, t, level, level_dx))
+#define ZB_LOOKUP_TEXTURE_V(texture_def, s, t, level, level_dx) zv_lookup_texture_general(texture_def, s, t, level, level_dx)
+#define FNAME(name) FB_triangle_sse2_zoff_coff_amore_zless_tgeneral_ ## name
+#include "ztriangle_two.h"
+
+
+ZB_fillTriangleFunc ztriangle_code_sse2[864] = {
+  FB_triangle_sse2_zon_cstore_anone_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_anone_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_anone_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_aless_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_aless_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_amore_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cstore_amore_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_anone_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_anone_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_aless_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_aless_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_amore_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cblend_amore_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_anone_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_aless_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_cgeneral_amore_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_coff_anone_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_coff_anone_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_coff_anone_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_coff_anone_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_coff_anone_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_coff_anone_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_coff_anone_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_coff_anone_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_coff_anone_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_coff_anone_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_coff_anone_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_coff_anone_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_coff_anone_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_coff_anone_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_coff_anone_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_coff_anone_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_coff_anone_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_coff_anone_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_coff_anone_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_coff_anone_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_coff_anone_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_coff_anone_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_coff_anone_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_coff_anone_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_coff_anone_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_coff_anone_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_coff_anone_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_coff_anone_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_coff_anone_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_coff_anone_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_coff_anone_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_coff_anone_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_coff_anone_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_coff_anone_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_coff_anone_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_coff_anone_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_coff_aless_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_coff_aless_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_coff_aless_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_coff_aless_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_coff_aless_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_coff_aless_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_coff_aless_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_coff_aless_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_coff_aless_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_coff_aless_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_coff_aless_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_coff_aless_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_coff_aless_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_coff_aless_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_coff_aless_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_coff_aless_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_coff_aless_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_coff_aless_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_coff_aless_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_coff_aless_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_coff_aless_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_coff_aless_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_coff_aless_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_coff_aless_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_coff_aless_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_coff_aless_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_coff_aless_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_coff_aless_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_coff_aless_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_coff_aless_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_coff_aless_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_coff_aless_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_coff_aless_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_coff_aless_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_coff_aless_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_coff_aless_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_coff_amore_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zon_coff_amore_znone_tnearest_white_textured,
+  FB_triangle_sse2_zon_coff_amore_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_coff_amore_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zon_coff_amore_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_coff_amore_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_coff_amore_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_coff_amore_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zon_coff_amore_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_coff_amore_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_coff_amore_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_coff_amore_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_coff_amore_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_coff_amore_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zon_coff_amore_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_coff_amore_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_coff_amore_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_coff_amore_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zon_coff_amore_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zon_coff_amore_zless_tnearest_white_textured,
+  FB_triangle_sse2_zon_coff_amore_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zon_coff_amore_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zon_coff_amore_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zon_coff_amore_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zon_coff_amore_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zon_coff_amore_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zon_coff_amore_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zon_coff_amore_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zon_coff_amore_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zon_coff_amore_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zon_coff_amore_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zon_coff_amore_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zon_coff_amore_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zon_coff_amore_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zon_coff_amore_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zon_coff_amore_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_anone_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_aless_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cstore_amore_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_anone_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_aless_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cblend_amore_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_anone_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_aless_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_cgeneral_amore_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_anone_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_anone_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_aless_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_aless_zless_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tnearest_white_textured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_amore_znone_tgeneral_smooth_textured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tnearest_white_untextured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tnearest_white_textured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tnearest_flat_untextured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tnearest_flat_textured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tnearest_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tnearest_smooth_textured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tmipmap_white_untextured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tmipmap_white_textured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tmipmap_flat_untextured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tmipmap_flat_textured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tmipmap_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tmipmap_smooth_textured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tgeneral_white_untextured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tgeneral_white_textured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tgeneral_flat_untextured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tgeneral_flat_textured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tgeneral_smooth_untextured,
+  FB_triangle_sse2_zoff_coff_amore_zless_tgeneral_smooth_textured,
+};
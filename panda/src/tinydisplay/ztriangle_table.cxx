@@ -3487,3 +3487,6969 @@ const ZB_fillTriangleFunc fill_tri_funcs[2][4][3][2][3][3][5] = {
     }
   }
 };
+
+#ifdef ZSIMD_HAVE_SSE2
+extern ZB_fillTriangleFunc ztriangle_code_sse2[];
+
+const ZB_fillTriangleFunc fill_tri_funcs_sse2[2][4][3][2][3][3][5] = {
+  {
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[0],
+              ztriangle_code_sse2[1],
+              ztriangle_code_1[2],
+              ztriangle_code_1[13],
+              ztriangle_code_1[14]
+            },
+            {
+              ztriangle_code_sse2[2],
+              ztriangle_code_sse2[3],
+              ztriangle_code_1[7],
+              ztriangle_code_1[13],
+              ztriangle_code_1[14]
+            },
+            {
+              ztriangle_code_sse2[4],
+              ztriangle_code_sse2[5],
+              ztriangle_code_1[12],
+              ztriangle_code_1[13],
+              ztriangle_code_1[14]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[6],
+              ztriangle_code_sse2[7],
+              ztriangle_code_1[17],
+              ztriangle_code_1[28],
+              ztriangle_code_1[29]
+            },
+            {
+              ztriangle_code_sse2[8],
+              ztriangle_code_sse2[9],
+              ztriangle_code_1[22],
+              ztriangle_code_1[28],
+              ztriangle_code_1[29]
+            },
+            {
+              ztriangle_code_sse2[10],
+              ztriangle_code_sse2[11],
+              ztriangle_code_1[27],
+              ztriangle_code_1[28],
+              ztriangle_code_1[29]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[12],
+              ztriangle_code_sse2[13],
+              ztriangle_code_1[32],
+              ztriangle_code_1[43],
+              ztriangle_code_1[44]
+            },
+            {
+              ztriangle_code_sse2[14],
+              ztriangle_code_sse2[15],
+              ztriangle_code_1[37],
+              ztriangle_code_1[43],
+              ztriangle_code_1[44]
+            },
+            {
+              ztriangle_code_sse2[16],
+              ztriangle_code_sse2[17],
+              ztriangle_code_1[42],
+              ztriangle_code_1[43],
+              ztriangle_code_1[44]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[18],
+              ztriangle_code_sse2[19],
+              ztriangle_code_1[47],
+              ztriangle_code_1[58],
+              ztriangle_code_1[59]
+            },
+            {
+              ztriangle_code_sse2[20],
+              ztriangle_code_sse2[21],
+              ztriangle_code_1[52],
+              ztriangle_code_1[58],
+              ztriangle_code_1[59]
+            },
+            {
+              ztriangle_code_sse2[22],
+              ztriangle_code_sse2[23],
+              ztriangle_code_1[57],
+              ztriangle_code_1[58],
+              ztriangle_code_1[59]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[24],
+              ztriangle_code_sse2[25],
+              ztriangle_code_1[62],
+              ztriangle_code_1[73],
+              ztriangle_code_1[74]
+            },
+            {
+              ztriangle_code_sse2[26],
+              ztriangle_code_sse2[27],
+              ztriangle_code_1[67],
+              ztriangle_code_1[73],
+              ztriangle_code_1[74]
+            },
+            {
+              ztriangle_code_sse2[28],
+              ztriangle_code_sse2[29],
+              ztriangle_code_1[72],
+              ztriangle_code_1[73],
+              ztriangle_code_1[74]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[30],
+              ztriangle_code_sse2[31],
+              ztriangle_code_1[77],
+              ztriangle_code_1[88],
+              ztriangle_code_1[89]
+            },
+            {
+              ztriangle_code_sse2[32],
+              ztriangle_code_sse2[33],
+              ztriangle_code_1[82],
+              ztriangle_code_1[88],
+              ztriangle_code_1[89]
+            },
+            {
+              ztriangle_code_sse2[34],
+              ztriangle_code_sse2[35],
+              ztriangle_code_1[87],
+              ztriangle_code_1[88],
+              ztriangle_code_1[89]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[36],
+              ztriangle_code_sse2[37],
+              ztriangle_code_1[92],
+              ztriangle_code_1[103],
+              ztriangle_code_1[104]
+            },
+            {
+              ztriangle_code_sse2[38],
+              ztriangle_code_sse2[39],
+              ztriangle_code_1[97],
+              ztriangle_code_1[103],
+              ztriangle_code_1[104]
+            },
+            {
+              ztriangle_code_sse2[40],
+              ztriangle_code_sse2[41],
+              ztriangle_code_1[102],
+              ztriangle_code_1[103],
+              ztriangle_code_1[104]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[42],
+              ztriangle_code_sse2[43],
+              ztriangle_code_1[107],
+              ztriangle_code_1[118],
+              ztriangle_code_1[119]
+            },
+            {
+              ztriangle_code_sse2[44],
+              ztriangle_code_sse2[45],
+              ztriangle_code_1[112],
+              ztriangle_code_1[118],
+              ztriangle_code_1[119]
+            },
+            {
+              ztriangle_code_sse2[46],
+              ztriangle_code_sse2[47],
+              ztriangle_code_1[117],
+              ztriangle_code_1[118],
+              ztriangle_code_1[119]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[48],
+              ztriangle_code_sse2[49],
+              ztriangle_code_1[122],
+              ztriangle_code_1[133],
+              ztriangle_code_1[134]
+            },
+            {
+              ztriangle_code_sse2[50],
+              ztriangle_code_sse2[51],
+              ztriangle_code_1[127],
+              ztriangle_code_1[133],
+              ztriangle_code_1[134]
+            },
+            {
+              ztriangle_code_sse2[52],
+              ztriangle_code_sse2[53],
+              ztriangle_code_1[132],
+              ztriangle_code_1[133],
+              ztriangle_code_1[134]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[54],
+              ztriangle_code_sse2[55],
+              ztriangle_code_1[137],
+              ztriangle_code_1[148],
+              ztriangle_code_1[149]
+            },
+            {
+              ztriangle_code_sse2[56],
+              ztriangle_code_sse2[57],
+              ztriangle_code_1[142],
+              ztriangle_code_1[148],
+              ztriangle_code_1[149]
+            },
+            {
+              ztriangle_code_sse2[58],
+              ztriangle_code_sse2[59],
+              ztriangle_code_1[147],
+              ztriangle_code_1[148],
+              ztriangle_code_1[149]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[60],
+              ztriangle_code_sse2[61],
+              ztriangle_code_1[152],
+              ztriangle_code_1[163],
+              ztriangle_code_1[164]
+            },
+            {
+              ztriangle_code_sse2[62],
+              ztriangle_code_sse2[63],
+              ztriangle_code_1[157],
+              ztriangle_code_1[163],
+              ztriangle_code_1[164]
+            },
+            {
+              ztriangle_code_sse2[64],
+              ztriangle_code_sse2[65],
+              ztriangle_code_1[162],
+              ztriangle_code_1[163],
+              ztriangle_code_1[164]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[66],
+              ztriangle_code_sse2[67],
+              ztriangle_code_1[167],
+              ztriangle_code_1[178],
+              ztriangle_code_1[179]
+            },
+            {
+              ztriangle_code_sse2[68],
+              ztriangle_code_sse2[69],
+              ztriangle_code_1[172],
+              ztriangle_code_1[178],
+              ztriangle_code_1[179]
+            },
+            {
+              ztriangle_code_sse2[70],
+              ztriangle_code_sse2[71],
+              ztriangle_code_1[177],
+              ztriangle_code_1[178],
+              ztriangle_code_1[179]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[72],
+              ztriangle_code_sse2[73],
+              ztriangle_code_1[182],
+              ztriangle_code_1[193],
+              ztriangle_code_1[194]
+            },
+            {
+              ztriangle_code_sse2[74],
+              ztriangle_code_sse2[75],
+              ztriangle_code_1[187],
+              ztriangle_code_1[193],
+              ztriangle_code_1[194]
+            },
+            {
+              ztriangle_code_sse2[76],
+              ztriangle_code_sse2[77],
+              ztriangle_code_1[192],
+              ztriangle_code_1[193],
+              ztriangle_code_1[194]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[78],
+              ztriangle_code_sse2[79],
+              ztriangle_code_1[197],
+              ztriangle_code_1[208],
+              ztriangle_code_1[209]
+            },
+            {
+              ztriangle_code_sse2[80],
+              ztriangle_code_sse2[81],
+              ztriangle_code_1[202],
+              ztriangle_code_1[208],
+              ztriangle_code_1[209]
+            },
+            {
+              ztriangle_code_sse2[82],
+              ztriangle_code_sse2[83],
+              ztriangle_code_1[207],
+              ztriangle_code_1[208],
+              ztriangle_code_1[209]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[84],
+              ztriangle_code_sse2[85],
+              ztriangle_code_1[212],
+              ztriangle_code_1[223],
+              ztriangle_code_1[224]
+            },
+            {
+              ztriangle_code_sse2[86],
+              ztriangle_code_sse2[87],
+              ztriangle_code_1[217],
+              ztriangle_code_1[223],
+              ztriangle_code_1[224]
+            },
+            {
+              ztriangle_code_sse2[88],
+              ztriangle_code_sse2[89],
+              ztriangle_code_1[222],
+              ztriangle_code_1[223],
+              ztriangle_code_1[224]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[90],
+              ztriangle_code_sse2[91],
+              ztriangle_code_1[227],
+              ztriangle_code_1[238],
+              ztriangle_code_1[239]
+            },
+            {
+              ztriangle_code_sse2[92],
+              ztriangle_code_sse2[93],
+              ztriangle_code_1[232],
+              ztriangle_code_1[238],
+              ztriangle_code_1[239]
+            },
+            {
+              ztriangle_code_sse2[94],
+              ztriangle_code_sse2[95],
+              ztriangle_code_1[237],
+              ztriangle_code_1[238],
+              ztriangle_code_1[239]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[96],
+              ztriangle_code_sse2[97],
+              ztriangle_code_1[242],
+              ztriangle_code_1[253],
+              ztriangle_code_1[254]
+            },
+            {
+              ztriangle_code_sse2[98],
+              ztriangle_code_sse2[99],
+              ztriangle_code_1[247],
+              ztriangle_code_1[253],
+              ztriangle_code_1[254]
+            },
+            {
+              ztriangle_code_sse2[100],
+              ztriangle_code_sse2[101],
+              ztriangle_code_1[252],
+              ztriangle_code_1[253],
+              ztriangle_code_1[254]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[102],
+              ztriangle_code_sse2[103],
+              ztriangle_code_1[257],
+              ztriangle_code_1[268],
+              ztriangle_code_1[269]
+            },
+            {
+              ztriangle_code_sse2[104],
+              ztriangle_code_sse2[105],
+              ztriangle_code_1[262],
+              ztriangle_code_1[268],
+              ztriangle_code_1[269]
+            },
+            {
+              ztriangle_code_sse2[106],
+              ztriangle_code_sse2[107],
+              ztriangle_code_1[267],
+              ztriangle_code_1[268],
+              ztriangle_code_1[269]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[108],
+              ztriangle_code_sse2[109],
+              ztriangle_code_1[272],
+              ztriangle_code_1[283],
+              ztriangle_code_1[284]
+            },
+            {
+              ztriangle_code_sse2[110],
+              ztriangle_code_sse2[111],
+              ztriangle_code_1[277],
+              ztriangle_code_1[283],
+              ztriangle_code_1[284]
+            },
+            {
+              ztriangle_code_sse2[112],
+              ztriangle_code_sse2[113],
+              ztriangle_code_1[282],
+              ztriangle_code_1[283],
+              ztriangle_code_1[284]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[114],
+              ztriangle_code_sse2[115],
+              ztriangle_code_1[287],
+              ztriangle_code_1[298],
+              ztriangle_code_1[299]
+            },
+            {
+              ztriangle_code_sse2[116],
+              ztriangle_code_sse2[117],
+              ztriangle_code_1[292],
+              ztriangle_code_1[298],
+              ztriangle_code_1[299]
+            },
+            {
+              ztriangle_code_sse2[118],
+              ztriangle_code_sse2[119],
+              ztriangle_code_1[297],
+              ztriangle_code_1[298],
+              ztriangle_code_1[299]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[120],
+              ztriangle_code_sse2[121],
+              ztriangle_code_1[302],
+              ztriangle_code_1[313],
+              ztriangle_code_1[314]
+            },
+            {
+              ztriangle_code_sse2[122],
+              ztriangle_code_sse2[123],
+              ztriangle_code_1[307],
+              ztriangle_code_1[313],
+              ztriangle_code_1[314]
+            },
+            {
+              ztriangle_code_sse2[124],
+              ztriangle_code_sse2[125],
+              ztriangle_code_1[312],
+              ztriangle_code_1[313],
+              ztriangle_code_1[314]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[126],
+              ztriangle_code_sse2[127],
+              ztriangle_code_1[317],
+              ztriangle_code_1[328],
+              ztriangle_code_1[329]
+            },
+            {
+              ztriangle_code_sse2[128],
+              ztriangle_code_sse2[129],
+              ztriangle_code_1[322],
+              ztriangle_code_1[328],
+              ztriangle_code_1[329]
+            },
+            {
+              ztriangle_code_sse2[130],
+              ztriangle_code_sse2[131],
+              ztriangle_code_1[327],
+              ztriangle_code_1[328],
+              ztriangle_code_1[329]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[132],
+              ztriangle_code_sse2[133],
+              ztriangle_code_1[332],
+              ztriangle_code_1[343],
+              ztriangle_code_1[344]
+            },
+            {
+              ztriangle_code_sse2[134],
+              ztriangle_code_sse2[135],
+              ztriangle_code_1[337],
+              ztriangle_code_1[343],
+              ztriangle_code_1[344]
+            },
+            {
+              ztriangle_code_sse2[136],
+              ztriangle_code_sse2[137],
+              ztriangle_code_1[342],
+              ztriangle_code_1[343],
+              ztriangle_code_1[344]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[138],
+              ztriangle_code_sse2[139],
+              ztriangle_code_1[347],
+              ztriangle_code_1[358],
+              ztriangle_code_1[359]
+            },
+            {
+              ztriangle_code_sse2[140],
+              ztriangle_code_sse2[141],
+              ztriangle_code_1[352],
+              ztriangle_code_1[358],
+              ztriangle_code_1[359]
+            },
+            {
+              ztriangle_code_sse2[142],
+              ztriangle_code_sse2[143],
+              ztriangle_code_1[357],
+              ztriangle_code_1[358],
+              ztriangle_code_1[359]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[144],
+              ztriangle_code_sse2[145],
+              ztriangle_code_1[362],
+              ztriangle_code_1[373],
+              ztriangle_code_1[374]
+            },
+            {
+              ztriangle_code_sse2[146],
+              ztriangle_code_sse2[147],
+              ztriangle_code_1[367],
+              ztriangle_code_1[373],
+              ztriangle_code_1[374]
+            },
+            {
+              ztriangle_code_sse2[148],
+              ztriangle_code_sse2[149],
+              ztriangle_code_1[372],
+              ztriangle_code_1[373],
+              ztriangle_code_1[374]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[150],
+              ztriangle_code_sse2[151],
+              ztriangle_code_1[377],
+              ztriangle_code_1[388],
+              ztriangle_code_1[389]
+            },
+            {
+              ztriangle_code_sse2[152],
+              ztriangle_code_sse2[153],
+              ztriangle_code_1[382],
+              ztriangle_code_1[388],
+              ztriangle_code_1[389]
+            },
+            {
+              ztriangle_code_sse2[154],
+              ztriangle_code_sse2[155],
+              ztriangle_code_1[387],
+              ztriangle_code_1[388],
+              ztriangle_code_1[389]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[156],
+              ztriangle_code_sse2[157],
+              ztriangle_code_1[392],
+              ztriangle_code_1[403],
+              ztriangle_code_1[404]
+            },
+            {
+              ztriangle_code_sse2[158],
+              ztriangle_code_sse2[159],
+              ztriangle_code_1[397],
+              ztriangle_code_1[403],
+              ztriangle_code_1[404]
+            },
+            {
+              ztriangle_code_sse2[160],
+              ztriangle_code_sse2[161],
+              ztriangle_code_1[402],
+              ztriangle_code_1[403],
+              ztriangle_code_1[404]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[162],
+              ztriangle_code_sse2[163],
+              ztriangle_code_1[407],
+              ztriangle_code_1[418],
+              ztriangle_code_1[419]
+            },
+            {
+              ztriangle_code_sse2[164],
+              ztriangle_code_sse2[165],
+              ztriangle_code_1[412],
+              ztriangle_code_1[418],
+              ztriangle_code_1[419]
+            },
+            {
+              ztriangle_code_sse2[166],
+              ztriangle_code_sse2[167],
+              ztriangle_code_1[417],
+              ztriangle_code_1[418],
+              ztriangle_code_1[419]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[168],
+              ztriangle_code_sse2[169],
+              ztriangle_code_1[422],
+              ztriangle_code_1[433],
+              ztriangle_code_1[434]
+            },
+            {
+              ztriangle_code_sse2[170],
+              ztriangle_code_sse2[171],
+              ztriangle_code_1[427],
+              ztriangle_code_1[433],
+              ztriangle_code_1[434]
+            },
+            {
+              ztriangle_code_sse2[172],
+              ztriangle_code_sse2[173],
+              ztriangle_code_1[432],
+              ztriangle_code_1[433],
+              ztriangle_code_1[434]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[174],
+              ztriangle_code_sse2[175],
+              ztriangle_code_1[437],
+              ztriangle_code_1[448],
+              ztriangle_code_1[449]
+            },
+            {
+              ztriangle_code_sse2[176],
+              ztriangle_code_sse2[177],
+              ztriangle_code_1[442],
+              ztriangle_code_1[448],
+              ztriangle_code_1[449]
+            },
+            {
+              ztriangle_code_sse2[178],
+              ztriangle_code_sse2[179],
+              ztriangle_code_1[447],
+              ztriangle_code_1[448],
+              ztriangle_code_1[449]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[180],
+              ztriangle_code_sse2[181],
+              ztriangle_code_1[452],
+              ztriangle_code_1[463],
+              ztriangle_code_1[464]
+            },
+            {
+              ztriangle_code_sse2[182],
+              ztriangle_code_sse2[183],
+              ztriangle_code_1[457],
+              ztriangle_code_1[463],
+              ztriangle_code_1[464]
+            },
+            {
+              ztriangle_code_sse2[184],
+              ztriangle_code_sse2[185],
+              ztriangle_code_1[462],
+              ztriangle_code_1[463],
+              ztriangle_code_1[464]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[186],
+              ztriangle_code_sse2[187],
+              ztriangle_code_1[467],
+              ztriangle_code_1[478],
+              ztriangle_code_1[479]
+            },
+            {
+              ztriangle_code_sse2[188],
+              ztriangle_code_sse2[189],
+              ztriangle_code_1[472],
+              ztriangle_code_1[478],
+              ztriangle_code_1[479]
+            },
+            {
+              ztriangle_code_sse2[190],
+              ztriangle_code_sse2[191],
+              ztriangle_code_1[477],
+              ztriangle_code_1[478],
+              ztriangle_code_1[479]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[192],
+              ztriangle_code_sse2[193],
+              ztriangle_code_1[482],
+              ztriangle_code_1[493],
+              ztriangle_code_1[494]
+            },
+            {
+              ztriangle_code_sse2[194],
+              ztriangle_code_sse2[195],
+              ztriangle_code_1[487],
+              ztriangle_code_1[493],
+              ztriangle_code_1[494]
+            },
+            {
+              ztriangle_code_sse2[196],
+              ztriangle_code_sse2[197],
+              ztriangle_code_1[492],
+              ztriangle_code_1[493],
+              ztriangle_code_1[494]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[198],
+              ztriangle_code_sse2[199],
+              ztriangle_code_1[497],
+              ztriangle_code_1[508],
+              ztriangle_code_1[509]
+            },
+            {
+              ztriangle_code_sse2[200],
+              ztriangle_code_sse2[201],
+              ztriangle_code_1[502],
+              ztriangle_code_1[508],
+              ztriangle_code_1[509]
+            },
+            {
+              ztriangle_code_sse2[202],
+              ztriangle_code_sse2[203],
+              ztriangle_code_1[507],
+              ztriangle_code_1[508],
+              ztriangle_code_1[509]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[204],
+              ztriangle_code_sse2[205],
+              ztriangle_code_1[512],
+              ztriangle_code_1[523],
+              ztriangle_code_1[524]
+            },
+            {
+              ztriangle_code_sse2[206],
+              ztriangle_code_sse2[207],
+              ztriangle_code_1[517],
+              ztriangle_code_1[523],
+              ztriangle_code_1[524]
+            },
+            {
+              ztriangle_code_sse2[208],
+              ztriangle_code_sse2[209],
+              ztriangle_code_1[522],
+              ztriangle_code_1[523],
+              ztriangle_code_1[524]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[210],
+              ztriangle_code_sse2[211],
+              ztriangle_code_1[527],
+              ztriangle_code_1[538],
+              ztriangle_code_1[539]
+            },
+            {
+              ztriangle_code_sse2[212],
+              ztriangle_code_sse2[213],
+              ztriangle_code_1[532],
+              ztriangle_code_1[538],
+              ztriangle_code_1[539]
+            },
+            {
+              ztriangle_code_sse2[214],
+              ztriangle_code_sse2[215],
+              ztriangle_code_1[537],
+              ztriangle_code_1[538],
+              ztriangle_code_1[539]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[216],
+              ztriangle_code_sse2[217],
+              ztriangle_code_2[2],
+              ztriangle_code_2[13],
+              ztriangle_code_2[14]
+            },
+            {
+              ztriangle_code_sse2[218],
+              ztriangle_code_sse2[219],
+              ztriangle_code_2[7],
+              ztriangle_code_2[13],
+              ztriangle_code_2[14]
+            },
+            {
+              ztriangle_code_sse2[220],
+              ztriangle_code_sse2[221],
+              ztriangle_code_2[12],
+              ztriangle_code_2[13],
+              ztriangle_code_2[14]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[222],
+              ztriangle_code_sse2[223],
+              ztriangle_code_2[17],
+              ztriangle_code_2[28],
+              ztriangle_code_2[29]
+            },
+            {
+              ztriangle_code_sse2[224],
+              ztriangle_code_sse2[225],
+              ztriangle_code_2[22],
+              ztriangle_code_2[28],
+              ztriangle_code_2[29]
+            },
+            {
+              ztriangle_code_sse2[226],
+              ztriangle_code_sse2[227],
+              ztriangle_code_2[27],
+              ztriangle_code_2[28],
+              ztriangle_code_2[29]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[228],
+              ztriangle_code_sse2[229],
+              ztriangle_code_2[32],
+              ztriangle_code_2[43],
+              ztriangle_code_2[44]
+            },
+            {
+              ztriangle_code_sse2[230],
+              ztriangle_code_sse2[231],
+              ztriangle_code_2[37],
+              ztriangle_code_2[43],
+              ztriangle_code_2[44]
+            },
+            {
+              ztriangle_code_sse2[232],
+              ztriangle_code_sse2[233],
+              ztriangle_code_2[42],
+              ztriangle_code_2[43],
+              ztriangle_code_2[44]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[234],
+              ztriangle_code_sse2[235],
+              ztriangle_code_2[47],
+              ztriangle_code_2[58],
+              ztriangle_code_2[59]
+            },
+            {
+              ztriangle_code_sse2[236],
+              ztriangle_code_sse2[237],
+              ztriangle_code_2[52],
+              ztriangle_code_2[58],
+              ztriangle_code_2[59]
+            },
+            {
+              ztriangle_code_sse2[238],
+              ztriangle_code_sse2[239],
+              ztriangle_code_2[57],
+              ztriangle_code_2[58],
+              ztriangle_code_2[59]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[240],
+              ztriangle_code_sse2[241],
+              ztriangle_code_2[62],
+              ztriangle_code_2[73],
+              ztriangle_code_2[74]
+            },
+            {
+              ztriangle_code_sse2[242],
+              ztriangle_code_sse2[243],
+              ztriangle_code_2[67],
+              ztriangle_code_2[73],
+              ztriangle_code_2[74]
+            },
+            {
+              ztriangle_code_sse2[244],
+              ztriangle_code_sse2[245],
+              ztriangle_code_2[72],
+              ztriangle_code_2[73],
+              ztriangle_code_2[74]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[246],
+              ztriangle_code_sse2[247],
+              ztriangle_code_2[77],
+              ztriangle_code_2[88],
+              ztriangle_code_2[89]
+            },
+            {
+              ztriangle_code_sse2[248],
+              ztriangle_code_sse2[249],
+              ztriangle_code_2[82],
+              ztriangle_code_2[88],
+              ztriangle_code_2[89]
+            },
+            {
+              ztriangle_code_sse2[250],
+              ztriangle_code_sse2[251],
+              ztriangle_code_2[87],
+              ztriangle_code_2[88],
+              ztriangle_code_2[89]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[252],
+              ztriangle_code_sse2[253],
+              ztriangle_code_2[92],
+              ztriangle_code_2[103],
+              ztriangle_code_2[104]
+            },
+            {
+              ztriangle_code_sse2[254],
+              ztriangle_code_sse2[255],
+              ztriangle_code_2[97],
+              ztriangle_code_2[103],
+              ztriangle_code_2[104]
+            },
+            {
+              ztriangle_code_sse2[256],
+              ztriangle_code_sse2[257],
+              ztriangle_code_2[102],
+              ztriangle_code_2[103],
+              ztriangle_code_2[104]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[258],
+              ztriangle_code_sse2[259],
+              ztriangle_code_2[107],
+              ztriangle_code_2[118],
+              ztriangle_code_2[119]
+            },
+            {
+              ztriangle_code_sse2[260],
+              ztriangle_code_sse2[261],
+              ztriangle_code_2[112],
+              ztriangle_code_2[118],
+              ztriangle_code_2[119]
+            },
+            {
+              ztriangle_code_sse2[262],
+              ztriangle_code_sse2[263],
+              ztriangle_code_2[117],
+              ztriangle_code_2[118],
+              ztriangle_code_2[119]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[264],
+              ztriangle_code_sse2[265],
+              ztriangle_code_2[122],
+              ztriangle_code_2[133],
+              ztriangle_code_2[134]
+            },
+            {
+              ztriangle_code_sse2[266],
+              ztriangle_code_sse2[267],
+              ztriangle_code_2[127],
+              ztriangle_code_2[133],
+              ztriangle_code_2[134]
+            },
+            {
+              ztriangle_code_sse2[268],
+              ztriangle_code_sse2[269],
+              ztriangle_code_2[132],
+              ztriangle_code_2[133],
+              ztriangle_code_2[134]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[270],
+              ztriangle_code_sse2[271],
+              ztriangle_code_2[137],
+              ztriangle_code_2[148],
+              ztriangle_code_2[149]
+            },
+            {
+              ztriangle_code_sse2[272],
+              ztriangle_code_sse2[273],
+              ztriangle_code_2[142],
+              ztriangle_code_2[148],
+              ztriangle_code_2[149]
+            },
+            {
+              ztriangle_code_sse2[274],
+              ztriangle_code_sse2[275],
+              ztriangle_code_2[147],
+              ztriangle_code_2[148],
+              ztriangle_code_2[149]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[276],
+              ztriangle_code_sse2[277],
+              ztriangle_code_2[152],
+              ztriangle_code_2[163],
+              ztriangle_code_2[164]
+            },
+            {
+              ztriangle_code_sse2[278],
+              ztriangle_code_sse2[279],
+              ztriangle_code_2[157],
+              ztriangle_code_2[163],
+              ztriangle_code_2[164]
+            },
+            {
+              ztriangle_code_sse2[280],
+              ztriangle_code_sse2[281],
+              ztriangle_code_2[162],
+              ztriangle_code_2[163],
+              ztriangle_code_2[164]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[282],
+              ztriangle_code_sse2[283],
+              ztriangle_code_2[167],
+              ztriangle_code_2[178],
+              ztriangle_code_2[179]
+            },
+            {
+              ztriangle_code_sse2[284],
+              ztriangle_code_sse2[285],
+              ztriangle_code_2[172],
+              ztriangle_code_2[178],
+              ztriangle_code_2[179]
+            },
+            {
+              ztriangle_code_sse2[286],
+              ztriangle_code_sse2[287],
+              ztriangle_code_2[177],
+              ztriangle_code_2[178],
+              ztriangle_code_2[179]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[288],
+              ztriangle_code_sse2[289],
+              ztriangle_code_2[182],
+              ztriangle_code_2[193],
+              ztriangle_code_2[194]
+            },
+            {
+              ztriangle_code_sse2[290],
+              ztriangle_code_sse2[291],
+              ztriangle_code_2[187],
+              ztriangle_code_2[193],
+              ztriangle_code_2[194]
+            },
+            {
+              ztriangle_code_sse2[292],
+              ztriangle_code_sse2[293],
+              ztriangle_code_2[192],
+              ztriangle_code_2[193],
+              ztriangle_code_2[194]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[294],
+              ztriangle_code_sse2[295],
+              ztriangle_code_2[197],
+              ztriangle_code_2[208],
+              ztriangle_code_2[209]
+            },
+            {
+              ztriangle_code_sse2[296],
+              ztriangle_code_sse2[297],
+              ztriangle_code_2[202],
+              ztriangle_code_2[208],
+              ztriangle_code_2[209]
+            },
+            {
+              ztriangle_code_sse2[298],
+              ztriangle_code_sse2[299],
+              ztriangle_code_2[207],
+              ztriangle_code_2[208],
+              ztriangle_code_2[209]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[300],
+              ztriangle_code_sse2[301],
+              ztriangle_code_2[212],
+              ztriangle_code_2[223],
+              ztriangle_code_2[224]
+            },
+            {
+              ztriangle_code_sse2[302],
+              ztriangle_code_sse2[303],
+              ztriangle_code_2[217],
+              ztriangle_code_2[223],
+              ztriangle_code_2[224]
+            },
+            {
+              ztriangle_code_sse2[304],
+              ztriangle_code_sse2[305],
+              ztriangle_code_2[222],
+              ztriangle_code_2[223],
+              ztriangle_code_2[224]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[306],
+              ztriangle_code_sse2[307],
+              ztriangle_code_2[227],
+              ztriangle_code_2[238],
+              ztriangle_code_2[239]
+            },
+            {
+              ztriangle_code_sse2[308],
+              ztriangle_code_sse2[309],
+              ztriangle_code_2[232],
+              ztriangle_code_2[238],
+              ztriangle_code_2[239]
+            },
+            {
+              ztriangle_code_sse2[310],
+              ztriangle_code_sse2[311],
+              ztriangle_code_2[237],
+              ztriangle_code_2[238],
+              ztriangle_code_2[239]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[312],
+              ztriangle_code_sse2[313],
+              ztriangle_code_2[242],
+              ztriangle_code_2[253],
+              ztriangle_code_2[254]
+            },
+            {
+              ztriangle_code_sse2[314],
+              ztriangle_code_sse2[315],
+              ztriangle_code_2[247],
+              ztriangle_code_2[253],
+              ztriangle_code_2[254]
+            },
+            {
+              ztriangle_code_sse2[316],
+              ztriangle_code_sse2[317],
+              ztriangle_code_2[252],
+              ztriangle_code_2[253],
+              ztriangle_code_2[254]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[318],
+              ztriangle_code_sse2[319],
+              ztriangle_code_2[257],
+              ztriangle_code_2[268],
+              ztriangle_code_2[269]
+            },
+            {
+              ztriangle_code_sse2[320],
+              ztriangle_code_sse2[321],
+              ztriangle_code_2[262],
+              ztriangle_code_2[268],
+              ztriangle_code_2[269]
+            },
+            {
+              ztriangle_code_sse2[322],
+              ztriangle_code_sse2[323],
+              ztriangle_code_2[267],
+              ztriangle_code_2[268],
+              ztriangle_code_2[269]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[324],
+              ztriangle_code_sse2[325],
+              ztriangle_code_2[272],
+              ztriangle_code_2[283],
+              ztriangle_code_2[284]
+            },
+            {
+              ztriangle_code_sse2[326],
+              ztriangle_code_sse2[327],
+              ztriangle_code_2[277],
+              ztriangle_code_2[283],
+              ztriangle_code_2[284]
+            },
+            {
+              ztriangle_code_sse2[328],
+              ztriangle_code_sse2[329],
+              ztriangle_code_2[282],
+              ztriangle_code_2[283],
+              ztriangle_code_2[284]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[330],
+              ztriangle_code_sse2[331],
+              ztriangle_code_2[287],
+              ztriangle_code_2[298],
+              ztriangle_code_2[299]
+            },
+            {
+              ztriangle_code_sse2[332],
+              ztriangle_code_sse2[333],
+              ztriangle_code_2[292],
+              ztriangle_code_2[298],
+              ztriangle_code_2[299]
+            },
+            {
+              ztriangle_code_sse2[334],
+              ztriangle_code_sse2[335],
+              ztriangle_code_2[297],
+              ztriangle_code_2[298],
+              ztriangle_code_2[299]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[336],
+              ztriangle_code_sse2[337],
+              ztriangle_code_2[302],
+              ztriangle_code_2[313],
+              ztriangle_code_2[314]
+            },
+            {
+              ztriangle_code_sse2[338],
+              ztriangle_code_sse2[339],
+              ztriangle_code_2[307],
+              ztriangle_code_2[313],
+              ztriangle_code_2[314]
+            },
+            {
+              ztriangle_code_sse2[340],
+              ztriangle_code_sse2[341],
+              ztriangle_code_2[312],
+              ztriangle_code_2[313],
+              ztriangle_code_2[314]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[342],
+              ztriangle_code_sse2[343],
+              ztriangle_code_2[317],
+              ztriangle_code_2[328],
+              ztriangle_code_2[329]
+            },
+            {
+              ztriangle_code_sse2[344],
+              ztriangle_code_sse2[345],
+              ztriangle_code_2[322],
+              ztriangle_code_2[328],
+              ztriangle_code_2[329]
+            },
+            {
+              ztriangle_code_sse2[346],
+              ztriangle_code_sse2[347],
+              ztriangle_code_2[327],
+              ztriangle_code_2[328],
+              ztriangle_code_2[329]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[348],
+              ztriangle_code_sse2[349],
+              ztriangle_code_2[332],
+              ztriangle_code_2[343],
+              ztriangle_code_2[344]
+            },
+            {
+              ztriangle_code_sse2[350],
+              ztriangle_code_sse2[351],
+              ztriangle_code_2[337],
+              ztriangle_code_2[343],
+              ztriangle_code_2[344]
+            },
+            {
+              ztriangle_code_sse2[352],
+              ztriangle_code_sse2[353],
+              ztriangle_code_2[342],
+              ztriangle_code_2[343],
+              ztriangle_code_2[344]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[354],
+              ztriangle_code_sse2[355],
+              ztriangle_code_2[347],
+              ztriangle_code_2[358],
+              ztriangle_code_2[359]
+            },
+            {
+              ztriangle_code_sse2[356],
+              ztriangle_code_sse2[357],
+              ztriangle_code_2[352],
+              ztriangle_code_2[358],
+              ztriangle_code_2[359]
+            },
+            {
+              ztriangle_code_sse2[358],
+              ztriangle_code_sse2[359],
+              ztriangle_code_2[357],
+              ztriangle_code_2[358],
+              ztriangle_code_2[359]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[360],
+              ztriangle_code_sse2[361],
+              ztriangle_code_2[362],
+              ztriangle_code_2[373],
+              ztriangle_code_2[374]
+            },
+            {
+              ztriangle_code_sse2[362],
+              ztriangle_code_sse2[363],
+              ztriangle_code_2[367],
+              ztriangle_code_2[373],
+              ztriangle_code_2[374]
+            },
+            {
+              ztriangle_code_sse2[364],
+              ztriangle_code_sse2[365],
+              ztriangle_code_2[372],
+              ztriangle_code_2[373],
+              ztriangle_code_2[374]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[366],
+              ztriangle_code_sse2[367],
+              ztriangle_code_2[377],
+              ztriangle_code_2[388],
+              ztriangle_code_2[389]
+            },
+            {
+              ztriangle_code_sse2[368],
+              ztriangle_code_sse2[369],
+              ztriangle_code_2[382],
+              ztriangle_code_2[388],
+              ztriangle_code_2[389]
+            },
+            {
+              ztriangle_code_sse2[370],
+              ztriangle_code_sse2[371],
+              ztriangle_code_2[387],
+              ztriangle_code_2[388],
+              ztriangle_code_2[389]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[372],
+              ztriangle_code_sse2[373],
+              ztriangle_code_2[392],
+              ztriangle_code_2[403],
+              ztriangle_code_2[404]
+            },
+            {
+              ztriangle_code_sse2[374],
+              ztriangle_code_sse2[375],
+              ztriangle_code_2[397],
+              ztriangle_code_2[403],
+              ztriangle_code_2[404]
+            },
+            {
+              ztriangle_code_sse2[376],
+              ztriangle_code_sse2[377],
+              ztriangle_code_2[402],
+              ztriangle_code_2[403],
+              ztriangle_code_2[404]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[378],
+              ztriangle_code_sse2[379],
+              ztriangle_code_2[407],
+              ztriangle_code_2[418],
+              ztriangle_code_2[419]
+            },
+            {
+              ztriangle_code_sse2[380],
+              ztriangle_code_sse2[381],
+              ztriangle_code_2[412],
+              ztriangle_code_2[418],
+              ztriangle_code_2[419]
+            },
+            {
+              ztriangle_code_sse2[382],
+              ztriangle_code_sse2[383],
+              ztriangle_code_2[417],
+              ztriangle_code_2[418],
+              ztriangle_code_2[419]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[384],
+              ztriangle_code_sse2[385],
+              ztriangle_code_2[422],
+              ztriangle_code_2[433],
+              ztriangle_code_2[434]
+            },
+            {
+              ztriangle_code_sse2[386],
+              ztriangle_code_sse2[387],
+              ztriangle_code_2[427],
+              ztriangle_code_2[433],
+              ztriangle_code_2[434]
+            },
+            {
+              ztriangle_code_sse2[388],
+              ztriangle_code_sse2[389],
+              ztriangle_code_2[432],
+              ztriangle_code_2[433],
+              ztriangle_code_2[434]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[390],
+              ztriangle_code_sse2[391],
+              ztriangle_code_2[437],
+              ztriangle_code_2[448],
+              ztriangle_code_2[449]
+            },
+            {
+              ztriangle_code_sse2[392],
+              ztriangle_code_sse2[393],
+              ztriangle_code_2[442],
+              ztriangle_code_2[448],
+              ztriangle_code_2[449]
+            },
+            {
+              ztriangle_code_sse2[394],
+              ztriangle_code_sse2[395],
+              ztriangle_code_2[447],
+              ztriangle_code_2[448],
+              ztriangle_code_2[449]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[396],
+              ztriangle_code_sse2[397],
+              ztriangle_code_2[452],
+              ztriangle_code_2[463],
+              ztriangle_code_2[464]
+            },
+            {
+              ztriangle_code_sse2[398],
+              ztriangle_code_sse2[399],
+              ztriangle_code_2[457],
+              ztriangle_code_2[463],
+              ztriangle_code_2[464]
+            },
+            {
+              ztriangle_code_sse2[400],
+              ztriangle_code_sse2[401],
+              ztriangle_code_2[462],
+              ztriangle_code_2[463],
+              ztriangle_code_2[464]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[402],
+              ztriangle_code_sse2[403],
+              ztriangle_code_2[467],
+              ztriangle_code_2[478],
+              ztriangle_code_2[479]
+            },
+            {
+              ztriangle_code_sse2[404],
+              ztriangle_code_sse2[405],
+              ztriangle_code_2[472],
+              ztriangle_code_2[478],
+              ztriangle_code_2[479]
+            },
+            {
+              ztriangle_code_sse2[406],
+              ztriangle_code_sse2[407],
+              ztriangle_code_2[477],
+              ztriangle_code_2[478],
+              ztriangle_code_2[479]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[408],
+              ztriangle_code_sse2[409],
+              ztriangle_code_2[482],
+              ztriangle_code_2[493],
+              ztriangle_code_2[494]
+            },
+            {
+              ztriangle_code_sse2[410],
+              ztriangle_code_sse2[411],
+              ztriangle_code_2[487],
+              ztriangle_code_2[493],
+              ztriangle_code_2[494]
+            },
+            {
+              ztriangle_code_sse2[412],
+              ztriangle_code_sse2[413],
+              ztriangle_code_2[492],
+              ztriangle_code_2[493],
+              ztriangle_code_2[494]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[414],
+              ztriangle_code_sse2[415],
+              ztriangle_code_2[497],
+              ztriangle_code_2[508],
+              ztriangle_code_2[509]
+            },
+            {
+              ztriangle_code_sse2[416],
+              ztriangle_code_sse2[417],
+              ztriangle_code_2[502],
+              ztriangle_code_2[508],
+              ztriangle_code_2[509]
+            },
+            {
+              ztriangle_code_sse2[418],
+              ztriangle_code_sse2[419],
+              ztriangle_code_2[507],
+              ztriangle_code_2[508],
+              ztriangle_code_2[509]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[420],
+              ztriangle_code_sse2[421],
+              ztriangle_code_2[512],
+              ztriangle_code_2[523],
+              ztriangle_code_2[524]
+            },
+            {
+              ztriangle_code_sse2[422],
+              ztriangle_code_sse2[423],
+              ztriangle_code_2[517],
+              ztriangle_code_2[523],
+              ztriangle_code_2[524]
+            },
+            {
+              ztriangle_code_sse2[424],
+              ztriangle_code_sse2[425],
+              ztriangle_code_2[522],
+              ztriangle_code_2[523],
+              ztriangle_code_2[524]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[426],
+              ztriangle_code_sse2[427],
+              ztriangle_code_2[527],
+              ztriangle_code_2[538],
+              ztriangle_code_2[539]
+            },
+            {
+              ztriangle_code_sse2[428],
+              ztriangle_code_sse2[429],
+              ztriangle_code_2[532],
+              ztriangle_code_2[538],
+              ztriangle_code_2[539]
+            },
+            {
+              ztriangle_code_sse2[430],
+              ztriangle_code_sse2[431],
+              ztriangle_code_2[537],
+              ztriangle_code_2[538],
+              ztriangle_code_2[539]
+            }
+          }
+        }
+      }
+    }
+  },
+  {
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[432],
+              ztriangle_code_sse2[433],
+              ztriangle_code_3[2],
+              ztriangle_code_3[13],
+              ztriangle_code_3[14]
+            },
+            {
+              ztriangle_code_sse2[434],
+              ztriangle_code_sse2[435],
+              ztriangle_code_3[7],
+              ztriangle_code_3[13],
+              ztriangle_code_3[14]
+            },
+            {
+              ztriangle_code_sse2[436],
+              ztriangle_code_sse2[437],
+              ztriangle_code_3[12],
+              ztriangle_code_3[13],
+              ztriangle_code_3[14]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[438],
+              ztriangle_code_sse2[439],
+              ztriangle_code_3[17],
+              ztriangle_code_3[28],
+              ztriangle_code_3[29]
+            },
+            {
+              ztriangle_code_sse2[440],
+              ztriangle_code_sse2[441],
+              ztriangle_code_3[22],
+              ztriangle_code_3[28],
+              ztriangle_code_3[29]
+            },
+            {
+              ztriangle_code_sse2[442],
+              ztriangle_code_sse2[443],
+              ztriangle_code_3[27],
+              ztriangle_code_3[28],
+              ztriangle_code_3[29]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[444],
+              ztriangle_code_sse2[445],
+              ztriangle_code_3[32],
+              ztriangle_code_3[43],
+              ztriangle_code_3[44]
+            },
+            {
+              ztriangle_code_sse2[446],
+              ztriangle_code_sse2[447],
+              ztriangle_code_3[37],
+              ztriangle_code_3[43],
+              ztriangle_code_3[44]
+            },
+            {
+              ztriangle_code_sse2[448],
+              ztriangle_code_sse2[449],
+              ztriangle_code_3[42],
+              ztriangle_code_3[43],
+              ztriangle_code_3[44]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[450],
+              ztriangle_code_sse2[451],
+              ztriangle_code_3[47],
+              ztriangle_code_3[58],
+              ztriangle_code_3[59]
+            },
+            {
+              ztriangle_code_sse2[452],
+              ztriangle_code_sse2[453],
+              ztriangle_code_3[52],
+              ztriangle_code_3[58],
+              ztriangle_code_3[59]
+            },
+            {
+              ztriangle_code_sse2[454],
+              ztriangle_code_sse2[455],
+              ztriangle_code_3[57],
+              ztriangle_code_3[58],
+              ztriangle_code_3[59]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[456],
+              ztriangle_code_sse2[457],
+              ztriangle_code_3[62],
+              ztriangle_code_3[73],
+              ztriangle_code_3[74]
+            },
+            {
+              ztriangle_code_sse2[458],
+              ztriangle_code_sse2[459],
+              ztriangle_code_3[67],
+              ztriangle_code_3[73],
+              ztriangle_code_3[74]
+            },
+            {
+              ztriangle_code_sse2[460],
+              ztriangle_code_sse2[461],
+              ztriangle_code_3[72],
+              ztriangle_code_3[73],
+              ztriangle_code_3[74]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[462],
+              ztriangle_code_sse2[463],
+              ztriangle_code_3[77],
+              ztriangle_code_3[88],
+              ztriangle_code_3[89]
+            },
+            {
+              ztriangle_code_sse2[464],
+              ztriangle_code_sse2[465],
+              ztriangle_code_3[82],
+              ztriangle_code_3[88],
+              ztriangle_code_3[89]
+            },
+            {
+              ztriangle_code_sse2[466],
+              ztriangle_code_sse2[467],
+              ztriangle_code_3[87],
+              ztriangle_code_3[88],
+              ztriangle_code_3[89]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[468],
+              ztriangle_code_sse2[469],
+              ztriangle_code_3[92],
+              ztriangle_code_3[103],
+              ztriangle_code_3[104]
+            },
+            {
+              ztriangle_code_sse2[470],
+              ztriangle_code_sse2[471],
+              ztriangle_code_3[97],
+              ztriangle_code_3[103],
+              ztriangle_code_3[104]
+            },
+            {
+              ztriangle_code_sse2[472],
+              ztriangle_code_sse2[473],
+              ztriangle_code_3[102],
+              ztriangle_code_3[103],
+              ztriangle_code_3[104]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[474],
+              ztriangle_code_sse2[475],
+              ztriangle_code_3[107],
+              ztriangle_code_3[118],
+              ztriangle_code_3[119]
+            },
+            {
+              ztriangle_code_sse2[476],
+              ztriangle_code_sse2[477],
+              ztriangle_code_3[112],
+              ztriangle_code_3[118],
+              ztriangle_code_3[119]
+            },
+            {
+              ztriangle_code_sse2[478],
+              ztriangle_code_sse2[479],
+              ztriangle_code_3[117],
+              ztriangle_code_3[118],
+              ztriangle_code_3[119]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[480],
+              ztriangle_code_sse2[481],
+              ztriangle_code_3[122],
+              ztriangle_code_3[133],
+              ztriangle_code_3[134]
+            },
+            {
+              ztriangle_code_sse2[482],
+              ztriangle_code_sse2[483],
+              ztriangle_code_3[127],
+              ztriangle_code_3[133],
+              ztriangle_code_3[134]
+            },
+            {
+              ztriangle_code_sse2[484],
+              ztriangle_code_sse2[485],
+              ztriangle_code_3[132],
+              ztriangle_code_3[133],
+              ztriangle_code_3[134]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[486],
+              ztriangle_code_sse2[487],
+              ztriangle_code_3[137],
+              ztriangle_code_3[148],
+              ztriangle_code_3[149]
+            },
+            {
+              ztriangle_code_sse2[488],
+              ztriangle_code_sse2[489],
+              ztriangle_code_3[142],
+              ztriangle_code_3[148],
+              ztriangle_code_3[149]
+            },
+            {
+              ztriangle_code_sse2[490],
+              ztriangle_code_sse2[491],
+              ztriangle_code_3[147],
+              ztriangle_code_3[148],
+              ztriangle_code_3[149]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[492],
+              ztriangle_code_sse2[493],
+              ztriangle_code_3[152],
+              ztriangle_code_3[163],
+              ztriangle_code_3[164]
+            },
+            {
+              ztriangle_code_sse2[494],
+              ztriangle_code_sse2[495],
+              ztriangle_code_3[157],
+              ztriangle_code_3[163],
+              ztriangle_code_3[164]
+            },
+            {
+              ztriangle_code_sse2[496],
+              ztriangle_code_sse2[497],
+              ztriangle_code_3[162],
+              ztriangle_code_3[163],
+              ztriangle_code_3[164]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[498],
+              ztriangle_code_sse2[499],
+              ztriangle_code_3[167],
+              ztriangle_code_3[178],
+              ztriangle_code_3[179]
+            },
+            {
+              ztriangle_code_sse2[500],
+              ztriangle_code_sse2[501],
+              ztriangle_code_3[172],
+              ztriangle_code_3[178],
+              ztriangle_code_3[179]
+            },
+            {
+              ztriangle_code_sse2[502],
+              ztriangle_code_sse2[503],
+              ztriangle_code_3[177],
+              ztriangle_code_3[178],
+              ztriangle_code_3[179]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[504],
+              ztriangle_code_sse2[505],
+              ztriangle_code_3[182],
+              ztriangle_code_3[193],
+              ztriangle_code_3[194]
+            },
+            {
+              ztriangle_code_sse2[506],
+              ztriangle_code_sse2[507],
+              ztriangle_code_3[187],
+              ztriangle_code_3[193],
+              ztriangle_code_3[194]
+            },
+            {
+              ztriangle_code_sse2[508],
+              ztriangle_code_sse2[509],
+              ztriangle_code_3[192],
+              ztriangle_code_3[193],
+              ztriangle_code_3[194]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[510],
+              ztriangle_code_sse2[511],
+              ztriangle_code_3[197],
+              ztriangle_code_3[208],
+              ztriangle_code_3[209]
+            },
+            {
+              ztriangle_code_sse2[512],
+              ztriangle_code_sse2[513],
+              ztriangle_code_3[202],
+              ztriangle_code_3[208],
+              ztriangle_code_3[209]
+            },
+            {
+              ztriangle_code_sse2[514],
+              ztriangle_code_sse2[515],
+              ztriangle_code_3[207],
+              ztriangle_code_3[208],
+              ztriangle_code_3[209]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[516],
+              ztriangle_code_sse2[517],
+              ztriangle_code_3[212],
+              ztriangle_code_3[223],
+              ztriangle_code_3[224]
+            },
+            {
+              ztriangle_code_sse2[518],
+              ztriangle_code_sse2[519],
+              ztriangle_code_3[217],
+              ztriangle_code_3[223],
+              ztriangle_code_3[224]
+            },
+            {
+              ztriangle_code_sse2[520],
+              ztriangle_code_sse2[521],
+              ztriangle_code_3[222],
+              ztriangle_code_3[223],
+              ztriangle_code_3[224]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[522],
+              ztriangle_code_sse2[523],
+              ztriangle_code_3[227],
+              ztriangle_code_3[238],
+              ztriangle_code_3[239]
+            },
+            {
+              ztriangle_code_sse2[524],
+              ztriangle_code_sse2[525],
+              ztriangle_code_3[232],
+              ztriangle_code_3[238],
+              ztriangle_code_3[239]
+            },
+            {
+              ztriangle_code_sse2[526],
+              ztriangle_code_sse2[527],
+              ztriangle_code_3[237],
+              ztriangle_code_3[238],
+              ztriangle_code_3[239]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[528],
+              ztriangle_code_sse2[529],
+              ztriangle_code_3[242],
+              ztriangle_code_3[253],
+              ztriangle_code_3[254]
+            },
+            {
+              ztriangle_code_sse2[530],
+              ztriangle_code_sse2[531],
+              ztriangle_code_3[247],
+              ztriangle_code_3[253],
+              ztriangle_code_3[254]
+            },
+            {
+              ztriangle_code_sse2[532],
+              ztriangle_code_sse2[533],
+              ztriangle_code_3[252],
+              ztriangle_code_3[253],
+              ztriangle_code_3[254]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[534],
+              ztriangle_code_sse2[535],
+              ztriangle_code_3[257],
+              ztriangle_code_3[268],
+              ztriangle_code_3[269]
+            },
+            {
+              ztriangle_code_sse2[536],
+              ztriangle_code_sse2[537],
+              ztriangle_code_3[262],
+              ztriangle_code_3[268],
+              ztriangle_code_3[269]
+            },
+            {
+              ztriangle_code_sse2[538],
+              ztriangle_code_sse2[539],
+              ztriangle_code_3[267],
+              ztriangle_code_3[268],
+              ztriangle_code_3[269]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[540],
+              ztriangle_code_sse2[541],
+              ztriangle_code_3[272],
+              ztriangle_code_3[283],
+              ztriangle_code_3[284]
+            },
+            {
+              ztriangle_code_sse2[542],
+              ztriangle_code_sse2[543],
+              ztriangle_code_3[277],
+              ztriangle_code_3[283],
+              ztriangle_code_3[284]
+            },
+            {
+              ztriangle_code_sse2[544],
+              ztriangle_code_sse2[545],
+              ztriangle_code_3[282],
+              ztriangle_code_3[283],
+              ztriangle_code_3[284]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[546],
+              ztriangle_code_sse2[547],
+              ztriangle_code_3[287],
+              ztriangle_code_3[298],
+              ztriangle_code_3[299]
+            },
+            {
+              ztriangle_code_sse2[548],
+              ztriangle_code_sse2[549],
+              ztriangle_code_3[292],
+              ztriangle_code_3[298],
+              ztriangle_code_3[299]
+            },
+            {
+              ztriangle_code_sse2[550],
+              ztriangle_code_sse2[551],
+              ztriangle_code_3[297],
+              ztriangle_code_3[298],
+              ztriangle_code_3[299]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[552],
+              ztriangle_code_sse2[553],
+              ztriangle_code_3[302],
+              ztriangle_code_3[313],
+              ztriangle_code_3[314]
+            },
+            {
+              ztriangle_code_sse2[554],
+              ztriangle_code_sse2[555],
+              ztriangle_code_3[307],
+              ztriangle_code_3[313],
+              ztriangle_code_3[314]
+            },
+            {
+              ztriangle_code_sse2[556],
+              ztriangle_code_sse2[557],
+              ztriangle_code_3[312],
+              ztriangle_code_3[313],
+              ztriangle_code_3[314]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[558],
+              ztriangle_code_sse2[559],
+              ztriangle_code_3[317],
+              ztriangle_code_3[328],
+              ztriangle_code_3[329]
+            },
+            {
+              ztriangle_code_sse2[560],
+              ztriangle_code_sse2[561],
+              ztriangle_code_3[322],
+              ztriangle_code_3[328],
+              ztriangle_code_3[329]
+            },
+            {
+              ztriangle_code_sse2[562],
+              ztriangle_code_sse2[563],
+              ztriangle_code_3[327],
+              ztriangle_code_3[328],
+              ztriangle_code_3[329]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[564],
+              ztriangle_code_sse2[565],
+              ztriangle_code_3[332],
+              ztriangle_code_3[343],
+              ztriangle_code_3[344]
+            },
+            {
+              ztriangle_code_sse2[566],
+              ztriangle_code_sse2[567],
+              ztriangle_code_3[337],
+              ztriangle_code_3[343],
+              ztriangle_code_3[344]
+            },
+            {
+              ztriangle_code_sse2[568],
+              ztriangle_code_sse2[569],
+              ztriangle_code_3[342],
+              ztriangle_code_3[343],
+              ztriangle_code_3[344]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[570],
+              ztriangle_code_sse2[571],
+              ztriangle_code_3[347],
+              ztriangle_code_3[358],
+              ztriangle_code_3[359]
+            },
+            {
+              ztriangle_code_sse2[572],
+              ztriangle_code_sse2[573],
+              ztriangle_code_3[352],
+              ztriangle_code_3[358],
+              ztriangle_code_3[359]
+            },
+            {
+              ztriangle_code_sse2[574],
+              ztriangle_code_sse2[575],
+              ztriangle_code_3[357],
+              ztriangle_code_3[358],
+              ztriangle_code_3[359]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[576],
+              ztriangle_code_sse2[577],
+              ztriangle_code_3[362],
+              ztriangle_code_3[373],
+              ztriangle_code_3[374]
+            },
+            {
+              ztriangle_code_sse2[578],
+              ztriangle_code_sse2[579],
+              ztriangle_code_3[367],
+              ztriangle_code_3[373],
+              ztriangle_code_3[374]
+            },
+            {
+              ztriangle_code_sse2[580],
+              ztriangle_code_sse2[581],
+              ztriangle_code_3[372],
+              ztriangle_code_3[373],
+              ztriangle_code_3[374]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[582],
+              ztriangle_code_sse2[583],
+              ztriangle_code_3[377],
+              ztriangle_code_3[388],
+              ztriangle_code_3[389]
+            },
+            {
+              ztriangle_code_sse2[584],
+              ztriangle_code_sse2[585],
+              ztriangle_code_3[382],
+              ztriangle_code_3[388],
+              ztriangle_code_3[389]
+            },
+            {
+              ztriangle_code_sse2[586],
+              ztriangle_code_sse2[587],
+              ztriangle_code_3[387],
+              ztriangle_code_3[388],
+              ztriangle_code_3[389]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[588],
+              ztriangle_code_sse2[589],
+              ztriangle_code_3[392],
+              ztriangle_code_3[403],
+              ztriangle_code_3[404]
+            },
+            {
+              ztriangle_code_sse2[590],
+              ztriangle_code_sse2[591],
+              ztriangle_code_3[397],
+              ztriangle_code_3[403],
+              ztriangle_code_3[404]
+            },
+            {
+              ztriangle_code_sse2[592],
+              ztriangle_code_sse2[593],
+              ztriangle_code_3[402],
+              ztriangle_code_3[403],
+              ztriangle_code_3[404]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[594],
+              ztriangle_code_sse2[595],
+              ztriangle_code_3[407],
+              ztriangle_code_3[418],
+              ztriangle_code_3[419]
+            },
+            {
+              ztriangle_code_sse2[596],
+              ztriangle_code_sse2[597],
+              ztriangle_code_3[412],
+              ztriangle_code_3[418],
+              ztriangle_code_3[419]
+            },
+            {
+              ztriangle_code_sse2[598],
+              ztriangle_code_sse2[599],
+              ztriangle_code_3[417],
+              ztriangle_code_3[418],
+              ztriangle_code_3[419]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[600],
+              ztriangle_code_sse2[601],
+              ztriangle_code_3[422],
+              ztriangle_code_3[433],
+              ztriangle_code_3[434]
+            },
+            {
+              ztriangle_code_sse2[602],
+              ztriangle_code_sse2[603],
+              ztriangle_code_3[427],
+              ztriangle_code_3[433],
+              ztriangle_code_3[434]
+            },
+            {
+              ztriangle_code_sse2[604],
+              ztriangle_code_sse2[605],
+              ztriangle_code_3[432],
+              ztriangle_code_3[433],
+              ztriangle_code_3[434]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[606],
+              ztriangle_code_sse2[607],
+              ztriangle_code_3[437],
+              ztriangle_code_3[448],
+              ztriangle_code_3[449]
+            },
+            {
+              ztriangle_code_sse2[608],
+              ztriangle_code_sse2[609],
+              ztriangle_code_3[442],
+              ztriangle_code_3[448],
+              ztriangle_code_3[449]
+            },
+            {
+              ztriangle_code_sse2[610],
+              ztriangle_code_sse2[611],
+              ztriangle_code_3[447],
+              ztriangle_code_3[448],
+              ztriangle_code_3[449]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[612],
+              ztriangle_code_sse2[613],
+              ztriangle_code_3[452],
+              ztriangle_code_3[463],
+              ztriangle_code_3[464]
+            },
+            {
+              ztriangle_code_sse2[614],
+              ztriangle_code_sse2[615],
+              ztriangle_code_3[457],
+              ztriangle_code_3[463],
+              ztriangle_code_3[464]
+            },
+            {
+              ztriangle_code_sse2[616],
+              ztriangle_code_sse2[617],
+              ztriangle_code_3[462],
+              ztriangle_code_3[463],
+              ztriangle_code_3[464]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[618],
+              ztriangle_code_sse2[619],
+              ztriangle_code_3[467],
+              ztriangle_code_3[478],
+              ztriangle_code_3[479]
+            },
+            {
+              ztriangle_code_sse2[620],
+              ztriangle_code_sse2[621],
+              ztriangle_code_3[472],
+              ztriangle_code_3[478],
+              ztriangle_code_3[479]
+            },
+            {
+              ztriangle_code_sse2[622],
+              ztriangle_code_sse2[623],
+              ztriangle_code_3[477],
+              ztriangle_code_3[478],
+              ztriangle_code_3[479]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[624],
+              ztriangle_code_sse2[625],
+              ztriangle_code_3[482],
+              ztriangle_code_3[493],
+              ztriangle_code_3[494]
+            },
+            {
+              ztriangle_code_sse2[626],
+              ztriangle_code_sse2[627],
+              ztriangle_code_3[487],
+              ztriangle_code_3[493],
+              ztriangle_code_3[494]
+            },
+            {
+              ztriangle_code_sse2[628],
+              ztriangle_code_sse2[629],
+              ztriangle_code_3[492],
+              ztriangle_code_3[493],
+              ztriangle_code_3[494]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[630],
+              ztriangle_code_sse2[631],
+              ztriangle_code_3[497],
+              ztriangle_code_3[508],
+              ztriangle_code_3[509]
+            },
+            {
+              ztriangle_code_sse2[632],
+              ztriangle_code_sse2[633],
+              ztriangle_code_3[502],
+              ztriangle_code_3[508],
+              ztriangle_code_3[509]
+            },
+            {
+              ztriangle_code_sse2[634],
+              ztriangle_code_sse2[635],
+              ztriangle_code_3[507],
+              ztriangle_code_3[508],
+              ztriangle_code_3[509]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[636],
+              ztriangle_code_sse2[637],
+              ztriangle_code_3[512],
+              ztriangle_code_3[523],
+              ztriangle_code_3[524]
+            },
+            {
+              ztriangle_code_sse2[638],
+              ztriangle_code_sse2[639],
+              ztriangle_code_3[517],
+              ztriangle_code_3[523],
+              ztriangle_code_3[524]
+            },
+            {
+              ztriangle_code_sse2[640],
+              ztriangle_code_sse2[641],
+              ztriangle_code_3[522],
+              ztriangle_code_3[523],
+              ztriangle_code_3[524]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[642],
+              ztriangle_code_sse2[643],
+              ztriangle_code_3[527],
+              ztriangle_code_3[538],
+              ztriangle_code_3[539]
+            },
+            {
+              ztriangle_code_sse2[644],
+              ztriangle_code_sse2[645],
+              ztriangle_code_3[532],
+              ztriangle_code_3[538],
+              ztriangle_code_3[539]
+            },
+            {
+              ztriangle_code_sse2[646],
+              ztriangle_code_sse2[647],
+              ztriangle_code_3[537],
+              ztriangle_code_3[538],
+              ztriangle_code_3[539]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[648],
+              ztriangle_code_sse2[649],
+              ztriangle_code_4[2],
+              ztriangle_code_4[13],
+              ztriangle_code_4[14]
+            },
+            {
+              ztriangle_code_sse2[650],
+              ztriangle_code_sse2[651],
+              ztriangle_code_4[7],
+              ztriangle_code_4[13],
+              ztriangle_code_4[14]
+            },
+            {
+              ztriangle_code_sse2[652],
+              ztriangle_code_sse2[653],
+              ztriangle_code_4[12],
+              ztriangle_code_4[13],
+              ztriangle_code_4[14]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[654],
+              ztriangle_code_sse2[655],
+              ztriangle_code_4[17],
+              ztriangle_code_4[28],
+              ztriangle_code_4[29]
+            },
+            {
+              ztriangle_code_sse2[656],
+              ztriangle_code_sse2[657],
+              ztriangle_code_4[22],
+              ztriangle_code_4[28],
+              ztriangle_code_4[29]
+            },
+            {
+              ztriangle_code_sse2[658],
+              ztriangle_code_sse2[659],
+              ztriangle_code_4[27],
+              ztriangle_code_4[28],
+              ztriangle_code_4[29]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[660],
+              ztriangle_code_sse2[661],
+              ztriangle_code_4[32],
+              ztriangle_code_4[43],
+              ztriangle_code_4[44]
+            },
+            {
+              ztriangle_code_sse2[662],
+              ztriangle_code_sse2[663],
+              ztriangle_code_4[37],
+              ztriangle_code_4[43],
+              ztriangle_code_4[44]
+            },
+            {
+              ztriangle_code_sse2[664],
+              ztriangle_code_sse2[665],
+              ztriangle_code_4[42],
+              ztriangle_code_4[43],
+              ztriangle_code_4[44]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[666],
+              ztriangle_code_sse2[667],
+              ztriangle_code_4[47],
+              ztriangle_code_4[58],
+              ztriangle_code_4[59]
+            },
+            {
+              ztriangle_code_sse2[668],
+              ztriangle_code_sse2[669],
+              ztriangle_code_4[52],
+              ztriangle_code_4[58],
+              ztriangle_code_4[59]
+            },
+            {
+              ztriangle_code_sse2[670],
+              ztriangle_code_sse2[671],
+              ztriangle_code_4[57],
+              ztriangle_code_4[58],
+              ztriangle_code_4[59]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[672],
+              ztriangle_code_sse2[673],
+              ztriangle_code_4[62],
+              ztriangle_code_4[73],
+              ztriangle_code_4[74]
+            },
+            {
+              ztriangle_code_sse2[674],
+              ztriangle_code_sse2[675],
+              ztriangle_code_4[67],
+              ztriangle_code_4[73],
+              ztriangle_code_4[74]
+            },
+            {
+              ztriangle_code_sse2[676],
+              ztriangle_code_sse2[677],
+              ztriangle_code_4[72],
+              ztriangle_code_4[73],
+              ztriangle_code_4[74]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[678],
+              ztriangle_code_sse2[679],
+              ztriangle_code_4[77],
+              ztriangle_code_4[88],
+              ztriangle_code_4[89]
+            },
+            {
+              ztriangle_code_sse2[680],
+              ztriangle_code_sse2[681],
+              ztriangle_code_4[82],
+              ztriangle_code_4[88],
+              ztriangle_code_4[89]
+            },
+            {
+              ztriangle_code_sse2[682],
+              ztriangle_code_sse2[683],
+              ztriangle_code_4[87],
+              ztriangle_code_4[88],
+              ztriangle_code_4[89]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[684],
+              ztriangle_code_sse2[685],
+              ztriangle_code_4[92],
+              ztriangle_code_4[103],
+              ztriangle_code_4[104]
+            },
+            {
+              ztriangle_code_sse2[686],
+              ztriangle_code_sse2[687],
+              ztriangle_code_4[97],
+              ztriangle_code_4[103],
+              ztriangle_code_4[104]
+            },
+            {
+              ztriangle_code_sse2[688],
+              ztriangle_code_sse2[689],
+              ztriangle_code_4[102],
+              ztriangle_code_4[103],
+              ztriangle_code_4[104]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[690],
+              ztriangle_code_sse2[691],
+              ztriangle_code_4[107],
+              ztriangle_code_4[118],
+              ztriangle_code_4[119]
+            },
+            {
+              ztriangle_code_sse2[692],
+              ztriangle_code_sse2[693],
+              ztriangle_code_4[112],
+              ztriangle_code_4[118],
+              ztriangle_code_4[119]
+            },
+            {
+              ztriangle_code_sse2[694],
+              ztriangle_code_sse2[695],
+              ztriangle_code_4[117],
+              ztriangle_code_4[118],
+              ztriangle_code_4[119]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[696],
+              ztriangle_code_sse2[697],
+              ztriangle_code_4[122],
+              ztriangle_code_4[133],
+              ztriangle_code_4[134]
+            },
+            {
+              ztriangle_code_sse2[698],
+              ztriangle_code_sse2[699],
+              ztriangle_code_4[127],
+              ztriangle_code_4[133],
+              ztriangle_code_4[134]
+            },
+            {
+              ztriangle_code_sse2[700],
+              ztriangle_code_sse2[701],
+              ztriangle_code_4[132],
+              ztriangle_code_4[133],
+              ztriangle_code_4[134]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[702],
+              ztriangle_code_sse2[703],
+              ztriangle_code_4[137],
+              ztriangle_code_4[148],
+              ztriangle_code_4[149]
+            },
+            {
+              ztriangle_code_sse2[704],
+              ztriangle_code_sse2[705],
+              ztriangle_code_4[142],
+              ztriangle_code_4[148],
+              ztriangle_code_4[149]
+            },
+            {
+              ztriangle_code_sse2[706],
+              ztriangle_code_sse2[707],
+              ztriangle_code_4[147],
+              ztriangle_code_4[148],
+              ztriangle_code_4[149]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[708],
+              ztriangle_code_sse2[709],
+              ztriangle_code_4[152],
+              ztriangle_code_4[163],
+              ztriangle_code_4[164]
+            },
+            {
+              ztriangle_code_sse2[710],
+              ztriangle_code_sse2[711],
+              ztriangle_code_4[157],
+              ztriangle_code_4[163],
+              ztriangle_code_4[164]
+            },
+            {
+              ztriangle_code_sse2[712],
+              ztriangle_code_sse2[713],
+              ztriangle_code_4[162],
+              ztriangle_code_4[163],
+              ztriangle_code_4[164]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[714],
+              ztriangle_code_sse2[715],
+              ztriangle_code_4[167],
+              ztriangle_code_4[178],
+              ztriangle_code_4[179]
+            },
+            {
+              ztriangle_code_sse2[716],
+              ztriangle_code_sse2[717],
+              ztriangle_code_4[172],
+              ztriangle_code_4[178],
+              ztriangle_code_4[179]
+            },
+            {
+              ztriangle_code_sse2[718],
+              ztriangle_code_sse2[719],
+              ztriangle_code_4[177],
+              ztriangle_code_4[178],
+              ztriangle_code_4[179]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[720],
+              ztriangle_code_sse2[721],
+              ztriangle_code_4[182],
+              ztriangle_code_4[193],
+              ztriangle_code_4[194]
+            },
+            {
+              ztriangle_code_sse2[722],
+              ztriangle_code_sse2[723],
+              ztriangle_code_4[187],
+              ztriangle_code_4[193],
+              ztriangle_code_4[194]
+            },
+            {
+              ztriangle_code_sse2[724],
+              ztriangle_code_sse2[725],
+              ztriangle_code_4[192],
+              ztriangle_code_4[193],
+              ztriangle_code_4[194]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[726],
+              ztriangle_code_sse2[727],
+              ztriangle_code_4[197],
+              ztriangle_code_4[208],
+              ztriangle_code_4[209]
+            },
+            {
+              ztriangle_code_sse2[728],
+              ztriangle_code_sse2[729],
+              ztriangle_code_4[202],
+              ztriangle_code_4[208],
+              ztriangle_code_4[209]
+            },
+            {
+              ztriangle_code_sse2[730],
+              ztriangle_code_sse2[731],
+              ztriangle_code_4[207],
+              ztriangle_code_4[208],
+              ztriangle_code_4[209]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[732],
+              ztriangle_code_sse2[733],
+              ztriangle_code_4[212],
+              ztriangle_code_4[223],
+              ztriangle_code_4[224]
+            },
+            {
+              ztriangle_code_sse2[734],
+              ztriangle_code_sse2[735],
+              ztriangle_code_4[217],
+              ztriangle_code_4[223],
+              ztriangle_code_4[224]
+            },
+            {
+              ztriangle_code_sse2[736],
+              ztriangle_code_sse2[737],
+              ztriangle_code_4[222],
+              ztriangle_code_4[223],
+              ztriangle_code_4[224]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[738],
+              ztriangle_code_sse2[739],
+              ztriangle_code_4[227],
+              ztriangle_code_4[238],
+              ztriangle_code_4[239]
+            },
+            {
+              ztriangle_code_sse2[740],
+              ztriangle_code_sse2[741],
+              ztriangle_code_4[232],
+              ztriangle_code_4[238],
+              ztriangle_code_4[239]
+            },
+            {
+              ztriangle_code_sse2[742],
+              ztriangle_code_sse2[743],
+              ztriangle_code_4[237],
+              ztriangle_code_4[238],
+              ztriangle_code_4[239]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[744],
+              ztriangle_code_sse2[745],
+              ztriangle_code_4[242],
+              ztriangle_code_4[253],
+              ztriangle_code_4[254]
+            },
+            {
+              ztriangle_code_sse2[746],
+              ztriangle_code_sse2[747],
+              ztriangle_code_4[247],
+              ztriangle_code_4[253],
+              ztriangle_code_4[254]
+            },
+            {
+              ztriangle_code_sse2[748],
+              ztriangle_code_sse2[749],
+              ztriangle_code_4[252],
+              ztriangle_code_4[253],
+              ztriangle_code_4[254]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[750],
+              ztriangle_code_sse2[751],
+              ztriangle_code_4[257],
+              ztriangle_code_4[268],
+              ztriangle_code_4[269]
+            },
+            {
+              ztriangle_code_sse2[752],
+              ztriangle_code_sse2[753],
+              ztriangle_code_4[262],
+              ztriangle_code_4[268],
+              ztriangle_code_4[269]
+            },
+            {
+              ztriangle_code_sse2[754],
+              ztriangle_code_sse2[755],
+              ztriangle_code_4[267],
+              ztriangle_code_4[268],
+              ztriangle_code_4[269]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[756],
+              ztriangle_code_sse2[757],
+              ztriangle_code_4[272],
+              ztriangle_code_4[283],
+              ztriangle_code_4[284]
+            },
+            {
+              ztriangle_code_sse2[758],
+              ztriangle_code_sse2[759],
+              ztriangle_code_4[277],
+              ztriangle_code_4[283],
+              ztriangle_code_4[284]
+            },
+            {
+              ztriangle_code_sse2[760],
+              ztriangle_code_sse2[761],
+              ztriangle_code_4[282],
+              ztriangle_code_4[283],
+              ztriangle_code_4[284]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[762],
+              ztriangle_code_sse2[763],
+              ztriangle_code_4[287],
+              ztriangle_code_4[298],
+              ztriangle_code_4[299]
+            },
+            {
+              ztriangle_code_sse2[764],
+              ztriangle_code_sse2[765],
+              ztriangle_code_4[292],
+              ztriangle_code_4[298],
+              ztriangle_code_4[299]
+            },
+            {
+              ztriangle_code_sse2[766],
+              ztriangle_code_sse2[767],
+              ztriangle_code_4[297],
+              ztriangle_code_4[298],
+              ztriangle_code_4[299]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[768],
+              ztriangle_code_sse2[769],
+              ztriangle_code_4[302],
+              ztriangle_code_4[313],
+              ztriangle_code_4[314]
+            },
+            {
+              ztriangle_code_sse2[770],
+              ztriangle_code_sse2[771],
+              ztriangle_code_4[307],
+              ztriangle_code_4[313],
+              ztriangle_code_4[314]
+            },
+            {
+              ztriangle_code_sse2[772],
+              ztriangle_code_sse2[773],
+              ztriangle_code_4[312],
+              ztriangle_code_4[313],
+              ztriangle_code_4[314]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[774],
+              ztriangle_code_sse2[775],
+              ztriangle_code_4[317],
+              ztriangle_code_4[328],
+              ztriangle_code_4[329]
+            },
+            {
+              ztriangle_code_sse2[776],
+              ztriangle_code_sse2[777],
+              ztriangle_code_4[322],
+              ztriangle_code_4[328],
+              ztriangle_code_4[329]
+            },
+            {
+              ztriangle_code_sse2[778],
+              ztriangle_code_sse2[779],
+              ztriangle_code_4[327],
+              ztriangle_code_4[328],
+              ztriangle_code_4[329]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[780],
+              ztriangle_code_sse2[781],
+              ztriangle_code_4[332],
+              ztriangle_code_4[343],
+              ztriangle_code_4[344]
+            },
+            {
+              ztriangle_code_sse2[782],
+              ztriangle_code_sse2[783],
+              ztriangle_code_4[337],
+              ztriangle_code_4[343],
+              ztriangle_code_4[344]
+            },
+            {
+              ztriangle_code_sse2[784],
+              ztriangle_code_sse2[785],
+              ztriangle_code_4[342],
+              ztriangle_code_4[343],
+              ztriangle_code_4[344]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[786],
+              ztriangle_code_sse2[787],
+              ztriangle_code_4[347],
+              ztriangle_code_4[358],
+              ztriangle_code_4[359]
+            },
+            {
+              ztriangle_code_sse2[788],
+              ztriangle_code_sse2[789],
+              ztriangle_code_4[352],
+              ztriangle_code_4[358],
+              ztriangle_code_4[359]
+            },
+            {
+              ztriangle_code_sse2[790],
+              ztriangle_code_sse2[791],
+              ztriangle_code_4[357],
+              ztriangle_code_4[358],
+              ztriangle_code_4[359]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[792],
+              ztriangle_code_sse2[793],
+              ztriangle_code_4[362],
+              ztriangle_code_4[373],
+              ztriangle_code_4[374]
+            },
+            {
+              ztriangle_code_sse2[794],
+              ztriangle_code_sse2[795],
+              ztriangle_code_4[367],
+              ztriangle_code_4[373],
+              ztriangle_code_4[374]
+            },
+            {
+              ztriangle_code_sse2[796],
+              ztriangle_code_sse2[797],
+              ztriangle_code_4[372],
+              ztriangle_code_4[373],
+              ztriangle_code_4[374]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[798],
+              ztriangle_code_sse2[799],
+              ztriangle_code_4[377],
+              ztriangle_code_4[388],
+              ztriangle_code_4[389]
+            },
+            {
+              ztriangle_code_sse2[800],
+              ztriangle_code_sse2[801],
+              ztriangle_code_4[382],
+              ztriangle_code_4[388],
+              ztriangle_code_4[389]
+            },
+            {
+              ztriangle_code_sse2[802],
+              ztriangle_code_sse2[803],
+              ztriangle_code_4[387],
+              ztriangle_code_4[388],
+              ztriangle_code_4[389]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[804],
+              ztriangle_code_sse2[805],
+              ztriangle_code_4[392],
+              ztriangle_code_4[403],
+              ztriangle_code_4[404]
+            },
+            {
+              ztriangle_code_sse2[806],
+              ztriangle_code_sse2[807],
+              ztriangle_code_4[397],
+              ztriangle_code_4[403],
+              ztriangle_code_4[404]
+            },
+            {
+              ztriangle_code_sse2[808],
+              ztriangle_code_sse2[809],
+              ztriangle_code_4[402],
+              ztriangle_code_4[403],
+              ztriangle_code_4[404]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[810],
+              ztriangle_code_sse2[811],
+              ztriangle_code_4[407],
+              ztriangle_code_4[418],
+              ztriangle_code_4[419]
+            },
+            {
+              ztriangle_code_sse2[812],
+              ztriangle_code_sse2[813],
+              ztriangle_code_4[412],
+              ztriangle_code_4[418],
+              ztriangle_code_4[419]
+            },
+            {
+              ztriangle_code_sse2[814],
+              ztriangle_code_sse2[815],
+              ztriangle_code_4[417],
+              ztriangle_code_4[418],
+              ztriangle_code_4[419]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[816],
+              ztriangle_code_sse2[817],
+              ztriangle_code_4[422],
+              ztriangle_code_4[433],
+              ztriangle_code_4[434]
+            },
+            {
+              ztriangle_code_sse2[818],
+              ztriangle_code_sse2[819],
+              ztriangle_code_4[427],
+              ztriangle_code_4[433],
+              ztriangle_code_4[434]
+            },
+            {
+              ztriangle_code_sse2[820],
+              ztriangle_code_sse2[821],
+              ztriangle_code_4[432],
+              ztriangle_code_4[433],
+              ztriangle_code_4[434]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[822],
+              ztriangle_code_sse2[823],
+              ztriangle_code_4[437],
+              ztriangle_code_4[448],
+              ztriangle_code_4[449]
+            },
+            {
+              ztriangle_code_sse2[824],
+              ztriangle_code_sse2[825],
+              ztriangle_code_4[442],
+              ztriangle_code_4[448],
+              ztriangle_code_4[449]
+            },
+            {
+              ztriangle_code_sse2[826],
+              ztriangle_code_sse2[827],
+              ztriangle_code_4[447],
+              ztriangle_code_4[448],
+              ztriangle_code_4[449]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_sse2[828],
+              ztriangle_code_sse2[829],
+              ztriangle_code_4[452],
+              ztriangle_code_4[463],
+              ztriangle_code_4[464]
+            },
+            {
+              ztriangle_code_sse2[830],
+              ztriangle_code_sse2[831],
+              ztriangle_code_4[457],
+              ztriangle_code_4[463],
+              ztriangle_code_4[464]
+            },
+            {
+              ztriangle_code_sse2[832],
+              ztriangle_code_sse2[833],
+              ztriangle_code_4[462],
+              ztriangle_code_4[463],
+              ztriangle_code_4[464]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[834],
+              ztriangle_code_sse2[835],
+              ztriangle_code_4[467],
+              ztriangle_code_4[478],
+              ztriangle_code_4[479]
+            },
+            {
+              ztriangle_code_sse2[836],
+              ztriangle_code_sse2[837],
+              ztriangle_code_4[472],
+              ztriangle_code_4[478],
+              ztriangle_code_4[479]
+            },
+            {
+              ztriangle_code_sse2[838],
+              ztriangle_code_sse2[839],
+              ztriangle_code_4[477],
+              ztriangle_code_4[478],
+              ztriangle_code_4[479]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[840],
+              ztriangle_code_sse2[841],
+              ztriangle_code_4[482],
+              ztriangle_code_4[493],
+              ztriangle_code_4[494]
+            },
+            {
+              ztriangle_code_sse2[842],
+              ztriangle_code_sse2[843],
+              ztriangle_code_4[487],
+              ztriangle_code_4[493],
+              ztriangle_code_4[494]
+            },
+            {
+              ztriangle_code_sse2[844],
+              ztriangle_code_sse2[845],
+              ztriangle_code_4[492],
+              ztriangle_code_4[493],
+              ztriangle_code_4[494]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_sse2[846],
+              ztriangle_code_sse2[847],
+              ztriangle_code_4[497],
+              ztriangle_code_4[508],
+              ztriangle_code_4[509]
+            },
+            {
+              ztriangle_code_sse2[848],
+              ztriangle_code_sse2[849],
+              ztriangle_code_4[502],
+              ztriangle_code_4[508],
+              ztriangle_code_4[509]
+            },
+            {
+              ztriangle_code_sse2[850],
+              ztriangle_code_sse2[851],
+              ztriangle_code_4[507],
+              ztriangle_code_4[508],
+              ztriangle_code_4[509]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[852],
+              ztriangle_code_sse2[853],
+              ztriangle_code_4[512],
+              ztriangle_code_4[523],
+              ztriangle_code_4[524]
+            },
+            {
+              ztriangle_code_sse2[854],
+              ztriangle_code_sse2[855],
+              ztriangle_code_4[517],
+              ztriangle_code_4[523],
+              ztriangle_code_4[524]
+            },
+            {
+              ztriangle_code_sse2[856],
+              ztriangle_code_sse2[857],
+              ztriangle_code_4[522],
+              ztriangle_code_4[523],
+              ztriangle_code_4[524]
+            }
+          },
+          {
+            {
+              ztriangle_code_sse2[858],
+              ztriangle_code_sse2[859],
+              ztriangle_code_4[527],
+              ztriangle_code_4[538],
+              ztriangle_code_4[539]
+            },
+            {
+              ztriangle_code_sse2[860],
+              ztriangle_code_sse2[861],
+              ztriangle_code_4[532],
+              ztriangle_code_4[538],
+              ztriangle_code_4[539]
+            },
+            {
+              ztriangle_code_sse2[862],
+              ztriangle_code_sse2[863],
+              ztriangle_code_4[537],
+              ztriangle_code_4[538],
+              ztriangle_code_4[539]
+            }
+          }
+        }
+      }
+    }
+  }
+};
+#endif
+
+#ifdef ZSIMD_HAVE_AVX2
+extern ZB_fillTriangleFunc ztriangle_code_avx2[];
+
+const ZB_fillTriangleFunc fill_tri_funcs_avx2[2][4][3][2][3][3][5] = {
+  {
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[0],
+              ztriangle_code_avx2[1],
+              ztriangle_code_1[2],
+              ztriangle_code_1[13],
+              ztriangle_code_1[14]
+            },
+            {
+              ztriangle_code_avx2[2],
+              ztriangle_code_avx2[3],
+              ztriangle_code_1[7],
+              ztriangle_code_1[13],
+              ztriangle_code_1[14]
+            },
+            {
+              ztriangle_code_avx2[4],
+              ztriangle_code_avx2[5],
+              ztriangle_code_1[12],
+              ztriangle_code_1[13],
+              ztriangle_code_1[14]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[6],
+              ztriangle_code_avx2[7],
+              ztriangle_code_1[17],
+              ztriangle_code_1[28],
+              ztriangle_code_1[29]
+            },
+            {
+              ztriangle_code_avx2[8],
+              ztriangle_code_avx2[9],
+              ztriangle_code_1[22],
+              ztriangle_code_1[28],
+              ztriangle_code_1[29]
+            },
+            {
+              ztriangle_code_avx2[10],
+              ztriangle_code_avx2[11],
+              ztriangle_code_1[27],
+              ztriangle_code_1[28],
+              ztriangle_code_1[29]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[12],
+              ztriangle_code_avx2[13],
+              ztriangle_code_1[32],
+              ztriangle_code_1[43],
+              ztriangle_code_1[44]
+            },
+            {
+              ztriangle_code_avx2[14],
+              ztriangle_code_avx2[15],
+              ztriangle_code_1[37],
+              ztriangle_code_1[43],
+              ztriangle_code_1[44]
+            },
+            {
+              ztriangle_code_avx2[16],
+              ztriangle_code_avx2[17],
+              ztriangle_code_1[42],
+              ztriangle_code_1[43],
+              ztriangle_code_1[44]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[18],
+              ztriangle_code_avx2[19],
+              ztriangle_code_1[47],
+              ztriangle_code_1[58],
+              ztriangle_code_1[59]
+            },
+            {
+              ztriangle_code_avx2[20],
+              ztriangle_code_avx2[21],
+              ztriangle_code_1[52],
+              ztriangle_code_1[58],
+              ztriangle_code_1[59]
+            },
+            {
+              ztriangle_code_avx2[22],
+              ztriangle_code_avx2[23],
+              ztriangle_code_1[57],
+              ztriangle_code_1[58],
+              ztriangle_code_1[59]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[24],
+              ztriangle_code_avx2[25],
+              ztriangle_code_1[62],
+              ztriangle_code_1[73],
+              ztriangle_code_1[74]
+            },
+            {
+              ztriangle_code_avx2[26],
+              ztriangle_code_avx2[27],
+              ztriangle_code_1[67],
+              ztriangle_code_1[73],
+              ztriangle_code_1[74]
+            },
+            {
+              ztriangle_code_avx2[28],
+              ztriangle_code_avx2[29],
+              ztriangle_code_1[72],
+              ztriangle_code_1[73],
+              ztriangle_code_1[74]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[30],
+              ztriangle_code_avx2[31],
+              ztriangle_code_1[77],
+              ztriangle_code_1[88],
+              ztriangle_code_1[89]
+            },
+            {
+              ztriangle_code_avx2[32],
+              ztriangle_code_avx2[33],
+              ztriangle_code_1[82],
+              ztriangle_code_1[88],
+              ztriangle_code_1[89]
+            },
+            {
+              ztriangle_code_avx2[34],
+              ztriangle_code_avx2[35],
+              ztriangle_code_1[87],
+              ztriangle_code_1[88],
+              ztriangle_code_1[89]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[36],
+              ztriangle_code_avx2[37],
+              ztriangle_code_1[92],
+              ztriangle_code_1[103],
+              ztriangle_code_1[104]
+            },
+            {
+              ztriangle_code_avx2[38],
+              ztriangle_code_avx2[39],
+              ztriangle_code_1[97],
+              ztriangle_code_1[103],
+              ztriangle_code_1[104]
+            },
+            {
+              ztriangle_code_avx2[40],
+              ztriangle_code_avx2[41],
+              ztriangle_code_1[102],
+              ztriangle_code_1[103],
+              ztriangle_code_1[104]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[42],
+              ztriangle_code_avx2[43],
+              ztriangle_code_1[107],
+              ztriangle_code_1[118],
+              ztriangle_code_1[119]
+            },
+            {
+              ztriangle_code_avx2[44],
+              ztriangle_code_avx2[45],
+              ztriangle_code_1[112],
+              ztriangle_code_1[118],
+              ztriangle_code_1[119]
+            },
+            {
+              ztriangle_code_avx2[46],
+              ztriangle_code_avx2[47],
+              ztriangle_code_1[117],
+              ztriangle_code_1[118],
+              ztriangle_code_1[119]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[48],
+              ztriangle_code_avx2[49],
+              ztriangle_code_1[122],
+              ztriangle_code_1[133],
+              ztriangle_code_1[134]
+            },
+            {
+              ztriangle_code_avx2[50],
+              ztriangle_code_avx2[51],
+              ztriangle_code_1[127],
+              ztriangle_code_1[133],
+              ztriangle_code_1[134]
+            },
+            {
+              ztriangle_code_avx2[52],
+              ztriangle_code_avx2[53],
+              ztriangle_code_1[132],
+              ztriangle_code_1[133],
+              ztriangle_code_1[134]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[54],
+              ztriangle_code_avx2[55],
+              ztriangle_code_1[137],
+              ztriangle_code_1[148],
+              ztriangle_code_1[149]
+            },
+            {
+              ztriangle_code_avx2[56],
+              ztriangle_code_avx2[57],
+              ztriangle_code_1[142],
+              ztriangle_code_1[148],
+              ztriangle_code_1[149]
+            },
+            {
+              ztriangle_code_avx2[58],
+              ztriangle_code_avx2[59],
+              ztriangle_code_1[147],
+              ztriangle_code_1[148],
+              ztriangle_code_1[149]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[60],
+              ztriangle_code_avx2[61],
+              ztriangle_code_1[152],
+              ztriangle_code_1[163],
+              ztriangle_code_1[164]
+            },
+            {
+              ztriangle_code_avx2[62],
+              ztriangle_code_avx2[63],
+              ztriangle_code_1[157],
+              ztriangle_code_1[163],
+              ztriangle_code_1[164]
+            },
+            {
+              ztriangle_code_avx2[64],
+              ztriangle_code_avx2[65],
+              ztriangle_code_1[162],
+              ztriangle_code_1[163],
+              ztriangle_code_1[164]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[66],
+              ztriangle_code_avx2[67],
+              ztriangle_code_1[167],
+              ztriangle_code_1[178],
+              ztriangle_code_1[179]
+            },
+            {
+              ztriangle_code_avx2[68],
+              ztriangle_code_avx2[69],
+              ztriangle_code_1[172],
+              ztriangle_code_1[178],
+              ztriangle_code_1[179]
+            },
+            {
+              ztriangle_code_avx2[70],
+              ztriangle_code_avx2[71],
+              ztriangle_code_1[177],
+              ztriangle_code_1[178],
+              ztriangle_code_1[179]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[72],
+              ztriangle_code_avx2[73],
+              ztriangle_code_1[182],
+              ztriangle_code_1[193],
+              ztriangle_code_1[194]
+            },
+            {
+              ztriangle_code_avx2[74],
+              ztriangle_code_avx2[75],
+              ztriangle_code_1[187],
+              ztriangle_code_1[193],
+              ztriangle_code_1[194]
+            },
+            {
+              ztriangle_code_avx2[76],
+              ztriangle_code_avx2[77],
+              ztriangle_code_1[192],
+              ztriangle_code_1[193],
+              ztriangle_code_1[194]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[78],
+              ztriangle_code_avx2[79],
+              ztriangle_code_1[197],
+              ztriangle_code_1[208],
+              ztriangle_code_1[209]
+            },
+            {
+              ztriangle_code_avx2[80],
+              ztriangle_code_avx2[81],
+              ztriangle_code_1[202],
+              ztriangle_code_1[208],
+              ztriangle_code_1[209]
+            },
+            {
+              ztriangle_code_avx2[82],
+              ztriangle_code_avx2[83],
+              ztriangle_code_1[207],
+              ztriangle_code_1[208],
+              ztriangle_code_1[209]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[84],
+              ztriangle_code_avx2[85],
+              ztriangle_code_1[212],
+              ztriangle_code_1[223],
+              ztriangle_code_1[224]
+            },
+            {
+              ztriangle_code_avx2[86],
+              ztriangle_code_avx2[87],
+              ztriangle_code_1[217],
+              ztriangle_code_1[223],
+              ztriangle_code_1[224]
+            },
+            {
+              ztriangle_code_avx2[88],
+              ztriangle_code_avx2[89],
+              ztriangle_code_1[222],
+              ztriangle_code_1[223],
+              ztriangle_code_1[224]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[90],
+              ztriangle_code_avx2[91],
+              ztriangle_code_1[227],
+              ztriangle_code_1[238],
+              ztriangle_code_1[239]
+            },
+            {
+              ztriangle_code_avx2[92],
+              ztriangle_code_avx2[93],
+              ztriangle_code_1[232],
+              ztriangle_code_1[238],
+              ztriangle_code_1[239]
+            },
+            {
+              ztriangle_code_avx2[94],
+              ztriangle_code_avx2[95],
+              ztriangle_code_1[237],
+              ztriangle_code_1[238],
+              ztriangle_code_1[239]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[96],
+              ztriangle_code_avx2[97],
+              ztriangle_code_1[242],
+              ztriangle_code_1[253],
+              ztriangle_code_1[254]
+            },
+            {
+              ztriangle_code_avx2[98],
+              ztriangle_code_avx2[99],
+              ztriangle_code_1[247],
+              ztriangle_code_1[253],
+              ztriangle_code_1[254]
+            },
+            {
+              ztriangle_code_avx2[100],
+              ztriangle_code_avx2[101],
+              ztriangle_code_1[252],
+              ztriangle_code_1[253],
+              ztriangle_code_1[254]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[102],
+              ztriangle_code_avx2[103],
+              ztriangle_code_1[257],
+              ztriangle_code_1[268],
+              ztriangle_code_1[269]
+            },
+            {
+              ztriangle_code_avx2[104],
+              ztriangle_code_avx2[105],
+              ztriangle_code_1[262],
+              ztriangle_code_1[268],
+              ztriangle_code_1[269]
+            },
+            {
+              ztriangle_code_avx2[106],
+              ztriangle_code_avx2[107],
+              ztriangle_code_1[267],
+              ztriangle_code_1[268],
+              ztriangle_code_1[269]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[108],
+              ztriangle_code_avx2[109],
+              ztriangle_code_1[272],
+              ztriangle_code_1[283],
+              ztriangle_code_1[284]
+            },
+            {
+              ztriangle_code_avx2[110],
+              ztriangle_code_avx2[111],
+              ztriangle_code_1[277],
+              ztriangle_code_1[283],
+              ztriangle_code_1[284]
+            },
+            {
+              ztriangle_code_avx2[112],
+              ztriangle_code_avx2[113],
+              ztriangle_code_1[282],
+              ztriangle_code_1[283],
+              ztriangle_code_1[284]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[114],
+              ztriangle_code_avx2[115],
+              ztriangle_code_1[287],
+              ztriangle_code_1[298],
+              ztriangle_code_1[299]
+            },
+            {
+              ztriangle_code_avx2[116],
+              ztriangle_code_avx2[117],
+              ztriangle_code_1[292],
+              ztriangle_code_1[298],
+              ztriangle_code_1[299]
+            },
+            {
+              ztriangle_code_avx2[118],
+              ztriangle_code_avx2[119],
+              ztriangle_code_1[297],
+              ztriangle_code_1[298],
+              ztriangle_code_1[299]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[120],
+              ztriangle_code_avx2[121],
+              ztriangle_code_1[302],
+              ztriangle_code_1[313],
+              ztriangle_code_1[314]
+            },
+            {
+              ztriangle_code_avx2[122],
+              ztriangle_code_avx2[123],
+              ztriangle_code_1[307],
+              ztriangle_code_1[313],
+              ztriangle_code_1[314]
+            },
+            {
+              ztriangle_code_avx2[124],
+              ztriangle_code_avx2[125],
+              ztriangle_code_1[312],
+              ztriangle_code_1[313],
+              ztriangle_code_1[314]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[126],
+              ztriangle_code_avx2[127],
+              ztriangle_code_1[317],
+              ztriangle_code_1[328],
+              ztriangle_code_1[329]
+            },
+            {
+              ztriangle_code_avx2[128],
+              ztriangle_code_avx2[129],
+              ztriangle_code_1[322],
+              ztriangle_code_1[328],
+              ztriangle_code_1[329]
+            },
+            {
+              ztriangle_code_avx2[130],
+              ztriangle_code_avx2[131],
+              ztriangle_code_1[327],
+              ztriangle_code_1[328],
+              ztriangle_code_1[329]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[132],
+              ztriangle_code_avx2[133],
+              ztriangle_code_1[332],
+              ztriangle_code_1[343],
+              ztriangle_code_1[344]
+            },
+            {
+              ztriangle_code_avx2[134],
+              ztriangle_code_avx2[135],
+              ztriangle_code_1[337],
+              ztriangle_code_1[343],
+              ztriangle_code_1[344]
+            },
+            {
+              ztriangle_code_avx2[136],
+              ztriangle_code_avx2[137],
+              ztriangle_code_1[342],
+              ztriangle_code_1[343],
+              ztriangle_code_1[344]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[138],
+              ztriangle_code_avx2[139],
+              ztriangle_code_1[347],
+              ztriangle_code_1[358],
+              ztriangle_code_1[359]
+            },
+            {
+              ztriangle_code_avx2[140],
+              ztriangle_code_avx2[141],
+              ztriangle_code_1[352],
+              ztriangle_code_1[358],
+              ztriangle_code_1[359]
+            },
+            {
+              ztriangle_code_avx2[142],
+              ztriangle_code_avx2[143],
+              ztriangle_code_1[357],
+              ztriangle_code_1[358],
+              ztriangle_code_1[359]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[144],
+              ztriangle_code_avx2[145],
+              ztriangle_code_1[362],
+              ztriangle_code_1[373],
+              ztriangle_code_1[374]
+            },
+            {
+              ztriangle_code_avx2[146],
+              ztriangle_code_avx2[147],
+              ztriangle_code_1[367],
+              ztriangle_code_1[373],
+              ztriangle_code_1[374]
+            },
+            {
+              ztriangle_code_avx2[148],
+              ztriangle_code_avx2[149],
+              ztriangle_code_1[372],
+              ztriangle_code_1[373],
+              ztriangle_code_1[374]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[150],
+              ztriangle_code_avx2[151],
+              ztriangle_code_1[377],
+              ztriangle_code_1[388],
+              ztriangle_code_1[389]
+            },
+            {
+              ztriangle_code_avx2[152],
+              ztriangle_code_avx2[153],
+              ztriangle_code_1[382],
+              ztriangle_code_1[388],
+              ztriangle_code_1[389]
+            },
+            {
+              ztriangle_code_avx2[154],
+              ztriangle_code_avx2[155],
+              ztriangle_code_1[387],
+              ztriangle_code_1[388],
+              ztriangle_code_1[389]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[156],
+              ztriangle_code_avx2[157],
+              ztriangle_code_1[392],
+              ztriangle_code_1[403],
+              ztriangle_code_1[404]
+            },
+            {
+              ztriangle_code_avx2[158],
+              ztriangle_code_avx2[159],
+              ztriangle_code_1[397],
+              ztriangle_code_1[403],
+              ztriangle_code_1[404]
+            },
+            {
+              ztriangle_code_avx2[160],
+              ztriangle_code_avx2[161],
+              ztriangle_code_1[402],
+              ztriangle_code_1[403],
+              ztriangle_code_1[404]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[162],
+              ztriangle_code_avx2[163],
+              ztriangle_code_1[407],
+              ztriangle_code_1[418],
+              ztriangle_code_1[419]
+            },
+            {
+              ztriangle_code_avx2[164],
+              ztriangle_code_avx2[165],
+              ztriangle_code_1[412],
+              ztriangle_code_1[418],
+              ztriangle_code_1[419]
+            },
+            {
+              ztriangle_code_avx2[166],
+              ztriangle_code_avx2[167],
+              ztriangle_code_1[417],
+              ztriangle_code_1[418],
+              ztriangle_code_1[419]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[168],
+              ztriangle_code_avx2[169],
+              ztriangle_code_1[422],
+              ztriangle_code_1[433],
+              ztriangle_code_1[434]
+            },
+            {
+              ztriangle_code_avx2[170],
+              ztriangle_code_avx2[171],
+              ztriangle_code_1[427],
+              ztriangle_code_1[433],
+              ztriangle_code_1[434]
+            },
+            {
+              ztriangle_code_avx2[172],
+              ztriangle_code_avx2[173],
+              ztriangle_code_1[432],
+              ztriangle_code_1[433],
+              ztriangle_code_1[434]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[174],
+              ztriangle_code_avx2[175],
+              ztriangle_code_1[437],
+              ztriangle_code_1[448],
+              ztriangle_code_1[449]
+            },
+            {
+              ztriangle_code_avx2[176],
+              ztriangle_code_avx2[177],
+              ztriangle_code_1[442],
+              ztriangle_code_1[448],
+              ztriangle_code_1[449]
+            },
+            {
+              ztriangle_code_avx2[178],
+              ztriangle_code_avx2[179],
+              ztriangle_code_1[447],
+              ztriangle_code_1[448],
+              ztriangle_code_1[449]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[180],
+              ztriangle_code_avx2[181],
+              ztriangle_code_1[452],
+              ztriangle_code_1[463],
+              ztriangle_code_1[464]
+            },
+            {
+              ztriangle_code_avx2[182],
+              ztriangle_code_avx2[183],
+              ztriangle_code_1[457],
+              ztriangle_code_1[463],
+              ztriangle_code_1[464]
+            },
+            {
+              ztriangle_code_avx2[184],
+              ztriangle_code_avx2[185],
+              ztriangle_code_1[462],
+              ztriangle_code_1[463],
+              ztriangle_code_1[464]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[186],
+              ztriangle_code_avx2[187],
+              ztriangle_code_1[467],
+              ztriangle_code_1[478],
+              ztriangle_code_1[479]
+            },
+            {
+              ztriangle_code_avx2[188],
+              ztriangle_code_avx2[189],
+              ztriangle_code_1[472],
+              ztriangle_code_1[478],
+              ztriangle_code_1[479]
+            },
+            {
+              ztriangle_code_avx2[190],
+              ztriangle_code_avx2[191],
+              ztriangle_code_1[477],
+              ztriangle_code_1[478],
+              ztriangle_code_1[479]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[192],
+              ztriangle_code_avx2[193],
+              ztriangle_code_1[482],
+              ztriangle_code_1[493],
+              ztriangle_code_1[494]
+            },
+            {
+              ztriangle_code_avx2[194],
+              ztriangle_code_avx2[195],
+              ztriangle_code_1[487],
+              ztriangle_code_1[493],
+              ztriangle_code_1[494]
+            },
+            {
+              ztriangle_code_avx2[196],
+              ztriangle_code_avx2[197],
+              ztriangle_code_1[492],
+              ztriangle_code_1[493],
+              ztriangle_code_1[494]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[198],
+              ztriangle_code_avx2[199],
+              ztriangle_code_1[497],
+              ztriangle_code_1[508],
+              ztriangle_code_1[509]
+            },
+            {
+              ztriangle_code_avx2[200],
+              ztriangle_code_avx2[201],
+              ztriangle_code_1[502],
+              ztriangle_code_1[508],
+              ztriangle_code_1[509]
+            },
+            {
+              ztriangle_code_avx2[202],
+              ztriangle_code_avx2[203],
+              ztriangle_code_1[507],
+              ztriangle_code_1[508],
+              ztriangle_code_1[509]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[204],
+              ztriangle_code_avx2[205],
+              ztriangle_code_1[512],
+              ztriangle_code_1[523],
+              ztriangle_code_1[524]
+            },
+            {
+              ztriangle_code_avx2[206],
+              ztriangle_code_avx2[207],
+              ztriangle_code_1[517],
+              ztriangle_code_1[523],
+              ztriangle_code_1[524]
+            },
+            {
+              ztriangle_code_avx2[208],
+              ztriangle_code_avx2[209],
+              ztriangle_code_1[522],
+              ztriangle_code_1[523],
+              ztriangle_code_1[524]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[210],
+              ztriangle_code_avx2[211],
+              ztriangle_code_1[527],
+              ztriangle_code_1[538],
+              ztriangle_code_1[539]
+            },
+            {
+              ztriangle_code_avx2[212],
+              ztriangle_code_avx2[213],
+              ztriangle_code_1[532],
+              ztriangle_code_1[538],
+              ztriangle_code_1[539]
+            },
+            {
+              ztriangle_code_avx2[214],
+              ztriangle_code_avx2[215],
+              ztriangle_code_1[537],
+              ztriangle_code_1[538],
+              ztriangle_code_1[539]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[216],
+              ztriangle_code_avx2[217],
+              ztriangle_code_2[2],
+              ztriangle_code_2[13],
+              ztriangle_code_2[14]
+            },
+            {
+              ztriangle_code_avx2[218],
+              ztriangle_code_avx2[219],
+              ztriangle_code_2[7],
+              ztriangle_code_2[13],
+              ztriangle_code_2[14]
+            },
+            {
+              ztriangle_code_avx2[220],
+              ztriangle_code_avx2[221],
+              ztriangle_code_2[12],
+              ztriangle_code_2[13],
+              ztriangle_code_2[14]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[222],
+              ztriangle_code_avx2[223],
+              ztriangle_code_2[17],
+              ztriangle_code_2[28],
+              ztriangle_code_2[29]
+            },
+            {
+              ztriangle_code_avx2[224],
+              ztriangle_code_avx2[225],
+              ztriangle_code_2[22],
+              ztriangle_code_2[28],
+              ztriangle_code_2[29]
+            },
+            {
+              ztriangle_code_avx2[226],
+              ztriangle_code_avx2[227],
+              ztriangle_code_2[27],
+              ztriangle_code_2[28],
+              ztriangle_code_2[29]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[228],
+              ztriangle_code_avx2[229],
+              ztriangle_code_2[32],
+              ztriangle_code_2[43],
+              ztriangle_code_2[44]
+            },
+            {
+              ztriangle_code_avx2[230],
+              ztriangle_code_avx2[231],
+              ztriangle_code_2[37],
+              ztriangle_code_2[43],
+              ztriangle_code_2[44]
+            },
+            {
+              ztriangle_code_avx2[232],
+              ztriangle_code_avx2[233],
+              ztriangle_code_2[42],
+              ztriangle_code_2[43],
+              ztriangle_code_2[44]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[234],
+              ztriangle_code_avx2[235],
+              ztriangle_code_2[47],
+              ztriangle_code_2[58],
+              ztriangle_code_2[59]
+            },
+            {
+              ztriangle_code_avx2[236],
+              ztriangle_code_avx2[237],
+              ztriangle_code_2[52],
+              ztriangle_code_2[58],
+              ztriangle_code_2[59]
+            },
+            {
+              ztriangle_code_avx2[238],
+              ztriangle_code_avx2[239],
+              ztriangle_code_2[57],
+              ztriangle_code_2[58],
+              ztriangle_code_2[59]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[240],
+              ztriangle_code_avx2[241],
+              ztriangle_code_2[62],
+              ztriangle_code_2[73],
+              ztriangle_code_2[74]
+            },
+            {
+              ztriangle_code_avx2[242],
+              ztriangle_code_avx2[243],
+              ztriangle_code_2[67],
+              ztriangle_code_2[73],
+              ztriangle_code_2[74]
+            },
+            {
+              ztriangle_code_avx2[244],
+              ztriangle_code_avx2[245],
+              ztriangle_code_2[72],
+              ztriangle_code_2[73],
+              ztriangle_code_2[74]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[246],
+              ztriangle_code_avx2[247],
+              ztriangle_code_2[77],
+              ztriangle_code_2[88],
+              ztriangle_code_2[89]
+            },
+            {
+              ztriangle_code_avx2[248],
+              ztriangle_code_avx2[249],
+              ztriangle_code_2[82],
+              ztriangle_code_2[88],
+              ztriangle_code_2[89]
+            },
+            {
+              ztriangle_code_avx2[250],
+              ztriangle_code_avx2[251],
+              ztriangle_code_2[87],
+              ztriangle_code_2[88],
+              ztriangle_code_2[89]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[252],
+              ztriangle_code_avx2[253],
+              ztriangle_code_2[92],
+              ztriangle_code_2[103],
+              ztriangle_code_2[104]
+            },
+            {
+              ztriangle_code_avx2[254],
+              ztriangle_code_avx2[255],
+              ztriangle_code_2[97],
+              ztriangle_code_2[103],
+              ztriangle_code_2[104]
+            },
+            {
+              ztriangle_code_avx2[256],
+              ztriangle_code_avx2[257],
+              ztriangle_code_2[102],
+              ztriangle_code_2[103],
+              ztriangle_code_2[104]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[258],
+              ztriangle_code_avx2[259],
+              ztriangle_code_2[107],
+              ztriangle_code_2[118],
+              ztriangle_code_2[119]
+            },
+            {
+              ztriangle_code_avx2[260],
+              ztriangle_code_avx2[261],
+              ztriangle_code_2[112],
+              ztriangle_code_2[118],
+              ztriangle_code_2[119]
+            },
+            {
+              ztriangle_code_avx2[262],
+              ztriangle_code_avx2[263],
+              ztriangle_code_2[117],
+              ztriangle_code_2[118],
+              ztriangle_code_2[119]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[264],
+              ztriangle_code_avx2[265],
+              ztriangle_code_2[122],
+              ztriangle_code_2[133],
+              ztriangle_code_2[134]
+            },
+            {
+              ztriangle_code_avx2[266],
+              ztriangle_code_avx2[267],
+              ztriangle_code_2[127],
+              ztriangle_code_2[133],
+              ztriangle_code_2[134]
+            },
+            {
+              ztriangle_code_avx2[268],
+              ztriangle_code_avx2[269],
+              ztriangle_code_2[132],
+              ztriangle_code_2[133],
+              ztriangle_code_2[134]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[270],
+              ztriangle_code_avx2[271],
+              ztriangle_code_2[137],
+              ztriangle_code_2[148],
+              ztriangle_code_2[149]
+            },
+            {
+              ztriangle_code_avx2[272],
+              ztriangle_code_avx2[273],
+              ztriangle_code_2[142],
+              ztriangle_code_2[148],
+              ztriangle_code_2[149]
+            },
+            {
+              ztriangle_code_avx2[274],
+              ztriangle_code_avx2[275],
+              ztriangle_code_2[147],
+              ztriangle_code_2[148],
+              ztriangle_code_2[149]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[276],
+              ztriangle_code_avx2[277],
+              ztriangle_code_2[152],
+              ztriangle_code_2[163],
+              ztriangle_code_2[164]
+            },
+            {
+              ztriangle_code_avx2[278],
+              ztriangle_code_avx2[279],
+              ztriangle_code_2[157],
+              ztriangle_code_2[163],
+              ztriangle_code_2[164]
+            },
+            {
+              ztriangle_code_avx2[280],
+              ztriangle_code_avx2[281],
+              ztriangle_code_2[162],
+              ztriangle_code_2[163],
+              ztriangle_code_2[164]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[282],
+              ztriangle_code_avx2[283],
+              ztriangle_code_2[167],
+              ztriangle_code_2[178],
+              ztriangle_code_2[179]
+            },
+            {
+              ztriangle_code_avx2[284],
+              ztriangle_code_avx2[285],
+              ztriangle_code_2[172],
+              ztriangle_code_2[178],
+              ztriangle_code_2[179]
+            },
+            {
+              ztriangle_code_avx2[286],
+              ztriangle_code_avx2[287],
+              ztriangle_code_2[177],
+              ztriangle_code_2[178],
+              ztriangle_code_2[179]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[288],
+              ztriangle_code_avx2[289],
+              ztriangle_code_2[182],
+              ztriangle_code_2[193],
+              ztriangle_code_2[194]
+            },
+            {
+              ztriangle_code_avx2[290],
+              ztriangle_code_avx2[291],
+              ztriangle_code_2[187],
+              ztriangle_code_2[193],
+              ztriangle_code_2[194]
+            },
+            {
+              ztriangle_code_avx2[292],
+              ztriangle_code_avx2[293],
+              ztriangle_code_2[192],
+              ztriangle_code_2[193],
+              ztriangle_code_2[194]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[294],
+              ztriangle_code_avx2[295],
+              ztriangle_code_2[197],
+              ztriangle_code_2[208],
+              ztriangle_code_2[209]
+            },
+            {
+              ztriangle_code_avx2[296],
+              ztriangle_code_avx2[297],
+              ztriangle_code_2[202],
+              ztriangle_code_2[208],
+              ztriangle_code_2[209]
+            },
+            {
+              ztriangle_code_avx2[298],
+              ztriangle_code_avx2[299],
+              ztriangle_code_2[207],
+              ztriangle_code_2[208],
+              ztriangle_code_2[209]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[300],
+              ztriangle_code_avx2[301],
+              ztriangle_code_2[212],
+              ztriangle_code_2[223],
+              ztriangle_code_2[224]
+            },
+            {
+              ztriangle_code_avx2[302],
+              ztriangle_code_avx2[303],
+              ztriangle_code_2[217],
+              ztriangle_code_2[223],
+              ztriangle_code_2[224]
+            },
+            {
+              ztriangle_code_avx2[304],
+              ztriangle_code_avx2[305],
+              ztriangle_code_2[222],
+              ztriangle_code_2[223],
+              ztriangle_code_2[224]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[306],
+              ztriangle_code_avx2[307],
+              ztriangle_code_2[227],
+              ztriangle_code_2[238],
+              ztriangle_code_2[239]
+            },
+            {
+              ztriangle_code_avx2[308],
+              ztriangle_code_avx2[309],
+              ztriangle_code_2[232],
+              ztriangle_code_2[238],
+              ztriangle_code_2[239]
+            },
+            {
+              ztriangle_code_avx2[310],
+              ztriangle_code_avx2[311],
+              ztriangle_code_2[237],
+              ztriangle_code_2[238],
+              ztriangle_code_2[239]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[312],
+              ztriangle_code_avx2[313],
+              ztriangle_code_2[242],
+              ztriangle_code_2[253],
+              ztriangle_code_2[254]
+            },
+            {
+              ztriangle_code_avx2[314],
+              ztriangle_code_avx2[315],
+              ztriangle_code_2[247],
+              ztriangle_code_2[253],
+              ztriangle_code_2[254]
+            },
+            {
+              ztriangle_code_avx2[316],
+              ztriangle_code_avx2[317],
+              ztriangle_code_2[252],
+              ztriangle_code_2[253],
+              ztriangle_code_2[254]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[318],
+              ztriangle_code_avx2[319],
+              ztriangle_code_2[257],
+              ztriangle_code_2[268],
+              ztriangle_code_2[269]
+            },
+            {
+              ztriangle_code_avx2[320],
+              ztriangle_code_avx2[321],
+              ztriangle_code_2[262],
+              ztriangle_code_2[268],
+              ztriangle_code_2[269]
+            },
+            {
+              ztriangle_code_avx2[322],
+              ztriangle_code_avx2[323],
+              ztriangle_code_2[267],
+              ztriangle_code_2[268],
+              ztriangle_code_2[269]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[324],
+              ztriangle_code_avx2[325],
+              ztriangle_code_2[272],
+              ztriangle_code_2[283],
+              ztriangle_code_2[284]
+            },
+            {
+              ztriangle_code_avx2[326],
+              ztriangle_code_avx2[327],
+              ztriangle_code_2[277],
+              ztriangle_code_2[283],
+              ztriangle_code_2[284]
+            },
+            {
+              ztriangle_code_avx2[328],
+              ztriangle_code_avx2[329],
+              ztriangle_code_2[282],
+              ztriangle_code_2[283],
+              ztriangle_code_2[284]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[330],
+              ztriangle_code_avx2[331],
+              ztriangle_code_2[287],
+              ztriangle_code_2[298],
+              ztriangle_code_2[299]
+            },
+            {
+              ztriangle_code_avx2[332],
+              ztriangle_code_avx2[333],
+              ztriangle_code_2[292],
+              ztriangle_code_2[298],
+              ztriangle_code_2[299]
+            },
+            {
+              ztriangle_code_avx2[334],
+              ztriangle_code_avx2[335],
+              ztriangle_code_2[297],
+              ztriangle_code_2[298],
+              ztriangle_code_2[299]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[336],
+              ztriangle_code_avx2[337],
+              ztriangle_code_2[302],
+              ztriangle_code_2[313],
+              ztriangle_code_2[314]
+            },
+            {
+              ztriangle_code_avx2[338],
+              ztriangle_code_avx2[339],
+              ztriangle_code_2[307],
+              ztriangle_code_2[313],
+              ztriangle_code_2[314]
+            },
+            {
+              ztriangle_code_avx2[340],
+              ztriangle_code_avx2[341],
+              ztriangle_code_2[312],
+              ztriangle_code_2[313],
+              ztriangle_code_2[314]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[342],
+              ztriangle_code_avx2[343],
+              ztriangle_code_2[317],
+              ztriangle_code_2[328],
+              ztriangle_code_2[329]
+            },
+            {
+              ztriangle_code_avx2[344],
+              ztriangle_code_avx2[345],
+              ztriangle_code_2[322],
+              ztriangle_code_2[328],
+              ztriangle_code_2[329]
+            },
+            {
+              ztriangle_code_avx2[346],
+              ztriangle_code_avx2[347],
+              ztriangle_code_2[327],
+              ztriangle_code_2[328],
+              ztriangle_code_2[329]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[348],
+              ztriangle_code_avx2[349],
+              ztriangle_code_2[332],
+              ztriangle_code_2[343],
+              ztriangle_code_2[344]
+            },
+            {
+              ztriangle_code_avx2[350],
+              ztriangle_code_avx2[351],
+              ztriangle_code_2[337],
+              ztriangle_code_2[343],
+              ztriangle_code_2[344]
+            },
+            {
+              ztriangle_code_avx2[352],
+              ztriangle_code_avx2[353],
+              ztriangle_code_2[342],
+              ztriangle_code_2[343],
+              ztriangle_code_2[344]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[354],
+              ztriangle_code_avx2[355],
+              ztriangle_code_2[347],
+              ztriangle_code_2[358],
+              ztriangle_code_2[359]
+            },
+            {
+              ztriangle_code_avx2[356],
+              ztriangle_code_avx2[357],
+              ztriangle_code_2[352],
+              ztriangle_code_2[358],
+              ztriangle_code_2[359]
+            },
+            {
+              ztriangle_code_avx2[358],
+              ztriangle_code_avx2[359],
+              ztriangle_code_2[357],
+              ztriangle_code_2[358],
+              ztriangle_code_2[359]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[360],
+              ztriangle_code_avx2[361],
+              ztriangle_code_2[362],
+              ztriangle_code_2[373],
+              ztriangle_code_2[374]
+            },
+            {
+              ztriangle_code_avx2[362],
+              ztriangle_code_avx2[363],
+              ztriangle_code_2[367],
+              ztriangle_code_2[373],
+              ztriangle_code_2[374]
+            },
+            {
+              ztriangle_code_avx2[364],
+              ztriangle_code_avx2[365],
+              ztriangle_code_2[372],
+              ztriangle_code_2[373],
+              ztriangle_code_2[374]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[366],
+              ztriangle_code_avx2[367],
+              ztriangle_code_2[377],
+              ztriangle_code_2[388],
+              ztriangle_code_2[389]
+            },
+            {
+              ztriangle_code_avx2[368],
+              ztriangle_code_avx2[369],
+              ztriangle_code_2[382],
+              ztriangle_code_2[388],
+              ztriangle_code_2[389]
+            },
+            {
+              ztriangle_code_avx2[370],
+              ztriangle_code_avx2[371],
+              ztriangle_code_2[387],
+              ztriangle_code_2[388],
+              ztriangle_code_2[389]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[372],
+              ztriangle_code_avx2[373],
+              ztriangle_code_2[392],
+              ztriangle_code_2[403],
+              ztriangle_code_2[404]
+            },
+            {
+              ztriangle_code_avx2[374],
+              ztriangle_code_avx2[375],
+              ztriangle_code_2[397],
+              ztriangle_code_2[403],
+              ztriangle_code_2[404]
+            },
+            {
+              ztriangle_code_avx2[376],
+              ztriangle_code_avx2[377],
+              ztriangle_code_2[402],
+              ztriangle_code_2[403],
+              ztriangle_code_2[404]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[378],
+              ztriangle_code_avx2[379],
+              ztriangle_code_2[407],
+              ztriangle_code_2[418],
+              ztriangle_code_2[419]
+            },
+            {
+              ztriangle_code_avx2[380],
+              ztriangle_code_avx2[381],
+              ztriangle_code_2[412],
+              ztriangle_code_2[418],
+              ztriangle_code_2[419]
+            },
+            {
+              ztriangle_code_avx2[382],
+              ztriangle_code_avx2[383],
+              ztriangle_code_2[417],
+              ztriangle_code_2[418],
+              ztriangle_code_2[419]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[384],
+              ztriangle_code_avx2[385],
+              ztriangle_code_2[422],
+              ztriangle_code_2[433],
+              ztriangle_code_2[434]
+            },
+            {
+              ztriangle_code_avx2[386],
+              ztriangle_code_avx2[387],
+              ztriangle_code_2[427],
+              ztriangle_code_2[433],
+              ztriangle_code_2[434]
+            },
+            {
+              ztriangle_code_avx2[388],
+              ztriangle_code_avx2[389],
+              ztriangle_code_2[432],
+              ztriangle_code_2[433],
+              ztriangle_code_2[434]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[390],
+              ztriangle_code_avx2[391],
+              ztriangle_code_2[437],
+              ztriangle_code_2[448],
+              ztriangle_code_2[449]
+            },
+            {
+              ztriangle_code_avx2[392],
+              ztriangle_code_avx2[393],
+              ztriangle_code_2[442],
+              ztriangle_code_2[448],
+              ztriangle_code_2[449]
+            },
+            {
+              ztriangle_code_avx2[394],
+              ztriangle_code_avx2[395],
+              ztriangle_code_2[447],
+              ztriangle_code_2[448],
+              ztriangle_code_2[449]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[396],
+              ztriangle_code_avx2[397],
+              ztriangle_code_2[452],
+              ztriangle_code_2[463],
+              ztriangle_code_2[464]
+            },
+            {
+              ztriangle_code_avx2[398],
+              ztriangle_code_avx2[399],
+              ztriangle_code_2[457],
+              ztriangle_code_2[463],
+              ztriangle_code_2[464]
+            },
+            {
+              ztriangle_code_avx2[400],
+              ztriangle_code_avx2[401],
+              ztriangle_code_2[462],
+              ztriangle_code_2[463],
+              ztriangle_code_2[464]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[402],
+              ztriangle_code_avx2[403],
+              ztriangle_code_2[467],
+              ztriangle_code_2[478],
+              ztriangle_code_2[479]
+            },
+            {
+              ztriangle_code_avx2[404],
+              ztriangle_code_avx2[405],
+              ztriangle_code_2[472],
+              ztriangle_code_2[478],
+              ztriangle_code_2[479]
+            },
+            {
+              ztriangle_code_avx2[406],
+              ztriangle_code_avx2[407],
+              ztriangle_code_2[477],
+              ztriangle_code_2[478],
+              ztriangle_code_2[479]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[408],
+              ztriangle_code_avx2[409],
+              ztriangle_code_2[482],
+              ztriangle_code_2[493],
+              ztriangle_code_2[494]
+            },
+            {
+              ztriangle_code_avx2[410],
+              ztriangle_code_avx2[411],
+              ztriangle_code_2[487],
+              ztriangle_code_2[493],
+              ztriangle_code_2[494]
+            },
+            {
+              ztriangle_code_avx2[412],
+              ztriangle_code_avx2[413],
+              ztriangle_code_2[492],
+              ztriangle_code_2[493],
+              ztriangle_code_2[494]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[414],
+              ztriangle_code_avx2[415],
+              ztriangle_code_2[497],
+              ztriangle_code_2[508],
+              ztriangle_code_2[509]
+            },
+            {
+              ztriangle_code_avx2[416],
+              ztriangle_code_avx2[417],
+              ztriangle_code_2[502],
+              ztriangle_code_2[508],
+              ztriangle_code_2[509]
+            },
+            {
+              ztriangle_code_avx2[418],
+              ztriangle_code_avx2[419],
+              ztriangle_code_2[507],
+              ztriangle_code_2[508],
+              ztriangle_code_2[509]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[420],
+              ztriangle_code_avx2[421],
+              ztriangle_code_2[512],
+              ztriangle_code_2[523],
+              ztriangle_code_2[524]
+            },
+            {
+              ztriangle_code_avx2[422],
+              ztriangle_code_avx2[423],
+              ztriangle_code_2[517],
+              ztriangle_code_2[523],
+              ztriangle_code_2[524]
+            },
+            {
+              ztriangle_code_avx2[424],
+              ztriangle_code_avx2[425],
+              ztriangle_code_2[522],
+              ztriangle_code_2[523],
+              ztriangle_code_2[524]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[426],
+              ztriangle_code_avx2[427],
+              ztriangle_code_2[527],
+              ztriangle_code_2[538],
+              ztriangle_code_2[539]
+            },
+            {
+              ztriangle_code_avx2[428],
+              ztriangle_code_avx2[429],
+              ztriangle_code_2[532],
+              ztriangle_code_2[538],
+              ztriangle_code_2[539]
+            },
+            {
+              ztriangle_code_avx2[430],
+              ztriangle_code_avx2[431],
+              ztriangle_code_2[537],
+              ztriangle_code_2[538],
+              ztriangle_code_2[539]
+            }
+          }
+        }
+      }
+    }
+  },
+  {
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[432],
+              ztriangle_code_avx2[433],
+              ztriangle_code_3[2],
+              ztriangle_code_3[13],
+              ztriangle_code_3[14]
+            },
+            {
+              ztriangle_code_avx2[434],
+              ztriangle_code_avx2[435],
+              ztriangle_code_3[7],
+              ztriangle_code_3[13],
+              ztriangle_code_3[14]
+            },
+            {
+              ztriangle_code_avx2[436],
+              ztriangle_code_avx2[437],
+              ztriangle_code_3[12],
+              ztriangle_code_3[13],
+              ztriangle_code_3[14]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[438],
+              ztriangle_code_avx2[439],
+              ztriangle_code_3[17],
+              ztriangle_code_3[28],
+              ztriangle_code_3[29]
+            },
+            {
+              ztriangle_code_avx2[440],
+              ztriangle_code_avx2[441],
+              ztriangle_code_3[22],
+              ztriangle_code_3[28],
+              ztriangle_code_3[29]
+            },
+            {
+              ztriangle_code_avx2[442],
+              ztriangle_code_avx2[443],
+              ztriangle_code_3[27],
+              ztriangle_code_3[28],
+              ztriangle_code_3[29]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[444],
+              ztriangle_code_avx2[445],
+              ztriangle_code_3[32],
+              ztriangle_code_3[43],
+              ztriangle_code_3[44]
+            },
+            {
+              ztriangle_code_avx2[446],
+              ztriangle_code_avx2[447],
+              ztriangle_code_3[37],
+              ztriangle_code_3[43],
+              ztriangle_code_3[44]
+            },
+            {
+              ztriangle_code_avx2[448],
+              ztriangle_code_avx2[449],
+              ztriangle_code_3[42],
+              ztriangle_code_3[43],
+              ztriangle_code_3[44]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[450],
+              ztriangle_code_avx2[451],
+              ztriangle_code_3[47],
+              ztriangle_code_3[58],
+              ztriangle_code_3[59]
+            },
+            {
+              ztriangle_code_avx2[452],
+              ztriangle_code_avx2[453],
+              ztriangle_code_3[52],
+              ztriangle_code_3[58],
+              ztriangle_code_3[59]
+            },
+            {
+              ztriangle_code_avx2[454],
+              ztriangle_code_avx2[455],
+              ztriangle_code_3[57],
+              ztriangle_code_3[58],
+              ztriangle_code_3[59]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[456],
+              ztriangle_code_avx2[457],
+              ztriangle_code_3[62],
+              ztriangle_code_3[73],
+              ztriangle_code_3[74]
+            },
+            {
+              ztriangle_code_avx2[458],
+              ztriangle_code_avx2[459],
+              ztriangle_code_3[67],
+              ztriangle_code_3[73],
+              ztriangle_code_3[74]
+            },
+            {
+              ztriangle_code_avx2[460],
+              ztriangle_code_avx2[461],
+              ztriangle_code_3[72],
+              ztriangle_code_3[73],
+              ztriangle_code_3[74]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[462],
+              ztriangle_code_avx2[463],
+              ztriangle_code_3[77],
+              ztriangle_code_3[88],
+              ztriangle_code_3[89]
+            },
+            {
+              ztriangle_code_avx2[464],
+              ztriangle_code_avx2[465],
+              ztriangle_code_3[82],
+              ztriangle_code_3[88],
+              ztriangle_code_3[89]
+            },
+            {
+              ztriangle_code_avx2[466],
+              ztriangle_code_avx2[467],
+              ztriangle_code_3[87],
+              ztriangle_code_3[88],
+              ztriangle_code_3[89]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[468],
+              ztriangle_code_avx2[469],
+              ztriangle_code_3[92],
+              ztriangle_code_3[103],
+              ztriangle_code_3[104]
+            },
+            {
+              ztriangle_code_avx2[470],
+              ztriangle_code_avx2[471],
+              ztriangle_code_3[97],
+              ztriangle_code_3[103],
+              ztriangle_code_3[104]
+            },
+            {
+              ztriangle_code_avx2[472],
+              ztriangle_code_avx2[473],
+              ztriangle_code_3[102],
+              ztriangle_code_3[103],
+              ztriangle_code_3[104]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[474],
+              ztriangle_code_avx2[475],
+              ztriangle_code_3[107],
+              ztriangle_code_3[118],
+              ztriangle_code_3[119]
+            },
+            {
+              ztriangle_code_avx2[476],
+              ztriangle_code_avx2[477],
+              ztriangle_code_3[112],
+              ztriangle_code_3[118],
+              ztriangle_code_3[119]
+            },
+            {
+              ztriangle_code_avx2[478],
+              ztriangle_code_avx2[479],
+              ztriangle_code_3[117],
+              ztriangle_code_3[118],
+              ztriangle_code_3[119]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[480],
+              ztriangle_code_avx2[481],
+              ztriangle_code_3[122],
+              ztriangle_code_3[133],
+              ztriangle_code_3[134]
+            },
+            {
+              ztriangle_code_avx2[482],
+              ztriangle_code_avx2[483],
+              ztriangle_code_3[127],
+              ztriangle_code_3[133],
+              ztriangle_code_3[134]
+            },
+            {
+              ztriangle_code_avx2[484],
+              ztriangle_code_avx2[485],
+              ztriangle_code_3[132],
+              ztriangle_code_3[133],
+              ztriangle_code_3[134]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[486],
+              ztriangle_code_avx2[487],
+              ztriangle_code_3[137],
+              ztriangle_code_3[148],
+              ztriangle_code_3[149]
+            },
+            {
+              ztriangle_code_avx2[488],
+              ztriangle_code_avx2[489],
+              ztriangle_code_3[142],
+              ztriangle_code_3[148],
+              ztriangle_code_3[149]
+            },
+            {
+              ztriangle_code_avx2[490],
+              ztriangle_code_avx2[491],
+              ztriangle_code_3[147],
+              ztriangle_code_3[148],
+              ztriangle_code_3[149]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[492],
+              ztriangle_code_avx2[493],
+              ztriangle_code_3[152],
+              ztriangle_code_3[163],
+              ztriangle_code_3[164]
+            },
+            {
+              ztriangle_code_avx2[494],
+              ztriangle_code_avx2[495],
+              ztriangle_code_3[157],
+              ztriangle_code_3[163],
+              ztriangle_code_3[164]
+            },
+            {
+              ztriangle_code_avx2[496],
+              ztriangle_code_avx2[497],
+              ztriangle_code_3[162],
+              ztriangle_code_3[163],
+              ztriangle_code_3[164]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[498],
+              ztriangle_code_avx2[499],
+              ztriangle_code_3[167],
+              ztriangle_code_3[178],
+              ztriangle_code_3[179]
+            },
+            {
+              ztriangle_code_avx2[500],
+              ztriangle_code_avx2[501],
+              ztriangle_code_3[172],
+              ztriangle_code_3[178],
+              ztriangle_code_3[179]
+            },
+            {
+              ztriangle_code_avx2[502],
+              ztriangle_code_avx2[503],
+              ztriangle_code_3[177],
+              ztriangle_code_3[178],
+              ztriangle_code_3[179]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[504],
+              ztriangle_code_avx2[505],
+              ztriangle_code_3[182],
+              ztriangle_code_3[193],
+              ztriangle_code_3[194]
+            },
+            {
+              ztriangle_code_avx2[506],
+              ztriangle_code_avx2[507],
+              ztriangle_code_3[187],
+              ztriangle_code_3[193],
+              ztriangle_code_3[194]
+            },
+            {
+              ztriangle_code_avx2[508],
+              ztriangle_code_avx2[509],
+              ztriangle_code_3[192],
+              ztriangle_code_3[193],
+              ztriangle_code_3[194]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[510],
+              ztriangle_code_avx2[511],
+              ztriangle_code_3[197],
+              ztriangle_code_3[208],
+              ztriangle_code_3[209]
+            },
+            {
+              ztriangle_code_avx2[512],
+              ztriangle_code_avx2[513],
+              ztriangle_code_3[202],
+              ztriangle_code_3[208],
+              ztriangle_code_3[209]
+            },
+            {
+              ztriangle_code_avx2[514],
+              ztriangle_code_avx2[515],
+              ztriangle_code_3[207],
+              ztriangle_code_3[208],
+              ztriangle_code_3[209]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[516],
+              ztriangle_code_avx2[517],
+              ztriangle_code_3[212],
+              ztriangle_code_3[223],
+              ztriangle_code_3[224]
+            },
+            {
+              ztriangle_code_avx2[518],
+              ztriangle_code_avx2[519],
+              ztriangle_code_3[217],
+              ztriangle_code_3[223],
+              ztriangle_code_3[224]
+            },
+            {
+              ztriangle_code_avx2[520],
+              ztriangle_code_avx2[521],
+              ztriangle_code_3[222],
+              ztriangle_code_3[223],
+              ztriangle_code_3[224]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[522],
+              ztriangle_code_avx2[523],
+              ztriangle_code_3[227],
+              ztriangle_code_3[238],
+              ztriangle_code_3[239]
+            },
+            {
+              ztriangle_code_avx2[524],
+              ztriangle_code_avx2[525],
+              ztriangle_code_3[232],
+              ztriangle_code_3[238],
+              ztriangle_code_3[239]
+            },
+            {
+              ztriangle_code_avx2[526],
+              ztriangle_code_avx2[527],
+              ztriangle_code_3[237],
+              ztriangle_code_3[238],
+              ztriangle_code_3[239]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[528],
+              ztriangle_code_avx2[529],
+              ztriangle_code_3[242],
+              ztriangle_code_3[253],
+              ztriangle_code_3[254]
+            },
+            {
+              ztriangle_code_avx2[530],
+              ztriangle_code_avx2[531],
+              ztriangle_code_3[247],
+              ztriangle_code_3[253],
+              ztriangle_code_3[254]
+            },
+            {
+              ztriangle_code_avx2[532],
+              ztriangle_code_avx2[533],
+              ztriangle_code_3[252],
+              ztriangle_code_3[253],
+              ztriangle_code_3[254]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[534],
+              ztriangle_code_avx2[535],
+              ztriangle_code_3[257],
+              ztriangle_code_3[268],
+              ztriangle_code_3[269]
+            },
+            {
+              ztriangle_code_avx2[536],
+              ztriangle_code_avx2[537],
+              ztriangle_code_3[262],
+              ztriangle_code_3[268],
+              ztriangle_code_3[269]
+            },
+            {
+              ztriangle_code_avx2[538],
+              ztriangle_code_avx2[539],
+              ztriangle_code_3[267],
+              ztriangle_code_3[268],
+              ztriangle_code_3[269]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[540],
+              ztriangle_code_avx2[541],
+              ztriangle_code_3[272],
+              ztriangle_code_3[283],
+              ztriangle_code_3[284]
+            },
+            {
+              ztriangle_code_avx2[542],
+              ztriangle_code_avx2[543],
+              ztriangle_code_3[277],
+              ztriangle_code_3[283],
+              ztriangle_code_3[284]
+            },
+            {
+              ztriangle_code_avx2[544],
+              ztriangle_code_avx2[545],
+              ztriangle_code_3[282],
+              ztriangle_code_3[283],
+              ztriangle_code_3[284]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[546],
+              ztriangle_code_avx2[547],
+              ztriangle_code_3[287],
+              ztriangle_code_3[298],
+              ztriangle_code_3[299]
+            },
+            {
+              ztriangle_code_avx2[548],
+              ztriangle_code_avx2[549],
+              ztriangle_code_3[292],
+              ztriangle_code_3[298],
+              ztriangle_code_3[299]
+            },
+            {
+              ztriangle_code_avx2[550],
+              ztriangle_code_avx2[551],
+              ztriangle_code_3[297],
+              ztriangle_code_3[298],
+              ztriangle_code_3[299]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[552],
+              ztriangle_code_avx2[553],
+              ztriangle_code_3[302],
+              ztriangle_code_3[313],
+              ztriangle_code_3[314]
+            },
+            {
+              ztriangle_code_avx2[554],
+              ztriangle_code_avx2[555],
+              ztriangle_code_3[307],
+              ztriangle_code_3[313],
+              ztriangle_code_3[314]
+            },
+            {
+              ztriangle_code_avx2[556],
+              ztriangle_code_avx2[557],
+              ztriangle_code_3[312],
+              ztriangle_code_3[313],
+              ztriangle_code_3[314]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[558],
+              ztriangle_code_avx2[559],
+              ztriangle_code_3[317],
+              ztriangle_code_3[328],
+              ztriangle_code_3[329]
+            },
+            {
+              ztriangle_code_avx2[560],
+              ztriangle_code_avx2[561],
+              ztriangle_code_3[322],
+              ztriangle_code_3[328],
+              ztriangle_code_3[329]
+            },
+            {
+              ztriangle_code_avx2[562],
+              ztriangle_code_avx2[563],
+              ztriangle_code_3[327],
+              ztriangle_code_3[328],
+              ztriangle_code_3[329]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[564],
+              ztriangle_code_avx2[565],
+              ztriangle_code_3[332],
+              ztriangle_code_3[343],
+              ztriangle_code_3[344]
+            },
+            {
+              ztriangle_code_avx2[566],
+              ztriangle_code_avx2[567],
+              ztriangle_code_3[337],
+              ztriangle_code_3[343],
+              ztriangle_code_3[344]
+            },
+            {
+              ztriangle_code_avx2[568],
+              ztriangle_code_avx2[569],
+              ztriangle_code_3[342],
+              ztriangle_code_3[343],
+              ztriangle_code_3[344]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[570],
+              ztriangle_code_avx2[571],
+              ztriangle_code_3[347],
+              ztriangle_code_3[358],
+              ztriangle_code_3[359]
+            },
+            {
+              ztriangle_code_avx2[572],
+              ztriangle_code_avx2[573],
+              ztriangle_code_3[352],
+              ztriangle_code_3[358],
+              ztriangle_code_3[359]
+            },
+            {
+              ztriangle_code_avx2[574],
+              ztriangle_code_avx2[575],
+              ztriangle_code_3[357],
+              ztriangle_code_3[358],
+              ztriangle_code_3[359]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[576],
+              ztriangle_code_avx2[577],
+              ztriangle_code_3[362],
+              ztriangle_code_3[373],
+              ztriangle_code_3[374]
+            },
+            {
+              ztriangle_code_avx2[578],
+              ztriangle_code_avx2[579],
+              ztriangle_code_3[367],
+              ztriangle_code_3[373],
+              ztriangle_code_3[374]
+            },
+            {
+              ztriangle_code_avx2[580],
+              ztriangle_code_avx2[581],
+              ztriangle_code_3[372],
+              ztriangle_code_3[373],
+              ztriangle_code_3[374]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[582],
+              ztriangle_code_avx2[583],
+              ztriangle_code_3[377],
+              ztriangle_code_3[388],
+              ztriangle_code_3[389]
+            },
+            {
+              ztriangle_code_avx2[584],
+              ztriangle_code_avx2[585],
+              ztriangle_code_3[382],
+              ztriangle_code_3[388],
+              ztriangle_code_3[389]
+            },
+            {
+              ztriangle_code_avx2[586],
+              ztriangle_code_avx2[587],
+              ztriangle_code_3[387],
+              ztriangle_code_3[388],
+              ztriangle_code_3[389]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[588],
+              ztriangle_code_avx2[589],
+              ztriangle_code_3[392],
+              ztriangle_code_3[403],
+              ztriangle_code_3[404]
+            },
+            {
+              ztriangle_code_avx2[590],
+              ztriangle_code_avx2[591],
+              ztriangle_code_3[397],
+              ztriangle_code_3[403],
+              ztriangle_code_3[404]
+            },
+            {
+              ztriangle_code_avx2[592],
+              ztriangle_code_avx2[593],
+              ztriangle_code_3[402],
+              ztriangle_code_3[403],
+              ztriangle_code_3[404]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[594],
+              ztriangle_code_avx2[595],
+              ztriangle_code_3[407],
+              ztriangle_code_3[418],
+              ztriangle_code_3[419]
+            },
+            {
+              ztriangle_code_avx2[596],
+              ztriangle_code_avx2[597],
+              ztriangle_code_3[412],
+              ztriangle_code_3[418],
+              ztriangle_code_3[419]
+            },
+            {
+              ztriangle_code_avx2[598],
+              ztriangle_code_avx2[599],
+              ztriangle_code_3[417],
+              ztriangle_code_3[418],
+              ztriangle_code_3[419]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[600],
+              ztriangle_code_avx2[601],
+              ztriangle_code_3[422],
+              ztriangle_code_3[433],
+              ztriangle_code_3[434]
+            },
+            {
+              ztriangle_code_avx2[602],
+              ztriangle_code_avx2[603],
+              ztriangle_code_3[427],
+              ztriangle_code_3[433],
+              ztriangle_code_3[434]
+            },
+            {
+              ztriangle_code_avx2[604],
+              ztriangle_code_avx2[605],
+              ztriangle_code_3[432],
+              ztriangle_code_3[433],
+              ztriangle_code_3[434]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[606],
+              ztriangle_code_avx2[607],
+              ztriangle_code_3[437],
+              ztriangle_code_3[448],
+              ztriangle_code_3[449]
+            },
+            {
+              ztriangle_code_avx2[608],
+              ztriangle_code_avx2[609],
+              ztriangle_code_3[442],
+              ztriangle_code_3[448],
+              ztriangle_code_3[449]
+            },
+            {
+              ztriangle_code_avx2[610],
+              ztriangle_code_avx2[611],
+              ztriangle_code_3[447],
+              ztriangle_code_3[448],
+              ztriangle_code_3[449]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[612],
+              ztriangle_code_avx2[613],
+              ztriangle_code_3[452],
+              ztriangle_code_3[463],
+              ztriangle_code_3[464]
+            },
+            {
+              ztriangle_code_avx2[614],
+              ztriangle_code_avx2[615],
+              ztriangle_code_3[457],
+              ztriangle_code_3[463],
+              ztriangle_code_3[464]
+            },
+            {
+              ztriangle_code_avx2[616],
+              ztriangle_code_avx2[617],
+              ztriangle_code_3[462],
+              ztriangle_code_3[463],
+              ztriangle_code_3[464]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[618],
+              ztriangle_code_avx2[619],
+              ztriangle_code_3[467],
+              ztriangle_code_3[478],
+              ztriangle_code_3[479]
+            },
+            {
+              ztriangle_code_avx2[620],
+              ztriangle_code_avx2[621],
+              ztriangle_code_3[472],
+              ztriangle_code_3[478],
+              ztriangle_code_3[479]
+            },
+            {
+              ztriangle_code_avx2[622],
+              ztriangle_code_avx2[623],
+              ztriangle_code_3[477],
+              ztriangle_code_3[478],
+              ztriangle_code_3[479]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[624],
+              ztriangle_code_avx2[625],
+              ztriangle_code_3[482],
+              ztriangle_code_3[493],
+              ztriangle_code_3[494]
+            },
+            {
+              ztriangle_code_avx2[626],
+              ztriangle_code_avx2[627],
+              ztriangle_code_3[487],
+              ztriangle_code_3[493],
+              ztriangle_code_3[494]
+            },
+            {
+              ztriangle_code_avx2[628],
+              ztriangle_code_avx2[629],
+              ztriangle_code_3[492],
+              ztriangle_code_3[493],
+              ztriangle_code_3[494]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[630],
+              ztriangle_code_avx2[631],
+              ztriangle_code_3[497],
+              ztriangle_code_3[508],
+              ztriangle_code_3[509]
+            },
+            {
+              ztriangle_code_avx2[632],
+              ztriangle_code_avx2[633],
+              ztriangle_code_3[502],
+              ztriangle_code_3[508],
+              ztriangle_code_3[509]
+            },
+            {
+              ztriangle_code_avx2[634],
+              ztriangle_code_avx2[635],
+              ztriangle_code_3[507],
+              ztriangle_code_3[508],
+              ztriangle_code_3[509]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[636],
+              ztriangle_code_avx2[637],
+              ztriangle_code_3[512],
+              ztriangle_code_3[523],
+              ztriangle_code_3[524]
+            },
+            {
+              ztriangle_code_avx2[638],
+              ztriangle_code_avx2[639],
+              ztriangle_code_3[517],
+              ztriangle_code_3[523],
+              ztriangle_code_3[524]
+            },
+            {
+              ztriangle_code_avx2[640],
+              ztriangle_code_avx2[641],
+              ztriangle_code_3[522],
+              ztriangle_code_3[523],
+              ztriangle_code_3[524]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[642],
+              ztriangle_code_avx2[643],
+              ztriangle_code_3[527],
+              ztriangle_code_3[538],
+              ztriangle_code_3[539]
+            },
+            {
+              ztriangle_code_avx2[644],
+              ztriangle_code_avx2[645],
+              ztriangle_code_3[532],
+              ztriangle_code_3[538],
+              ztriangle_code_3[539]
+            },
+            {
+              ztriangle_code_avx2[646],
+              ztriangle_code_avx2[647],
+              ztriangle_code_3[537],
+              ztriangle_code_3[538],
+              ztriangle_code_3[539]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[648],
+              ztriangle_code_avx2[649],
+              ztriangle_code_4[2],
+              ztriangle_code_4[13],
+              ztriangle_code_4[14]
+            },
+            {
+              ztriangle_code_avx2[650],
+              ztriangle_code_avx2[651],
+              ztriangle_code_4[7],
+              ztriangle_code_4[13],
+              ztriangle_code_4[14]
+            },
+            {
+              ztriangle_code_avx2[652],
+              ztriangle_code_avx2[653],
+              ztriangle_code_4[12],
+              ztriangle_code_4[13],
+              ztriangle_code_4[14]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[654],
+              ztriangle_code_avx2[655],
+              ztriangle_code_4[17],
+              ztriangle_code_4[28],
+              ztriangle_code_4[29]
+            },
+            {
+              ztriangle_code_avx2[656],
+              ztriangle_code_avx2[657],
+              ztriangle_code_4[22],
+              ztriangle_code_4[28],
+              ztriangle_code_4[29]
+            },
+            {
+              ztriangle_code_avx2[658],
+              ztriangle_code_avx2[659],
+              ztriangle_code_4[27],
+              ztriangle_code_4[28],
+              ztriangle_code_4[29]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[660],
+              ztriangle_code_avx2[661],
+              ztriangle_code_4[32],
+              ztriangle_code_4[43],
+              ztriangle_code_4[44]
+            },
+            {
+              ztriangle_code_avx2[662],
+              ztriangle_code_avx2[663],
+              ztriangle_code_4[37],
+              ztriangle_code_4[43],
+              ztriangle_code_4[44]
+            },
+            {
+              ztriangle_code_avx2[664],
+              ztriangle_code_avx2[665],
+              ztriangle_code_4[42],
+              ztriangle_code_4[43],
+              ztriangle_code_4[44]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[666],
+              ztriangle_code_avx2[667],
+              ztriangle_code_4[47],
+              ztriangle_code_4[58],
+              ztriangle_code_4[59]
+            },
+            {
+              ztriangle_code_avx2[668],
+              ztriangle_code_avx2[669],
+              ztriangle_code_4[52],
+              ztriangle_code_4[58],
+              ztriangle_code_4[59]
+            },
+            {
+              ztriangle_code_avx2[670],
+              ztriangle_code_avx2[671],
+              ztriangle_code_4[57],
+              ztriangle_code_4[58],
+              ztriangle_code_4[59]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[672],
+              ztriangle_code_avx2[673],
+              ztriangle_code_4[62],
+              ztriangle_code_4[73],
+              ztriangle_code_4[74]
+            },
+            {
+              ztriangle_code_avx2[674],
+              ztriangle_code_avx2[675],
+              ztriangle_code_4[67],
+              ztriangle_code_4[73],
+              ztriangle_code_4[74]
+            },
+            {
+              ztriangle_code_avx2[676],
+              ztriangle_code_avx2[677],
+              ztriangle_code_4[72],
+              ztriangle_code_4[73],
+              ztriangle_code_4[74]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[678],
+              ztriangle_code_avx2[679],
+              ztriangle_code_4[77],
+              ztriangle_code_4[88],
+              ztriangle_code_4[89]
+            },
+            {
+              ztriangle_code_avx2[680],
+              ztriangle_code_avx2[681],
+              ztriangle_code_4[82],
+              ztriangle_code_4[88],
+              ztriangle_code_4[89]
+            },
+            {
+              ztriangle_code_avx2[682],
+              ztriangle_code_avx2[683],
+              ztriangle_code_4[87],
+              ztriangle_code_4[88],
+              ztriangle_code_4[89]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[684],
+              ztriangle_code_avx2[685],
+              ztriangle_code_4[92],
+              ztriangle_code_4[103],
+              ztriangle_code_4[104]
+            },
+            {
+              ztriangle_code_avx2[686],
+              ztriangle_code_avx2[687],
+              ztriangle_code_4[97],
+              ztriangle_code_4[103],
+              ztriangle_code_4[104]
+            },
+            {
+              ztriangle_code_avx2[688],
+              ztriangle_code_avx2[689],
+              ztriangle_code_4[102],
+              ztriangle_code_4[103],
+              ztriangle_code_4[104]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[690],
+              ztriangle_code_avx2[691],
+              ztriangle_code_4[107],
+              ztriangle_code_4[118],
+              ztriangle_code_4[119]
+            },
+            {
+              ztriangle_code_avx2[692],
+              ztriangle_code_avx2[693],
+              ztriangle_code_4[112],
+              ztriangle_code_4[118],
+              ztriangle_code_4[119]
+            },
+            {
+              ztriangle_code_avx2[694],
+              ztriangle_code_avx2[695],
+              ztriangle_code_4[117],
+              ztriangle_code_4[118],
+              ztriangle_code_4[119]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[696],
+              ztriangle_code_avx2[697],
+              ztriangle_code_4[122],
+              ztriangle_code_4[133],
+              ztriangle_code_4[134]
+            },
+            {
+              ztriangle_code_avx2[698],
+              ztriangle_code_avx2[699],
+              ztriangle_code_4[127],
+              ztriangle_code_4[133],
+              ztriangle_code_4[134]
+            },
+            {
+              ztriangle_code_avx2[700],
+              ztriangle_code_avx2[701],
+              ztriangle_code_4[132],
+              ztriangle_code_4[133],
+              ztriangle_code_4[134]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[702],
+              ztriangle_code_avx2[703],
+              ztriangle_code_4[137],
+              ztriangle_code_4[148],
+              ztriangle_code_4[149]
+            },
+            {
+              ztriangle_code_avx2[704],
+              ztriangle_code_avx2[705],
+              ztriangle_code_4[142],
+              ztriangle_code_4[148],
+              ztriangle_code_4[149]
+            },
+            {
+              ztriangle_code_avx2[706],
+              ztriangle_code_avx2[707],
+              ztriangle_code_4[147],
+              ztriangle_code_4[148],
+              ztriangle_code_4[149]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[708],
+              ztriangle_code_avx2[709],
+              ztriangle_code_4[152],
+              ztriangle_code_4[163],
+              ztriangle_code_4[164]
+            },
+            {
+              ztriangle_code_avx2[710],
+              ztriangle_code_avx2[711],
+              ztriangle_code_4[157],
+              ztriangle_code_4[163],
+              ztriangle_code_4[164]
+            },
+            {
+              ztriangle_code_avx2[712],
+              ztriangle_code_avx2[713],
+              ztriangle_code_4[162],
+              ztriangle_code_4[163],
+              ztriangle_code_4[164]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[714],
+              ztriangle_code_avx2[715],
+              ztriangle_code_4[167],
+              ztriangle_code_4[178],
+              ztriangle_code_4[179]
+            },
+            {
+              ztriangle_code_avx2[716],
+              ztriangle_code_avx2[717],
+              ztriangle_code_4[172],
+              ztriangle_code_4[178],
+              ztriangle_code_4[179]
+            },
+            {
+              ztriangle_code_avx2[718],
+              ztriangle_code_avx2[719],
+              ztriangle_code_4[177],
+              ztriangle_code_4[178],
+              ztriangle_code_4[179]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[720],
+              ztriangle_code_avx2[721],
+              ztriangle_code_4[182],
+              ztriangle_code_4[193],
+              ztriangle_code_4[194]
+            },
+            {
+              ztriangle_code_avx2[722],
+              ztriangle_code_avx2[723],
+              ztriangle_code_4[187],
+              ztriangle_code_4[193],
+              ztriangle_code_4[194]
+            },
+            {
+              ztriangle_code_avx2[724],
+              ztriangle_code_avx2[725],
+              ztriangle_code_4[192],
+              ztriangle_code_4[193],
+              ztriangle_code_4[194]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[726],
+              ztriangle_code_avx2[727],
+              ztriangle_code_4[197],
+              ztriangle_code_4[208],
+              ztriangle_code_4[209]
+            },
+            {
+              ztriangle_code_avx2[728],
+              ztriangle_code_avx2[729],
+              ztriangle_code_4[202],
+              ztriangle_code_4[208],
+              ztriangle_code_4[209]
+            },
+            {
+              ztriangle_code_avx2[730],
+              ztriangle_code_avx2[731],
+              ztriangle_code_4[207],
+              ztriangle_code_4[208],
+              ztriangle_code_4[209]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[732],
+              ztriangle_code_avx2[733],
+              ztriangle_code_4[212],
+              ztriangle_code_4[223],
+              ztriangle_code_4[224]
+            },
+            {
+              ztriangle_code_avx2[734],
+              ztriangle_code_avx2[735],
+              ztriangle_code_4[217],
+              ztriangle_code_4[223],
+              ztriangle_code_4[224]
+            },
+            {
+              ztriangle_code_avx2[736],
+              ztriangle_code_avx2[737],
+              ztriangle_code_4[222],
+              ztriangle_code_4[223],
+              ztriangle_code_4[224]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[738],
+              ztriangle_code_avx2[739],
+              ztriangle_code_4[227],
+              ztriangle_code_4[238],
+              ztriangle_code_4[239]
+            },
+            {
+              ztriangle_code_avx2[740],
+              ztriangle_code_avx2[741],
+              ztriangle_code_4[232],
+              ztriangle_code_4[238],
+              ztriangle_code_4[239]
+            },
+            {
+              ztriangle_code_avx2[742],
+              ztriangle_code_avx2[743],
+              ztriangle_code_4[237],
+              ztriangle_code_4[238],
+              ztriangle_code_4[239]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[744],
+              ztriangle_code_avx2[745],
+              ztriangle_code_4[242],
+              ztriangle_code_4[253],
+              ztriangle_code_4[254]
+            },
+            {
+              ztriangle_code_avx2[746],
+              ztriangle_code_avx2[747],
+              ztriangle_code_4[247],
+              ztriangle_code_4[253],
+              ztriangle_code_4[254]
+            },
+            {
+              ztriangle_code_avx2[748],
+              ztriangle_code_avx2[749],
+              ztriangle_code_4[252],
+              ztriangle_code_4[253],
+              ztriangle_code_4[254]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[750],
+              ztriangle_code_avx2[751],
+              ztriangle_code_4[257],
+              ztriangle_code_4[268],
+              ztriangle_code_4[269]
+            },
+            {
+              ztriangle_code_avx2[752],
+              ztriangle_code_avx2[753],
+              ztriangle_code_4[262],
+              ztriangle_code_4[268],
+              ztriangle_code_4[269]
+            },
+            {
+              ztriangle_code_avx2[754],
+              ztriangle_code_avx2[755],
+              ztriangle_code_4[267],
+              ztriangle_code_4[268],
+              ztriangle_code_4[269]
+            }
+          }
+        }
+      }
+    },
+    {
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[756],
+              ztriangle_code_avx2[757],
+              ztriangle_code_4[272],
+              ztriangle_code_4[283],
+              ztriangle_code_4[284]
+            },
+            {
+              ztriangle_code_avx2[758],
+              ztriangle_code_avx2[759],
+              ztriangle_code_4[277],
+              ztriangle_code_4[283],
+              ztriangle_code_4[284]
+            },
+            {
+              ztriangle_code_avx2[760],
+              ztriangle_code_avx2[761],
+              ztriangle_code_4[282],
+              ztriangle_code_4[283],
+              ztriangle_code_4[284]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[762],
+              ztriangle_code_avx2[763],
+              ztriangle_code_4[287],
+              ztriangle_code_4[298],
+              ztriangle_code_4[299]
+            },
+            {
+              ztriangle_code_avx2[764],
+              ztriangle_code_avx2[765],
+              ztriangle_code_4[292],
+              ztriangle_code_4[298],
+              ztriangle_code_4[299]
+            },
+            {
+              ztriangle_code_avx2[766],
+              ztriangle_code_avx2[767],
+              ztriangle_code_4[297],
+              ztriangle_code_4[298],
+              ztriangle_code_4[299]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[768],
+              ztriangle_code_avx2[769],
+              ztriangle_code_4[302],
+              ztriangle_code_4[313],
+              ztriangle_code_4[314]
+            },
+            {
+              ztriangle_code_avx2[770],
+              ztriangle_code_avx2[771],
+              ztriangle_code_4[307],
+              ztriangle_code_4[313],
+              ztriangle_code_4[314]
+            },
+            {
+              ztriangle_code_avx2[772],
+              ztriangle_code_avx2[773],
+              ztriangle_code_4[312],
+              ztriangle_code_4[313],
+              ztriangle_code_4[314]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[774],
+              ztriangle_code_avx2[775],
+              ztriangle_code_4[317],
+              ztriangle_code_4[328],
+              ztriangle_code_4[329]
+            },
+            {
+              ztriangle_code_avx2[776],
+              ztriangle_code_avx2[777],
+              ztriangle_code_4[322],
+              ztriangle_code_4[328],
+              ztriangle_code_4[329]
+            },
+            {
+              ztriangle_code_avx2[778],
+              ztriangle_code_avx2[779],
+              ztriangle_code_4[327],
+              ztriangle_code_4[328],
+              ztriangle_code_4[329]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[780],
+              ztriangle_code_avx2[781],
+              ztriangle_code_4[332],
+              ztriangle_code_4[343],
+              ztriangle_code_4[344]
+            },
+            {
+              ztriangle_code_avx2[782],
+              ztriangle_code_avx2[783],
+              ztriangle_code_4[337],
+              ztriangle_code_4[343],
+              ztriangle_code_4[344]
+            },
+            {
+              ztriangle_code_avx2[784],
+              ztriangle_code_avx2[785],
+              ztriangle_code_4[342],
+              ztriangle_code_4[343],
+              ztriangle_code_4[344]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[786],
+              ztriangle_code_avx2[787],
+              ztriangle_code_4[347],
+              ztriangle_code_4[358],
+              ztriangle_code_4[359]
+            },
+            {
+              ztriangle_code_avx2[788],
+              ztriangle_code_avx2[789],
+              ztriangle_code_4[352],
+              ztriangle_code_4[358],
+              ztriangle_code_4[359]
+            },
+            {
+              ztriangle_code_avx2[790],
+              ztriangle_code_avx2[791],
+              ztriangle_code_4[357],
+              ztriangle_code_4[358],
+              ztriangle_code_4[359]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[792],
+              ztriangle_code_avx2[793],
+              ztriangle_code_4[362],
+              ztriangle_code_4[373],
+              ztriangle_code_4[374]
+            },
+            {
+              ztriangle_code_avx2[794],
+              ztriangle_code_avx2[795],
+              ztriangle_code_4[367],
+              ztriangle_code_4[373],
+              ztriangle_code_4[374]
+            },
+            {
+              ztriangle_code_avx2[796],
+              ztriangle_code_avx2[797],
+              ztriangle_code_4[372],
+              ztriangle_code_4[373],
+              ztriangle_code_4[374]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[798],
+              ztriangle_code_avx2[799],
+              ztriangle_code_4[377],
+              ztriangle_code_4[388],
+              ztriangle_code_4[389]
+            },
+            {
+              ztriangle_code_avx2[800],
+              ztriangle_code_avx2[801],
+              ztriangle_code_4[382],
+              ztriangle_code_4[388],
+              ztriangle_code_4[389]
+            },
+            {
+              ztriangle_code_avx2[802],
+              ztriangle_code_avx2[803],
+              ztriangle_code_4[387],
+              ztriangle_code_4[388],
+              ztriangle_code_4[389]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[804],
+              ztriangle_code_avx2[805],
+              ztriangle_code_4[392],
+              ztriangle_code_4[403],
+              ztriangle_code_4[404]
+            },
+            {
+              ztriangle_code_avx2[806],
+              ztriangle_code_avx2[807],
+              ztriangle_code_4[397],
+              ztriangle_code_4[403],
+              ztriangle_code_4[404]
+            },
+            {
+              ztriangle_code_avx2[808],
+              ztriangle_code_avx2[809],
+              ztriangle_code_4[402],
+              ztriangle_code_4[403],
+              ztriangle_code_4[404]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[810],
+              ztriangle_code_avx2[811],
+              ztriangle_code_4[407],
+              ztriangle_code_4[418],
+              ztriangle_code_4[419]
+            },
+            {
+              ztriangle_code_avx2[812],
+              ztriangle_code_avx2[813],
+              ztriangle_code_4[412],
+              ztriangle_code_4[418],
+              ztriangle_code_4[419]
+            },
+            {
+              ztriangle_code_avx2[814],
+              ztriangle_code_avx2[815],
+              ztriangle_code_4[417],
+              ztriangle_code_4[418],
+              ztriangle_code_4[419]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[816],
+              ztriangle_code_avx2[817],
+              ztriangle_code_4[422],
+              ztriangle_code_4[433],
+              ztriangle_code_4[434]
+            },
+            {
+              ztriangle_code_avx2[818],
+              ztriangle_code_avx2[819],
+              ztriangle_code_4[427],
+              ztriangle_code_4[433],
+              ztriangle_code_4[434]
+            },
+            {
+              ztriangle_code_avx2[820],
+              ztriangle_code_avx2[821],
+              ztriangle_code_4[432],
+              ztriangle_code_4[433],
+              ztriangle_code_4[434]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[822],
+              ztriangle_code_avx2[823],
+              ztriangle_code_4[437],
+              ztriangle_code_4[448],
+              ztriangle_code_4[449]
+            },
+            {
+              ztriangle_code_avx2[824],
+              ztriangle_code_avx2[825],
+              ztriangle_code_4[442],
+              ztriangle_code_4[448],
+              ztriangle_code_4[449]
+            },
+            {
+              ztriangle_code_avx2[826],
+              ztriangle_code_avx2[827],
+              ztriangle_code_4[447],
+              ztriangle_code_4[448],
+              ztriangle_code_4[449]
+            }
+          }
+        }
+      },
+      {
+        {
+          {
+            {
+              ztriangle_code_avx2[828],
+              ztriangle_code_avx2[829],
+              ztriangle_code_4[452],
+              ztriangle_code_4[463],
+              ztriangle_code_4[464]
+            },
+            {
+              ztriangle_code_avx2[830],
+              ztriangle_code_avx2[831],
+              ztriangle_code_4[457],
+              ztriangle_code_4[463],
+              ztriangle_code_4[464]
+            },
+            {
+              ztriangle_code_avx2[832],
+              ztriangle_code_avx2[833],
+              ztriangle_code_4[462],
+              ztriangle_code_4[463],
+              ztriangle_code_4[464]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[834],
+              ztriangle_code_avx2[835],
+              ztriangle_code_4[467],
+              ztriangle_code_4[478],
+              ztriangle_code_4[479]
+            },
+            {
+              ztriangle_code_avx2[836],
+              ztriangle_code_avx2[837],
+              ztriangle_code_4[472],
+              ztriangle_code_4[478],
+              ztriangle_code_4[479]
+            },
+            {
+              ztriangle_code_avx2[838],
+              ztriangle_code_avx2[839],
+              ztriangle_code_4[477],
+              ztriangle_code_4[478],
+              ztriangle_code_4[479]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[840],
+              ztriangle_code_avx2[841],
+              ztriangle_code_4[482],
+              ztriangle_code_4[493],
+              ztriangle_code_4[494]
+            },
+            {
+              ztriangle_code_avx2[842],
+              ztriangle_code_avx2[843],
+              ztriangle_code_4[487],
+              ztriangle_code_4[493],
+              ztriangle_code_4[494]
+            },
+            {
+              ztriangle_code_avx2[844],
+              ztriangle_code_avx2[845],
+              ztriangle_code_4[492],
+              ztriangle_code_4[493],
+              ztriangle_code_4[494]
+            }
+          }
+        },
+        {
+          {
+            {
+              ztriangle_code_avx2[846],
+              ztriangle_code_avx2[847],
+              ztriangle_code_4[497],
+              ztriangle_code_4[508],
+              ztriangle_code_4[509]
+            },
+            {
+              ztriangle_code_avx2[848],
+              ztriangle_code_avx2[849],
+              ztriangle_code_4[502],
+              ztriangle_code_4[508],
+              ztriangle_code_4[509]
+            },
+            {
+              ztriangle_code_avx2[850],
+              ztriangle_code_avx2[851],
+              ztriangle_code_4[507],
+              ztriangle_code_4[508],
+              ztriangle_code_4[509]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[852],
+              ztriangle_code_avx2[853],
+              ztriangle_code_4[512],
+              ztriangle_code_4[523],
+              ztriangle_code_4[524]
+            },
+            {
+              ztriangle_code_avx2[854],
+              ztriangle_code_avx2[855],
+              ztriangle_code_4[517],
+              ztriangle_code_4[523],
+              ztriangle_code_4[524]
+            },
+            {
+              ztriangle_code_avx2[856],
+              ztriangle_code_avx2[857],
+              ztriangle_code_4[522],
+              ztriangle_code_4[523],
+              ztriangle_code_4[524]
+            }
+          },
+          {
+            {
+              ztriangle_code_avx2[858],
+              ztriangle_code_avx2[859],
+              ztriangle_code_4[527],
+              ztriangle_code_4[538],
+              ztriangle_code_4[539]
+            },
+            {
+              ztriangle_code_avx2[860],
+              ztriangle_code_avx2[861],
+              ztriangle_code_4[532],
+              ztriangle_code_4[538],
+              ztriangle_code_4[539]
+            },
+            {
+              ztriangle_code_avx2[862],
+              ztriangle_code_avx2[863],
+              ztriangle_code_4[537],
+              ztriangle_code_4[538],
+              ztriangle_code_4[539]
+            }
+          }
+        }
+      }
+    }
+  }
+};
+#endif
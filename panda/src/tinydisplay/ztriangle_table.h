@@ -1,3 +1,13 @@
 /* This file is generated code--do not edit.  See ztriangle.py. */
 
+#include "zsimd.h"
+
 extern const ZB_fillTriangleFunc fill_tri_funcs[2][4][3][2][3][3][5];
+
+#ifdef ZSIMD_HAVE_SSE2
+extern const ZB_fillTriangleFunc fill_tri_funcs_sse2[2][4][3][2][3][3][5];
+#endif
+
+#ifdef ZSIMD_HAVE_AVX2
+extern const ZB_fillTriangleFunc fill_tri_funcs_avx2[2][4][3][2][3][3][5];
+#endif
@@ -22,6 +22,16 @@ FNAME(white_untextured) (ZBuffer *zb,
     z+=dzdx;                                                            \
   }
 
+#define PUT_PIXELS_SIMD()                                               \
+  {                                                                     \
+    zvec zzv = zv_srli(zv_ramp(z, dzdx), ZB_POINT_Z_FRAC_BITS);         \
+    zvec mask = ZCMP_V(zv_loadu(pz), zzv);                              \
+    zvec ffff = zv_set1(0xffff);                                        \
+    STORE_PIX_V(pp, mask, zv_set1(0xffffffff), ffff, ffff, ffff, ffff); \
+    STORE_Z_V(pz, mask, zzv);                                           \
+    z+=ZSIMD_WIDTH * (unsigned int)dzdx;                                \
+  }
+
 #define PIXEL_COUNT pixel_count_white_untextured
 
 #include "ztriangle.h"
@@ -62,6 +72,16 @@ FNAME(flat_untextured) (ZBuffer *zb,
     z+=dzdx;                                            \
   }
 
+#define PUT_PIXELS_SIMD()                                               \
+  {                                                                     \
+    zvec zzv = zv_srli(zv_ramp(z, dzdx), ZB_POINT_Z_FRAC_BITS);         \
+    zvec mask = ZCMP_V(zv_loadu(pz), zzv);                              \
+    STORE_PIX_V(pp, mask, zv_set1(color), zv_set1(or0), zv_set1(og0),  \
+                zv_set1(ob0), zv_set1(oa0));                            \
+    STORE_Z_V(pz, mask, zzv);                                           \
+    z+=ZSIMD_WIDTH * (unsigned int)dzdx;                                \
+  }
+
 #define PIXEL_COUNT pixel_count_flat_untextured
 
 #include "ztriangle.h"
@@ -112,6 +132,24 @@ FNAME(smooth_untextured) (ZBuffer *zb,
     oa1+=dadx;                                                          \
   }
 
+#define PUT_PIXELS_SIMD()                                               \
+  {                                                                     \
+    zvec zzv = zv_srli(zv_ramp(z, dzdx), ZB_POINT_Z_FRAC_BITS);         \
+    zvec mask = ZCMP_V(zv_loadu(pz), zzv);                              \
+    zvec rv = zv_ramp(or1, drdx);                                       \
+    zvec gv = zv_ramp(og1, dgdx);                                       \
+    zvec bv = zv_ramp(ob1, dbdx);                                       \
+    zvec av = zv_ramp(oa1, dadx);                                       \
+    mask = zv_and(mask, ACMP_V(zb, av));                                \
+    STORE_PIX_V(pp, mask, zv_rgba_to_pixel(rv, gv, bv, av), rv, gv, bv, av); \
+    STORE_Z_V(pz, mask, zzv);                                           \
+    z+=ZSIMD_WIDTH * (unsigned int)dzdx;                                \
+    og1+=ZSIMD_WIDTH * (unsigned int)dgdx;                              \
+    or1+=ZSIMD_WIDTH * (unsigned int)drdx;                              \
+    ob1+=ZSIMD_WIDTH * (unsigned int)dbdx;                              \
+    oa1+=ZSIMD_WIDTH * (unsigned int)dadx;                              \
+  }
+
 #define PIXEL_COUNT pixel_count_smooth_untextured
 
 #include "ztriangle.h"
@@ -150,6 +188,22 @@ FNAME(white_textured) (ZBuffer *zb,
     t+=dtdx;                                                            \
   }
 
+#define PUT_PIXELS_SIMD()                                               \
+  {                                                                     \
+    zvec zzv = zv_srli(zv_ramp(z, dzdx), ZB_POINT_Z_FRAC_BITS);         \
+    zvec mask = ZCMP_V(zv_loadu(pz), zzv);                              \
+    if (zv_any(mask)) {                                                 \
+      zvec texel = ZB_LOOKUP_TEXTURE_V(texture_def, zv_ramp(s, dsdx), zv_ramp(t, dtdx), mipmap_level, mipmap_dx); \
+      zvec av = zv_pixel_a(texel);                                      \
+      mask = zv_and(mask, ACMP_V(zb, av));                              \
+      STORE_PIX_V(pp, mask, texel, zv_pixel_r(texel), zv_pixel_g(texel), zv_pixel_b(texel), av); \
+      STORE_Z_V(pz, mask, zzv);                                         \
+    }                                                                   \
+    z+=ZSIMD_WIDTH * (unsigned int)dzdx;                                \
+    s+=ZSIMD_WIDTH * (unsigned int)dsdx;                                \
+    t+=ZSIMD_WIDTH * (unsigned int)dtdx;                                \
+  }
+
 #define PIXEL_COUNT pixel_count_white_textured
 
 #include "ztriangle.h"
@@ -206,6 +260,25 @@ FNAME(flat_textured) (ZBuffer *zb,
     t+=dtdx;                                                            \
   }
 
+#define PUT_PIXELS_SIMD()                                               \
+  {                                                                     \
+    zvec zzv = zv_srli(zv_ramp(z, dzdx), ZB_POINT_Z_FRAC_BITS);         \
+    zvec mask = ZCMP_V(zv_loadu(pz), zzv);                              \
+    if (zv_any(mask)) {                                                 \
+      zvec texel = ZB_LOOKUP_TEXTURE_V(texture_def, zv_ramp(s, dsdx), zv_ramp(t, dtdx), mipmap_level, mipmap_dx); \
+      zvec av = zv_palpha_mult(zv_set1(oa0), zv_pixel_a(texel));       \
+      mask = zv_and(mask, ACMP_V(zb, av));                              \
+      zvec rv = zv_pcomponent_mult(zv_set1(or0), zv_pixel_r(texel));   \
+      zvec gv = zv_pcomponent_mult(zv_set1(og0), zv_pixel_g(texel));   \
+      zvec bv = zv_pcomponent_mult(zv_set1(ob0), zv_pixel_b(texel));   \
+      STORE_PIX_V(pp, mask, zv_rgba_to_pixel(rv, gv, bv, av), rv, gv, bv, av); \
+      STORE_Z_V(pz, mask, zzv);                                         \
+    }                                                                   \
+    z+=ZSIMD_WIDTH * (unsigned int)dzdx;                                \
+    s+=ZSIMD_WIDTH * (unsigned int)dsdx;                                \
+    t+=ZSIMD_WIDTH * (unsigned int)dtdx;                                \
+  }
+
 #define PIXEL_COUNT pixel_count_flat_textured
 
 #include "ztriangle.h"
@@ -272,11 +345,38 @@ FNAME(smooth_textured) (ZBuffer *zb,
     t+=dtdx;                                                            \
   }
 
+#define PUT_PIXELS_SIMD()                                               \
+  {                                                                     \
+    zvec zzv = zv_srli(zv_ramp(z, dzdx), ZB_POINT_Z_FRAC_BITS);         \
+    zvec mask = ZCMP_V(zv_loadu(pz), zzv);                              \
+    if (zv_any(mask)) {                                                 \
+      zvec texel = ZB_LOOKUP_TEXTURE_V(texture_def, zv_ramp(s, dsdx), zv_ramp(t, dtdx), mipmap_level, mipmap_dx); \
+      zvec av = zv_palpha_mult(zv_ramp(oa1, dadx), zv_pixel_a(texel));  \
+      mask = zv_and(mask, ACMP_V(zb, av));                              \
+      zvec rv = zv_pcomponent_mult(zv_ramp(or1, drdx), zv_pixel_r(texel)); \
+      zvec gv = zv_pcomponent_mult(zv_ramp(og1, dgdx), zv_pixel_g(texel)); \
+      zvec bv = zv_pcomponent_mult(zv_ramp(ob1, dbdx), zv_pixel_b(texel)); \
+      STORE_PIX_V(pp, mask, zv_rgba_to_pixel(rv, gv, bv, av), rv, gv, bv, av); \
+      STORE_Z_V(pz, mask, zzv);                                         \
+    }                                                                   \
+    z+=ZSIMD_WIDTH * (unsigned int)dzdx;                                \
+    og1+=ZSIMD_WIDTH * (unsigned int)dgdx;                              \
+    or1+=ZSIMD_WIDTH * (unsigned int)drdx;                              \
+    ob1+=ZSIMD_WIDTH * (unsigned int)dbdx;                              \
+    oa1+=ZSIMD_WIDTH * (unsigned int)dadx;                              \
+    s+=ZSIMD_WIDTH * (unsigned int)dsdx;                                \
+    t+=ZSIMD_WIDTH * (unsigned int)dtdx;                                \
+  }
+
 #define PIXEL_COUNT pixel_count_smooth_textured
 
 #include "ztriangle.h"
 }
 
+/* The remaining fillers draw with DRAW_LINE, and so have no vectorized
+   version; the SIMD tables share the scalar ones. */
+#ifndef ZSIMD_WIDTH
+
 /*
  * Texture mapping with perspective correction.
  * We use the gradient method to make less divisions.
@@ -1000,12 +1100,23 @@ FNAME(smooth_multitex3) (ZBuffer *zb,
 #include "ztriangle.h"
 }
 
+#endif  // ZSIMD_WIDTH
+
 #undef ACMP
 #undef ZCMP
 #undef STORE_PIX
 #undef STORE_Z
+#undef A_TEST
+#undef Z_TEST
+#undef Z_WRITE
 #undef FNAME
 #undef INTERP_MIPMAP
 #undef CALC_MIPMAP_LEVEL
 #undef ZB_LOOKUP_TEXTURE
 
+#undef ACMP_V
+#undef ZCMP_V
+#undef STORE_PIX_V
+#undef STORE_Z_V
+#undef ZB_LOOKUP_TEXTURE_V
+
@@ -108,6 +108,17 @@ EggToBam() :
      "written exactly as they are, losslessly.",
      &EggToBam::dispatch_none, &_compression_off);
 
+  add_option
+    ("QC", "tolerance", 0,
+     "Store the transform tables of animation channels in quantized, "
+     "keyframe-reduced form, as AnimChannelMatrixQuantized channels, "
+     "rather than as full tables of floats.  Each value of the scale, "
+     "shear, and translation tables will be reproduced to within the "
+     "indicated tolerance; the tolerance for rotations, in degrees, "
+     "comes from quantize-chan-angle-tolerance in the Config.prc file.  "
+     "This is unrelated to -C, which does not apply to quantized channels.",
+     &EggToBam::dispatch_double, &_quantize_channels, &_quantize_tolerance);
+
   add_option
     ("rawtex", "", 0,
      "Record texture data directly in the bam file, instead of storing "
@@ -248,6 +259,13 @@ run() {
     compress_chan_quality = _compression_quality;
   }
 
+  if (_quantize_channels) {
+    // If the user specified -QC, load the animation tables as
+    // quantized channels, with the indicated tolerance.
+    egg_quantize_anim_channels = true;
+    quantize_chan_tolerance = _quantize_tolerance;
+  }
+
   if (_ctex_quality != "default") {
     // Override the user's config file with the command-line parameter
     // for texture compression.
@@ -61,6 +61,8 @@ private:
   bool _has_compression_quality;
   int _compression_quality;
   bool _compression_off;
+  bool _quantize_channels;
+  double _quantize_tolerance;
   bool _tex_rawdata;
   bool _tex_txo;
   bool _tex_txopz;